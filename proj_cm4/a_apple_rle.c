@@ -0,0 +1,548 @@
+/*
+ * a_apple_rle.c
+ *
+ *  Generated by tools/bmp_rle.py from a_apple.c, do not edit.
+ *  100 x 128 pixels, 12800 bytes raw, 6060 bytes run-length coded.
+ */
+
+#include "GUI.h"
+#include "lcd_rle.h"
+
+#ifndef GUI_CONST_STORAGE
+  #define GUI_CONST_STORAGE const
+#endif
+
+static GUI_CONST_STORAGE GUI_COLOR _Colorsa_apple[] = {
+#if (GUI_USE_ARGB == 0)
+  0xF4931E, 0x1734C6, 0x2445E8, 0x1C3BD5,
+  0x2A4BF4, 0x3557FA, 0xF59421, 0x1632BE,
+  0x4468FB, 0x5479FD, 0x2D51FA, 0x203EDB,
+  0x1A9749, 0x648AFD, 0x147238, 0x2241DC,
+  0x198844, 0x5B83FE, 0x6A93FE, 0x4C72FD,
+  0x3D61FC, 0xE88915, 0x2B3AB5, 0x7698FD,
+  0xF48D15, 0xE99227, 0x3557EB, 0xDA893A,
+  0xE69336, 0x87A4FD, 0x197943, 0xE38C35,
+  0x985404, 0xE28B23, 0xE9EAE3, 0x1AA14C,
+  0x884903, 0xA45903, 0x957B5A, 0xA5B9FD,
+  0xEBC692, 0xEA870C, 0x93ABFD, 0xB7C7FD,
+  0x4446A8, 0x68558B, 0xD58747, 0xEDD9B4,
+  0x73440F, 0x1E40E0, 0x564A97, 0xA97466,
+  0xC78257, 0xD9D5C9, 0x713800, 0x1E40DC,
+  0xB56509, 0xEC941D, 0xB5A997, 0xDCDBD4,
+  0x3542B4, 0x886478, 0xB67B67, 0x876687,
+  0xDC9B3B, 0x9BB2FD, 0xF0D9B4, 0xF3ECD7,
+  0x113372, 0x714E2D, 0x1C4389, 0x224A93,
+  0x3A43A9, 0xC87614, 0xE5B46A, 0xE4B774,
+  0xB5A48B, 0xF8F7EB, 0x307030, 0x655796,
+  0x914C01, 0xAB6207, 0xB57758, 0xCA730B,
+  0xF18B0D, 0xDC9841, 0x839EFD, 0xE5E4D8,
+  0x6B752C, 0x173B83, 0x2238C9, 0x1D4695,
+  0x2E51EA, 0x5B529A, 0x725788, 0x17823D,
+  0x99696B, 0xD47C13, 0xECC58C, 0x5A2C01,
+  0x505675, 0x785B7A, 0x24468A, 0xD4780A,
+  0xA7832A, 0xC98929, 0xE6A754, 0xC6BBAB,
+  0xC9C3B6, 0x0F2A56, 0x30304A, 0x745D93,
+  0x7B6186, 0x218A49, 0x488439, 0x6D8934,
+  0xDB8726, 0xD99226, 0xC78147, 0xE3A043,
+  0xE4DCC6, 0x4D702D, 0x2958AC, 0x3366C6,
+  0x728DFB, 0xA67D46, 0xAB7359, 0xBC7C4A,
+  0xA97572, 0xC06B05, 0xCA7E48, 0xB68159,
+  0xB59467, 0xDE8619, 0xC69128, 0xDEA041,
+  0xACC0FD, 0xD5C4AA, 0xEBD6A8, 0xD2CCC3,
+  0x264C7C, 0x584742, 0x756A73, 0x2557B3,
+  0x4549B0, 0x4A903D, 0x56893A, 0x83541A,
+  0x927E25, 0x997634, 0xB15D00, 0xBE7415,
+  0x865F77, 0x846640, 0x8F7559, 0x966B74,
+  0xA46D5E, 0xC47927, 0x888B2E, 0x97852C,
+  0xBB822A, 0xB6932A, 0x9A8973, 0xA79276,
+  0xCB8C3E, 0xF49334, 0xE19E40, 0xBDB6AB,
+  0xC6B69C, 0xF3E4BE, 0xF4E6C4, 0xF5F2DE,
+  0x363961, 0x1C596B, 0x453942, 0x5E4B3D,
+  0x79604F, 0x1F3FE0, 0x203EE0, 0x27509A,
+  0x3C4C85, 0x3D528C, 0x2E40B4, 0x325CBA,
+  0x2D61B9, 0x3861B5, 0x304FFD, 0x484C9F,
+  0x524D8E, 0x5353A5, 0x5D6285, 0x56679E,
+  0x674F8F, 0x6153A5, 0x6C6B84, 0x487ED8,
+  0x22853E, 0x3D8139, 0x0D964B, 0x209145,
+  0x798234, 0x7E9139, 0x7DA0FF, 0x804A12,
+  0x925A14, 0x82623E, 0x817A2C, 0x867831,
+  0x916339, 0xA25F13, 0xAB6E1F, 0xB26613,
+  0xAA6F25, 0xB06F2B, 0x8A704A, 0x866E68,
+  0x847067, 0x887174, 0x937E60, 0x99727B,
+  0xE27F06, 0xCF7F54, 0x8E8130, 0x99922D,
+  0xB08831, 0x988161, 0xBF824F, 0xB5905A,
+  0xA48868, 0xAF9165, 0xBD8061, 0xDF961F,
+  0xE8A13D, 0xD28657, 0xC19E68, 0xD9A05C,
+  0xDEB064, 0xD6B179, 0xEAB05C, 0xE2AA63,
+  0xF2BA71, 0xE5C17D, 0xF3C475, 0xAB9E85,
+  0xB19F88, 0xAFA18C, 0xAFA492, 0xC0BBB6,
+  0xD0CABF, 0xEDD097, 0xCBC9C0, 0xE0DFD3,
+  0xEEE1C0, 0xEFF1EE, 0xF1EFE8, 0xFDFEFE
+#else
+  0xFF1E93F4, 0xFFC63417, 0xFFE84524, 0xFFD53B1C,
+  0xFFF44B2A, 0xFFFA5735, 0xFF2194F5, 0xFFBE3216,
+  0xFFFB6844, 0xFFFD7954, 0xFFFA512D, 0xFFDB3E20,
+  0xFF49971A, 0xFFFD8A64, 0xFF387214, 0xFFDC4122,
+  0xFF448819, 0xFFFE835B, 0xFFFE936A, 0xFFFD724C,
+  0xFFFC613D, 0xFF1589E8, 0xFFB53A2B, 0xFFFD9876,
+  0xFF158DF4, 0xFF2792E9, 0xFFEB5735, 0xFF3A89DA,
+  0xFF3693E6, 0xFFFDA487, 0xFF437919, 0xFF358CE3,
+  0xFF045498, 0xFF238BE2, 0xFFE3EAE9, 0xFF4CA11A,
+  0xFF034988, 0xFF0359A4, 0xFF5A7B95, 0xFFFDB9A5,
+  0xFF92C6EB, 0xFF0C87EA, 0xFFFDAB93, 0xFFFDC7B7,
+  0xFFA84644, 0xFF8B5568, 0xFF4787D5, 0xFFB4D9ED,
+  0xFF0F4473, 0xFFE0401E, 0xFF974A56, 0xFF6674A9,
+  0xFF5782C7, 0xFFC9D5D9, 0xFF003871, 0xFFDC401E,
+  0xFF0965B5, 0xFF1D94EC, 0xFF97A9B5, 0xFFD4DBDC,
+  0xFFB44235, 0xFF786488, 0xFF677BB6, 0xFF876687,
+  0xFF3B9BDC, 0xFFFDB29B, 0xFFB4D9F0, 0xFFD7ECF3,
+  0xFF723311, 0xFF2D4E71, 0xFF89431C, 0xFF934A22,
+  0xFFA9433A, 0xFF1476C8, 0xFF6AB4E5, 0xFF74B7E4,
+  0xFF8BA4B5, 0xFFEBF7F8, 0xFF307030, 0xFF965765,
+  0xFF014C91, 0xFF0762AB, 0xFF5877B5, 0xFF0B73CA,
+  0xFF0D8BF1, 0xFF4198DC, 0xFFFD9E83, 0xFFD8E4E5,
+  0xFF2C756B, 0xFF833B17, 0xFFC93822, 0xFF95461D,
+  0xFFEA512E, 0xFF9A525B, 0xFF885772, 0xFF3D8217,
+  0xFF6B6999, 0xFF137CD4, 0xFF8CC5EC, 0xFF012C5A,
+  0xFF755650, 0xFF7A5B78, 0xFF8A4624, 0xFF0A78D4,
+  0xFF2A83A7, 0xFF2989C9, 0xFF54A7E6, 0xFFABBBC6,
+  0xFFB6C3C9, 0xFF562A0F, 0xFF4A3030, 0xFF935D74,
+  0xFF86617B, 0xFF498A21, 0xFF398448, 0xFF34896D,
+  0xFF2687DB, 0xFF2692D9, 0xFF4781C7, 0xFF43A0E3,
+  0xFFC6DCE4, 0xFF2D704D, 0xFFAC5829, 0xFFC66633,
+  0xFFFB8D72, 0xFF467DA6, 0xFF5973AB, 0xFF4A7CBC,
+  0xFF7275A9, 0xFF056BC0, 0xFF487ECA, 0xFF5981B6,
+  0xFF6794B5, 0xFF1986DE, 0xFF2891C6, 0xFF41A0DE,
+  0xFFFDC0AC, 0xFFAAC4D5, 0xFFA8D6EB, 0xFFC3CCD2,
+  0xFF7C4C26, 0xFF424758, 0xFF736A75, 0xFFB35725,
+  0xFFB04945, 0xFF3D904A, 0xFF3A8956, 0xFF1A5483,
+  0xFF257E92, 0xFF347699, 0xFF005DB1, 0xFF1574BE,
+  0xFF775F86, 0xFF406684, 0xFF59758F, 0xFF746B96,
+  0xFF5E6DA4, 0xFF2779C4, 0xFF2E8B88, 0xFF2C8597,
+  0xFF2A82BB, 0xFF2A93B6, 0xFF73899A, 0xFF7692A7,
+  0xFF3E8CCB, 0xFF3493F4, 0xFF409EE1, 0xFFABB6BD,
+  0xFF9CB6C6, 0xFFBEE4F3, 0xFFC4E6F4, 0xFFDEF2F5,
+  0xFF613936, 0xFF6B591C, 0xFF423945, 0xFF3D4B5E,
+  0xFF4F6079, 0xFFE03F1F, 0xFFE03E20, 0xFF9A5027,
+  0xFF854C3C, 0xFF8C523D, 0xFFB4402E, 0xFFBA5C32,
+  0xFFB9612D, 0xFFB56138, 0xFFFD4F30, 0xFF9F4C48,
+  0xFF8E4D52, 0xFFA55353, 0xFF85625D, 0xFF9E6756,
+  0xFF8F4F67, 0xFFA55361, 0xFF846B6C, 0xFFD87E48,
+  0xFF3E8522, 0xFF39813D, 0xFF4B960D, 0xFF459120,
+  0xFF348279, 0xFF39917E, 0xFFFFA07D, 0xFF124A80,
+  0xFF145A92, 0xFF3E6282, 0xFF2C7A81, 0xFF317886,
+  0xFF396391, 0xFF135FA2, 0xFF1F6EAB, 0xFF1366B2,
+  0xFF256FAA, 0xFF2B6FB0, 0xFF4A708A, 0xFF686E86,
+  0xFF677084, 0xFF747188, 0xFF607E93, 0xFF7B7299,
+  0xFF067FE2, 0xFF547FCF, 0xFF30818E, 0xFF2D9299,
+  0xFF3188B0, 0xFF618198, 0xFF4F82BF, 0xFF5A90B5,
+  0xFF6888A4, 0xFF6591AF, 0xFF6180BD, 0xFF1F96DF,
+  0xFF3DA1E8, 0xFF5786D2, 0xFF689EC1, 0xFF5CA0D9,
+  0xFF64B0DE, 0xFF79B1D6, 0xFF5CB0EA, 0xFF63AAE2,
+  0xFF71BAF2, 0xFF7DC1E5, 0xFF75C4F3, 0xFF859EAB,
+  0xFF889FB1, 0xFF8CA1AF, 0xFF92A4AF, 0xFFB6BBC0,
+  0xFFBFCAD0, 0xFF97D0ED, 0xFFC0C9CB, 0xFFD3DFE0,
+  0xFFC0E1EE, 0xFFEEF1EF, 0xFFE8EFF1, 0xFFFEFEFD
+#endif
+
+};
+
+static GUI_CONST_STORAGE GUI_LOGPALETTE _Palbma_apple_rle = {
+  256,  // Number of entries
+  0,    // No transparency
+  (const LCD_COLOR *)&_Colorsa_apple[0]
+};
+
+static GUI_CONST_STORAGE unsigned char _acbma_apple_rle[] = {
+  0xFF, 0x00, 0xE4, 0x00, 0x80, 0x06, 0x81, 0x00, 0x80, 0x06, 0xBF, 0x00, 0x00, 0x06, 0x97, 0x00,
+  0x83, 0x06, 0x00, 0x00, 0x81, 0x06, 0xD1, 0x00, 0x84, 0x06, 0x04, 0x19, 0x86, 0x9E, 0x73, 0x72,
+  0x80, 0xC5, 0x06, 0x72, 0x92, 0x73, 0xDF, 0xA1, 0x75, 0x06, 0xD0, 0x00, 0x80, 0x06, 0x04, 0x86,
+  0xC8, 0xC5, 0x0E, 0x1E, 0x81, 0x5F, 0x81, 0x10, 0x80, 0xC6, 0x05, 0x71, 0xC7, 0x91, 0xC9, 0x86,
+  0x39, 0x80, 0x00, 0x00, 0x06, 0xC8, 0x00, 0x03, 0x39, 0x69, 0x9F, 0x79, 0x82, 0x0E, 0x82, 0x5F,
+  0x81, 0x10, 0x00, 0xC7, 0x82, 0x0C, 0x03, 0xC6, 0x0C, 0x91, 0xA1, 0x80, 0x00, 0x00, 0x06, 0x80,
+  0x00, 0x00, 0x06, 0xC4, 0x00, 0x01, 0xE7, 0x58, 0x85, 0x0E, 0x80, 0x1E, 0x82, 0x10, 0x00, 0xC7,
+  0x80, 0x0C, 0x81, 0x23, 0x81, 0x0C, 0x01, 0x73, 0x39, 0x81, 0x00, 0x00, 0x06, 0xC3, 0x00, 0x03,
+  0x06, 0x00, 0x06, 0x9F, 0x80, 0x0E, 0x00, 0x1E, 0x85, 0x0E, 0x80, 0x5F, 0x80, 0x10, 0x80, 0x0C,
+  0x82, 0x23, 0x80, 0x0C, 0x03, 0x91, 0xE7, 0x00, 0x39, 0x84, 0x00, 0x06, 0x06, 0x00, 0x19, 0x83,
+  0xD9, 0xD7, 0x7F, 0x81, 0x06, 0xA5, 0x00, 0x00, 0x06, 0x8E, 0x00, 0x80, 0x06, 0x01, 0x68, 0x0E,
+  0x85, 0x1E, 0x82, 0x0E, 0x81, 0x10, 0x80, 0x0C, 0x80, 0x23, 0x81, 0x0C, 0x02, 0x92, 0x39, 0x06,
+  0x83, 0x00, 0x80, 0x06, 0x01, 0x26, 0xB4, 0x80, 0x8F, 0x80, 0x7A, 0x01, 0xC2, 0x1F, 0xB9, 0x00,
+  0x02, 0x06, 0xDE, 0x0E, 0x80, 0x1E, 0x80, 0x5F, 0x82, 0x10, 0x00, 0x1E, 0x80, 0x0E, 0x00, 0x5F,
+  0x81, 0x10, 0x00, 0x0C, 0x80, 0x23, 0x80, 0x0C, 0x03, 0x10, 0x9E, 0x06, 0x00, 0x81, 0x06, 0x0D,
+  0x00, 0x1B, 0x64, 0x5B, 0x47, 0x5B, 0xC3, 0xB7, 0xB9, 0xB8, 0xBF, 0x19, 0x00, 0x06, 0xB7, 0x00,
+  0x02, 0x06, 0xCF, 0x0E, 0x82, 0x10, 0x80, 0xC7, 0x80, 0x0C, 0x01, 0xC7, 0x10, 0x80, 0x0E, 0x00,
+  0x5F, 0x80, 0x10, 0x00, 0xC7, 0x81, 0x0C, 0x02, 0xC7, 0xC4, 0x86, 0x82, 0x00, 0x03, 0x1B, 0x64,
+  0x5B, 0x47, 0x81, 0x46, 0x00, 0x7A, 0x81, 0x7B, 0x01, 0xE2, 0x06, 0x8B, 0x00, 0x00, 0x06, 0x8A,
+  0x00, 0x00, 0x06, 0x9C, 0x00, 0x04, 0x06, 0x00, 0x06, 0x58, 0x0E, 0x80, 0x10, 0x80, 0xC7, 0x84,
+  0x0C, 0x00, 0x10, 0x80, 0x0E, 0x81, 0x10, 0x80, 0x0C, 0x02, 0xC7, 0x10, 0x73, 0x81, 0x00, 0x07,
+  0x1C, 0x64, 0x5B, 0x47, 0x46, 0x66, 0x59, 0x44, 0x80, 0x6D, 0x02, 0xAC, 0xB0, 0x19, 0x80, 0x06,
+  0xAE, 0x00, 0x00, 0x06, 0x86, 0x00, 0x07, 0x06, 0x00, 0x06, 0x58, 0x0E, 0xC7, 0x10, 0xC7, 0x80,
+  0x0C, 0x83, 0x23, 0x03, 0xC7, 0x5F, 0x0E, 0x5F, 0x80, 0x10, 0x00, 0xC7, 0x80, 0x10, 0x04, 0xC4,
+  0x19, 0x00, 0x06, 0xD8, 0x80, 0x47, 0x80, 0x46, 0x04, 0x44, 0x6D, 0xAE, 0xD0, 0x69, 0x81, 0x06,
+  0xB0, 0x00, 0x00, 0x06, 0x87, 0x00, 0x06, 0x06, 0x00, 0x06, 0x58, 0x0E, 0x71, 0x10, 0x80, 0x0C,
+  0x84, 0x23, 0x03, 0x0C, 0x10, 0x1E, 0x0E, 0x80, 0x5F, 0x80, 0x10, 0x03, 0x5F, 0x68, 0x06, 0x2E,
+  0x80, 0x47, 0x04, 0x66, 0x59, 0x6D, 0xAF, 0x74, 0x82, 0x06, 0xBE, 0x00, 0x80, 0x06, 0x03, 0xCE,
+  0x0E, 0x71, 0xC7, 0x81, 0x0C, 0x84, 0x23, 0x02, 0xC7, 0x1E, 0x0E, 0x80, 0x5F, 0x80, 0x1E, 0x07,
+  0x58, 0x06, 0xC2, 0xB3, 0x5B, 0x59, 0x6E, 0x9D, 0x80, 0x06, 0x01, 0x00, 0x06, 0xC1, 0x00, 0x05,
+  0x06, 0x00, 0x68, 0x0E, 0x10, 0xC7, 0x81, 0x0C, 0x83, 0x23, 0x04, 0x0C, 0xC7, 0x1E, 0x0E, 0x5F,
+  0x80, 0x1E, 0x07, 0xC5, 0x55, 0xB3, 0x5B, 0x59, 0xAF, 0x19, 0x06, 0x82, 0x00, 0x00, 0x06, 0xC1,
+  0x00, 0x80, 0x06, 0x04, 0x75, 0x79, 0x0E, 0x10, 0x71, 0x81, 0x0C, 0x81, 0x23, 0x80, 0x0C, 0x0A,
+  0x10, 0x1E, 0x0E, 0x1E, 0x0E, 0x4E, 0xD8, 0x66, 0x59, 0x8D, 0x06, 0xCA, 0x00, 0x80, 0x06, 0x03,
+  0x95, 0x4E, 0x0E, 0x10, 0x80, 0xC7, 0x83, 0x0C, 0x01, 0xC7, 0xC4, 0x80, 0x0E, 0x80, 0x1E, 0x04,
+  0x8C, 0x46, 0x6D, 0x74, 0x06, 0x90, 0x00, 0x00, 0x06, 0xB7, 0x00, 0x04, 0x06, 0x00, 0x06, 0x75,
+  0xCE, 0x80, 0x0E, 0x02, 0x5F, 0x71, 0x0C, 0x80, 0xC7, 0x80, 0x10, 0x01, 0xC4, 0x1E, 0x80, 0x0E,
+  0x04, 0x1E, 0x46, 0x44, 0x45, 0x06, 0x87, 0x00, 0x80, 0x06, 0x00, 0x00, 0x80, 0x06, 0x00, 0x39,
+  0xBC, 0x00, 0x80, 0x06, 0x80, 0x00, 0x03, 0x06, 0xE7, 0x94, 0x79, 0x80, 0x0E, 0x82, 0x10, 0x00,
+  0x5F, 0x80, 0x1E, 0x05, 0x0E, 0xAD, 0x66, 0x44, 0x9D, 0x06, 0x8A, 0x00, 0x00, 0x18, 0x80, 0x00,
+  0x80, 0x06, 0x8F, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x82, 0x06, 0x80, 0x00, 0x04, 0x06, 0x75, 0x94,
+  0x79, 0x4E, 0x84, 0x0E, 0x03, 0xAD, 0x46, 0x6E, 0x06, 0x89, 0x00, 0x03, 0x1C, 0x1B, 0x1F, 0x19,
+  0x80, 0x06, 0x90, 0x00, 0x00, 0x06, 0x9F, 0x00, 0x81, 0x06, 0x81, 0x00, 0x05, 0x1C, 0x2E, 0x33,
+  0x60, 0x70, 0x2D, 0x80, 0x5D, 0x09, 0x5E, 0x60, 0x33, 0x2E, 0x06, 0x00, 0x06, 0x21, 0x86, 0xA0,
+  0x80, 0x68, 0x04, 0xE0, 0x64, 0x59, 0x45, 0x06, 0x85, 0x00, 0x04, 0x06, 0x1F, 0x33, 0x5D, 0x48,
+  0x80, 0x16, 0x05, 0x48, 0x2C, 0x5E, 0x33, 0x2E, 0x06, 0x80, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00,
+  0x06, 0xA8, 0x00, 0x80, 0x06, 0x80, 0x00, 0x04, 0x1B, 0x33, 0x4F, 0xB6, 0x07, 0x87, 0x01, 0x03,
+  0x07, 0x48, 0x3D, 0x1B, 0x80, 0x06, 0x07, 0x00, 0x06, 0x00, 0xA5, 0xBE, 0x44, 0xD5, 0x06, 0x80,
+  0x00, 0x00, 0x06, 0x80, 0x00, 0x03, 0x19, 0x83, 0x2D, 0x16, 0x88, 0x01, 0x02, 0x48, 0x3D, 0xA4,
+  0x80, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x80, 0x06, 0x03, 0xDD, 0x2D, 0x16, 0x01, 0x86, 0x07, 0x01,
+  0x01, 0x07, 0x83, 0x01, 0x09, 0x16, 0x5E, 0x1B, 0x06, 0x00, 0x18, 0x1C, 0xB5, 0x6D, 0x21, 0x82,
+  0x00, 0x04, 0x06, 0x33, 0xBB, 0x07, 0x01, 0x85, 0x07, 0x85, 0x01, 0x03, 0x5E, 0x76, 0x00, 0x06,
+  0xA4, 0x00, 0x00, 0x39, 0x81, 0x00, 0x03, 0x2E, 0x4F, 0x07, 0x01, 0x88, 0x07, 0x01, 0x01, 0x07,
+  0x85, 0x01, 0x07, 0x16, 0x9C, 0x06, 0x18, 0x1C, 0x66, 0x6E, 0x06, 0x80, 0x00, 0x02, 0x06, 0x83,
+  0x2C, 0x81, 0x01, 0x87, 0x07, 0x86, 0x01, 0x01, 0x5E, 0x1F, 0xA6, 0x00, 0x01, 0x1C, 0x3F, 0x81,
+  0x01, 0x86, 0x07, 0x8A, 0x01, 0x0E, 0x03, 0x01, 0x2D, 0x1B, 0x55, 0x8C, 0x45, 0x06, 0x19, 0xE2,
+  0x6F, 0x01, 0x07, 0x5A, 0x01, 0x8A, 0x07, 0x01, 0x01, 0x07, 0x83, 0x01, 0x04, 0x16, 0x9C, 0x06,
+  0x00, 0x06, 0xA0, 0x00, 0x03, 0x06, 0x34, 0x2C, 0x07, 0x80, 0x01, 0x84, 0x07, 0x85, 0x01, 0x00,
+  0x5A, 0x82, 0x01, 0x81, 0x03, 0x00, 0x5A, 0x80, 0x03, 0x05, 0x5A, 0x4F, 0x59, 0x64, 0x3F, 0x90,
+  0x82, 0x01, 0x01, 0x07, 0x01, 0x8E, 0x07, 0x80, 0x01, 0x00, 0x07, 0x80, 0x01, 0x01, 0x5D, 0x1F,
+  0xA0, 0x00, 0x03, 0x06, 0x80, 0x07, 0x01, 0x85, 0x07, 0x85, 0x01, 0x8D, 0x03, 0x01, 0x07, 0x01,
+  0x80, 0x03, 0x03, 0x01, 0x5A, 0x01, 0x5A, 0x87, 0x01, 0x88, 0x07, 0x83, 0x01, 0x04, 0x48, 0x82,
+  0x00, 0x06, 0x19, 0x9B, 0x00, 0x01, 0x06, 0x3F, 0x80, 0x01, 0x84, 0x07, 0x82, 0x01, 0x00, 0x5A,
+  0x83, 0x03, 0x80, 0x0B, 0x00, 0x0F, 0x82, 0xB1, 0x84, 0x0F, 0x00, 0x0B, 0x81, 0x03, 0x88, 0x5A,
+  0x8C, 0x01, 0x81, 0x07, 0x81, 0x01, 0x02, 0x16, 0x7F, 0x06, 0x9B, 0x00, 0x02, 0x06, 0x6F, 0x01,
+  0x84, 0x07, 0x82, 0x01, 0x84, 0x03, 0x80, 0xB1, 0x01, 0x31, 0xB1, 0x88, 0x02, 0x85, 0x0F, 0x87,
+  0x03, 0x83, 0x5A, 0x87, 0x01, 0x81, 0x07, 0x81, 0x01, 0x01, 0x07, 0x52, 0x9A, 0x00, 0x02, 0x06,
+  0x3F, 0x01, 0x84, 0x07, 0x82, 0x01, 0x82, 0x03, 0x80, 0x37, 0x80, 0x31, 0x83, 0x02, 0x00, 0x04,
+  0x88, 0x5C, 0x00, 0x02, 0x87, 0x0F, 0x81, 0x0B, 0x85, 0x03, 0x00, 0x5A, 0x85, 0x01, 0x82, 0x07,
+  0x80, 0x01, 0x03, 0x16, 0x82, 0x00, 0x06, 0x96, 0x00, 0x01, 0x06, 0xDB, 0x81, 0x01, 0x82, 0x07,
+  0x82, 0x01, 0x81, 0x03, 0x02, 0x37, 0xB1, 0x31, 0x81, 0x02, 0x82, 0x04, 0x81, 0x5C, 0x88, 0x1A,
+  0x84, 0x5C, 0x80, 0x02, 0x85, 0x0F, 0x80, 0x0B, 0x83, 0x03, 0x84, 0x01, 0x82, 0x07, 0x80, 0x01,
+  0x03, 0x16, 0x1F, 0x18, 0x06, 0x95, 0x00, 0x02, 0xE6, 0x07, 0x01, 0x84, 0x07, 0x81, 0x01, 0x80,
+  0x03, 0x03, 0x0B, 0x37, 0x31, 0xB1, 0x81, 0x02, 0x82, 0x04, 0x02, 0x0A, 0x5C, 0x05, 0x80, 0x1A,
+  0x80, 0x14, 0x83, 0x08, 0x00, 0x14, 0x84, 0x1A, 0x83, 0x5C, 0x82, 0x02, 0x00, 0x31, 0x80, 0x0F,
+  0x01, 0x37, 0x0B, 0x83, 0x03, 0x83, 0x01, 0x81, 0x07, 0x81, 0x01, 0x01, 0x32, 0x19, 0x91, 0x00,
+  0x06, 0x06, 0x00, 0x06, 0x00, 0x1C, 0x90, 0x01, 0x84, 0x07, 0x81, 0x01, 0x80, 0x03, 0x00, 0x0B,
+  0x81, 0x31, 0x80, 0x02, 0x81, 0x04, 0x02, 0x0A, 0x5C, 0x1A, 0x81, 0x05, 0x80, 0x14, 0x80, 0x08,
+  0x84, 0x13, 0x81, 0x08, 0x00, 0x14, 0x84, 0x1A, 0x82, 0x5C, 0x82, 0x02, 0x80, 0x0F, 0x80, 0x0B,
+  0x82, 0x03, 0x83, 0x01, 0x02, 0x07, 0x01, 0x07, 0x81, 0x01, 0x01, 0x60, 0x06, 0x90, 0x00, 0x00,
+  0x06, 0x80, 0x00, 0x02, 0x06, 0x70, 0x01, 0x84, 0x07, 0x81, 0x01, 0x80, 0x03, 0x00, 0x0B, 0x80,
+  0x31, 0x81, 0x02, 0x80, 0x04, 0x01, 0x0A, 0x04, 0x82, 0x05, 0x80, 0x14, 0x80, 0x08, 0x02, 0x13,
+  0x09, 0x11, 0x81, 0x0D, 0x80, 0x11, 0x80, 0x09, 0x00, 0x13, 0x81, 0x08, 0x00, 0x14, 0x84, 0x1A,
+  0x81, 0x5C, 0x82, 0x02, 0x80, 0x0F, 0x00, 0x0B, 0x82, 0x03, 0x88, 0x01, 0x04, 0x16, 0x1B, 0x00,
+  0x39, 0x06, 0x90, 0x00, 0x01, 0x34, 0x01, 0x84, 0x07, 0x81, 0x01, 0x80, 0x03, 0x00, 0x0B, 0x80,
+  0xB1, 0x81, 0x02, 0x81, 0x04, 0x80, 0x0A, 0x81, 0x05, 0x00, 0x14, 0x80, 0x08, 0x06, 0x13, 0x09,
+  0x11, 0x0D, 0x7C, 0x17, 0x56, 0x80, 0x17, 0x03, 0x7C, 0x0D, 0x11, 0x09, 0x80, 0x13, 0x80, 0x08,
+  0x82, 0x14, 0x81, 0x05, 0x80, 0x0A, 0x80, 0x5C, 0x81, 0x02, 0x80, 0x0F, 0x80, 0x0B, 0x81, 0x03,
+  0x83, 0x01, 0x00, 0x07, 0x82, 0x01, 0x01, 0x5E, 0x00, 0x80, 0x06, 0x8F, 0x00, 0x01, 0x06, 0xBD,
+  0x80, 0x01, 0x82, 0x07, 0x81, 0x01, 0x80, 0x03, 0x00, 0x0B, 0x80, 0xB1, 0x80, 0x02, 0x82, 0x04,
+  0x00, 0x0A, 0x82, 0x05, 0x80, 0x14, 0x00, 0x08, 0x80, 0x13, 0x04, 0x11, 0x0D, 0x17, 0x56, 0x1D,
+  0x81, 0x2A, 0x04, 0x56, 0x17, 0x0D, 0x11, 0x09, 0x80, 0x13, 0x81, 0x08, 0x81, 0x14, 0x82, 0x05,
+  0x02, 0x0A, 0x04, 0x5C, 0x81, 0x02, 0x80, 0x31, 0x01, 0xB2, 0x0B, 0x81, 0x03, 0x82, 0x01, 0x00,
+  0x07, 0x83, 0x01, 0x00, 0x2E, 0x91, 0x00, 0x00, 0xE6, 0x80, 0x01, 0x83, 0x07, 0x81, 0x01, 0x80,
+  0x03, 0x01, 0x37, 0x31, 0x80, 0x02, 0x82, 0x04, 0x00, 0x0A, 0x82, 0x05, 0x80, 0x14, 0x80, 0x08,
+  0x06, 0x13, 0x11, 0x0D, 0x17, 0x1D, 0x2A, 0x41, 0x80, 0x27, 0x06, 0x41, 0x2A, 0x56, 0x17, 0x0D,
+  0x11, 0x09, 0x80, 0x13, 0x81, 0x08, 0x81, 0x14, 0x82, 0x05, 0x00, 0x0A, 0x80, 0x5C, 0x80, 0x02,
+  0x80, 0x31, 0x00, 0xB1, 0x80, 0x0B, 0x81, 0x03, 0x83, 0x01, 0x00, 0x07, 0x81, 0x01, 0x02, 0x5E,
+  0x00, 0x06, 0x8D, 0x00, 0x80, 0x06, 0x00, 0xC1, 0x80, 0x01, 0x82, 0x07, 0x81, 0x01, 0x80, 0x03,
+  0x02, 0x37, 0xB1, 0x31, 0x80, 0x02, 0x81, 0x04, 0x00, 0x0A, 0x81, 0x05, 0x81, 0x14, 0x80, 0x08,
+  0x08, 0x13, 0x09, 0x11, 0x7C, 0x56, 0x2A, 0x27, 0x88, 0x2B, 0x80, 0x88, 0x06, 0x41, 0x2A, 0x56,
+  0x7C, 0x0D, 0x11, 0x09, 0x81, 0x13, 0x80, 0x08, 0x80, 0x14, 0x82, 0x05, 0x00, 0x0A, 0x80, 0x5C,
+  0x82, 0x02, 0x80, 0x0F, 0x80, 0x0B, 0x80, 0x03, 0x00, 0x5A, 0x83, 0x01, 0x00, 0x07, 0x80, 0x01,
+  0x01, 0x16, 0x1B, 0x8F, 0x00, 0x00, 0xE9, 0x81, 0x01, 0x82, 0x07, 0x80, 0x01, 0x80, 0x03, 0x02,
+  0x0B, 0xB1, 0x31, 0x80, 0x02, 0x81, 0x04, 0x80, 0x0A, 0x81, 0x05, 0x81, 0x14, 0x00, 0x08, 0x80,
+  0x13, 0x05, 0x09, 0x0D, 0x17, 0x1D, 0x41, 0x88, 0x82, 0x2B, 0x05, 0x27, 0x2A, 0x56, 0x17, 0x0D,
+  0x11, 0x80, 0x09, 0x80, 0x13, 0x81, 0x08, 0x80, 0x14, 0x82, 0x05, 0x00, 0x0A, 0x80, 0x04, 0x82,
+  0x02, 0x81, 0x0F, 0x81, 0x03, 0x00, 0x5A, 0x81, 0x01, 0x80, 0x07, 0x81, 0x01, 0x00, 0x9C, 0x8F,
+  0x00, 0x00, 0x3F, 0x80, 0x01, 0x82, 0x07, 0x81, 0x01, 0x80, 0x03, 0x01, 0x0B, 0xB1, 0x81, 0x02,
+  0x80, 0x04, 0x80, 0x0A, 0x82, 0x05, 0x80, 0x14, 0x80, 0x08, 0x07, 0x13, 0x09, 0x11, 0x0D, 0x17,
+  0x1D, 0x41, 0x88, 0x82, 0x2B, 0x07, 0x27, 0x41, 0x1D, 0x17, 0x12, 0x0D, 0x11, 0x09, 0x81, 0x13,
+  0x80, 0x08, 0x81, 0x14, 0x81, 0x05, 0x80, 0x0A, 0x80, 0x04, 0x82, 0x02, 0x80, 0x0F, 0x00, 0x0B,
+  0x80, 0x03, 0x00, 0x5A, 0x81, 0x01, 0x81, 0x07, 0x80, 0x01, 0x01, 0x32, 0x06, 0x8D, 0x00, 0x01,
+  0xA5, 0x90, 0x81, 0x01, 0x81, 0x07, 0x81, 0x01, 0x03, 0x03, 0x0B, 0x0F, 0xB1, 0x80, 0x02, 0x81,
+  0x04, 0x80, 0x0A, 0x81, 0x05, 0x81, 0x14, 0x00, 0x08, 0x80, 0x13, 0x06, 0x09, 0x11, 0x0D, 0x17,
+  0x1D, 0x41, 0x27, 0x82, 0x2B, 0x06, 0x27, 0x41, 0x1D, 0x17, 0x7C, 0x0D, 0x11, 0x80, 0x09, 0x80,
+  0x13, 0x81, 0x08, 0x80, 0x14, 0x81, 0x05, 0x80, 0x0A, 0x81, 0x04, 0x81, 0x02, 0x80, 0x0F, 0x00,
+  0x0B, 0x81, 0x03, 0x81, 0x01, 0x80, 0x07, 0x81, 0x01, 0x01, 0x16, 0x1F, 0x8D, 0x00, 0x01, 0x2E,
+  0x5A, 0x80, 0x01, 0x82, 0x07, 0x80, 0x01, 0x80, 0x03, 0x01, 0x37, 0xB1, 0x80, 0x02, 0x81, 0x04,
+  0x80, 0x0A, 0x82, 0x05, 0x80, 0x14, 0x80, 0x08, 0x80, 0x13, 0x07, 0x09, 0x11, 0x0D, 0x17, 0x56,
+  0x2A, 0x41, 0x27, 0x80, 0x88, 0x07, 0x27, 0x41, 0x2A, 0x56, 0x17, 0x12, 0x0D, 0x11, 0x81, 0x09,
+  0x80, 0x13, 0x80, 0x08, 0x80, 0x14, 0x81, 0x05, 0x01, 0xBA, 0x0A, 0x81, 0x04, 0x82, 0x02, 0x02,
+  0x0F, 0xB2, 0x0B, 0x81, 0x03, 0x80, 0x01, 0x81, 0x07, 0x81, 0x01, 0x00, 0x52, 0x8B, 0x00, 0x02,
+  0x06, 0x00, 0x80, 0x81, 0x01, 0x81, 0x07, 0x81, 0x01, 0x01, 0x03, 0x0B, 0x80, 0xB1, 0x80, 0x02,
+  0x81, 0x04, 0x80, 0x0A, 0x82, 0x05, 0x80, 0x14, 0x00, 0x08, 0x81, 0x13, 0x07, 0x09, 0x11, 0x0D,
+  0x12, 0xCA, 0x1D, 0x2A, 0x41, 0x80, 0x27, 0x06, 0x41, 0x2A, 0x1D, 0xCA, 0x17, 0x12, 0x0D, 0x80,
+  0x11, 0x80, 0x09, 0x80, 0x13, 0x80, 0x08, 0x81, 0x14, 0x81, 0x05, 0x00, 0x0A, 0x82, 0x04, 0x82,
+  0x02, 0x01, 0x0F, 0x0B, 0x81, 0x03, 0x81, 0x01, 0x81, 0x07, 0x80, 0x01, 0x01, 0x98, 0x06, 0x8B,
+  0x00, 0x01, 0x06, 0x4F, 0x80, 0x01, 0x82, 0x07, 0x80, 0x01, 0x80, 0x03, 0x01, 0x0B, 0xB1, 0x80,
+  0x02, 0x81, 0x04, 0x81, 0x0A, 0x81, 0x05, 0x80, 0x14, 0x80, 0x08, 0x80, 0x13, 0x80, 0x09, 0x05,
+  0x11, 0x0D, 0x12, 0x17, 0xCA, 0x1D, 0x82, 0x2A, 0x02, 0x1D, 0x56, 0x17, 0x80, 0x12, 0x00, 0x0D,
+  0x80, 0x11, 0x80, 0x09, 0x81, 0x13, 0x00, 0x08, 0x80, 0x14, 0x81, 0x05, 0x01, 0xBA, 0x0A, 0x82,
+  0x04, 0x83, 0x02, 0x01, 0x0F, 0x0B, 0x80, 0x03, 0x81, 0x01, 0x81, 0x07, 0x80, 0x01, 0x03, 0xC0,
+  0x06, 0x00, 0x06, 0x89, 0x00, 0x01, 0xA5, 0x3C, 0x81, 0x01, 0x80, 0x07, 0x81, 0x01, 0x02, 0x03,
+  0x0B, 0x37, 0x80, 0x31, 0x00, 0x02, 0x81, 0x04, 0x81, 0x0A, 0x80, 0x05, 0x81, 0x14, 0x80, 0x08,
+  0x80, 0x13, 0x80, 0x09, 0x01, 0x11, 0x0D, 0x80, 0x12, 0x02, 0x17, 0xCA, 0x56, 0x80, 0x1D, 0x80,
+  0xCA, 0x80, 0x17, 0x00, 0x12, 0x80, 0x0D, 0x80, 0x11, 0x81, 0x09, 0x80, 0x13, 0x00, 0x08, 0x81,
+  0x14, 0x00, 0x05, 0x80, 0xBA, 0x80, 0x0A, 0x82, 0x04, 0x82, 0x02, 0x01, 0x0F, 0x0B, 0x81, 0x03,
+  0x80, 0x01, 0x80, 0x07, 0x81, 0x01, 0x01, 0xBB, 0xA5, 0x89, 0x00, 0x03, 0x06, 0x00, 0x1C, 0xB6,
+  0x80, 0x01, 0x81, 0x07, 0x80, 0x01, 0x80, 0x03, 0x00, 0x0B, 0x80, 0x31, 0x80, 0x02, 0x81, 0x04,
+  0x80, 0x0A, 0x82, 0x05, 0x80, 0x14, 0x80, 0x08, 0x80, 0x13, 0x80, 0x09, 0x00, 0x11, 0x80, 0x0D,
+  0x00, 0x12, 0x80, 0x17, 0x82, 0xCA, 0x80, 0x17, 0x80, 0x12, 0x81, 0x0D, 0x80, 0x11, 0x80, 0x09,
+  0x80, 0x13, 0x00, 0x08, 0x81, 0x14, 0x01, 0x05, 0xBA, 0x81, 0x0A, 0x82, 0x04, 0x82, 0x02, 0x00,
+  0x0F, 0x80, 0x0B, 0x80, 0x03, 0x80, 0x01, 0x81, 0x07, 0x80, 0x01, 0x03, 0xB6, 0x1F, 0x00, 0x06,
+  0x89, 0x00, 0x01, 0x34, 0x5A, 0x80, 0x01, 0x81, 0x07, 0x80, 0x01, 0x80, 0x03, 0x02, 0x0B, 0x31,
+  0xB1, 0x80, 0x02, 0x81, 0x04, 0x80, 0x0A, 0x82, 0x05, 0x00, 0x14, 0x81, 0x08, 0x00, 0x13, 0x81,
+  0x09, 0x00, 0x11, 0x80, 0x0D, 0x81, 0x12, 0x83, 0x17, 0x82, 0x12, 0x80, 0x0D, 0x80, 0x11, 0x80,
+  0x09, 0x80, 0x13, 0x00, 0x08, 0x81, 0x14, 0x01, 0x05, 0xBA, 0x81, 0x0A, 0x82, 0x04, 0x82, 0x02,
+  0x02, 0xB2, 0x0F, 0x0B, 0x80, 0x03, 0x80, 0x01, 0x82, 0x07, 0x04, 0x01, 0x16, 0x1F, 0x00, 0x06,
+  0x89, 0x00, 0x00, 0xE6, 0x81, 0x01, 0x80, 0x07, 0x81, 0x01, 0x80, 0x03, 0x02, 0x0B, 0x37, 0x31,
+  0x80, 0x02, 0x81, 0x04, 0x80, 0x0A, 0x81, 0x05, 0x80, 0x14, 0x81, 0x08, 0x00, 0x13, 0x80, 0x09,
+  0x80, 0x11, 0x81, 0x0D, 0x81, 0x12, 0x82, 0x17, 0x82, 0x12, 0x80, 0x0D, 0x80, 0x11, 0x80, 0x09,
+  0x80, 0x13, 0x00, 0x08, 0x80, 0x14, 0x80, 0x05, 0x00, 0xBA, 0x81, 0x0A, 0x82, 0x04, 0x82, 0x02,
+  0x02, 0x0F, 0xB2, 0x0B, 0x80, 0x03, 0x81, 0x01, 0x81, 0x07, 0x04, 0x01, 0x16, 0x1B, 0x00, 0x06,
+  0x89, 0x00, 0x00, 0x3E, 0x81, 0x01, 0x80, 0x07, 0x81, 0x01, 0x80, 0x03, 0x01, 0x0B, 0xB1, 0x81,
+  0x02, 0x81, 0x04, 0x80, 0x0A, 0x82, 0x05, 0x00, 0x14, 0x81, 0x08, 0x00, 0x13, 0x80, 0x09, 0x80,
+  0x11, 0x81, 0x0D, 0x89, 0x12, 0x80, 0x0D, 0x80, 0x11, 0x80, 0x09, 0x00, 0x13, 0x80, 0x08, 0x80,
+  0x14, 0x80, 0x05, 0x00, 0xBA, 0x81, 0x0A, 0x82, 0x04, 0x82, 0x02, 0x80, 0xB1, 0x00, 0x0B, 0x80,
+  0x03, 0x81, 0x01, 0x81, 0x07, 0x02, 0x01, 0x16, 0x1B, 0x8B, 0x00, 0x00, 0x80, 0x81, 0x01, 0x80,
+  0x07, 0x81, 0x01, 0x80, 0x03, 0x01, 0x0B, 0xB1, 0x81, 0x02, 0x81, 0x04, 0x80, 0x0A, 0x82, 0x05,
+  0x00, 0x14, 0x81, 0x08, 0x00, 0x13, 0x80, 0x09, 0x81, 0x11, 0x80, 0x0D, 0x89, 0x12, 0x80, 0x0D,
+  0x80, 0x11, 0x80, 0x09, 0x00, 0x13, 0x80, 0x08, 0x80, 0x14, 0x81, 0x05, 0x01, 0xBA, 0x0A, 0x82,
+  0x04, 0x83, 0x02, 0x80, 0xB1, 0x00, 0x0B, 0x80, 0x03, 0x81, 0x01, 0x81, 0x07, 0x04, 0x01, 0x16,
+  0x1B, 0x00, 0x06, 0x82, 0x00, 0x00, 0x06, 0x84, 0x00, 0x00, 0x80, 0x81, 0x01, 0x80, 0x07, 0x81,
+  0x01, 0x80, 0x03, 0x00, 0x0B, 0x80, 0xB1, 0x80, 0x02, 0x81, 0x04, 0x80, 0x0A, 0x82, 0x05, 0x80,
+  0x14, 0x00, 0x08, 0x80, 0x13, 0x81, 0x09, 0x80, 0x11, 0x80, 0x0D, 0x89, 0x12, 0x80, 0x0D, 0x80,
+  0x11, 0x80, 0x09, 0x00, 0x13, 0x80, 0x08, 0x80, 0x14, 0x80, 0x05, 0x80, 0xBA, 0x80, 0x0A, 0x82,
+  0x04, 0x82, 0x02, 0x02, 0x0F, 0x31, 0x0B, 0x80, 0x03, 0x00, 0x5A, 0x80, 0x01, 0x80, 0x07, 0x80,
+  0x01, 0x01, 0x16, 0x1B, 0x8B, 0x00, 0x00, 0x3E, 0x80, 0x01, 0x81, 0x07, 0x81, 0x01, 0x80, 0x03,
+  0x03, 0x0B, 0xB1, 0x31, 0x02, 0x82, 0x04, 0x80, 0x0A, 0x82, 0x05, 0x80, 0x14, 0x80, 0x08, 0x00,
+  0x13, 0x81, 0x09, 0x80, 0x11, 0x80, 0x0D, 0x88, 0x12, 0x80, 0x0D, 0x80, 0x11, 0x80, 0x09, 0x80,
+  0x13, 0x00, 0x08, 0x80, 0x14, 0x81, 0x05, 0x00, 0xBA, 0x81, 0x0A, 0x81, 0x04, 0x83, 0x02, 0x02,
+  0x0F, 0xB1, 0x0B, 0x80, 0x03, 0x00, 0x5A, 0x80, 0x01, 0x80, 0x07, 0x80, 0x01, 0x01, 0x16, 0x1B,
+  0x8B, 0x00, 0x00, 0x3E, 0x80, 0x01, 0x81, 0x07, 0x81, 0x01, 0x80, 0x03, 0x02, 0x0B, 0xB1, 0x31,
+  0x80, 0x02, 0x81, 0x04, 0x80, 0x0A, 0x82, 0x05, 0x81, 0x14, 0x00, 0x08, 0x80, 0x13, 0x80, 0x09,
+  0x81, 0x11, 0x80, 0x0D, 0x87, 0x12, 0x80, 0x0D, 0x80, 0x11, 0x80, 0x09, 0x00, 0x13, 0x80, 0x08,
+  0x80, 0x14, 0x80, 0x05, 0x80, 0xBA, 0x00, 0x0A, 0x82, 0x04, 0x84, 0x02, 0x80, 0x0F, 0x00, 0x0B,
+  0x80, 0x03, 0x81, 0x01, 0x80, 0x07, 0x80, 0x01, 0x01, 0x16, 0x1F, 0x89, 0x00, 0x02, 0x06, 0x00,
+  0xE6, 0x82, 0x01, 0x00, 0x07, 0x81, 0x01, 0x80, 0x03, 0x00, 0x0B, 0x80, 0xB1, 0x80, 0x02, 0x82,
+  0x04, 0x81, 0x0A, 0x81, 0x05, 0x80, 0x14, 0x80, 0x08, 0x80, 0x13, 0x00, 0x09, 0x81, 0x11, 0x81,
+  0x0D, 0x84, 0x12, 0x81, 0x0D, 0x80, 0x11, 0x80, 0x09, 0x80, 0x13, 0x80, 0x08, 0x00, 0x14, 0x81,
+  0x05, 0x00, 0xBA, 0x80, 0x0A, 0x82, 0x04, 0x85, 0x02, 0x01, 0xB2, 0x0B, 0x80, 0x03, 0x81, 0x01,
+  0x80, 0x07, 0x80, 0x01, 0x01, 0x48, 0x1F, 0x89, 0x00, 0x03, 0x06, 0x00, 0x2E, 0x16, 0x80, 0x01,
+  0x80, 0x07, 0x81, 0x01, 0x81, 0x03, 0x00, 0x0B, 0x80, 0xB1, 0x00, 0x02, 0x81, 0x04, 0x82, 0x0A,
+  0x81, 0x05, 0x80, 0x14, 0x80, 0x08, 0x80, 0x13, 0x80, 0x09, 0x81, 0x11, 0x88, 0x0D, 0x80, 0x11,
+  0x80, 0x09, 0x80, 0x13, 0x80, 0x08, 0x80, 0x14, 0x81, 0x05, 0x00, 0xBA, 0x80, 0x0A, 0x83, 0x04,
+  0x83, 0x02, 0x02, 0x0F, 0xB2, 0x0B, 0x80, 0x03, 0x81, 0x01, 0x80, 0x07, 0x80, 0x01, 0x00, 0x32,
+  0x80, 0x06, 0x89, 0x00, 0x02, 0x18, 0xA5, 0x3C, 0x80, 0x01, 0x80, 0x07, 0x81, 0x01, 0x81, 0x03,
+  0x02, 0x0B, 0x0F, 0x31, 0x80, 0x02, 0x81, 0x04, 0x81, 0x0A, 0x82, 0x05, 0x00, 0x14, 0x81, 0x08,
+  0x80, 0x13, 0x80, 0x09, 0x82, 0x11, 0x84, 0x0D, 0x81, 0x11, 0x81, 0x09, 0x00, 0x13, 0x80, 0x08,
+  0x80, 0x14, 0x80, 0x05, 0x82, 0x0A, 0x84, 0x04, 0x83, 0x02, 0x02, 0x0F, 0xB2, 0x0B, 0x80, 0x03,
+  0x81, 0x01, 0x81, 0x07, 0x02, 0x01, 0xC0, 0x06, 0x8B, 0x00, 0x01, 0x06, 0x90, 0x80, 0x01, 0x80,
+  0x07, 0x82, 0x01, 0x80, 0x03, 0x02, 0x0B, 0x0F, 0x31, 0x80, 0x02, 0x82, 0x04, 0x80, 0x0A, 0x82,
+  0x05, 0x80, 0x14, 0x81, 0x08, 0x80, 0x13, 0x81, 0x09, 0x87, 0x11, 0x81, 0x09, 0x81, 0x13, 0x00,
+  0x08, 0x81, 0x14, 0x80, 0x05, 0x80, 0xBA, 0x00, 0x0A, 0x84, 0x04, 0x84, 0x02, 0x00, 0x0F, 0x80,
+  0x0B, 0x00, 0x03, 0x81, 0x01, 0x82, 0x07, 0x02, 0x01, 0x65, 0x06, 0x8C, 0x00, 0x01, 0x6F, 0x01,
+  0x80, 0x07, 0x01, 0x01, 0x07, 0x80, 0x01, 0x82, 0x03, 0x01, 0x0F, 0x31, 0x80, 0x02, 0x83, 0x04,
+  0x80, 0x0A, 0x82, 0x05, 0x80, 0x14, 0x80, 0x08, 0x81, 0x13, 0x82, 0x09, 0x83, 0x11, 0x82, 0x09,
+  0x81, 0x13, 0x00, 0x08, 0x81, 0x14, 0x81, 0x05, 0x01, 0xBA, 0x0A, 0x86, 0x04, 0x83, 0x02, 0x01,
+  0x0F, 0x0B, 0x80, 0x03, 0x81, 0x01, 0x81, 0x07, 0x80, 0x01, 0x02, 0x60, 0x00, 0x06, 0x89, 0x00,
+  0x02, 0x39, 0x00, 0x80, 0x80, 0x01, 0x02, 0x07, 0x01, 0x07, 0x81, 0x01, 0x81, 0x03, 0x01, 0x37,
+  0xB1, 0x81, 0x02, 0x82, 0x04, 0x80, 0x0A, 0x83, 0x05, 0x80, 0x14, 0x81, 0x08, 0x82, 0x13, 0x85,
+  0x09, 0x82, 0x13, 0x80, 0x08, 0x80, 0x14, 0x82, 0x05, 0x00, 0xBA, 0x80, 0x0A, 0x84, 0x04, 0x84,
+  0x02, 0x00, 0xB1, 0x80, 0x0F, 0x81, 0x03, 0x80, 0x01, 0x80, 0x07, 0x81, 0x01, 0x00, 0x52, 0x80,
+  0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x06, 0x85, 0x00, 0x04, 0x06, 0x00, 0x2E, 0x07, 0x01, 0x81,
+  0x07, 0x81, 0x01, 0x81, 0x03, 0x00, 0x0B, 0x80, 0xB1, 0x80, 0x02, 0x83, 0x04, 0x02, 0x0A, 0xBA,
+  0x0A, 0x81, 0x05, 0x82, 0x14, 0x80, 0x08, 0x84, 0x13, 0x00, 0x09, 0x84, 0x13, 0x00, 0x08, 0x82,
+  0x14, 0x81, 0x05, 0x81, 0x0A, 0x84, 0x04, 0x85, 0x02, 0x02, 0xB1, 0xB2, 0x0B, 0x80, 0x03, 0x00,
+  0x5A, 0x80, 0x01, 0x80, 0x07, 0x80, 0x01, 0x01, 0x07, 0x1B, 0x8D, 0x00, 0x02, 0xA5, 0x3C, 0x01,
+  0x80, 0x07, 0x83, 0x01, 0x80, 0x03, 0x02, 0x0B, 0x37, 0xB1, 0x81, 0x02, 0x82, 0x04, 0x82, 0x0A,
+  0x81, 0x05, 0x82, 0x14, 0x82, 0x08, 0x84, 0x13, 0x83, 0x08, 0x80, 0x14, 0x82, 0x05, 0x00, 0xBA,
+  0x80, 0x0A, 0x85, 0x04, 0x85, 0x02, 0x00, 0xB1, 0x80, 0x0B, 0x80, 0x03, 0x00, 0x5A, 0x80, 0x01,
+  0x81, 0x07, 0x02, 0x01, 0x48, 0x19, 0x8D, 0x00, 0x02, 0x06, 0x6F, 0x01, 0x81, 0x07, 0x81, 0x01,
+  0x82, 0x03, 0x01, 0x37, 0xB1, 0x81, 0x02, 0x83, 0x04, 0x81, 0x0A, 0x83, 0x05, 0x83, 0x14, 0x86,
+  0x08, 0x83, 0x14, 0x82, 0x05, 0x80, 0xBA, 0x00, 0x0A, 0x86, 0x04, 0x85, 0x02, 0x02, 0x31, 0xB2,
+  0x0B, 0x80, 0x03, 0x80, 0x01, 0x82, 0x07, 0x02, 0x01, 0xBC, 0x06, 0x8B, 0x00, 0x00, 0x06, 0x80,
+  0x00, 0x01, 0x3E, 0x01, 0x81, 0x07, 0x82, 0x01, 0x81, 0x03, 0x02, 0x0B, 0x37, 0x31, 0x81, 0x02,
+  0x82, 0x04, 0x81, 0x0A, 0x80, 0xBA, 0x81, 0x05, 0x87, 0x14, 0x00, 0x08, 0x85, 0x14, 0x82, 0x05,
+  0x82, 0x0A, 0x84, 0x04, 0x86, 0x02, 0x02, 0x31, 0x0F, 0x0B, 0x80, 0x03, 0x81, 0x01, 0x81, 0x07,
+  0x80, 0x01, 0x00, 0x98, 0x8F, 0x00, 0x02, 0x55, 0x3C, 0x01, 0x81, 0x07, 0x82, 0x01, 0x80, 0x03,
+  0x02, 0x0B, 0x37, 0x31, 0x82, 0x02, 0x83, 0x04, 0x80, 0x0A, 0x80, 0xBA, 0x83, 0x05, 0x88, 0x14,
+  0x84, 0x05, 0x00, 0xBA, 0x83, 0x0A, 0x84, 0x04, 0x86, 0x02, 0x02, 0xB1, 0x0F, 0x0B, 0x80, 0x03,
+  0x81, 0x01, 0x81, 0x07, 0x80, 0x01, 0x00, 0x7F, 0x8F, 0x00, 0x02, 0x06, 0x6F, 0x01, 0x81, 0x07,
+  0x82, 0x01, 0x80, 0x03, 0x02, 0x0B, 0x37, 0x31, 0x82, 0x02, 0x83, 0x04, 0x80, 0x0A, 0x82, 0xBA,
+  0x87, 0x05, 0x81, 0x14, 0x84, 0x05, 0x00, 0x0A, 0x80, 0xBA, 0x80, 0x0A, 0x84, 0x04, 0x87, 0x02,
+  0x01, 0x31, 0xB1, 0x80, 0x0B, 0x80, 0x03, 0x80, 0x01, 0x82, 0x07, 0x02, 0x01, 0x3C, 0x1F, 0x90,
+  0x00, 0x00, 0x3E, 0x81, 0x01, 0x00, 0x07, 0x83, 0x01, 0x80, 0x03, 0x00, 0x0B, 0x80, 0xB1, 0x82,
+  0x02, 0x83, 0x04, 0x80, 0x0A, 0x80, 0xBA, 0x82, 0x0A, 0x8A, 0x05, 0x82, 0xBA, 0x81, 0x0A, 0x85,
+  0x04, 0x87, 0x02, 0x02, 0x31, 0xB2, 0x0B, 0x80, 0x03, 0x00, 0x5A, 0x80, 0x01, 0x80, 0x07, 0x81,
+  0x01, 0x01, 0xC0, 0x06, 0x90, 0x00, 0x01, 0xA5, 0x48, 0x80, 0x01, 0x00, 0x07, 0x83, 0x01, 0x80,
+  0x03, 0x80, 0x0B, 0x01, 0xB1, 0x31, 0x82, 0x02, 0x83, 0x04, 0x87, 0x0A, 0x86, 0x05, 0x81, 0xBA,
+  0x82, 0x0A, 0x87, 0x04, 0x86, 0x02, 0x80, 0x31, 0x01, 0xB2, 0x0B, 0x80, 0x03, 0x81, 0x01, 0x81,
+  0x07, 0x80, 0x01, 0x02, 0x7E, 0x00, 0x06, 0x90, 0x00, 0x02, 0xDB, 0x07, 0x01, 0x80, 0x07, 0x82,
+  0x01, 0x81, 0x03, 0x02, 0x0B, 0x37, 0x31, 0x82, 0x02, 0x86, 0x04, 0x00, 0x0A, 0x80, 0xBA, 0x81,
+  0x0A, 0x81, 0xBA, 0x00, 0x0A, 0x85, 0xBA, 0x81, 0x0A, 0x86, 0x04, 0x01, 0x02, 0x04, 0x86, 0x02,
+  0x01, 0xB1, 0xB2, 0x80, 0x0B, 0x00, 0x03, 0x82, 0x01, 0x81, 0x07, 0x02, 0x01, 0x48, 0x1C, 0x92,
+  0x00, 0x01, 0x1F, 0xB6, 0x80, 0x01, 0x80, 0x07, 0x81, 0x01, 0x00, 0x5A, 0x80, 0x03, 0x80, 0x0B,
+  0x01, 0xB2, 0x0F, 0x82, 0x02, 0x86, 0x04, 0x84, 0x0A, 0x80, 0xBA, 0x87, 0x0A, 0x88, 0x04, 0x87,
+  0x02, 0x01, 0xB1, 0xB2, 0x80, 0x0B, 0x80, 0x03, 0x81, 0x01, 0x81, 0x07, 0x80, 0x01, 0x00, 0x98,
+  0x80, 0x06, 0x84, 0x00, 0x00, 0x06, 0x8B, 0x00, 0x00, 0x3F, 0x80, 0x01, 0x80, 0x07, 0x81, 0x01,
+  0x00, 0x5A, 0x81, 0x03, 0x80, 0x0B, 0x01, 0xB1, 0x31, 0x83, 0x02, 0x87, 0x04, 0x8A, 0x0A, 0x89,
+  0x04, 0x87, 0x02, 0x80, 0xB1, 0x01, 0xB2, 0x0B, 0x80, 0x03, 0x81, 0x01, 0x82, 0x07, 0x04, 0x01,
+  0x07, 0x1B, 0x00, 0x06, 0x92, 0x00, 0x01, 0x55, 0xB6, 0x80, 0x01, 0x00, 0x07, 0x83, 0x01, 0x80,
+  0x03, 0x80, 0x0B, 0x01, 0xB1, 0x31, 0x83, 0x02, 0x9E, 0x04, 0x86, 0x02, 0x81, 0xB2, 0x00, 0x0B,
+  0x80, 0x03, 0x00, 0x5A, 0x80, 0x01, 0x82, 0x07, 0x80, 0x01, 0x01, 0x65, 0x06, 0x80, 0x00, 0x00,
+  0x06, 0x92, 0x00, 0x00, 0xDB, 0x86, 0x01, 0x82, 0x03, 0x00, 0x37, 0x80, 0xB2, 0x84, 0x02, 0x96,
+  0x04, 0x8B, 0x02, 0x80, 0xB2, 0x01, 0x0F, 0x0B, 0x80, 0x03, 0x00, 0x5A, 0x80, 0x01, 0x82, 0x07,
+  0x80, 0x01, 0x01, 0x07, 0x2E, 0x96, 0x00, 0x02, 0x1C, 0x3C, 0x01, 0x81, 0x07, 0x82, 0x01, 0x81,
+  0x03, 0x80, 0x0B, 0x80, 0xB2, 0x85, 0x02, 0x01, 0x04, 0x02, 0x8F, 0x04, 0x00, 0x02, 0x80, 0x04,
+  0x89, 0x02, 0x80, 0x31, 0x02, 0xB1, 0xB2, 0x0B, 0x81, 0x03, 0x81, 0x01, 0x81, 0x07, 0x81, 0x01,
+  0x01, 0x65, 0x06, 0x95, 0x00, 0x02, 0x06, 0x00, 0x3E, 0x80, 0x01, 0x81, 0x07, 0x82, 0x01, 0x81,
+  0x03, 0x80, 0x0B, 0x80, 0x0F, 0x00, 0xB2, 0x8B, 0x02, 0x84, 0x04, 0x8E, 0x02, 0x83, 0x31, 0x80,
+  0x0B, 0x81, 0x03, 0x81, 0x01, 0x82, 0x07, 0x80, 0x01, 0x03, 0x48, 0x1F, 0x00, 0x06, 0x96, 0x00,
+  0x03, 0x06, 0x6F, 0x01, 0x07, 0x80, 0x01, 0x00, 0x07, 0x82, 0x01, 0x81, 0x03, 0x02, 0x0B, 0x37,
+  0x0F, 0x80, 0xB2, 0x00, 0xB1, 0x9F, 0x02, 0x00, 0xB1, 0x80, 0x31, 0x00, 0xB1, 0x80, 0x0B, 0x80,
+  0x03, 0x82, 0x01, 0x83, 0x07, 0x80, 0x01, 0x01, 0x7E, 0x06, 0x84, 0x00, 0x00, 0x06, 0x92, 0x00,
+  0x05, 0x2E, 0xB6, 0x01, 0x07, 0x01, 0x07, 0x82, 0x01, 0x82, 0x03, 0x80, 0x0B, 0x02, 0xB2, 0xB1,
+  0x31, 0x80, 0xB1, 0x80, 0x31, 0x99, 0x02, 0x82, 0xB1, 0x01, 0x37, 0x0B, 0x82, 0x03, 0x81, 0x01,
+  0x82, 0x07, 0x81, 0x01, 0x01, 0x65, 0x06, 0x80, 0x00, 0x00, 0x06, 0x98, 0x00, 0x01, 0x3E, 0x07,
+  0x80, 0x01, 0x80, 0x07, 0x81, 0x01, 0x80, 0x5A, 0x82, 0x03, 0x01, 0x0B, 0x37, 0x84, 0xB1, 0x94,
+  0x02, 0x80, 0xB2, 0x01, 0xB1, 0x0F, 0x80, 0xB1, 0x80, 0x37, 0x00, 0x0B, 0x82, 0x03, 0x82, 0x01,
+  0x82, 0x07, 0x80, 0x01, 0x01, 0x32, 0x19, 0x9A, 0x00, 0x03, 0x06, 0x39, 0x06, 0x3F, 0x80, 0x01,
+  0x81, 0x07, 0x82, 0x01, 0x83, 0x03, 0x81, 0x0B, 0x00, 0xB2, 0x82, 0xB1, 0x00, 0x31, 0x81, 0xB1,
+  0x82, 0xB2, 0x00, 0x31, 0x80, 0xB1, 0x01, 0x02, 0xB1, 0x85, 0xB2, 0x82, 0xB1, 0x00, 0x37, 0x81,
+  0x0B, 0x82, 0x03, 0x83, 0x01, 0x82, 0x07, 0x80, 0x01, 0x03, 0x32, 0x1F, 0x00, 0x06, 0x9C, 0x00,
+  0x01, 0x06, 0x5D, 0x80, 0x01, 0x81, 0x07, 0x82, 0x01, 0x84, 0x03, 0x83, 0x0B, 0x02, 0x37, 0xB1,
+  0x37, 0x84, 0xB2, 0x82, 0xB1, 0x81, 0x0B, 0x02, 0xB2, 0x0F, 0xB2, 0x80, 0x0F, 0x80, 0xB1, 0x81,
+  0x0B, 0x84, 0x03, 0x82, 0x01, 0x83, 0x07, 0x80, 0x01, 0x01, 0x32, 0x1F, 0x9D, 0x00, 0x00, 0x06,
+  0x80, 0x00, 0x01, 0x1B, 0x48, 0x83, 0x07, 0x82, 0x01, 0x85, 0x03, 0x81, 0x0B, 0x00, 0x03, 0x92,
+  0x0B, 0x88, 0x03, 0x83, 0x01, 0x82, 0x07, 0x80, 0x01, 0x05, 0x32, 0x19, 0x00, 0x06, 0x00, 0x06,
+  0x9E, 0x00, 0x02, 0xE9, 0xB6, 0x01, 0x82, 0x07, 0x85, 0x01, 0xA1, 0x03, 0x83, 0x01, 0x80, 0x07,
+  0x00, 0x01, 0x80, 0x07, 0x80, 0x01, 0x01, 0xC0, 0x1C, 0xA3, 0x00, 0x03, 0x18, 0x34, 0x16, 0x01,
+  0x82, 0x07, 0x85, 0x01, 0x01, 0x03, 0x01, 0x85, 0x03, 0x80, 0x5A, 0x93, 0x03, 0x84, 0x01, 0x81,
+  0x07, 0x01, 0x01, 0x07, 0x80, 0x01, 0x03, 0x65, 0x06, 0x00, 0x06, 0x94, 0x00, 0x00, 0x06, 0x89,
+  0x00, 0x00, 0x06, 0x81, 0x00, 0x02, 0x34, 0x16, 0x01, 0x82, 0x07, 0x83, 0x01, 0x00, 0x5A, 0x8C,
+  0x01, 0x84, 0x5A, 0x82, 0x01, 0x81, 0x03, 0x03, 0x01, 0x03, 0x01, 0x03, 0x84, 0x01, 0x82, 0x07,
+  0x81, 0x01, 0x01, 0x60, 0x06, 0x80, 0x00, 0x00, 0x06, 0xA5, 0x00, 0x02, 0xE6, 0x5A, 0x01, 0x83,
+  0x07, 0x9F, 0x01, 0x00, 0x5A, 0x83, 0x01, 0x80, 0x07, 0x01, 0x01, 0x07, 0x81, 0x01, 0x02, 0x16,
+  0x7E, 0x06, 0xAA, 0x00, 0x02, 0x34, 0x16, 0x01, 0x85, 0x07, 0x82, 0x01, 0x8B, 0x07, 0x92, 0x01,
+  0x00, 0x07, 0x80, 0x01, 0x03, 0x07, 0x01, 0x48, 0x82, 0x80, 0x00, 0x00, 0x06, 0xA6, 0x00, 0x00,
+  0x06, 0x81, 0x00, 0x02, 0x2E, 0x48, 0x01, 0x99, 0x07, 0x8B, 0x01, 0x02, 0x07, 0x01, 0x07, 0x82,
+  0x01, 0x01, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x06, 0x99, 0x00, 0x01, 0x1C,
+  0x5D, 0x80, 0x01, 0x90, 0x07, 0x81, 0x01, 0x85, 0x07, 0x85, 0x01, 0x81, 0x07, 0x83, 0x01, 0x02,
+  0x07, 0x9B, 0x06, 0xAE, 0x00, 0x06, 0x06, 0x19, 0x00, 0xA5, 0x3F, 0x07, 0x01, 0x8E, 0x07, 0x02,
+  0x16, 0x2C, 0xB6, 0x81, 0x01, 0x87, 0x07, 0x80, 0x01, 0x00, 0x07, 0x85, 0x01, 0x02, 0x32, 0x76,
+  0x06, 0xAF, 0x00, 0x08, 0x06, 0x00, 0x06, 0x00, 0x06, 0x83, 0x3C, 0x07, 0x01, 0x87, 0x07, 0x80,
+  0x01, 0x08, 0x07, 0x2D, 0x52, 0x19, 0x06, 0x19, 0xE2, 0x3D, 0x48, 0x81, 0x01, 0x83, 0x07, 0x00,
+  0x01, 0x80, 0x07, 0x84, 0x01, 0x02, 0x16, 0x60, 0xA5, 0x80, 0x00, 0x00, 0x06, 0xA2, 0x00, 0x00,
+  0x06, 0x8E, 0x00, 0x03, 0x06, 0x1C, 0x70, 0x16, 0x83, 0x01, 0x00, 0x07, 0x80, 0x01, 0x04, 0x07,
+  0x48, 0x9B, 0x1F, 0x06, 0x84, 0x00, 0x02, 0x06, 0x83, 0xBB, 0x83, 0x01, 0x00, 0x07, 0x85, 0x01,
+  0x02, 0x16, 0x98, 0x1F, 0xB6, 0x00, 0x00, 0x06, 0x81, 0x00, 0x0B, 0x06, 0x1C, 0x33, 0x70, 0x32,
+  0xBB, 0x2C, 0x32, 0x2D, 0x98, 0x52, 0x06, 0x89, 0x00, 0x03, 0x06, 0xDD, 0x4F, 0x16, 0x86, 0x01,
+  0x05, 0x48, 0x3D, 0x1B, 0x00, 0x06, 0x39, 0xB6, 0x00, 0x00, 0x06, 0x80, 0x00, 0x80, 0x06, 0x80,
+  0x00, 0x83, 0x06, 0x89, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x06, 0x80, 0x00, 0x09, 0x1B, 0x33,
+  0x6F, 0x90, 0xB6, 0x48, 0x5D, 0x3D, 0x82, 0x19, 0x82, 0x00, 0x00, 0x06, 0x87, 0x00, 0x00, 0x06,
+  0xCB, 0x00, 0x83, 0x06, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x06, 0x8C, 0x00,
+  0x00, 0x06, 0xFF, 0x00, 0xC6, 0x00, 0x84, 0x21, 0xA8, 0x00, 0x00, 0x19, 0x82, 0x21, 0x88, 0x00,
+  0x00, 0x06, 0x8C, 0x00, 0x00, 0x06, 0x92, 0x00, 0x00, 0x19, 0x84, 0xFF, 0x01, 0xEC, 0x18, 0xA4,
+  0x00, 0x02, 0x06, 0x54, 0xA9, 0x82, 0xFF, 0x01, 0x4B, 0x18, 0x8C, 0x00, 0x00, 0x06, 0x9A, 0x00,
+  0x01, 0x18, 0x62, 0x84, 0xFF, 0x02, 0x35, 0x67, 0x06, 0xA4, 0x00, 0x01, 0x54, 0x42, 0x82, 0xFF,
+  0x01, 0x9A, 0x85, 0xA5, 0x00, 0x00, 0x06, 0x81, 0x00, 0x01, 0x15, 0x4D, 0x85, 0xFF, 0x01, 0xD2,
+  0x06, 0x8F, 0x00, 0x00, 0x06, 0x88, 0x00, 0x00, 0x06, 0x87, 0x00, 0x01, 0x54, 0x42, 0x82, 0xFF,
+  0x01, 0x26, 0x15, 0xA9, 0x00, 0x00, 0x77, 0x86, 0xFF, 0x01, 0x4C, 0x18, 0x83, 0x00, 0x01, 0x06,
+  0x18, 0x82, 0x00, 0x01, 0x06, 0x00, 0x81, 0x18, 0x81, 0x00, 0x00, 0x06, 0x85, 0x00, 0x00, 0x06,
+  0x80, 0x00, 0x80, 0x18, 0x00, 0x39, 0x81, 0x00, 0x03, 0x06, 0x00, 0x54, 0x42, 0x82, 0xFF, 0x01,
+  0x26, 0x15, 0x80, 0x00, 0x80, 0x06, 0x80, 0x00, 0x83, 0x18, 0x9D, 0x00, 0x01, 0x54, 0x8A, 0x82,
+  0xFF, 0x00, 0xFD, 0x81, 0xFF, 0x02, 0xFD, 0x81, 0x06, 0x83, 0x00, 0x82, 0x1C, 0x07, 0x06, 0x54,
+  0x15, 0xEE, 0x4B, 0x4A, 0x1F, 0x54, 0x82, 0x00, 0x00, 0x19, 0x82, 0x1C, 0x08, 0x06, 0x54, 0x19,
+  0x4A, 0x4B, 0xEF, 0x21, 0x18, 0x06, 0x80, 0x00, 0x01, 0x54, 0x42, 0x82, 0xFF, 0x02, 0x26, 0x15,
+  0x00, 0x80, 0x06, 0x03, 0x00, 0x54, 0x21, 0xEE, 0x80, 0x4B, 0x04, 0x4A, 0x6A, 0x85, 0x54, 0x39,
+  0x9A, 0x00, 0x00, 0x85, 0x82, 0xFF, 0x01, 0x78, 0x3A, 0x82, 0xFF, 0x00, 0x7D, 0x83, 0x00, 0x00,
+  0x87, 0x82, 0xFF, 0x01, 0xED, 0xEB, 0x83, 0xFF, 0x01, 0x8A, 0x15, 0x80, 0x00, 0x01, 0x15, 0xF9,
+  0x82, 0xFF, 0x01, 0xA0, 0xF9, 0x83, 0xFF, 0x01, 0x4A, 0x15, 0x80, 0x00, 0x01, 0x54, 0x42, 0x82,
+  0xFF, 0x06, 0x26, 0x15, 0x00, 0x06, 0x18, 0x19, 0x42, 0x85, 0xFF, 0x02, 0xFC, 0x19, 0x18, 0x98,
+  0x00, 0x01, 0x18, 0x4A, 0x82, 0xFF, 0x01, 0xA3, 0x7D, 0x82, 0xFF, 0x01, 0x6B, 0x29, 0x81, 0x00,
+  0x01, 0x18, 0x87, 0x82, 0xFF, 0x00, 0x6C, 0x85, 0xFF, 0x04, 0x8A, 0x29, 0x00, 0x18, 0x62, 0x82,
+  0xFF, 0x00, 0x6C, 0x85, 0xFF, 0x04, 0xEF, 0x18, 0x06, 0x54, 0x42, 0x82, 0xFF, 0x04, 0x26, 0x15,
+  0x06, 0x18, 0x55, 0x89, 0xFF, 0x01, 0x40, 0x18, 0x96, 0x00, 0x02, 0x06, 0x29, 0x43, 0x82, 0xFF,
+  0x01, 0x45, 0x61, 0x83, 0xFF, 0x00, 0x38, 0x81, 0x00, 0x01, 0x18, 0x87, 0x8B, 0xFF, 0x00, 0xA4,
+  0x80, 0x18, 0x00, 0x62, 0x8B, 0xFF, 0x03, 0x61, 0x00, 0x54, 0x42, 0x82, 0xFF, 0x03, 0x26, 0x15,
+  0x00, 0x21, 0x83, 0xFF, 0x02, 0x35, 0xF4, 0x8B, 0x83, 0xFF, 0x00, 0x85, 0x97, 0x00, 0x00, 0x19,
+  0x82, 0xFF, 0x03, 0x4D, 0x36, 0x00, 0xAA, 0x82, 0xFF, 0x00, 0xE5, 0x82, 0x00, 0x00, 0x87, 0x83,
+  0xFF, 0x00, 0xFE, 0x80, 0x99, 0x00, 0xFE, 0x82, 0xFF, 0x03, 0x6B, 0x15, 0x18, 0x28, 0x83, 0xFF,
+  0x02, 0x89, 0xCD, 0xE1, 0x83, 0xFF, 0x03, 0xE3, 0x00, 0x54, 0x42, 0x82, 0xFF, 0x03, 0x26, 0x15,
+  0x54, 0xF9, 0x82, 0xFF, 0x04, 0xA8, 0x63, 0x51, 0x96, 0x89, 0x82, 0xFF, 0x00, 0xEA, 0x96, 0x00,
+  0x01, 0x18, 0x62, 0x82, 0xFF, 0x03, 0x3A, 0x25, 0x18, 0x4B, 0x82, 0xFF, 0x01, 0x3B, 0x67, 0x80,
+  0x06, 0x01, 0x00, 0x87, 0x83, 0xFF, 0x03, 0x30, 0x51, 0x15, 0xA4, 0x82, 0xFF, 0x03, 0x4D, 0x51,
+  0x18, 0x28, 0x82, 0xFF, 0x04, 0x22, 0x63, 0x49, 0x29, 0xF1, 0x82, 0xFF, 0x03, 0x6B, 0x85, 0x54,
+  0x42, 0x82, 0xFF, 0x03, 0x26, 0x15, 0x29, 0x4D, 0x82, 0xFF, 0x04, 0x63, 0x61, 0x18, 0x54, 0x75,
+  0x82, 0xFF, 0x01, 0x8B, 0x67, 0x95, 0x00, 0x01, 0x15, 0x4D, 0x82, 0xFF, 0x03, 0x45, 0x97, 0x85,
+  0x69, 0x83, 0xFF, 0x04, 0xD4, 0x00, 0x06, 0x18, 0x87, 0x82, 0xFF, 0x04, 0xFE, 0x36, 0x06, 0x00,
+  0x29, 0x83, 0xFF, 0x02, 0xCC, 0x18, 0x28, 0x82, 0xFF, 0x04, 0x3A, 0x51, 0x06, 0x00, 0x77, 0x82,
+  0xFF, 0x03, 0x35, 0x38, 0x54, 0x42, 0x82, 0xFF, 0x02, 0x26, 0x15, 0x85, 0x83, 0xFF, 0x00, 0x57,
+  0x81, 0xAB, 0x00, 0x43, 0x82, 0xFF, 0x02, 0xFD, 0x25, 0x06, 0x93, 0x00, 0x01, 0x18, 0x6A, 0x8C,
+  0xFF, 0x01, 0x4C, 0x18, 0x80, 0x00, 0x00, 0x87, 0x82, 0xFF, 0x05, 0x3B, 0x25, 0x06, 0x00, 0x85,
+  0x4D, 0x82, 0xFF, 0x02, 0x93, 0x18, 0x28, 0x82, 0xFF, 0x04, 0xF4, 0x53, 0x06, 0x18, 0xA6, 0x82,
+  0xFF, 0x03, 0x57, 0x25, 0x18, 0x42, 0x82, 0xFF, 0x02, 0x26, 0x15, 0x19, 0x8D, 0xFF, 0x01, 0x50,
+  0x06, 0x93, 0x00, 0x01, 0x54, 0x2F, 0x8C, 0xFF, 0x04, 0x4D, 0x81, 0x06, 0x00, 0x87, 0x83, 0xFF,
+  0x03, 0x20, 0x06, 0x00, 0x15, 0x83, 0xFF, 0x02, 0xCB, 0x18, 0x28, 0x82, 0xFF, 0x04, 0xA7, 0x53,
+  0x06, 0x18, 0x6A, 0x82, 0xFF, 0x03, 0x35, 0x25, 0x18, 0x42, 0x82, 0xFF, 0x00, 0x26, 0x80, 0x15,
+  0x83, 0xFF, 0x00, 0xF5, 0x81, 0x4C, 0x81, 0xF6, 0x04, 0x4C, 0xF6, 0x3A, 0xCB, 0x06, 0x91, 0x00,
+  0x02, 0x06, 0x00, 0x85, 0x8E, 0xFF, 0x00, 0x7D, 0x80, 0x00, 0x00, 0x87, 0x83, 0xFF, 0x00, 0x84,
+  0x80, 0x29, 0x00, 0x4B, 0x83, 0xFF, 0x02, 0x36, 0x18, 0x62, 0x83, 0xFF, 0x03, 0x97, 0x54, 0xDC,
+  0xFC, 0x82, 0xFF, 0x03, 0x6B, 0x51, 0x18, 0x42, 0x82, 0xFF, 0x03, 0x26, 0x15, 0x54, 0x43, 0x82,
+  0xFF, 0x01, 0x93, 0x81, 0x80, 0x38, 0x01, 0x96, 0x25, 0x81, 0x96, 0x01, 0x38, 0x61, 0x80, 0x06,
+  0x91, 0x00, 0x01, 0x18, 0x4B, 0x83, 0xFF, 0x84, 0x22, 0x83, 0xFF, 0x03, 0x6C, 0x29, 0x00, 0x87,
+  0x84, 0xFF, 0x80, 0xFC, 0x83, 0xFF, 0x03, 0x6B, 0x25, 0x18, 0x62, 0x84, 0xFF, 0x01, 0x2F, 0x43,
+  0x83, 0xFF, 0x03, 0x9A, 0x49, 0x18, 0x2F, 0x82, 0xFF, 0x03, 0x26, 0x15, 0x18, 0x4A, 0x82, 0xFF,
+  0x0B, 0x57, 0x21, 0x29, 0x15, 0xAA, 0xFF, 0x4D, 0x43, 0xA9, 0xF2, 0x00, 0x06, 0x89, 0x00, 0x00,
+  0x06, 0x86, 0x00, 0x01, 0x29, 0x43, 0x82, 0xFF, 0x01, 0x35, 0x63, 0x82, 0x24, 0x01, 0x36, 0xA8,
+  0x83, 0xFF, 0x02, 0xD3, 0x00, 0x87, 0x8B, 0xFF, 0x03, 0x45, 0x61, 0x18, 0x28, 0x8A, 0xFF, 0x04,
+  0x4D, 0x63, 0x06, 0x54, 0x42, 0x82, 0xFF, 0x04, 0x26, 0x15, 0x06, 0x15, 0x43, 0x83, 0xFF, 0x00,
+  0xAB, 0x84, 0xFF, 0x02, 0x30, 0x85, 0x06, 0x91, 0x00, 0x01, 0x18, 0x40, 0x83, 0xFF, 0x01, 0xA2,
+  0x81, 0x82, 0x06, 0x01, 0x00, 0xEE, 0x83, 0xFF, 0x02, 0x84, 0x18, 0x87, 0x82, 0xFF, 0x00, 0xFD,
+  0x85, 0xFF, 0x04, 0xE4, 0x36, 0x06, 0x18, 0x28, 0x82, 0xFF, 0x00, 0x22, 0x85, 0xFF, 0x04, 0x45,
+  0x38, 0x06, 0x54, 0x42, 0x82, 0xFF, 0x01, 0xDA, 0x15, 0x80, 0x00, 0x01, 0x21, 0x43, 0x88, 0xFF,
+  0x02, 0x30, 0xD1, 0x06, 0x92, 0x00, 0x02, 0x18, 0xF1, 0x57, 0x81, 0x3B, 0x03, 0x22, 0x30, 0x39,
+  0x06, 0x81, 0x00, 0x02, 0x06, 0x15, 0x43, 0x81, 0x3B, 0x03, 0xFB, 0xF7, 0x67, 0xA6, 0x82, 0xFF,
+  0x02, 0x57, 0x30, 0x89, 0x81, 0xFF, 0x06, 0x3B, 0xCD, 0x36, 0x06, 0x00, 0x18, 0x28, 0x82, 0xFF,
+  0x02, 0xF3, 0x95, 0x78, 0x81, 0xFF, 0x02, 0x6C, 0x30, 0x20, 0x80, 0x06, 0x02, 0x18, 0xF9, 0xFB,
+  0x80, 0x3B, 0x02, 0x22, 0xD6, 0x15, 0x81, 0x00, 0x02, 0x61, 0xE5, 0x35, 0x83, 0xFF, 0x03, 0xFB,
+  0xA3, 0x63, 0xD1, 0x80, 0x06, 0x82, 0x00, 0x00, 0x06, 0x8F, 0x00, 0x01, 0x25, 0x24, 0x81, 0x50,
+  0x01, 0xD1, 0x06, 0x84, 0x00, 0x00, 0x61, 0x83, 0x50, 0x01, 0x49, 0x77, 0x82, 0xFF, 0x04, 0x22,
+  0x25, 0x15, 0x50, 0xCB, 0x80, 0x36, 0x00, 0xD3, 0x80, 0x06, 0x02, 0x00, 0x18, 0x28, 0x82, 0xFF,
+  0x00, 0x3A, 0x80, 0x53, 0x05, 0x24, 0xCB, 0x36, 0x24, 0x97, 0x06, 0x80, 0x00, 0x01, 0x06, 0x18,
+  0x82, 0x50, 0x02, 0x20, 0x00, 0x06, 0x81, 0x00, 0x02, 0x39, 0x38, 0x24, 0x80, 0xCB, 0x05, 0x30,
+  0x36, 0x24, 0xD1, 0x21, 0x06, 0x94, 0x00, 0x01, 0x06, 0x00, 0x84, 0x06, 0x85, 0x00, 0x84, 0x06,
+  0x01, 0x00, 0xA6, 0x82, 0xFF, 0x01, 0x22, 0x20, 0x84, 0x06, 0x04, 0x00, 0x06, 0x00, 0x18, 0x28,
+  0x82, 0xFF, 0x01, 0x3A, 0x49, 0x84, 0x06, 0x83, 0x00, 0x83, 0x06, 0x01, 0x00, 0x06, 0x82, 0x00,
+  0x87, 0x06, 0x9C, 0x00, 0x81, 0x06, 0x85, 0x00, 0x00, 0x06, 0x80, 0x00, 0x02, 0x06, 0x00, 0xA6,
+  0x82, 0xFF, 0x02, 0x22, 0x20, 0x06, 0x84, 0x00, 0x03, 0x06, 0x00, 0x18, 0x28, 0x82, 0xFF, 0x02,
+  0x3A, 0x53, 0x06, 0x83, 0x00, 0x02, 0x06, 0x00, 0x06, 0x84, 0x00, 0x00, 0x06, 0x83, 0x00, 0x80,
+  0x06, 0x97, 0x00, 0x00, 0x06, 0x99, 0x00, 0x00, 0xE8, 0x82, 0xFF, 0x02, 0x22, 0x25, 0x06, 0x86,
+  0x00, 0x01, 0x15, 0x28, 0x82, 0xFF, 0x02, 0x3A, 0x53, 0x06, 0xBC, 0x00, 0x00, 0x06, 0x8A, 0x00,
+  0x07, 0xE8, 0x78, 0xFA, 0xF8, 0x8B, 0xA7, 0x20, 0x06, 0x85, 0x00, 0x03, 0x06, 0x18, 0xF0, 0x35,
+  0x80, 0xF8, 0x03, 0x35, 0xA2, 0x49, 0x06, 0xBC, 0x00, 0x00, 0x06, 0x8B, 0x00, 0x01, 0x53, 0x20,
+  0x80, 0x25, 0x02, 0x20, 0x49, 0x06, 0x85, 0x00, 0x00, 0x06, 0x80, 0x00, 0x06, 0x51, 0x25, 0x20,
+  0x25, 0xD1, 0x85, 0x06, 0xCA, 0x00, 0x84, 0x06, 0x89, 0x00, 0x84, 0x06, 0xFF, 0x00, 0xA4, 0x00,
+  0x00, 0x06, 0x92, 0x00, 0x00, 0x06, 0xA3, 0x00, 0x00, 0x06, 0xF2, 0x00,
+};
+
+GUI_CONST_STORAGE GUI_BITMAP bma_apple_rle = {
+  100, // xSize
+  128, // ySize
+  100, // BytesPerLine
+  8, // BitsPerPixel
+  (const unsigned char *)_acbma_apple_rle,  // Pointer to run-length stream
+  &_Palbma_apple_rle,  // Pointer to palette
+  &LCD_RLE_METHODS_8BPP
+};
+
+/* [] END OF FILE */
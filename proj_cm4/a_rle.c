@@ -0,0 +1,387 @@
+/*
+ * a_rle.c
+ *
+ *  Generated by tools/bmp_rle.py from a.c, do not edit.
+ *  120 x 87 pixels, 10440 bytes raw, 3480 bytes run-length coded.
+ */
+
+#include "GUI.h"
+#include "lcd_rle.h"
+
+#ifndef GUI_CONST_STORAGE
+  #define GUI_CONST_STORAGE const
+#endif
+
+static GUI_CONST_STORAGE GUI_COLOR _Colorsa[] = {
+#if (GUI_USE_ARGB == 0)
+  0xBA3385, 0xCACB00, 0xCBD200, 0xD239AB,
+  0xCB37A4, 0xC53699, 0x96297B, 0xB82A8A,
+  0xB63296, 0x977508, 0xA52D88, 0x776A06,
+  0x877305, 0xD537B3, 0x8B2673, 0xC6C803,
+  0xD1D303, 0x866C08, 0x6A6704, 0x9B2A82,
+  0x84246C, 0x797403, 0xB5387B, 0xB92B93,
+  0xC0348B, 0xC62CA4, 0xD2D20A, 0x792164,
+  0xA7A608, 0xC59439, 0xCCA130, 0xB7B508,
+  0xA17708, 0xAB318C, 0x898603, 0xC9B716,
+  0xC8A626, 0xD9DC0C, 0xA82794, 0x979603,
+  0xD5935B, 0xFEFE2B, 0xAD3091, 0xB2297C,
+  0x988808, 0xFEFE3B, 0xB44668, 0xC49827,
+  0x866718, 0xA69708, 0xD2CC0D, 0xD1D901,
+  0xAC2978, 0xA69814, 0xD79964, 0x665B06,
+  0x786712, 0xAC376A, 0xAA3674, 0xA84859,
+  0xB45554, 0xB8A70C, 0xA56927, 0xB97737,
+  0xA55748, 0xB66446, 0xBD9135, 0xD2BB19,
+  0xCBCC0C, 0xD2C313, 0xB14959, 0xB3594A,
+  0xA94567, 0xC22D94, 0xC8AC1C, 0xCDD20A,
+  0xCCD900, 0xD2C911, 0x721E5D, 0x936D08,
+  0x976C16, 0xA57313, 0x9A5246, 0x978713,
+  0xCBCA11, 0x945A36, 0x867712, 0xB36939,
+  0xB84874, 0xBB2CA1, 0xC54588, 0xD141A4,
+  0xB6B312, 0xD6D811, 0x78196C, 0x986425,
+  0xC94295, 0xA5880A, 0xAAB104, 0xC4BA0C,
+  0xC98449, 0xCBC313, 0xD6DA0E, 0xFCFC34,
+  0x895D2B, 0xAB5654, 0xBA7747, 0xC57C4A,
+  0xC1666B, 0xCE36B0, 0xCE40A3, 0xBA862C,
+  0xB78434, 0xABA510, 0xB4A613, 0xC58937,
+  0xFCFE23, 0xFDFF43, 0x6E1C5A, 0xB0346B,
+  0xA25E38, 0x9D4D52, 0xB96456, 0xC45775,
+  0xC26A55, 0xBF33A3, 0xB3980C, 0xB69D19,
+  0xAE9224, 0xC6D000, 0xD4D512, 0xFDFE4B,
+  0xFFFD58, 0x7A1971, 0x7E8000, 0x841B76,
+  0x9B3272, 0xAB3D5C, 0x8D5936, 0x856123,
+  0x986434, 0xA9683C, 0xA27D2A, 0x8D4848,
+  0xAD5665, 0xB95567, 0xA66B44, 0xBD606A,
+  0xBC637D, 0xC24B79, 0xC5576E, 0xC67355,
+  0xB54580, 0xC12D88, 0x8E9000, 0x9EA100,
+  0xBB922E, 0xBAC400, 0xC08E2A, 0xC7CB12,
+  0xCED112, 0xD8DB13, 0xFDFF16, 0xEBCD72,
+  0xFEFF6A, 0xFEFF8D, 0x773248, 0x5C4F00,
+  0x735E0E, 0x765B16, 0x687200, 0x993B5D,
+  0x983A60, 0xAA2D68, 0x925F2A, 0xA66E17,
+  0xAF7439, 0xA64F4F, 0xBB5178, 0xC16D4E,
+  0x8F2180, 0xC72DB0, 0xDA32C3, 0xC95884,
+  0xD7449E, 0xC26C99, 0x8D8014, 0xA18F16,
+  0xAA852B, 0xBD8042, 0xD09C32, 0xC8B429,
+  0xD7AB3E, 0xD2B521, 0xE1BD34, 0xC9934C,
+  0xD18E5F, 0xCB8163, 0xD1816C, 0xDCA065,
+  0xE3AF4F, 0xE8B556, 0xE5AA71, 0xE0B965,
+  0xC7D008, 0xC7D800, 0xC5D510, 0xD2C20F,
+  0xD1C118, 0xD9D109, 0xD6D71E, 0xDEDD19,
+  0xCCD52F, 0xCFDC23, 0xD5C523, 0xD8CD28,
+  0xD6D825, 0xDBDD25, 0xD9DE33, 0xDEE910,
+  0xE0DE39, 0xE3E507, 0xE3E40B, 0xE4E90A,
+  0xE2E515, 0xE1E418, 0xFCFF0A, 0xFBFC1B,
+  0xEEEE3B, 0xE4CF68, 0xEACD7E, 0xE5F053,
+  0xFFE749, 0xFFEE44, 0xF9E156, 0xE7E566,
+  0xF8E167, 0xF9E073, 0xFFFF77, 0xFEFF7E,
+  0xCF9691, 0xD79688, 0xD49DA1, 0xD4A29F,
+  0xE2B885, 0xE5BFA1, 0xE6C1AF, 0xF7E285,
+  0xF6E491, 0xFFFF81, 0xF4F396, 0xFCE8A0,
+  0xFFFFA3, 0xFFFFA9, 0xFFFFB2, 0xFFFFC4
+#else
+  0xFF8533BA, 0xFF00CBCA, 0xFF00D2CB, 0xFFAB39D2,
+  0xFFA437CB, 0xFF9936C5, 0xFF7B2996, 0xFF8A2AB8,
+  0xFF9632B6, 0xFF087597, 0xFF882DA5, 0xFF066A77,
+  0xFF057387, 0xFFB337D5, 0xFF73268B, 0xFF03C8C6,
+  0xFF03D3D1, 0xFF086C86, 0xFF04676A, 0xFF822A9B,
+  0xFF6C2484, 0xFF037479, 0xFF7B38B5, 0xFF932BB9,
+  0xFF8B34C0, 0xFFA42CC6, 0xFF0AD2D2, 0xFF642179,
+  0xFF08A6A7, 0xFF3994C5, 0xFF30A1CC, 0xFF08B5B7,
+  0xFF0877A1, 0xFF8C31AB, 0xFF038689, 0xFF16B7C9,
+  0xFF26A6C8, 0xFF0CDCD9, 0xFF9427A8, 0xFF039697,
+  0xFF5B93D5, 0xFF2BFEFE, 0xFF9130AD, 0xFF7C29B2,
+  0xFF088898, 0xFF3BFEFE, 0xFF6846B4, 0xFF2798C4,
+  0xFF186786, 0xFF0897A6, 0xFF0DCCD2, 0xFF01D9D1,
+  0xFF7829AC, 0xFF1498A6, 0xFF6499D7, 0xFF065B66,
+  0xFF126778, 0xFF6A37AC, 0xFF7436AA, 0xFF5948A8,
+  0xFF5455B4, 0xFF0CA7B8, 0xFF2769A5, 0xFF3777B9,
+  0xFF4857A5, 0xFF4664B6, 0xFF3591BD, 0xFF19BBD2,
+  0xFF0CCCCB, 0xFF13C3D2, 0xFF5949B1, 0xFF4A59B3,
+  0xFF6745A9, 0xFF942DC2, 0xFF1CACC8, 0xFF0AD2CD,
+  0xFF00D9CC, 0xFF11C9D2, 0xFF5D1E72, 0xFF086D93,
+  0xFF166C97, 0xFF1373A5, 0xFF46529A, 0xFF138797,
+  0xFF11CACB, 0xFF365A94, 0xFF127786, 0xFF3969B3,
+  0xFF7448B8, 0xFFA12CBB, 0xFF8845C5, 0xFFA441D1,
+  0xFF12B3B6, 0xFF11D8D6, 0xFF6C1978, 0xFF256498,
+  0xFF9542C9, 0xFF0A88A5, 0xFF04B1AA, 0xFF0CBAC4,
+  0xFF4984C9, 0xFF13C3CB, 0xFF0EDAD6, 0xFF34FCFC,
+  0xFF2B5D89, 0xFF5456AB, 0xFF4777BA, 0xFF4A7CC5,
+  0xFF6B66C1, 0xFFB036CE, 0xFFA340CE, 0xFF2C86BA,
+  0xFF3484B7, 0xFF10A5AB, 0xFF13A6B4, 0xFF3789C5,
+  0xFF23FEFC, 0xFF43FFFD, 0xFF5A1C6E, 0xFF6B34B0,
+  0xFF385EA2, 0xFF524D9D, 0xFF5664B9, 0xFF7557C4,
+  0xFF556AC2, 0xFFA333BF, 0xFF0C98B3, 0xFF199DB6,
+  0xFF2492AE, 0xFF00D0C6, 0xFF12D5D4, 0xFF4BFEFD,
+  0xFF58FDFF, 0xFF71197A, 0xFF00807E, 0xFF761B84,
+  0xFF72329B, 0xFF5C3DAB, 0xFF36598D, 0xFF236185,
+  0xFF346498, 0xFF3C68A9, 0xFF2A7DA2, 0xFF48488D,
+  0xFF6556AD, 0xFF6755B9, 0xFF446BA6, 0xFF6A60BD,
+  0xFF7D63BC, 0xFF794BC2, 0xFF6E57C5, 0xFF5573C6,
+  0xFF8045B5, 0xFF882DC1, 0xFF00908E, 0xFF00A19E,
+  0xFF2E92BB, 0xFF00C4BA, 0xFF2A8EC0, 0xFF12CBC7,
+  0xFF12D1CE, 0xFF13DBD8, 0xFF16FFFD, 0xFF72CDEB,
+  0xFF6AFFFE, 0xFF8DFFFE, 0xFF483277, 0xFF004F5C,
+  0xFF0E5E73, 0xFF165B76, 0xFF007268, 0xFF5D3B99,
+  0xFF603A98, 0xFF682DAA, 0xFF2A5F92, 0xFF176EA6,
+  0xFF3974AF, 0xFF4F4FA6, 0xFF7851BB, 0xFF4E6DC1,
+  0xFF80218F, 0xFFB02DC7, 0xFFC332DA, 0xFF8458C9,
+  0xFF9E44D7, 0xFF996CC2, 0xFF14808D, 0xFF168FA1,
+  0xFF2B85AA, 0xFF4280BD, 0xFF329CD0, 0xFF29B4C8,
+  0xFF3EABD7, 0xFF21B5D2, 0xFF34BDE1, 0xFF4C93C9,
+  0xFF5F8ED1, 0xFF6381CB, 0xFF6C81D1, 0xFF65A0DC,
+  0xFF4FAFE3, 0xFF56B5E8, 0xFF71AAE5, 0xFF65B9E0,
+  0xFF08D0C7, 0xFF00D8C7, 0xFF10D5C5, 0xFF0FC2D2,
+  0xFF18C1D1, 0xFF09D1D9, 0xFF1ED7D6, 0xFF19DDDE,
+  0xFF2FD5CC, 0xFF23DCCF, 0xFF23C5D5, 0xFF28CDD8,
+  0xFF25D8D6, 0xFF25DDDB, 0xFF33DED9, 0xFF10E9DE,
+  0xFF39DEE0, 0xFF07E5E3, 0xFF0BE4E3, 0xFF0AE9E4,
+  0xFF15E5E2, 0xFF18E4E1, 0xFF0AFFFC, 0xFF1BFCFB,
+  0xFF3BEEEE, 0xFF68CFE4, 0xFF7ECDEA, 0xFF53F0E5,
+  0xFF49E7FF, 0xFF44EEFF, 0xFF56E1F9, 0xFF66E5E7,
+  0xFF67E1F8, 0xFF73E0F9, 0xFF77FFFF, 0xFF7EFFFE,
+  0xFF9196CF, 0xFF8896D7, 0xFFA19DD4, 0xFF9FA2D4,
+  0xFF85B8E2, 0xFFA1BFE5, 0xFFAFC1E6, 0xFF85E2F7,
+  0xFF91E4F6, 0xFF81FFFF, 0xFF96F3F4, 0xFFA0E8FC,
+  0xFFA3FFFF, 0xFFA9FFFF, 0xFFB2FFFF, 0xFFC4FFFF
+#endif
+
+};
+
+static GUI_CONST_STORAGE GUI_LOGPALETTE _Palbma_rle = {
+  256,  // Number of entries
+  0,    // No transparency
+  (const LCD_COLOR *)&_Colorsa[0]
+};
+
+static GUI_CONST_STORAGE unsigned char _acbma_rle[] = {
+  0xE8, 0x00, 0x00, 0x18, 0xFF, 0x00, 0xFF, 0x00, 0x9B, 0x00, 0x00, 0x18, 0x8E, 0x07, 0xE3, 0x00,
+  0x03, 0x18, 0x07, 0xAD, 0xC6, 0x8A, 0x36, 0x02, 0xC7, 0xCA, 0x6C, 0xE2, 0x00, 0x07, 0x18, 0x3A,
+  0xC5, 0x84, 0x2D, 0x75, 0x2D, 0x75, 0x86, 0x2D, 0x04, 0x75, 0xDA, 0x22, 0xA8, 0x16, 0xE0, 0x00,
+  0x08, 0x18, 0x39, 0xC2, 0xDB, 0x66, 0x5D, 0x66, 0x5D, 0x66, 0x84, 0x5D, 0x07, 0x66, 0xA1, 0x2C,
+  0x37, 0x0B, 0xAA, 0x79, 0x18, 0xDF, 0x00, 0x02, 0x17, 0x41, 0x33, 0x8B, 0x01, 0x02, 0x81, 0x71,
+  0x12, 0x80, 0x0B, 0x00, 0x8B, 0xE0, 0x00, 0x02, 0x2B, 0x4A, 0x02, 0x8C, 0x01, 0x00, 0x54, 0x82,
+  0x0B, 0x01, 0x39, 0x18, 0xDD, 0x00, 0x02, 0x18, 0x46, 0x1A, 0x8D, 0x01, 0x02, 0x10, 0xBB, 0xA8,
+  0x80, 0x0B, 0x01, 0x52, 0x18, 0xDD, 0x00, 0x02, 0x07, 0x6F, 0x4C, 0x8D, 0x01, 0x01, 0x02, 0x63,
+  0x81, 0x0B, 0x02, 0x8B, 0x16, 0x18, 0xDB, 0x00, 0x03, 0x18, 0x77, 0xD0, 0x02, 0x8E, 0x01, 0x02,
+  0x1A, 0x0C, 0x38, 0x80, 0x0B, 0x01, 0x48, 0x18, 0xDB, 0x00, 0x03, 0x07, 0x41, 0x10, 0x81, 0x8E,
+  0x01, 0x02, 0x10, 0x71, 0xA8, 0x80, 0x0B, 0x00, 0x8A, 0xDC, 0x00, 0x02, 0x2B, 0x24, 0x02, 0x90,
+  0x01, 0x00, 0x54, 0x81, 0x0B, 0x03, 0x11, 0x3A, 0x00, 0x18, 0xD8, 0x00, 0x03, 0x18, 0x89, 0x1A,
+  0x81, 0x90, 0x01, 0x01, 0x10, 0x2C, 0x80, 0x0B, 0x02, 0x15, 0x52, 0x18, 0xD9, 0x00, 0x02, 0x17,
+  0x70, 0x10, 0x91, 0x01, 0x01, 0x02, 0x5C, 0x80, 0x0B, 0x01, 0x15, 0x30, 0xD9, 0x00, 0x03, 0x18,
+  0x34, 0x43, 0x02, 0x92, 0x01, 0x06, 0x4B, 0x0C, 0x0B, 0x15, 0x11, 0x48, 0x18, 0xD7, 0x00, 0x02,
+  0x17, 0x47, 0x1A, 0x93, 0x01, 0x06, 0x02, 0x71, 0x0B, 0x11, 0x15, 0x55, 0x18, 0xD7, 0x00, 0x02,
+  0x07, 0x2F, 0x02, 0x93, 0x01, 0x06, 0x02, 0x54, 0x0B, 0x11, 0x15, 0x11, 0x16, 0xD6, 0x00, 0x03,
+  0x17, 0x89, 0x32, 0x81, 0x94, 0x01, 0x02, 0x4B, 0x2C, 0x38, 0x80, 0x15, 0x01, 0x79, 0x18, 0xD5,
+  0x00, 0x02, 0x17, 0x3F, 0x4C, 0x95, 0x01, 0x07, 0x02, 0x5C, 0x0B, 0x11, 0x15, 0x8B, 0x00, 0x07,
+  0xD4, 0x00, 0x02, 0x2B, 0x23, 0x02, 0x96, 0x01, 0x01, 0x1A, 0x15, 0x80, 0x11, 0x02, 0x15, 0x48,
+  0x18, 0xD3, 0x00, 0x02, 0x99, 0x46, 0x1A, 0x97, 0x01, 0x05, 0x10, 0x35, 0x0B, 0x11, 0x15, 0x52,
+  0xD4, 0x00, 0x02, 0x07, 0x9E, 0xCD, 0x98, 0x01, 0x05, 0x65, 0x0B, 0x11, 0x15, 0x30, 0x16, 0xD2,
+  0x00, 0x03, 0x07, 0x39, 0x4D, 0x81, 0x98, 0x01, 0x01, 0x1A, 0x22, 0x80, 0x11, 0x02, 0x15, 0x3B,
+  0x18, 0xD1, 0x00, 0x02, 0x07, 0x41, 0x4C, 0x99, 0x01, 0x05, 0x02, 0x72, 0x0B, 0x0C, 0x15, 0xAE,
+  0xD2, 0x00, 0x02, 0x2B, 0x4A, 0x02, 0x9A, 0x01, 0x00, 0xA0, 0x80, 0x11, 0x03, 0x15, 0x11, 0x2E,
+  0x99, 0xCF, 0x00, 0x02, 0x17, 0x3B, 0xD1, 0x8B, 0x01, 0x02, 0x02, 0x31, 0x0F, 0x8B, 0x01, 0x01,
+  0x10, 0x31, 0x80, 0x11, 0x02, 0x0C, 0x52, 0x18, 0xCF, 0x00, 0x02, 0x17, 0x6F, 0x02, 0x8B, 0x01,
+  0x03, 0xA0, 0x0B, 0x1C, 0x02, 0x8A, 0x01, 0x05, 0x02, 0x63, 0x0B, 0x11, 0x0C, 0x30, 0xCF, 0x00,
+  0x03, 0x07, 0x77, 0x45, 0x81, 0x8B, 0x01, 0x03, 0x5C, 0x37, 0x15, 0x10, 0x8B, 0x01, 0x01, 0x4B,
+  0x22, 0x80, 0x11, 0x02, 0x0C, 0x3B, 0x18, 0xCD, 0x00, 0x02, 0x17, 0x41, 0x10, 0x8B, 0x01, 0x05,
+  0x10, 0x22, 0x12, 0xA8, 0x63, 0x02, 0x8A, 0x01, 0x05, 0x02, 0x71, 0x0B, 0x11, 0x15, 0x55, 0xCE,
+  0x00, 0x02, 0x2B, 0x24, 0x02, 0x8B, 0x01, 0x00, 0x9F, 0x80, 0x12, 0x02, 0x8F, 0xB0, 0x4C, 0x8B,
+  0x01, 0x00, 0x54, 0x80, 0x11, 0x02, 0x0C, 0x30, 0x16, 0xCC, 0x00, 0x03, 0x07, 0x89, 0xD1, 0x81,
+  0x8A, 0x01, 0x03, 0x10, 0x1C, 0x12, 0x0B, 0x80, 0x39, 0x00, 0x44, 0x8B, 0x01, 0x01, 0x4B, 0x2C,
+  0x80, 0x11, 0x02, 0x15, 0xB1, 0x99, 0xCB, 0x00, 0x02, 0x07, 0x3F, 0x10, 0x8B, 0x01, 0x07, 0x4B,
+  0x15, 0x12, 0x8B, 0x18, 0x07, 0x2F, 0x02, 0x8A, 0x01, 0x06, 0x02, 0x63, 0x0B, 0x11, 0x15, 0x5F,
+  0x16, 0xCA, 0x00, 0x03, 0x07, 0x34, 0x43, 0x81, 0x8A, 0x01, 0x08, 0x02, 0x5C, 0x12, 0xAA, 0x79,
+  0x18, 0x07, 0x47, 0x1A, 0x8B, 0x01, 0x01, 0x1A, 0x0C, 0x80, 0x11, 0x01, 0x0C, 0x48, 0xCA, 0x00,
+  0x02, 0x07, 0x3C, 0x33, 0x8B, 0x01, 0x04, 0x1A, 0x22, 0x0B, 0x38, 0x3A, 0x80, 0x18, 0x02, 0x2B,
+  0x23, 0x02, 0x8A, 0x01, 0x01, 0x02, 0x71, 0x80, 0x11, 0x03, 0x0C, 0x78, 0x00, 0x07, 0xC8, 0x00,
+  0x02, 0x07, 0x2F, 0x02, 0x8B, 0x01, 0x00, 0x54, 0x80, 0x0B, 0x00, 0x8A, 0x81, 0x00, 0x02, 0x07,
+  0x3F, 0x02, 0x8B, 0x01, 0x00, 0x54, 0x80, 0x11, 0x02, 0x0C, 0x50, 0x16, 0xC8, 0x00, 0x03, 0x07,
+  0x39, 0x32, 0x81, 0x8A, 0x01, 0x05, 0x10, 0x71, 0x0B, 0x11, 0x48, 0x99, 0x80, 0x00, 0x03, 0x18,
+  0x89, 0x1A, 0x81, 0x8A, 0x01, 0x02, 0x1A, 0x2C, 0x11, 0x80, 0x0C, 0x01, 0xB1, 0x17, 0xC6, 0x00,
+  0x03, 0x99, 0x07, 0x3F, 0x10, 0x8B, 0x01, 0x03, 0x1A, 0x0C, 0x15, 0x5F, 0x83, 0x00, 0x02, 0x07,
+  0x2F, 0x02, 0x8A, 0x01, 0x01, 0x02, 0x5C, 0x80, 0x11, 0x01, 0x0C, 0x5F, 0xC8, 0x00, 0x02, 0x2B,
+  0xC1, 0x02, 0x8A, 0x01, 0x05, 0x02, 0x5C, 0x11, 0x0C, 0xB1, 0x18, 0x82, 0x00, 0x02, 0x49, 0x47,
+  0x33, 0x8B, 0x01, 0x00, 0x4B, 0x80, 0x0C, 0x02, 0x11, 0x4F, 0x2E, 0xC6, 0x00, 0x02, 0x17, 0x3C,
+  0x1A, 0x8B, 0x01, 0x05, 0x10, 0x61, 0x0C, 0x4F, 0x16, 0x18, 0x82, 0x00, 0x03, 0x18, 0x77, 0x43,
+  0x02, 0x8A, 0x01, 0x01, 0x02, 0x35, 0x80, 0x11, 0x02, 0x0C, 0x40, 0x18, 0xC5, 0x00, 0x02, 0x17,
+  0x9E, 0x02, 0x8A, 0x01, 0x05, 0x02, 0x4D, 0x11, 0x0C, 0x78, 0x17, 0x84, 0x00, 0x02, 0x17, 0x70,
+  0x4C, 0x8A, 0x01, 0x07, 0x02, 0x65, 0x11, 0x4F, 0x0C, 0x50, 0x16, 0x18, 0xC3, 0x00, 0x03, 0x18,
+  0x77, 0x4D, 0x81, 0x8A, 0x01, 0x05, 0x02, 0x3D, 0x11, 0x09, 0x2E, 0x18, 0x84, 0x00, 0x03, 0x18,
+  0x46, 0x1A, 0x81, 0x8A, 0x01, 0x02, 0x1A, 0x2C, 0x4F, 0x80, 0x0C, 0x01, 0x3B, 0x49, 0x9C, 0x00,
+  0x81, 0x18, 0xA2, 0x00, 0x02, 0x17, 0x57, 0x10, 0x8B, 0x01, 0x05, 0x32, 0x20, 0x09, 0x3E, 0x00,
+  0x18, 0x85, 0x00, 0x02, 0x2B, 0x24, 0x02, 0x8A, 0x01, 0x02, 0x02, 0x3D, 0x11, 0x80, 0x0C, 0x00,
+  0x8C, 0x98, 0x00, 0x00, 0x99, 0x80, 0x07, 0x82, 0x2B, 0x81, 0x07, 0x00, 0x99, 0x85, 0x00, 0x80,
+  0x18, 0x96, 0x00, 0x02, 0x07, 0x4A, 0x02, 0x8A, 0x01, 0x05, 0x02, 0x63, 0x09, 0x20, 0x69, 0x18,
+  0x86, 0x00, 0x02, 0x17, 0x41, 0x33, 0x8B, 0x01, 0x06, 0x32, 0x0C, 0x4F, 0x0C, 0x4F, 0x58, 0x18,
+  0x93, 0x00, 0x07, 0x18, 0x99, 0x2B, 0x34, 0x94, 0xF1, 0xF4, 0xE6, 0x80, 0xA3, 0x05, 0xCB, 0x36,
+  0x6C, 0x16, 0x07, 0x17, 0x81, 0x00, 0x01, 0x2B, 0x34, 0x85, 0x2B, 0x01, 0x00, 0x18, 0x8E, 0x00,
+  0x02, 0x49, 0x46, 0x1A, 0x8B, 0x01, 0x04, 0x10, 0x7E, 0x09, 0x51, 0x16, 0x87, 0x00, 0x03, 0x18,
+  0x77, 0x45, 0x81, 0x8A, 0x01, 0x02, 0x4B, 0x31, 0x11, 0x80, 0x0C, 0x01, 0x40, 0x18, 0x91, 0x00,
+  0x80, 0x07, 0x0B, 0x34, 0xB9, 0xF6, 0xFE, 0xFC, 0xA5, 0xF9, 0xEE, 0xA4, 0x84, 0x83, 0x75, 0x80,
+  0x2D, 0x01, 0xC9, 0x58, 0x80, 0x07, 0x0B, 0x3A, 0xF5, 0xFB, 0xF8, 0xF7, 0xED, 0xEC, 0xEA, 0xE8,
+  0xE9, 0x70, 0x16, 0x8E, 0x00, 0x02, 0x07, 0x73, 0x02, 0x8B, 0x01, 0x04, 0x4D, 0x09, 0x20, 0x57,
+  0x07, 0x87, 0x00, 0x03, 0x18, 0x17, 0x6F, 0x02, 0x8B, 0x01, 0x01, 0x63, 0x11, 0x80, 0x0C, 0x02,
+  0x50, 0x00, 0x18, 0x8E, 0x00, 0x21, 0x99, 0x07, 0x21, 0xF2, 0xFA, 0xE7, 0xD5, 0x9F, 0x44, 0x0F,
+  0x44, 0xA0, 0xD9, 0xE4, 0x83, 0x75, 0x67, 0x74, 0xA2, 0x74, 0xC8, 0xF3, 0xFF, 0xFD, 0xA5, 0xEF,
+  0xA4, 0x84, 0x83, 0x2D, 0xD4, 0xAA, 0x37, 0x16, 0x8D, 0x00, 0x03, 0x18, 0x77, 0xD0, 0x81, 0x8A,
+  0x01, 0x01, 0x02, 0x3D, 0x80, 0x20, 0x00, 0x2E, 0x80, 0x18, 0x87, 0x00, 0x03, 0x18, 0x46, 0x1A,
+  0x02, 0x8A, 0x01, 0x01, 0x1A, 0x09, 0x81, 0x4F, 0x01, 0x46, 0x17, 0x8D, 0x00, 0x04, 0x07, 0x2B,
+  0xF0, 0xEB, 0xCE, 0x80, 0x0F, 0x84, 0x01, 0x81, 0x0F, 0x06, 0xD3, 0x67, 0x29, 0x74, 0xE2, 0xDF,
+  0xCC, 0x84, 0x0F, 0x05, 0x01, 0x71, 0xA7, 0x37, 0xA9, 0x16, 0x8D, 0x00, 0x02, 0x49, 0x41, 0x4C,
+  0x8B, 0x01, 0x03, 0x10, 0x61, 0x20, 0x3E, 0x8A, 0x00, 0x03, 0x18, 0x2B, 0x4A, 0x02, 0x8A, 0x01,
+  0x07, 0x02, 0x72, 0x11, 0x4F, 0x0C, 0x78, 0x00, 0x18, 0x8B, 0x00, 0x04, 0x07, 0x98, 0xE5, 0x4B,
+  0x0F, 0x8B, 0x01, 0x05, 0x0F, 0xE0, 0x74, 0xA2, 0xDD, 0x0F, 0x84, 0x01, 0x05, 0x02, 0x35, 0x37,
+  0x12, 0xA8, 0x16, 0x8C, 0x00, 0x03, 0x18, 0x07, 0x24, 0x02, 0x8A, 0x01, 0x05, 0x81, 0x65, 0x09,
+  0x20, 0x3C, 0x18, 0x8A, 0x00, 0x03, 0x17, 0x57, 0x33, 0x81, 0x8A, 0x01, 0x05, 0x44, 0x0C, 0x4F,
+  0x09, 0x4F, 0x16, 0x8B, 0x00, 0x03, 0x07, 0x94, 0xDC, 0x81, 0x8E, 0x01, 0x03, 0x0F, 0x10, 0xE3,
+  0xDE, 0x85, 0x01, 0x05, 0x02, 0x71, 0x37, 0x12, 0x38, 0x16, 0x8C, 0x00, 0x04, 0x18, 0x89, 0x1A,
+  0x01, 0x0F, 0x89, 0x01, 0x07, 0x10, 0x7E, 0x20, 0xAF, 0x16, 0x17, 0x07, 0x17, 0x87, 0x07, 0x80,
+  0x17, 0x01, 0xAD, 0xCF, 0x8B, 0x01, 0x02, 0x4B, 0x31, 0x4F, 0x80, 0x09, 0x01, 0xB1, 0x18, 0x89,
+  0x00, 0x03, 0x07, 0x6C, 0xD8, 0x81, 0x91, 0x01, 0x01, 0x10, 0x25, 0x85, 0x01, 0x01, 0x02, 0x71,
+  0x80, 0x12, 0x01, 0x38, 0x16, 0x8C, 0x00, 0x02, 0x17, 0x3F, 0x33, 0x8B, 0x01, 0x03, 0x32, 0x09,
+  0x4F, 0x1E, 0x8D, 0x28, 0x02, 0xC4, 0x43, 0x02, 0x8B, 0x01, 0x04, 0x63, 0x11, 0x09, 0x0C, 0x5F,
+  0x89, 0x00, 0x03, 0x17, 0x91, 0xD2, 0x81, 0x9B, 0x01, 0x01, 0x02, 0x71, 0x80, 0x12, 0x01, 0x38,
+  0x16, 0x8B, 0x00, 0x03, 0x18, 0x77, 0x23, 0x02, 0x8A, 0x01, 0x02, 0x02, 0x3D, 0x7F, 0x80, 0x67,
+  0x8F, 0x29, 0x00, 0x0F, 0x8B, 0x01, 0x02, 0x82, 0x09, 0x4F, 0x80, 0x09, 0x01, 0x2E, 0x18, 0x86,
+  0x00, 0x03, 0x18, 0x3A, 0xD7, 0x81, 0x9C, 0x01, 0x05, 0x02, 0x1C, 0x12, 0xAA, 0x38, 0x16, 0x8B,
+  0x00, 0x02, 0x49, 0x47, 0x33, 0x8C, 0x01, 0x01, 0x32, 0xE1, 0x8F, 0x25, 0x01, 0x66, 0x25, 0x8C,
+  0x01, 0x06, 0x02, 0x3D, 0x4F, 0x09, 0x0C, 0x78, 0x18, 0x85, 0x00, 0x05, 0x18, 0x07, 0xBE, 0x02,
+  0x01, 0x81, 0x87, 0x01, 0x00, 0x02, 0x80, 0x10, 0x81, 0x02, 0x00, 0x81, 0x8B, 0x01, 0x05, 0x02,
+  0x71, 0x12, 0x15, 0x38, 0x16, 0x8B, 0x00, 0x02, 0x07, 0x2F, 0x02, 0xB0, 0x01, 0x01, 0x54, 0x4F,
+  0x80, 0x09, 0x01, 0x50, 0x16, 0x85, 0x00, 0x02, 0x99, 0x3C, 0x1A, 0x86, 0x01, 0x0C, 0x81, 0x01,
+  0x10, 0x44, 0x1D, 0x6A, 0x7C, 0xB3, 0x6A, 0x1D, 0x45, 0x33, 0x02, 0x89, 0x01, 0x05, 0x02, 0x71,
+  0x12, 0x15, 0x38, 0x16, 0x8A, 0x00, 0x03, 0x99, 0x89, 0x32, 0x81, 0xB0, 0x01, 0x02, 0x1A, 0x61,
+  0x4F, 0x80, 0x09, 0x01, 0x3C, 0x18, 0x83, 0x00, 0x03, 0x18, 0x2B, 0x4A, 0x02, 0x84, 0x01, 0x05,
+  0x81, 0x01, 0x02, 0x44, 0x27, 0x52, 0x81, 0x07, 0x00, 0x99, 0x80, 0x17, 0x03, 0x16, 0x41, 0xD0,
+  0x02, 0x88, 0x01, 0x05, 0x02, 0x71, 0x0B, 0x15, 0x30, 0x16, 0x8A, 0x00, 0x02, 0x17, 0x3F, 0x4C,
+  0xB1, 0x01, 0x02, 0x02, 0x5C, 0x4F, 0x80, 0x09, 0x00, 0x3E, 0x84, 0x00, 0x03, 0x49, 0x47, 0x1A,
+  0x81, 0x85, 0x01, 0x06, 0x10, 0x5C, 0x15, 0x55, 0x00, 0x99, 0x18, 0x80, 0x00, 0x06, 0x18, 0x00,
+  0x18, 0x17, 0x77, 0x2F, 0x02, 0x87, 0x01, 0x05, 0x02, 0x71, 0x0B, 0x15, 0x56, 0x16, 0x8A, 0x00,
+  0x02, 0x34, 0x4A, 0x81, 0xB2, 0x01, 0x00, 0x1A, 0x82, 0x09, 0x01, 0x2E, 0x18, 0x82, 0x00, 0x02,
+  0x07, 0x2F, 0x02, 0x85, 0x01, 0x05, 0x10, 0x63, 0x12, 0x30, 0x16, 0x99, 0x85, 0x00, 0x04, 0x18,
+  0x99, 0x2B, 0x24, 0x02, 0x86, 0x01, 0x05, 0x02, 0x71, 0x15, 0x86, 0x56, 0x16, 0x89, 0x00, 0x02,
+  0x49, 0x3C, 0x10, 0xB3, 0x01, 0x02, 0x10, 0x7E, 0x4F, 0x80, 0x09, 0x01, 0x40, 0x18, 0x81, 0x00,
+  0x03, 0x18, 0x77, 0x4D, 0x02, 0x85, 0x01, 0x04, 0x54, 0x12, 0xAA, 0x52, 0x18, 0x88, 0x00, 0x03,
+  0x49, 0x77, 0x43, 0x02, 0x85, 0x01, 0x05, 0x02, 0x71, 0x15, 0x86, 0x56, 0x16, 0x89, 0x00, 0x02,
+  0x07, 0x9E, 0x02, 0xB4, 0x01, 0x01, 0x65, 0x4F, 0x80, 0x09, 0x02, 0xAF, 0x16, 0x18, 0x80, 0x00,
+  0x02, 0x17, 0x3C, 0x10, 0x85, 0x01, 0x05, 0x10, 0x2C, 0x12, 0x0B, 0x48, 0x18, 0x89, 0x00, 0x02,
+  0x17, 0x41, 0x10, 0x85, 0x01, 0x05, 0x02, 0x1C, 0x15, 0x86, 0x56, 0x16, 0x88, 0x00, 0x03, 0x18,
+  0x39, 0x4D, 0x81, 0xB4, 0x01, 0x01, 0x1A, 0x2C, 0x81, 0x09, 0x01, 0x46, 0x49, 0x80, 0x00, 0x02,
+  0x07, 0x3F, 0x33, 0x85, 0x01, 0x05, 0x9F, 0x37, 0x12, 0x30, 0x00, 0x18, 0x89, 0x00, 0x03, 0x18,
+  0x2B, 0x23, 0x81, 0x84, 0x01, 0x01, 0x02, 0x1C, 0x80, 0x86, 0x01, 0x56, 0x16, 0x86, 0x00, 0x05,
+  0x18, 0x00, 0x17, 0x57, 0x10, 0x81, 0xB4, 0x01, 0x02, 0x02, 0x3D, 0x4F, 0x80, 0x09, 0x00, 0x3E,
+  0x81, 0x00, 0x02, 0x07, 0x9E, 0x02, 0x84, 0x01, 0x05, 0x02, 0x71, 0x37, 0x12, 0x68, 0x18, 0x8B,
+  0x00, 0x02, 0x17, 0x6F, 0x02, 0x84, 0x01, 0x01, 0x02, 0x1C, 0x80, 0x86, 0x01, 0xBA, 0x16, 0x87,
+  0x00, 0x03, 0x18, 0x2B, 0x4A, 0x02, 0xB6, 0x01, 0x00, 0x4D, 0x82, 0x09, 0x05, 0x58, 0x18, 0x00,
+  0x07, 0x24, 0x02, 0x84, 0x01, 0x05, 0x10, 0xBA, 0x37, 0x12, 0x8A, 0x18, 0x8B, 0x00, 0x02, 0x49,
+  0x41, 0x4C, 0x84, 0x01, 0x06, 0x02, 0x62, 0x86, 0x22, 0xBA, 0x16, 0x00, 0x86, 0x18, 0x02, 0x49,
+  0x46, 0x1A, 0xB7, 0x01, 0x02, 0x10, 0x31, 0x50, 0x80, 0x09, 0x05, 0x47, 0x49, 0x18, 0x00, 0x4A,
+  0x02, 0x84, 0x01, 0x04, 0x10, 0x56, 0x37, 0xAA, 0x8A, 0x8C, 0x18, 0x02, 0x49, 0x46, 0x10, 0x85,
+  0x01, 0x00, 0x62, 0x80, 0x22, 0x01, 0xBA, 0x00, 0x86, 0x18, 0x80, 0x49, 0x01, 0x73, 0x02, 0xB8,
+  0x01, 0x01, 0x65, 0x4F, 0x80, 0x09, 0x05, 0x3E, 0x18, 0x49, 0x00, 0x23, 0x02, 0x84, 0x01, 0x04,
+  0x10, 0x0B, 0x37, 0x12, 0x68, 0x8C, 0x18, 0x02, 0x49, 0x2E, 0x1A, 0x85, 0x01, 0x00, 0x1F, 0x80,
+  0x22, 0x01, 0x53, 0x00, 0x85, 0x18, 0x04, 0x05, 0x49, 0x16, 0x45, 0x02, 0xB8, 0x01, 0x01, 0x1A,
+  0x20, 0x81, 0x09, 0x04, 0x58, 0x19, 0x00, 0x23, 0x02, 0x84, 0x01, 0x01, 0x10, 0x0B, 0x80, 0x12,
+  0x02, 0x8B, 0x18, 0x05, 0x8A, 0x18, 0x02, 0x05, 0x2E, 0x1A, 0x85, 0x01, 0x04, 0x1F, 0x22, 0x9A,
+  0x53, 0x18, 0x86, 0x05, 0x02, 0x19, 0x7A, 0x10, 0x8C, 0x01, 0x01, 0x02, 0x10, 0x9A, 0x02, 0x01,
+  0xCD, 0x02, 0x8B, 0x01, 0x09, 0x02, 0x3D, 0x09, 0x20, 0x09, 0x8D, 0x05, 0x17, 0x4A, 0x02, 0x84,
+  0x01, 0x05, 0x10, 0x56, 0x37, 0x12, 0x0B, 0x98, 0x8B, 0x05, 0x02, 0x19, 0x3C, 0x10, 0x85, 0x01,
+  0x04, 0x1F, 0x22, 0x9A, 0x53, 0x18, 0x86, 0x05, 0x02, 0x59, 0x24, 0x02, 0x8B, 0x01, 0x03, 0x44,
+  0x1F, 0x62, 0x4A, 0x99, 0x1E, 0x01, 0xBE, 0x23, 0x8C, 0x01, 0x08, 0x4D, 0x09, 0x20, 0x09, 0x51,
+  0x5A, 0x19, 0x24, 0x02, 0x84, 0x01, 0x06, 0x10, 0x2C, 0x37, 0x12, 0xAA, 0x3B, 0x04, 0x8A, 0x05,
+  0x02, 0x19, 0xB3, 0x4C, 0x85, 0x01, 0x04, 0x1F, 0x22, 0x9A, 0x53, 0x18, 0x83, 0x05, 0x04, 0x04,
+  0x05, 0x04, 0x58, 0x1A, 0x8B, 0x01, 0x04, 0x10, 0x31, 0x37, 0x12, 0x16, 0x99, 0x19, 0x02, 0xB5,
+  0x2E, 0x1A, 0x8B, 0x01, 0x02, 0x10, 0x7E, 0x09, 0x80, 0x20, 0x03, 0x3C, 0xB5, 0x73, 0x4C, 0x84,
+  0x01, 0x06, 0x02, 0x5C, 0x37, 0x12, 0x0B, 0x30, 0x60, 0x80, 0x04, 0x80, 0x05, 0x82, 0x04, 0x82,
+  0x05, 0x02, 0x19, 0x2F, 0x02, 0x84, 0x01, 0x01, 0x02, 0x1F, 0x80, 0x9A, 0x01, 0xBB, 0x60, 0x85,
+  0x04, 0x02, 0xB5, 0x64, 0x10, 0x8B, 0x01, 0x03, 0xA0, 0x0B, 0x12, 0x68, 0x9B, 0x04, 0x02, 0x05,
+  0x24, 0x02, 0x8A, 0x01, 0x02, 0x02, 0x63, 0x09, 0x80, 0x20, 0x03, 0x3E, 0x6D, 0x7C, 0x4C, 0x85,
+  0x01, 0x00, 0x4B, 0x80, 0x12, 0x03, 0x0B, 0x15, 0x40, 0x03, 0x88, 0x04, 0x03, 0x03, 0x5A, 0x4D,
+  0x81, 0x84, 0x01, 0x05, 0x02, 0x1F, 0x9A, 0x27, 0xBB, 0x60, 0x85, 0x04, 0x02, 0x05, 0x43, 0x02,
+  0x8A, 0x01, 0x05, 0x02, 0x5C, 0x0B, 0xAA, 0x48, 0x0D, 0x9A, 0x04, 0x02, 0x6D, 0x7C, 0x10, 0x8B,
+  0x01, 0x02, 0x1A, 0x20, 0x51, 0x80, 0x20, 0x03, 0x5A, 0x95, 0x10, 0x81, 0x84, 0x01, 0x03, 0x02,
+  0x1C, 0x37, 0x0B, 0x80, 0x15, 0x01, 0x90, 0x6D, 0x87, 0x04, 0x02, 0x6D, 0x6B, 0x4C, 0x85, 0x01,
+  0x01, 0x02, 0x1F, 0x80, 0x27, 0x02, 0xBB, 0x60, 0x04, 0x83, 0x03, 0x03, 0x0D, 0x93, 0x10, 0x81,
+  0x8A, 0x01, 0x05, 0x1A, 0x22, 0x0B, 0x30, 0x60, 0x03, 0x80, 0x04, 0x00, 0x03, 0x82, 0x04, 0x91,
+  0x03, 0x05, 0x5B, 0x04, 0x0D, 0x18, 0x45, 0x02, 0x8A, 0x01, 0x02, 0x10, 0x3D, 0x09, 0x80, 0x20,
+  0x03, 0x47, 0x04, 0xC1, 0x02, 0x85, 0x01, 0x03, 0x1A, 0x0C, 0x12, 0x15, 0x80, 0x86, 0x00, 0x90,
+  0x80, 0x6D, 0x84, 0x03, 0x02, 0x0D, 0xB2, 0x32, 0x86, 0x01, 0x01, 0x02, 0x1F, 0x80, 0x27, 0x01,
+  0xBB, 0x60, 0x84, 0x03, 0x02, 0x6D, 0xBE, 0x02, 0x8B, 0x01, 0x04, 0x9F, 0x0B, 0x15, 0x40, 0x0D,
+  0x9C, 0x03, 0x02, 0x6D, 0x73, 0x02, 0x8B, 0x01, 0x01, 0x4D, 0x4F, 0x80, 0x20, 0x03, 0xAF, 0x6D,
+  0x6B, 0x10, 0x85, 0x01, 0x0A, 0x02, 0x9F, 0x15, 0x0B, 0x15, 0x86, 0x22, 0x92, 0x5A, 0x03, 0xB6,
+  0x81, 0x0D, 0x03, 0xB6, 0x5A, 0x43, 0x02, 0x87, 0x01, 0x00, 0x1F, 0x80, 0x27, 0x01, 0xBB, 0x6E,
+  0x83, 0x03, 0x03, 0x0D, 0x5A, 0x4D, 0x81, 0x8A, 0x01, 0x05, 0x10, 0x35, 0x0B, 0x15, 0x5A, 0x0D,
+  0x9C, 0x03, 0x02, 0x0D, 0x96, 0x10, 0x8B, 0x01, 0x01, 0x10, 0x61, 0x81, 0x20, 0x03, 0x95, 0x60,
+  0x4D, 0x81, 0x85, 0x01, 0x03, 0x02, 0x9F, 0x22, 0x15, 0x80, 0x86, 0x09, 0x9A, 0x2C, 0x8E, 0x7A,
+  0x93, 0x96, 0x93, 0xBD, 0x43, 0x02, 0x88, 0x01, 0x05, 0x1F, 0x27, 0x9B, 0x35, 0x6E, 0x0D, 0x81,
+  0x03, 0x80, 0x0D, 0x01, 0x6B, 0x02, 0x8B, 0x01, 0x07, 0x1A, 0x0C, 0x15, 0x8C, 0x03, 0x0D, 0x03,
+  0x0D, 0x97, 0x03, 0x00, 0x0D, 0x81, 0x03, 0x02, 0x6D, 0xC1, 0x81, 0x8A, 0x01, 0x02, 0x02, 0x23,
+  0x09, 0x80, 0x20, 0x03, 0x57, 0x0D, 0x64, 0x4C, 0x86, 0x01, 0x04, 0x02, 0x4B, 0x62, 0x22, 0x86,
+  0x80, 0x22, 0x00, 0x9A, 0x80, 0x27, 0x01, 0x9B, 0x9D, 0x80, 0x02, 0x89, 0x01, 0x04, 0x1F, 0x27,
+  0x9B, 0x35, 0x6E, 0x81, 0x0D, 0x04, 0x03, 0x0D, 0x04, 0xC1, 0x02, 0x8A, 0x01, 0x04, 0x02, 0x1F,
+  0x11, 0x0C, 0x58, 0x81, 0x0D, 0x85, 0x03, 0x87, 0x0D, 0x85, 0x03, 0x82, 0x0D, 0x05, 0x03, 0x0D,
+  0x03, 0xB6, 0x97, 0x02, 0x8B, 0x01, 0x00, 0x32, 0x82, 0x20, 0x80, 0x60, 0x01, 0xD0, 0x81, 0x87,
+  0x01, 0x04, 0x02, 0x4B, 0x0F, 0x1F, 0x62, 0x80, 0x1F, 0x02, 0x0F, 0x10, 0x02, 0x8B, 0x01, 0x00,
+  0x1F, 0x80, 0x9B, 0x01, 0x35, 0x6E, 0x80, 0x0D, 0x00, 0x03, 0x80, 0x0D, 0x01, 0x7B, 0x10, 0x8B,
+  0x01, 0x05, 0x10, 0x2C, 0x4F, 0x50, 0x6E, 0x6D, 0x87, 0x03, 0x88, 0x04, 0x81, 0x03, 0x02, 0x04,
+  0x03, 0x04, 0x83, 0x03, 0x05, 0x6D, 0x03, 0x0D, 0x5A, 0x45, 0x02, 0x8A, 0x01, 0x01, 0x10, 0x7E,
+  0x81, 0x20, 0x03, 0x7A, 0xB6, 0x96, 0x10, 0x8D, 0x01, 0x00, 0x02, 0x8E, 0x01, 0x00, 0x1F, 0x80,
+  0x9B, 0x02, 0x35, 0x6E, 0x0D, 0x80, 0x03, 0x80, 0x0D, 0x01, 0x1D, 0x02, 0x8A, 0x01, 0x05, 0x02,
+  0x65, 0x11, 0x0C, 0x40, 0x03, 0x80, 0x04, 0x02, 0x7D, 0x05, 0x7D, 0x88, 0x05, 0x82, 0x7D, 0x01,
+  0x05, 0x7D, 0x83, 0x05, 0x00, 0x7D, 0x81, 0x05, 0x82, 0x04, 0x02, 0x19, 0x1D, 0xCD, 0x8B, 0x01,
+  0x09, 0xCF, 0x09, 0x51, 0x20, 0xAF, 0x5B, 0xB6, 0x6B, 0x33, 0x81, 0x91, 0x01, 0x02, 0x81, 0x01,
+  0x81, 0x80, 0x01, 0x00, 0x0F, 0x83, 0x01, 0x00, 0x1F, 0x80, 0x9B, 0x02, 0x7F, 0x5B, 0x0D, 0x80,
+  0x03, 0x03, 0x0D, 0x60, 0xD0, 0x81, 0x8A, 0x01, 0x05, 0x10, 0x71, 0x11, 0x4F, 0x58, 0x05, 0x87,
+  0x08, 0x82, 0x2A, 0x80, 0x08, 0x80, 0x2A, 0x01, 0x08, 0x2A, 0x81, 0x08, 0x80, 0x2A, 0x88, 0x08,
+  0x02, 0x7D, 0x3C, 0x33, 0x8B, 0x01, 0x01, 0x1A, 0x61, 0x81, 0x20, 0x05, 0x95, 0xB6, 0x6D, 0x64,
+  0x10, 0x02, 0x91, 0x01, 0x80, 0x02, 0x80, 0x01, 0x00, 0x81, 0x83, 0x01, 0x00, 0x9D, 0x80, 0x1C,
+  0x01, 0x72, 0x5B, 0x82, 0x0D, 0x01, 0x97, 0x02, 0x8B, 0x01, 0x00, 0x32, 0x80, 0x09, 0x00, 0x3E,
+  0x82, 0x2A, 0x82, 0x21, 0x92, 0x0A, 0x82, 0x21, 0x82, 0x2A, 0x03, 0x08, 0x0A, 0x23, 0x02, 0x8A,
+  0x01, 0x0B, 0x02, 0x3D, 0x09, 0x51, 0x20, 0x57, 0x03, 0xB6, 0x6D, 0x64, 0x33, 0x81, 0x8E, 0x01,
+  0x04, 0x81, 0x33, 0xC0, 0x9E, 0x02, 0x85, 0x01, 0x0A, 0x9D, 0x1C, 0x62, 0x71, 0x6E, 0x0D, 0x03,
+  0x0D, 0x04, 0x4A, 0x02, 0x8B, 0x01, 0x04, 0x63, 0x4F, 0x09, 0x3B, 0x26, 0x81, 0x0A, 0x84, 0x13,
+  0x8D, 0x06, 0x00, 0x13, 0x80, 0x06, 0x82, 0x13, 0x82, 0x0A, 0x03, 0x21, 0x26, 0xB0, 0x33, 0x8B,
+  0x01, 0x0B, 0x32, 0x20, 0x51, 0x20, 0x51, 0x60, 0x6D, 0x03, 0xB5, 0x7A, 0x4D, 0x33, 0x8C, 0x01,
+  0x05, 0x02, 0x33, 0xC3, 0x17, 0xBD, 0x02, 0x85, 0x01, 0x09, 0x9D, 0x1C, 0x62, 0x7F, 0xB8, 0x0D,
+  0x03, 0x6D, 0xB2, 0x1A, 0x8B, 0x01, 0x04, 0x1A, 0x31, 0x09, 0x3E, 0x88, 0x81, 0x13, 0x83, 0x06,
+  0x92, 0x0E, 0x84, 0x06, 0x81, 0x13, 0x02, 0x0A, 0xAB, 0x44, 0x8B, 0x01, 0x02, 0x10, 0x7E, 0x51,
+  0x80, 0x20, 0x07, 0x91, 0x7D, 0x08, 0x7D, 0x59, 0x3A, 0x9C, 0x1A, 0x80, 0x02, 0x87, 0x01, 0x08,
+  0x02, 0x33, 0xD6, 0x69, 0x13, 0x26, 0x6F, 0x4C, 0x10, 0x84, 0x02, 0x03, 0x9D, 0x62, 0x42, 0xB7,
+  0x80, 0x0D, 0x03, 0x03, 0xB5, 0x42, 0x4C, 0x8A, 0x02, 0x04, 0x4C, 0x10, 0x09, 0x40, 0x88, 0x84,
+  0x06, 0x82, 0x0E, 0x82, 0x14, 0x89, 0x1B, 0x82, 0x14, 0x82, 0x0E, 0x84, 0x06, 0x02, 0xB4, 0x7F,
+  0x4C, 0x82, 0x02, 0x82, 0x4C, 0x82, 0x02, 0x05, 0x4C, 0x0F, 0x09, 0x3E, 0x2E, 0x08, 0x80, 0x2A,
+  0x81, 0x21, 0x07, 0x13, 0xAC, 0x70, 0x65, 0x1A, 0x33, 0x4C, 0x02, 0x80, 0x10, 0x80, 0x33, 0x09,
+  0x82, 0xBF, 0x92, 0x14, 0xB4, 0x06, 0xB4, 0x92, 0xBF, 0x1E, 0x80, 0x24, 0x82, 0x1E, 0x02, 0x1D,
+  0xB2, 0x04, 0x80, 0x0D, 0x03, 0x03, 0x04, 0x05, 0x64, 0x87, 0x1D, 0x83, 0x42, 0x01, 0x6A, 0x88,
+  0x81, 0x13, 0x81, 0x06, 0x82, 0x0E, 0x81, 0x14, 0x82, 0x1B, 0x87, 0x4E, 0x81, 0x1B, 0x83, 0x14,
+  0x81, 0x0E, 0x81, 0x06, 0x80, 0x13, 0x02, 0x79, 0x42, 0x9C, 0x83, 0x42, 0x86, 0x1D, 0x02, 0x69,
+  0x21, 0x08, 0x80, 0x2A, 0x00, 0x21, 0x81, 0x0A, 0x06, 0x13, 0x06, 0xB4, 0x14, 0x8F, 0x8C, 0xBC,
+  0x81, 0x80, 0x04, 0x8E, 0x8A, 0xA6, 0x76, 0x5E, 0x80, 0x14, 0x80, 0x0E, 0x04, 0xB4, 0x0E, 0x06,
+  0x13, 0x0A, 0x80, 0x26, 0x04, 0x2A, 0x08, 0x59, 0x7D, 0x04, 0x80, 0x6D, 0x00, 0x03, 0x80, 0x04,
+  0x80, 0x19, 0x01, 0xB5, 0x19, 0x82, 0x59, 0x00, 0x17, 0x83, 0x26, 0x81, 0x0A, 0x81, 0x13, 0x81,
+  0x06, 0x82, 0x0E, 0x83, 0x14, 0x83, 0x1B, 0x82, 0x4E, 0x83, 0x1B, 0x82, 0x14, 0x82, 0x0E, 0x81,
+  0x06, 0x83, 0x13, 0x85, 0x26, 0x85, 0x59, 0x81, 0x08, 0x80, 0x2A, 0x00, 0x21, 0x80, 0x0A, 0x80,
+  0x13, 0x80, 0x06, 0x00, 0xB4, 0x80, 0x87, 0x80, 0x85, 0x80, 0x5E, 0x02, 0x85, 0x5E, 0x1B, 0x80,
+  0x14, 0x80, 0x0E, 0x02, 0xB4, 0x06, 0x13, 0x80, 0x0A, 0x81, 0x2A, 0x80, 0x08, 0x01, 0x05, 0x7D,
+  0x80, 0x04, 0x02, 0x03, 0x0D, 0x03, 0x82, 0x04, 0x81, 0x7D, 0x83, 0x08, 0x80, 0x2A, 0x81, 0x21,
+  0x80, 0x0A, 0x82, 0x13, 0x83, 0x06, 0x85, 0x0E, 0x88, 0x14, 0x84, 0x0E, 0x83, 0x06, 0x81, 0x13,
+  0x82, 0x0A, 0x00, 0x21, 0x81, 0x2A, 0x83, 0x08, 0x84, 0x7D, 0x01, 0x05, 0x7D, 0x82, 0x08, 0x00,
+  0x2A, 0x80, 0x21, 0x00, 0x0A, 0x82, 0x13, 0x87, 0x06, 0x80, 0x13, 0x80, 0x0A, 0x01, 0x2A, 0x21,
+  0x80, 0x2A, 0x80, 0x08, 0x01, 0x05, 0x7D, 0x80, 0x04, 0x00, 0x03, 0x81, 0x0D, 0x81, 0x03, 0x82,
+  0x04, 0x83, 0x7D, 0x82, 0x08, 0x81, 0x2A, 0x80, 0x21, 0x83, 0x0A, 0x84, 0x13, 0x90, 0x06, 0x83,
+  0x13, 0x82, 0x0A, 0x80, 0x21, 0x81, 0x2A, 0x84, 0x08, 0x80, 0x7D, 0x00, 0x05, 0x83, 0x04, 0x02,
+  0x03, 0x6D, 0x03, 0x81, 0x04, 0x81, 0x7D, 0x84, 0x08, 0x88, 0x2A, 0x82, 0x08, 0x81, 0x7D, 0x80,
+  0x04, 0x81, 0x03, 0x81, 0x0D, 0x01, 0x03, 0x0D,
+};
+
+GUI_CONST_STORAGE GUI_BITMAP bma_rle = {
+  120, // xSize
+  87, // ySize
+  120, // BytesPerLine
+  8, // BitsPerPixel
+  (const unsigned char *)_acbma_rle,  // Pointer to run-length stream
+  &_Palbma_rle,  // Pointer to palette
+  &LCD_RLE_METHODS_8BPP
+};
+
+/* [] END OF FILE */
@@ -0,0 +1,76 @@
+/*
+ * app_arena.c
+ *
+ *  Application arena, see app_arena.h.
+ */
+
+#include "app_arena.h"
+#include "GUIPool.h"
+
+
+#define APP_ARENA_ALIGN             (8u)
+
+#if (APP_ARENA_BYTES > 0)
+static uint64_t app_arena_mem[APP_ARENA_BYTES / sizeof(uint64_t)];
+#else
+static uint64_t app_arena_mem[1];
+#endif
+
+static app_arena_stats_t app_arena_stats;
+
+
+/*******************************************************************************
+ * Allocates from the arena.
+ *******************************************************************************/
+void *app_arena_alloc(size_t bytes)
+{
+    uint32_t size = (uint32_t)((bytes + APP_ARENA_ALIGN - 1u) & ~(size_t)(APP_ARENA_ALIGN - 1u));
+    void *block;
+
+    if ((bytes == 0u) || (size > APP_ARENA_BYTES - app_arena_stats.used))
+    {
+        app_arena_stats.failures++;
+        return NULL;
+    }
+
+    block = (uint8_t *)app_arena_mem + app_arena_stats.used;
+    app_arena_stats.used += size;
+    if (app_arena_stats.used > app_arena_stats.peak)
+    {
+        app_arena_stats.peak = app_arena_stats.used;
+    }
+    return block;
+}
+
+
+/*******************************************************************************
+ * Returns the current fill level.
+ *******************************************************************************/
+uint32_t app_arena_mark(void)
+{
+    return app_arena_stats.used;
+}
+
+
+/*******************************************************************************
+ * Frees every block allocated after the mark.
+ *******************************************************************************/
+void app_arena_release(uint32_t mark)
+{
+    if (mark < app_arena_stats.used)
+    {
+        app_arena_stats.used = mark;
+    }
+}
+
+
+/*******************************************************************************
+ * Copies the counters.
+ *******************************************************************************/
+void app_arena_get_stats(app_arena_stats_t *stats)
+{
+    *stats = app_arena_stats;
+    stats->size = APP_ARENA_BYTES;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,61 @@
+/*
+ * app_arena.h
+ *
+ *  Application arena in the SRAM the emWin pool gives up, sized by
+ *  configs/GUIPool.h. A bump allocator: blocks are 8-byte aligned, never
+ *  freed one by one, and released together back to a mark.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/** Arena counters, in bytes */
+typedef struct
+{
+    uint32_t size;          /**< APP_ARENA_BYTES */
+    uint32_t used;          /**< Allocated now */
+    uint32_t peak;          /**< Most ever allocated */
+    uint32_t failures;      /**< Allocations that did not fit */
+} app_arena_stats_t;
+
+
+/**
+ * Allocates from the arena.
+ * @param[in] bytes Size of the block
+ * @return The block, NULL when the arena is full
+ */
+void *app_arena_alloc(size_t bytes);
+
+/**
+ * Returns the current fill level, for app_arena_release().
+ * @return Mark
+ */
+uint32_t app_arena_mark(void);
+
+/**
+ * Frees every block allocated after the mark was taken.
+ * @param[in] mark Value returned by app_arena_mark()
+ */
+void app_arena_release(uint32_t mark);
+
+/**
+ * Copies the counters.
+ * @param[out] stats Where to store the counters
+ */
+void app_arena_get_stats(app_arena_stats_t *stats);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,68 @@
+/*
+ * app_handoff.c
+ *
+ *  Handoff of the requested screen, see app_handoff.h.
+ */
+
+#include "cyhal.h"
+#include "app_handoff.h"
+#include "lcd_prof.h"
+
+#if (LCD_RTOS)
+#include "cyabs_rtos.h"
+
+
+/* Given by the input task, the renderer draws the newest request once */
+static cy_semaphore_t app_handoff_sem;
+/* Newest request and the arrival of the message behind it */
+static screen_id_t app_handoff_id;
+static uint32_t app_handoff_since;
+
+
+/*******************************************************************************
+ * Creates the render semaphore.
+ *******************************************************************************/
+cy_rslt_t app_handoff_init(void)
+{
+    return cy_rtos_init_semaphore(&app_handoff_sem, 1u, 0u);
+}
+
+
+/*******************************************************************************
+ * Makes a screen the newest request and wakes the renderer.
+ *******************************************************************************/
+void app_handoff_post(screen_id_t id, uint32_t since)
+{
+    uint32_t state = cyhal_system_critical_section_enter();
+
+    app_handoff_id = id;
+    app_handoff_since = since;
+    cyhal_system_critical_section_exit(state);
+
+    (void)cy_rtos_set_semaphore(&app_handoff_sem, false);
+}
+
+
+/*******************************************************************************
+ * Waits for a request and records the wake latency.
+ *******************************************************************************/
+bool app_handoff_wait(uint32_t timeout_ms, screen_id_t *id, uint32_t *since)
+{
+    uint32_t state;
+
+    if (CY_RSLT_SUCCESS != cy_rtos_get_semaphore(&app_handoff_sem, timeout_ms, false))
+    {
+        return false;
+    }
+    state = cyhal_system_critical_section_enter();
+    *id = app_handoff_id;
+    *since = app_handoff_since;
+    cyhal_system_critical_section_exit(state);
+
+    LCD_PROF_RECORD(LCD_PROF_WAKE, lcd_prof_now() - *since);
+    return true;
+}
+
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,52 @@
+/*
+ * app_handoff.h
+ *
+ *  Handoff of the requested screen from the input task to the render task
+ *  in the LCD_RTOS build. The input task posts each screen it moves to with
+ *  the arrival time of the message behind it; requests posted while the
+ *  renderer is busy collapse, so it wakes once and draws the newest.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+#include "screens.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/**
+ * Creates the render semaphore. Must be called before the tasks start.
+ * @return Result of the semaphore creation
+ */
+cy_rslt_t app_handoff_init(void);
+
+/**
+ * Makes a screen the newest request and wakes the renderer.
+ * @param[in] id    Screen to draw
+ * @param[in] since lcd_prof_now() when the message that asked for it arrived
+ */
+void app_handoff_post(screen_id_t id, uint32_t since);
+
+/**
+ * Waits for a request and records how long the renderer took to wake for
+ * it in LCD_PROF_WAKE.
+ * @param[in]  timeout_ms Longest wait, CY_RTOS_NEVER_TIMEOUT for none
+ * @param[out] id         Newest requested screen
+ * @param[out] since      Arrival of the message behind it
+ * @return false if the wait timed out
+ */
+bool app_handoff_wait(uint32_t timeout_ms, screen_id_t *id, uint32_t *since);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
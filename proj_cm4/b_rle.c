@@ -0,0 +1,355 @@
+/*
+ * b_rle.c
+ *
+ *  Generated by tools/bmp_rle.py from b.c, do not edit.
+ *  120 x 86 pixels, 10320 bytes raw, 2964 bytes run-length coded.
+ */
+
+#include "GUI.h"
+#include "lcd_rle.h"
+
+#ifndef GUI_CONST_STORAGE
+  #define GUI_CONST_STORAGE const
+#endif
+
+static GUI_CONST_STORAGE GUI_COLOR _Colorsb[] = {
+#if (GUI_USE_ARGB == 0)
+  0xC07000, 0xBE6C00, 0xB86000, 0xBF6E00,
+  0xBA6200, 0xBD6A00, 0xBC6800, 0xC57E19,
+  0xF0DFC6, 0xBA6400, 0xB85E00, 0xCF923E,
+  0xFEFEFD, 0xF7EEE1, 0xBC6600, 0xDBAE6F,
+  0xBB6600, 0xD09442, 0xB75C00, 0xFDFBF9,
+  0xEBD2AF, 0xBE6B00, 0xB96200, 0xC06F00,
+  0xC57D18, 0xC2760C, 0xC07204, 0xD09644,
+  0xD49E52, 0xDBAC6C, 0xC47A12, 0xDDB378,
+  0xE6C79B, 0xE7C99F, 0xC17407, 0xC3780E,
+  0xC67D18, 0xC67E1A, 0xC88323, 0xCC8C32,
+  0xCE913A, 0xD09441, 0xD19646, 0xD6A25A,
+  0xD9AA68, 0xDCB072, 0xDDB276, 0xE0BA84,
+  0xE9CDA6, 0xEEDABD, 0xF5E9D9, 0xF6EBDC,
+  0xF9F1E7, 0xFCF8F3, 0xFEFDFC, 0xFEFEFE,
+  0xB75E00, 0xB85D00, 0xC07102, 0xC07203,
+  0xC17306, 0xC27408, 0xC7811E, 0xCA882B,
+  0xCB892C, 0xCC8B30, 0xCC8D34, 0xCD8E36,
+  0xCE913C, 0xCE923C, 0xD29949, 0xD49E53,
+  0xD5A056, 0xD5A259, 0xD9AA67, 0xDBAD6D,
+  0xDDB379, 0xDEB47A, 0xDEB57B, 0xE0B982,
+  0xE5C598, 0xE5C599, 0xEBD1AE, 0xEBD2B0,
+  0xEBD3B0, 0xEDD5B5, 0xEDD6B7, 0xEED9BB,
+  0xEFDABE, 0xEFDBBF, 0xEFDCC0, 0xEFDCC1,
+  0xF1DFC7, 0xF1E0C9, 0xF3E5D1, 0xF4E6D3,
+  0xF6EADA, 0xF6ECDD, 0xF7EDE0, 0xF8F0E4,
+  0xF8F1E5, 0xF9F2E8, 0xFAF3EA, 0xFDFBF8,
+  0xFDFCFA, 0xB35300, 0xB45500, 0xB55800,
+  0xB65900, 0xC17408, 0xC2750A, 0xC2760A,
+  0xC37810, 0xC57C16, 0xC88221, 0xC88423,
+  0xC98425, 0xC98627, 0xCA8729, 0xCB892E,
+  0xCC8E35, 0xCD9039, 0xCF9440, 0xD09340,
+  0xD19847, 0xD19848, 0xD29848, 0xD2994A,
+  0xD29A4A, 0xD39B4D, 0xD39B4E, 0xD39D51,
+  0xD49D51, 0xD49E51, 0xD49F54, 0xD5A057,
+  0xD6A35B, 0xD6A35C, 0xD7A45C, 0xD7A55E,
+  0xD7A55F, 0xD7A660, 0xD7A662, 0xD8A661,
+  0xD8A762, 0xD8A864, 0xD9A965, 0xD9A966,
+  0xD9A967, 0xDAAB69, 0xDAAC6B, 0xDAAD6D,
+  0xDBAF70, 0xDCAF72, 0xDBB072, 0xDCB174,
+  0xDDB277, 0xDDB479, 0xDEB47B, 0xDFB77E,
+  0xDFB77F, 0xDFB87F, 0xDFB780, 0xDFB881,
+  0xDFB882, 0xDFB982, 0xE1BB85, 0xE1BB87,
+  0xE1BC87, 0xE1BC88, 0xE1BD8A, 0xE2BD8A,
+  0xE2BE8A, 0xE2BE8B, 0xE2BE8C, 0xE2BF8C,
+  0xE3BF8E, 0xE3BF8F, 0xE4C08F, 0xE3C090,
+  0xE4C192, 0xE4C293, 0xE5C497, 0xE6C69A,
+  0xE6C89D, 0xE7C89D, 0xE7C9A0, 0xE7CAA0,
+  0xE8CBA2, 0xE8CBA3, 0xE8CCA3, 0xE9CEA8,
+  0xE9CFAA, 0xEAD1AD, 0xEAD1AE, 0xEBD3B2,
+  0xEBD4B2, 0xECD4B3, 0xECD4B4, 0xECD5B5,
+  0xECD5B6, 0xEDD6B5, 0xEDD7B8, 0xEED9BC,
+  0xEED9BD, 0xEFDABD, 0xEEDABE, 0xEEDBBE,
+  0xEFDBBE, 0xEFDBC0, 0xF0DDC2, 0xF0DDC4,
+  0xF0DEC5, 0xF1DEC4, 0xF0DFC7, 0xF1E0C8,
+  0xF1E1CA, 0xF2E2CC, 0xF2E3CD, 0xF3E2CC,
+  0xF2E3CE, 0xF3E4D0, 0xF3E5D0, 0xF3E5D2,
+  0xF4E7D4, 0xF5E9D8, 0xF5EADA, 0xF6EBDB,
+  0xF6ECDE, 0xF7EEE2, 0xF7EFE3, 0xF8EFE2,
+  0xF8EFE3, 0xF8EFE4, 0xF8F0E5, 0xF9F1E6,
+  0xF9F2E7, 0xF9F3EB, 0xFAF4EB, 0xFAF5ED,
+  0xFAF5EE, 0xFBF5EE, 0xFBF6F0, 0xFBF7F1,
+  0xFCF9F3, 0xFCF9F4, 0xFCF9F5, 0xFDFAF6,
+  0xFEFCFA, 0xFEFCFB, 0xFEFDFB, 0xFFFEFD,
+  0xFEFFFF, 0xFFFEFE, 0xFFFFFE, 0xFFFFFF
+#else
+  0xFF0070C0, 0xFF006CBE, 0xFF0060B8, 0xFF006EBF,
+  0xFF0062BA, 0xFF006ABD, 0xFF0068BC, 0xFF197EC5,
+  0xFFC6DFF0, 0xFF0064BA, 0xFF005EB8, 0xFF3E92CF,
+  0xFFFDFEFE, 0xFFE1EEF7, 0xFF0066BC, 0xFF6FAEDB,
+  0xFF0066BB, 0xFF4294D0, 0xFF005CB7, 0xFFF9FBFD,
+  0xFFAFD2EB, 0xFF006BBE, 0xFF0062B9, 0xFF006FC0,
+  0xFF187DC5, 0xFF0C76C2, 0xFF0472C0, 0xFF4496D0,
+  0xFF529ED4, 0xFF6CACDB, 0xFF127AC4, 0xFF78B3DD,
+  0xFF9BC7E6, 0xFF9FC9E7, 0xFF0774C1, 0xFF0E78C3,
+  0xFF187DC6, 0xFF1A7EC6, 0xFF2383C8, 0xFF328CCC,
+  0xFF3A91CE, 0xFF4194D0, 0xFF4696D1, 0xFF5AA2D6,
+  0xFF68AAD9, 0xFF72B0DC, 0xFF76B2DD, 0xFF84BAE0,
+  0xFFA6CDE9, 0xFFBDDAEE, 0xFFD9E9F5, 0xFFDCEBF6,
+  0xFFE7F1F9, 0xFFF3F8FC, 0xFFFCFDFE, 0xFFFEFEFE,
+  0xFF005EB7, 0xFF005DB8, 0xFF0271C0, 0xFF0372C0,
+  0xFF0673C1, 0xFF0874C2, 0xFF1E81C7, 0xFF2B88CA,
+  0xFF2C89CB, 0xFF308BCC, 0xFF348DCC, 0xFF368ECD,
+  0xFF3C91CE, 0xFF3C92CE, 0xFF4999D2, 0xFF539ED4,
+  0xFF56A0D5, 0xFF59A2D5, 0xFF67AAD9, 0xFF6DADDB,
+  0xFF79B3DD, 0xFF7AB4DE, 0xFF7BB5DE, 0xFF82B9E0,
+  0xFF98C5E5, 0xFF99C5E5, 0xFFAED1EB, 0xFFB0D2EB,
+  0xFFB0D3EB, 0xFFB5D5ED, 0xFFB7D6ED, 0xFFBBD9EE,
+  0xFFBEDAEF, 0xFFBFDBEF, 0xFFC0DCEF, 0xFFC1DCEF,
+  0xFFC7DFF1, 0xFFC9E0F1, 0xFFD1E5F3, 0xFFD3E6F4,
+  0xFFDAEAF6, 0xFFDDECF6, 0xFFE0EDF7, 0xFFE4F0F8,
+  0xFFE5F1F8, 0xFFE8F2F9, 0xFFEAF3FA, 0xFFF8FBFD,
+  0xFFFAFCFD, 0xFF0053B3, 0xFF0055B4, 0xFF0058B5,
+  0xFF0059B6, 0xFF0874C1, 0xFF0A75C2, 0xFF0A76C2,
+  0xFF1078C3, 0xFF167CC5, 0xFF2182C8, 0xFF2384C8,
+  0xFF2584C9, 0xFF2786C9, 0xFF2987CA, 0xFF2E89CB,
+  0xFF358ECC, 0xFF3990CD, 0xFF4094CF, 0xFF4093D0,
+  0xFF4798D1, 0xFF4898D1, 0xFF4898D2, 0xFF4A99D2,
+  0xFF4A9AD2, 0xFF4D9BD3, 0xFF4E9BD3, 0xFF519DD3,
+  0xFF519DD4, 0xFF519ED4, 0xFF549FD4, 0xFF57A0D5,
+  0xFF5BA3D6, 0xFF5CA3D6, 0xFF5CA4D7, 0xFF5EA5D7,
+  0xFF5FA5D7, 0xFF60A6D7, 0xFF62A6D7, 0xFF61A6D8,
+  0xFF62A7D8, 0xFF64A8D8, 0xFF65A9D9, 0xFF66A9D9,
+  0xFF67A9D9, 0xFF69ABDA, 0xFF6BACDA, 0xFF6DADDA,
+  0xFF70AFDB, 0xFF72AFDC, 0xFF72B0DB, 0xFF74B1DC,
+  0xFF77B2DD, 0xFF79B4DD, 0xFF7BB4DE, 0xFF7EB7DF,
+  0xFF7FB7DF, 0xFF7FB8DF, 0xFF80B7DF, 0xFF81B8DF,
+  0xFF82B8DF, 0xFF82B9DF, 0xFF85BBE1, 0xFF87BBE1,
+  0xFF87BCE1, 0xFF88BCE1, 0xFF8ABDE1, 0xFF8ABDE2,
+  0xFF8ABEE2, 0xFF8BBEE2, 0xFF8CBEE2, 0xFF8CBFE2,
+  0xFF8EBFE3, 0xFF8FBFE3, 0xFF8FC0E4, 0xFF90C0E3,
+  0xFF92C1E4, 0xFF93C2E4, 0xFF97C4E5, 0xFF9AC6E6,
+  0xFF9DC8E6, 0xFF9DC8E7, 0xFFA0C9E7, 0xFFA0CAE7,
+  0xFFA2CBE8, 0xFFA3CBE8, 0xFFA3CCE8, 0xFFA8CEE9,
+  0xFFAACFE9, 0xFFADD1EA, 0xFFAED1EA, 0xFFB2D3EB,
+  0xFFB2D4EB, 0xFFB3D4EC, 0xFFB4D4EC, 0xFFB5D5EC,
+  0xFFB6D5EC, 0xFFB5D6ED, 0xFFB8D7ED, 0xFFBCD9EE,
+  0xFFBDD9EE, 0xFFBDDAEF, 0xFFBEDAEE, 0xFFBEDBEE,
+  0xFFBEDBEF, 0xFFC0DBEF, 0xFFC2DDF0, 0xFFC4DDF0,
+  0xFFC5DEF0, 0xFFC4DEF1, 0xFFC7DFF0, 0xFFC8E0F1,
+  0xFFCAE1F1, 0xFFCCE2F2, 0xFFCDE3F2, 0xFFCCE2F3,
+  0xFFCEE3F2, 0xFFD0E4F3, 0xFFD0E5F3, 0xFFD2E5F3,
+  0xFFD4E7F4, 0xFFD8E9F5, 0xFFDAEAF5, 0xFFDBEBF6,
+  0xFFDEECF6, 0xFFE2EEF7, 0xFFE3EFF7, 0xFFE2EFF8,
+  0xFFE3EFF8, 0xFFE4EFF8, 0xFFE5F0F8, 0xFFE6F1F9,
+  0xFFE7F2F9, 0xFFEBF3F9, 0xFFEBF4FA, 0xFFEDF5FA,
+  0xFFEEF5FA, 0xFFEEF5FB, 0xFFF0F6FB, 0xFFF1F7FB,
+  0xFFF3F9FC, 0xFFF4F9FC, 0xFFF5F9FC, 0xFFF6FAFD,
+  0xFFFAFCFE, 0xFFFBFCFE, 0xFFFBFDFE, 0xFFFDFEFF,
+  0xFFFFFFFE, 0xFFFEFEFF, 0xFFFEFFFF, 0xFFFFFFFF
+#endif
+
+};
+
+static GUI_CONST_STORAGE GUI_LOGPALETTE _Palbmb_rle = {
+  256,  // Number of entries
+  0,    // No transparency
+  (const LCD_COLOR *)&_Colorsb[0]
+};
+
+static GUI_CONST_STORAGE unsigned char _acbmb_rle[] = {
+  0x01, 0x68, 0x33, 0x97, 0x0D, 0x05, 0x62, 0x34, 0xF2, 0xF1, 0x35, 0x37, 0xA3, 0xFF, 0x01, 0xE5,
+  0x62, 0x88, 0x0D, 0x01, 0xE4, 0xF0, 0xA2, 0xFF, 0x01, 0xCF, 0x6A, 0x9B, 0x16, 0x82, 0x02, 0x06,
+  0x05, 0x19, 0x40, 0x85, 0xA4, 0xCA, 0x37, 0x9A, 0xFF, 0x01, 0x1A, 0x0A, 0x88, 0x16, 0x01, 0x6C,
+  0x8E, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0x9E, 0x00, 0x80, 0x03, 0x08, 0x01, 0x15, 0x05, 0x10, 0x04,
+  0x0A, 0x23, 0x96, 0x66, 0x97, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF,
+  0x01, 0x08, 0x04, 0xA5, 0x00, 0x05, 0x03, 0x01, 0x06, 0x0A, 0x28, 0x67, 0x95, 0xFF, 0x01, 0x07,
+  0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0xA8, 0x00, 0x03, 0x03, 0x05,
+  0x02, 0x51, 0x94, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08,
+  0x04, 0xAA, 0x00, 0x02, 0x03, 0x02, 0x48, 0x93, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06,
+  0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0xAB, 0x00, 0x02, 0x03, 0x04, 0x46, 0x92, 0xFF, 0x01, 0x07,
+  0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0xAD, 0x00, 0x01, 0x16, 0x97,
+  0x91, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0xAD,
+  0x00, 0x02, 0x03, 0x12, 0xCB, 0x90, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2,
+  0xFF, 0x01, 0x08, 0x04, 0xAE, 0x00, 0x01, 0x03, 0x04, 0x90, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00,
+  0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0xAF, 0x00, 0x01, 0x06, 0x82, 0x8F, 0xFF, 0x01,
+  0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0xAF, 0x00, 0x02, 0x03,
+  0x12, 0x34, 0x8E, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08,
+  0x04, 0xB0, 0x00, 0x01, 0x05, 0x11, 0x8E, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F,
+  0xA2, 0xFF, 0x01, 0x08, 0x04, 0x8A, 0x00, 0x00, 0x03, 0x8B, 0x01, 0x84, 0x03, 0x90, 0x00, 0x02,
+  0x03, 0x0A, 0xFC, 0x8D, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01,
+  0x08, 0x04, 0x89, 0x00, 0x02, 0x03, 0x1A, 0x25, 0x86, 0x18, 0x04, 0x24, 0x23, 0x22, 0x3D, 0x22,
+  0x80, 0x05, 0x06, 0x06, 0x10, 0x16, 0x02, 0x04, 0x0E, 0x01, 0x8D, 0x00, 0x01, 0x10, 0xAC, 0x8D,
+  0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00,
+  0x01, 0x05, 0x2A, 0x91, 0xFF, 0x05, 0xED, 0x5D, 0x2F, 0x6F, 0x09, 0x03, 0x8B, 0x00, 0x01, 0x01,
+  0x26, 0x8D, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04,
+  0x89, 0x00, 0x01, 0x05, 0x0B, 0x95, 0xFF, 0x02, 0xA1, 0x02, 0x03, 0x8A, 0x00, 0x01, 0x03, 0x16,
+  0x8D, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0x89,
+  0x00, 0x01, 0x05, 0x0B, 0x96, 0xFF, 0x02, 0xBB, 0x02, 0x03, 0x8A, 0x00, 0x01, 0x16, 0x5E, 0x8C,
+  0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00,
+  0x01, 0x05, 0x0B, 0x97, 0xFF, 0x01, 0x1C, 0x06, 0x8A, 0x00, 0x01, 0x10, 0xB8, 0x8C, 0xFF, 0x01,
+  0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05,
+  0x0B, 0x98, 0xFF, 0x01, 0x04, 0x03, 0x89, 0x00, 0x01, 0x06, 0x1F, 0x8C, 0xFF, 0x01, 0x07, 0x01,
+  0x88, 0x00, 0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x98,
+  0xFF, 0x01, 0x80, 0x05, 0x89, 0x00, 0x01, 0x06, 0x8B, 0x8C, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00,
+  0x01, 0x06, 0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x98, 0xFF, 0x01,
+  0x30, 0x10, 0x89, 0x00, 0x01, 0x05, 0x1C, 0x8C, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06,
+  0x0F, 0xA2, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x98, 0xFF, 0x01, 0xE9, 0x16,
+  0x89, 0x00, 0x01, 0x05, 0x83, 0x8C, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0x89,
+  0xFF, 0x05, 0xF4, 0x5A, 0x52, 0x30, 0x56, 0xDD, 0x91, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01,
+  0x05, 0x0B, 0x98, 0xFF, 0x01, 0x36, 0x02, 0x89, 0x00, 0x01, 0x06, 0x2B, 0x8C, 0xFF, 0x01, 0x07,
+  0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0x86, 0xFF, 0x04, 0x59, 0x81, 0x05, 0x02, 0x04, 0x80, 0x09,
+  0x05, 0x04, 0x16, 0x0A, 0x22, 0x94, 0xE0, 0x8D, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05,
+  0x0B, 0x99, 0xFF, 0x01, 0x16, 0x03, 0x88, 0x00, 0x01, 0x06, 0x2E, 0x8C, 0xFF, 0x01, 0x07, 0x01,
+  0x88, 0x00, 0x01, 0x06, 0x0F, 0x84, 0xFF, 0x04, 0xC5, 0x6E, 0x02, 0x05, 0x03, 0x84, 0x00, 0x05,
+  0x03, 0x01, 0x06, 0x02, 0x24, 0x57, 0x8B, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B,
+  0x98, 0xFF, 0x01, 0xF6, 0x02, 0x89, 0x00, 0x01, 0x10, 0x20, 0x8C, 0xFF, 0x01, 0x07, 0x01, 0x88,
+  0x00, 0x01, 0x06, 0x0F, 0x83, 0xFF, 0x02, 0x41, 0x02, 0x01, 0x8A, 0x00, 0x04, 0x17, 0x01, 0x02,
+  0x41, 0x37, 0x89, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x98, 0xFF, 0x01, 0x60,
+  0x16, 0x89, 0x00, 0x01, 0x16, 0xDC, 0x8C, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F,
+  0x81, 0xFF, 0x03, 0x33, 0x10, 0x05, 0x17, 0x8D, 0x00, 0x03, 0x03, 0x05, 0x09, 0xD7, 0x88, 0xFF,
+  0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x98, 0xFF, 0x01, 0x50, 0x10, 0x88, 0x00, 0x01,
+  0x03, 0x02, 0x8D, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x0F, 0x80, 0xFF, 0x02, 0xCD,
+  0x12, 0x03, 0x91, 0x00, 0x02, 0x03, 0x12, 0xBA, 0x87, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01,
+  0x05, 0x0B, 0x98, 0xFF, 0x01, 0x79, 0x05, 0x88, 0x00, 0x01, 0x01, 0x72, 0x8D, 0xFF, 0x01, 0x07,
+  0x01, 0x88, 0x00, 0x05, 0x06, 0x0F, 0xFF, 0xD8, 0x12, 0x03, 0x93, 0x00, 0x02, 0x03, 0x39, 0x50,
+  0x86, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x97, 0xFF, 0x02, 0x67, 0x02, 0x03,
+  0x88, 0x00, 0x01, 0x10, 0x2F, 0x8D, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x04, 0x06, 0x1F, 0x0C,
+  0x12, 0x03, 0x95, 0x00, 0x02, 0x03, 0x12, 0xD1, 0x85, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01,
+  0x05, 0x0B, 0x97, 0xFF, 0x01, 0x3F, 0x05, 0x88, 0x00, 0x02, 0x03, 0x0A, 0xF8, 0x8D, 0xFF, 0x01,
+  0x07, 0x01, 0x88, 0x00, 0x03, 0x05, 0x9E, 0x19, 0x01, 0x97, 0x00, 0x02, 0x03, 0x02, 0xEF, 0x84,
+  0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x96, 0xFF, 0x02, 0x4A, 0x04, 0x03, 0x88,
+  0x00, 0x01, 0x05, 0x28, 0x8E, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x02, 0x03, 0x15, 0x01, 0x99,
+  0x00, 0x01, 0x15, 0x19, 0x84, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x95, 0xFF,
+  0x02, 0x7A, 0x04, 0x03, 0x88, 0x00, 0x02, 0x03, 0x12, 0x64, 0x8E, 0xFF, 0x01, 0x07, 0x01, 0x89,
+  0x00, 0x00, 0x03, 0x9B, 0x00, 0x01, 0x09, 0x9B, 0x83, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01,
+  0x05, 0x2A, 0x92, 0xFF, 0x04, 0xE1, 0x95, 0x09, 0x06, 0x03, 0x89, 0x00, 0x01, 0x06, 0x7E, 0x8F,
+  0xFF, 0x01, 0x07, 0x01, 0x92, 0x00, 0x83, 0x03, 0x8E, 0x00, 0x02, 0x03, 0x02, 0xFD, 0x82, 0xFF,
+  0x01, 0x08, 0x04, 0x89, 0x00, 0x02, 0x03, 0x70, 0x7F, 0x8B, 0x11, 0x08, 0x1B, 0x27, 0x77, 0x3E,
+  0x23, 0x09, 0x16, 0x06, 0x03, 0x8A, 0x00, 0x01, 0x03, 0x09, 0x90, 0xFF, 0x01, 0x07, 0x01, 0x90,
+  0x00, 0x09, 0x03, 0x06, 0x16, 0x04, 0x10, 0x09, 0x16, 0x10, 0x01, 0x17, 0x8C, 0x00, 0x01, 0x06,
+  0x84, 0x82, 0xFF, 0x01, 0x08, 0x04, 0x8A, 0x00, 0x00, 0x03, 0x8E, 0x05, 0x00, 0x15, 0x80, 0x01,
+  0x00, 0x03, 0x8C, 0x00, 0x02, 0x03, 0x12, 0x59, 0x90, 0xFF, 0x01, 0x07, 0x01, 0x8E, 0x00, 0x00,
+  0x03, 0x80, 0x06, 0x01, 0x2D, 0x32, 0x81, 0xFF, 0x04, 0x63, 0xAF, 0x1A, 0x09, 0x03, 0x8B, 0x00,
+  0x02, 0x03, 0x0A, 0xFB, 0x81, 0xFF, 0x01, 0x08, 0x04, 0xAC, 0x00, 0x02, 0x17, 0x02, 0x9C, 0x91,
+  0xFF, 0x01, 0x07, 0x01, 0x8D, 0x00, 0x02, 0x03, 0x02, 0x86, 0x87, 0xFF, 0x02, 0xAB, 0x02, 0x03,
+  0x8B, 0x00, 0x01, 0x10, 0x4E, 0x81, 0xFF, 0x01, 0x08, 0x04, 0xAB, 0x00, 0x02, 0x03, 0x02, 0x8C,
+  0x92, 0xFF, 0x01, 0x07, 0x01, 0x8C, 0x00, 0x02, 0x03, 0x0A, 0x51, 0x89, 0xFF, 0x02, 0x5F, 0x02,
+  0x03, 0x8A, 0x00, 0x80, 0x03, 0x81, 0xFF, 0x01, 0x08, 0x04, 0xAA, 0x00, 0x02, 0x01, 0x12, 0xA0,
+  0x93, 0xFF, 0x01, 0x07, 0x01, 0x8B, 0x00, 0x02, 0x17, 0x16, 0xAA, 0x8B, 0xFF, 0x02, 0xDA, 0x12,
+  0x03, 0x8A, 0x00, 0x01, 0x02, 0x5F, 0x80, 0xFF, 0x01, 0x08, 0x04, 0xA9, 0x00, 0x02, 0x01, 0x22,
+  0xDE, 0x94, 0xFF, 0x01, 0x07, 0x01, 0x8B, 0x00, 0x01, 0x05, 0x28, 0x8D, 0xFF, 0x01, 0x1F, 0x10,
+  0x8A, 0x00, 0x01, 0x06, 0x4B, 0x80, 0xFF, 0x01, 0x08, 0x04, 0xA8, 0x00, 0x02, 0x03, 0x05, 0x52,
+  0x95, 0xFF, 0x01, 0x07, 0x01, 0x8A, 0x00, 0x01, 0x03, 0x04, 0x8F, 0xFF, 0x01, 0x00, 0x01, 0x89,
+  0x00, 0x01, 0x01, 0x19, 0x80, 0xFF, 0x01, 0x08, 0x04, 0xA9, 0x00, 0x03, 0x03, 0x09, 0x10, 0x4E,
+  0x93, 0xFF, 0x01, 0x07, 0x01, 0x8A, 0x00, 0x01, 0x06, 0x2E, 0x8F, 0xFF, 0x01, 0xBE, 0x09, 0x89,
+  0x00, 0x01, 0x03, 0x0A, 0x80, 0xFF, 0x01, 0x08, 0x04, 0xAB, 0x00, 0x03, 0x03, 0x10, 0x06, 0xD5,
+  0x91, 0xFF, 0x01, 0x07, 0x01, 0x89, 0x00, 0x01, 0x03, 0x0A, 0x91, 0xFF, 0x01, 0x10, 0x03, 0x89,
+  0x00, 0x04, 0x04, 0xD0, 0xFF, 0x08, 0x04, 0xAD, 0x00, 0x02, 0x03, 0x12, 0x4A, 0x90, 0xFF, 0x01,
+  0x07, 0x01, 0x89, 0x00, 0x01, 0x05, 0x42, 0x91, 0xFF, 0x01, 0x47, 0x05, 0x89, 0x00, 0x04, 0x06,
+  0x4C, 0xFF, 0x08, 0x04, 0xAE, 0x00, 0x02, 0x03, 0x04, 0x78, 0x8F, 0xFF, 0x01, 0x07, 0x01, 0x89,
+  0x00, 0x01, 0x10, 0xB5, 0x91, 0xFF, 0x01, 0x54, 0x09, 0x89, 0x00, 0x04, 0x05, 0x7C, 0xFF, 0x08,
+  0x04, 0xB0, 0x00, 0x01, 0x10, 0x43, 0x8E, 0xFF, 0x01, 0x07, 0x01, 0x89, 0x00, 0x01, 0x02, 0xEA,
+  0x92, 0xFF, 0x01, 0x0A, 0x03, 0x88, 0x00, 0x04, 0x01, 0x25, 0xFF, 0x08, 0x04, 0xB1, 0x00, 0x01,
+  0x04, 0x93, 0x8D, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x03, 0x04, 0x93, 0xFF, 0x80, 0x03,
+  0x88, 0x00, 0x04, 0x03, 0x10, 0xFF, 0x08, 0x04, 0x8A, 0x00, 0x00, 0x01, 0x89, 0x09, 0x84, 0x10,
+  0x80, 0x06, 0x02, 0x05, 0x01, 0x03, 0x8E, 0x00, 0x02, 0x03, 0x39, 0xD4, 0x8C, 0xFF, 0x01, 0x07,
+  0x01, 0x88, 0x00, 0x01, 0x01, 0x24, 0x93, 0xFF, 0x01, 0x42, 0x05, 0x89, 0x00, 0x03, 0x0A, 0xFF,
+  0x08, 0x04, 0x89, 0x00, 0x02, 0x01, 0x3F, 0x31, 0x87, 0x14, 0x00, 0x53, 0x81, 0x21, 0x0A, 0x20,
+  0xB3, 0x4F, 0x2D, 0x88, 0x44, 0x1E, 0x10, 0x16, 0x06, 0x03, 0x8C, 0x00, 0x80, 0x01, 0x8C, 0xFF,
+  0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x05, 0x11, 0x93, 0xFF, 0x01, 0x89, 0x06, 0x89, 0x00, 0x03,
+  0x02, 0x35, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x11, 0x94, 0xFF, 0x04, 0x61, 0x2C, 0x10, 0x06,
+  0x17, 0x8B, 0x00, 0x01, 0x09, 0x4F, 0x8B, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x8F,
+  0x93, 0xFF, 0x01, 0xA3, 0x0E, 0x89, 0x00, 0x03, 0x16, 0x33, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05,
+  0x0B, 0x97, 0xFF, 0x02, 0x11, 0x16, 0x17, 0x8A, 0x00, 0x01, 0x03, 0x10, 0x8B, 0xFF, 0x01, 0x07,
+  0x01, 0x88, 0x00, 0x01, 0x06, 0x1F, 0x93, 0xFF, 0x01, 0x20, 0x10, 0x89, 0x00, 0x03, 0x04, 0xD6,
+  0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x98, 0xFF, 0x02, 0x9A, 0x16, 0x17, 0x8A, 0x00, 0x01,
+  0x09, 0x20, 0x8A, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x10, 0xA9, 0x93, 0xFF, 0x01, 0x14,
+  0x09, 0x89, 0x00, 0x03, 0x09, 0x58, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x99, 0xFF, 0x01,
+  0x2A, 0x06, 0x8A, 0x00, 0x01, 0x15, 0x26, 0x8A, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x10,
+  0xB0, 0x93, 0xFF, 0x01, 0x58, 0x04, 0x89, 0x00, 0x03, 0x09, 0x56, 0x08, 0x04, 0x89, 0x00, 0x01,
+  0x05, 0x0B, 0x9A, 0xFF, 0x01, 0x06, 0x03, 0x89, 0x00, 0x01, 0x03, 0x02, 0x8A, 0xFF, 0x01, 0x07,
+  0x01, 0x88, 0x00, 0x01, 0x10, 0xB1, 0x93, 0xFF, 0x01, 0xD3, 0x04, 0x89, 0x00, 0x03, 0x10, 0x14,
+  0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x9A, 0xFF, 0x01, 0xAD, 0x10, 0x8A, 0x00, 0x01, 0x04,
+  0xC8, 0x89, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x10, 0xB2, 0x93, 0xFF, 0x01, 0xDB, 0x04,
+  0x89, 0x00, 0x03, 0x10, 0xC0, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x9A, 0xFF, 0x02, 0x0C,
+  0x16, 0x03, 0x89, 0x00, 0x01, 0x06, 0x98, 0x89, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x10,
+  0xA7, 0x93, 0xFF, 0x01, 0x5C, 0x04, 0x89, 0x00, 0x03, 0x09, 0xC6, 0x08, 0x04, 0x89, 0x00, 0x01,
+  0x05, 0x0B, 0x9B, 0xFF, 0x01, 0x71, 0x01, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x89, 0xFF, 0x01, 0x07,
+  0x01, 0x88, 0x00, 0x01, 0x06, 0x4D, 0x93, 0xFF, 0x01, 0x5A, 0x04, 0x89, 0x00, 0x03, 0x09, 0x57,
+  0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x9B, 0xFF, 0x01, 0x1C, 0x05, 0x89, 0x00, 0x01, 0x01,
+  0x1E, 0x89, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x06, 0x2C, 0x93, 0xFF, 0x01, 0x55, 0x09,
+  0x89, 0x00, 0x03, 0x04, 0x5B, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x9B, 0xFF, 0x01, 0x2D,
+  0x06, 0x89, 0x00, 0x01, 0x03, 0x15, 0x89, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x05, 0x47,
+  0x93, 0xFF, 0x01, 0x21, 0x10, 0x89, 0x00, 0x03, 0x04, 0x5E, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05,
+  0x0B, 0x9B, 0xFF, 0x01, 0x2F, 0x0E, 0x89, 0x00, 0x01, 0x03, 0x06, 0x89, 0xFF, 0x01, 0x07, 0x01,
+  0x88, 0x00, 0x01, 0x05, 0x27, 0x93, 0xFF, 0x01, 0xA8, 0x10, 0x89, 0x00, 0x03, 0x16, 0x66, 0x08,
+  0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x9B, 0xFF, 0x01, 0xA2, 0x06, 0x89, 0x00, 0x01, 0x03, 0x0E,
+  0x89, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x01, 0x23, 0x93, 0xFF, 0x01, 0x90, 0x06, 0x89,
+  0x00, 0x03, 0x02, 0xFF, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x9B, 0xFF, 0x01, 0x0F, 0x06,
+  0x89, 0x00, 0x01, 0x03, 0x06, 0x89, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x03, 0x16, 0x93,
+  0xFF, 0x01, 0x45, 0x05, 0x88, 0x00, 0x04, 0x03, 0x02, 0xFF, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05,
+  0x0B, 0x9B, 0xFF, 0x01, 0x29, 0x05, 0x89, 0x00, 0x01, 0x03, 0x05, 0x89, 0xFF, 0x01, 0x07, 0x01,
+  0x89, 0x00, 0x01, 0x16, 0xE6, 0x92, 0xFF, 0x01, 0x3B, 0x03, 0x88, 0x00, 0x04, 0x01, 0x6D, 0xFF,
+  0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x9B, 0xFF, 0x01, 0x3C, 0x03, 0x89, 0x00, 0x01, 0x03,
+  0x1A, 0x89, 0xFF, 0x01, 0x07, 0x01, 0x89, 0x00, 0x01, 0x10, 0xB9, 0x92, 0xFF, 0x01, 0x0A, 0x03,
+  0x88, 0x00, 0x04, 0x05, 0x43, 0xFF, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x9A, 0xFF, 0x02,
+  0xE8, 0x02, 0x03, 0x89, 0x00, 0x01, 0x01, 0x26, 0x89, 0xFF, 0x01, 0x07, 0x01, 0x89, 0x00, 0x01,
+  0x05, 0x1B, 0x91, 0xFF, 0x01, 0xC3, 0x09, 0x89, 0x00, 0x04, 0x06, 0x92, 0xFF, 0x08, 0x04, 0x89,
+  0x00, 0x01, 0x05, 0x0B, 0x9A, 0xFF, 0x01, 0x2B, 0x06, 0x8A, 0x00, 0x01, 0x05, 0x46, 0x89, 0xFF,
+  0x01, 0x07, 0x01, 0x89, 0x00, 0x01, 0x03, 0x16, 0x91, 0xFF, 0x01, 0x1C, 0x05, 0x89, 0x00, 0x04,
+  0x10, 0xBC, 0xFF, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x99, 0xFF, 0x02, 0xF3, 0x02, 0x03,
+  0x8A, 0x00, 0x01, 0x06, 0x9F, 0x89, 0xFF, 0x01, 0x07, 0x01, 0x8A, 0x00, 0x01, 0x10, 0xB4, 0x90,
+  0xFF, 0x01, 0x09, 0x03, 0x89, 0x00, 0x04, 0x02, 0xEE, 0xFF, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05,
+  0x0B, 0x99, 0xFF, 0x01, 0x23, 0x01, 0x8B, 0x00, 0x01, 0x04, 0xCC, 0x89, 0xFF, 0x01, 0x07, 0x01,
+  0x8A, 0x00, 0x80, 0x03, 0x8F, 0xFF, 0x01, 0xB6, 0x09, 0x89, 0x00, 0x01, 0x03, 0x06, 0x80, 0xFF,
+  0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x0B, 0x98, 0xFF, 0x01, 0x73, 0x06, 0x8B, 0x00, 0x01,
+  0x03, 0x16, 0x8A, 0xFF, 0x01, 0x07, 0x01, 0x8B, 0x00, 0x01, 0x09, 0xA5, 0x8E, 0xFF, 0x01, 0x05,
+  0x03, 0x89, 0x00, 0x01, 0x05, 0x11, 0x80, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x01, 0x05, 0x7B,
+  0x96, 0xFF, 0x02, 0x54, 0x01, 0x05, 0x8C, 0x00, 0x01, 0x01, 0x3E, 0x8A, 0xFF, 0x01, 0x07, 0x01,
+  0x8B, 0x00, 0x02, 0x03, 0x02, 0xEB, 0x8C, 0xFF, 0x01, 0x49, 0x06, 0x8A, 0x00, 0x01, 0x09, 0x30,
+  0x80, 0xFF, 0x01, 0x08, 0x04, 0x89, 0x00, 0x02, 0x05, 0x0B, 0xFF, 0x8B, 0x13, 0x0B, 0xF7, 0x65,
+  0x63, 0xE2, 0x5D, 0xC7, 0xB7, 0x2E, 0x29, 0x15, 0x04, 0x03, 0x8D, 0x00, 0x01, 0x10, 0xAE, 0x8A,
+  0xFF, 0x01, 0x07, 0x01, 0x8C, 0x00, 0x01, 0x01, 0x15, 0x8B, 0xFF, 0x02, 0xBF, 0x02, 0x03, 0x89,
+  0x00, 0x01, 0x03, 0x02, 0x81, 0xFF, 0x01, 0x08, 0x04, 0x8A, 0x00, 0x00, 0x05, 0x8D, 0x02, 0x81,
+  0x16, 0x05, 0x04, 0x09, 0x10, 0x06, 0x05, 0x03, 0x8E, 0x00, 0x02, 0x03, 0x02, 0xFE, 0x8A, 0xFF,
+  0x01, 0x07, 0x01, 0x8D, 0x00, 0x02, 0x15, 0x05, 0x65, 0x88, 0xFF, 0x02, 0xC2, 0x0A, 0x03, 0x8A,
+  0x00, 0x01, 0x05, 0x44, 0x81, 0xFF, 0x01, 0x08, 0x04, 0xB3, 0x00, 0x01, 0x05, 0x1B, 0x8B, 0xFF,
+  0x01, 0x07, 0x01, 0x8E, 0x00, 0x02, 0x01, 0x0A, 0x4C, 0x86, 0xFF, 0x02, 0x8D, 0x02, 0x03, 0x8B,
+  0x00, 0x01, 0x02, 0x5C, 0x81, 0xFF, 0x01, 0x08, 0x04, 0xB2, 0x00, 0x02, 0x03, 0x0A, 0x34, 0x8B,
+  0xFF, 0x01, 0x07, 0x01, 0x8F, 0x00, 0x00, 0x03, 0x80, 0x10, 0x08, 0x49, 0xC1, 0xDF, 0x32, 0xC9,
+  0x91, 0x10, 0x06, 0x03, 0x8B, 0x00, 0x01, 0x01, 0x3C, 0x82, 0xFF, 0x01, 0x08, 0x04, 0xB2, 0x00,
+  0x01, 0x06, 0x7C, 0x8C, 0xFF, 0x01, 0x07, 0x01, 0x91, 0x00, 0x07, 0x03, 0x05, 0x09, 0x04, 0x16,
+  0x09, 0x06, 0x03, 0x8D, 0x00, 0x01, 0x16, 0x53, 0x82, 0xFF, 0x01, 0x08, 0x04, 0xB1, 0x00, 0x01,
+  0x03, 0x09, 0x8D, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x01, 0x03, 0x9B, 0x00, 0x01, 0x01,
+  0x23, 0x83, 0xFF, 0x01, 0x08, 0x04, 0xB0, 0x00, 0x02, 0x03, 0x0A, 0xC4, 0x8D, 0xFF, 0x01, 0x07,
+  0x01, 0x87, 0x00, 0x03, 0x01, 0x1B, 0x06, 0x03, 0x99, 0x00, 0x02, 0x03, 0x38, 0x32, 0x83, 0xFF,
+  0x01, 0x08, 0x04, 0xB0, 0x00, 0x01, 0x09, 0x48, 0x8E, 0xFF, 0x01, 0x07, 0x01, 0x87, 0x00, 0x03,
+  0x06, 0xA6, 0x99, 0x10, 0x99, 0x00, 0x01, 0x09, 0x2C, 0x84, 0xFF, 0x01, 0x08, 0x04, 0xAF, 0x00,
+  0x01, 0x06, 0x74, 0x8F, 0xFF, 0x01, 0x07, 0x01, 0x87, 0x00, 0x04, 0x06, 0x4B, 0xFF, 0x3A, 0x01,
+  0x97, 0x00, 0x01, 0x05, 0x1E, 0x85, 0xFF, 0x01, 0x08, 0x04, 0xAE, 0x00, 0x01, 0x10, 0x25, 0x90,
+  0xFF, 0x01, 0x07, 0x01, 0x87, 0x00, 0x05, 0x06, 0x1D, 0xFF, 0xF5, 0x02, 0x03, 0x95, 0x00, 0x01,
+  0x01, 0x06, 0x86, 0xFF, 0x01, 0x08, 0x04, 0xAC, 0x00, 0x02, 0x03, 0x16, 0x27, 0x91, 0xFF, 0x01,
+  0x07, 0x01, 0x87, 0x00, 0x01, 0x06, 0x1D, 0x80, 0xFF, 0x02, 0xD9, 0x12, 0x03, 0x93, 0x00, 0x02,
+  0x01, 0x04, 0x64, 0x86, 0xFF, 0x01, 0x08, 0x04, 0xAA, 0x00, 0x03, 0x03, 0x05, 0x0A, 0x4D, 0x92,
+  0xFF, 0x01, 0x07, 0x01, 0x87, 0x00, 0x01, 0x06, 0x1D, 0x81, 0xFF, 0x02, 0x5B, 0x38, 0x03, 0x91,
+  0x00, 0x02, 0x01, 0x16, 0xE7, 0x87, 0xFF, 0x01, 0x08, 0x04, 0xA8, 0x00, 0x04, 0x03, 0x05, 0x0A,
+  0x76, 0xEC, 0x93, 0xFF, 0x01, 0x07, 0x01, 0x87, 0x00, 0x01, 0x06, 0x1D, 0x82, 0xFF, 0x02, 0xE3,
+  0x10, 0x05, 0x8E, 0x00, 0x03, 0x03, 0x06, 0x03, 0x35, 0x88, 0xFF, 0x01, 0x08, 0x04, 0x9E, 0x00,
+  0x81, 0x03, 0x02, 0x01, 0x15, 0x05, 0x80, 0x06, 0x04, 0x09, 0x02, 0x06, 0x1C, 0x60, 0x95, 0xFF,
+  0x01, 0x07, 0x01, 0x87, 0x00, 0x01, 0x06, 0x1D, 0x84, 0xFF, 0x02, 0x40, 0x02, 0x01, 0x8B, 0x00,
+  0x02, 0x01, 0x0A, 0x29, 0x8A, 0xFF, 0x01, 0x31, 0x69, 0x9C, 0x02, 0x0B, 0x0A, 0x12, 0x10, 0x05,
+  0x3B, 0x1E, 0x75, 0x0B, 0x2B, 0x9D, 0xBD, 0x61, 0x98, 0xFF, 0x01, 0x3A, 0x12, 0x87, 0x02, 0x01,
+  0x6B, 0x8A, 0x85, 0xFF, 0x04, 0x55, 0x3A, 0x16, 0x05, 0x03, 0x85, 0x00, 0x04, 0x03, 0x05, 0x02,
+  0x6E, 0xCE, 0x8C, 0xFF, 0x00, 0x68, 0x98, 0x0C, 0x00, 0x36, 0xA7, 0xFF, 0x01, 0xF9, 0x36, 0x87,
+  0x0C, 0x01, 0xFA, 0x0C, 0x87, 0xFF, 0x01, 0x31, 0x7D, 0x80, 0x03, 0x83, 0x00, 0x03, 0x03, 0x00,
+  0x87, 0xD2, 0x8D, 0xFF,
+};
+
+GUI_CONST_STORAGE GUI_BITMAP bmb_rle = {
+  120, // xSize
+  86, // ySize
+  120, // BytesPerLine
+  8, // BitsPerPixel
+  (const unsigned char *)_acbmb_rle,  // Pointer to run-length stream
+  &_Palbmb_rle,  // Pointer to palette
+  &LCD_RLE_METHODS_8BPP
+};
+
+/* [] END OF FILE */
@@ -0,0 +1,418 @@
+/*
+ * ball_rle.c
+ *
+ *  Generated by tools/bmp_rle.py from ball.c, do not edit.
+ *  100 x 99 pixels, 9900 bytes raw, 3980 bytes run-length coded.
+ */
+
+#include "GUI.h"
+#include "lcd_rle.h"
+
+#ifndef GUI_CONST_STORAGE
+  #define GUI_CONST_STORAGE const
+#endif
+
+static GUI_CONST_STORAGE GUI_COLOR _Colorsball[] = {
+#if (GUI_USE_ARGB == 0)
+  0x036BEC, 0xF5EAE4, 0x2C32E8, 0x4C51F0,
+  0xA74400, 0xF8F2ED, 0x2D76EE, 0x0614D3,
+  0x1827E3, 0x1624DB, 0xE5DAD9, 0x8488FB,
+  0xECE1DD, 0x00BCF2, 0x3A43ED, 0x747AF9,
+  0xB34A01, 0x7C82FA, 0x9B4105, 0x6469F5,
+  0x77AD00, 0x974417, 0xDCD4D9, 0xECE4E1,
+  0x983D05, 0x5866F4, 0x86B300, 0xD6CCD9,
+  0x01C1F4, 0xD9C5BA, 0x262EDD, 0x6B72F8,
+  0x7AB100, 0xF6E5DC, 0x6F6BDB, 0x5787EB,
+  0xDCD2C6, 0x9B4923, 0x02B9ED, 0x4783F2,
+  0xDBCAC3, 0xA95528, 0xD9D2BC, 0x38B9E9,
+  0x57BBE5, 0x3983F7, 0x4882EC, 0xA63D00,
+  0xA75A37, 0x46BAE8, 0xA34A18, 0x28BAEB,
+  0x95B638, 0x5689F1, 0x658BEA, 0x95B448,
+  0xAA5119, 0x5253DC, 0x615EE8, 0x83AD02,
+  0x8CAA44, 0x9594F5, 0x0282F7, 0x8D3407,
+  0xB13D00, 0xD7D7E7, 0xE7E8F5, 0x0C1BE2,
+  0x0E4DF0, 0x7997E9, 0x963C16, 0x93B627,
+  0xA8A7F3, 0xC8E7F5, 0xE0D4CA, 0xE4DDE2,
+  0x3353AF, 0x6EB400, 0x6AB5DB, 0xC49B88,
+  0xC4C4F3, 0xE9F2F8, 0x2C55CD, 0x22BEF3,
+  0x13C3F2, 0x68BCE2, 0xA14C22, 0xB8B8E8,
+  0xD7BDB3, 0x1858CC, 0x7876E2, 0x1AB7E9,
+  0x6995EA, 0x76BBDD, 0x56C3EA, 0x956A00,
+  0x92B505, 0x87A629, 0x9AB264, 0x9896E3,
+  0x95A9EA, 0xB9D9E4, 0xC3D397, 0xC6D1A9,
+  0xD7D6F3, 0x724152, 0x1660D8, 0x336BDD,
+  0x494D8F, 0x16BDF0, 0x44ABDA, 0x54B2DE,
+  0x658DF0, 0x76C3E4, 0x833D36, 0x8C7703,
+  0xB57758, 0x85AB14, 0x8DB314, 0x94B518,
+  0x8FB326, 0x9892DB, 0x8E90F7, 0xA19EF3,
+  0xB7C584, 0x82D6EA, 0x95CAE3, 0xA9D4E5,
+  0xD5B7AA, 0xC6C1DB, 0xDCE5CA, 0xCBE2E8,
+  0xDAE9F5, 0x594675, 0x6E4A6A, 0x211DDA,
+  0x4658AD, 0x526DDC, 0x605FDC, 0x799700,
+  0x7BA81B, 0x3BC1ED, 0x47B0DE, 0x59AED9,
+  0x88443C, 0x994C37, 0xA75405, 0xB0552A,
+  0xA66547, 0xB47A65, 0x8AAC35, 0xB98B77,
+  0xADC375, 0xC1927D, 0x8787DA, 0x819BE4,
+  0x918EE4, 0x9BB5EB, 0xA49CEA, 0xA8B8EB,
+  0x9AC3DA, 0x87C8E8, 0xC9A08C, 0xC2BCE9,
+  0xCED7B6, 0xCCC9EE, 0xC7D2EE, 0xD6CDE9,
+  0xD9E4E4, 0xE0CEC7, 0x7C3D3E, 0x60558C,
+  0x716CE6, 0x6FAC00, 0x6CAC6A, 0x19AE93,
+  0x39B5AC, 0x1280F6, 0x2287FA, 0x3BABDB,
+  0x3CBCFB, 0x25C0EF, 0x26C2F4, 0x3BC8F1,
+  0x48B7B8, 0x58B9AB, 0x6AB69B, 0x5B92E8,
+  0x51BBF9, 0x6990F2, 0x7397F3, 0x64AFD6,
+  0x60BBF6, 0x46C3EE, 0x4DD3F1, 0x5CD4EF,
+  0x66C1E6, 0x71D2EE, 0x8A2F00, 0x8D3812,
+  0xA23911, 0x9F573A, 0x977313, 0x946D2E,
+  0x9C6236, 0xB34C19, 0xB04D22, 0xB25632,
+  0x874D5A, 0x9B5840, 0x935A53, 0xA05F41,
+  0xAE755F, 0x857FDF, 0x878300, 0x838A24,
+  0x8CB037, 0x92AE4B, 0x91AD51, 0x9CB757,
+  0xBF886F, 0xA0BA64, 0xA9BD7D, 0xA8C268,
+  0xC08F79, 0x8280EC, 0x8CA4EA, 0xAAA4DE,
+  0xA5B5DF, 0xB3ABDE, 0xB8BCDD, 0xA6A2E3,
+  0xA4B7F2, 0xB3B2F0, 0xAEC184, 0x8EC1DE,
+  0x99DDEB, 0xBEC0DC, 0xA9CCE1, 0xBDC1E0,
+  0xB4DFF1, 0xBFE3E8, 0xCBA795, 0xCDB0A5,
+  0xC2B8D9, 0xC0BCF5, 0xC0CA8B, 0xC2CB97,
+  0xC0D48A, 0xCFD9F7, 0xDDE4D1, 0xD7F0F9,
+  0xF7DFDD, 0xE4F0DF, 0xFDF2DF, 0xFEFEFE
+#else
+  0xFFEC6B03, 0xFFE4EAF5, 0xFFE8322C, 0xFFF0514C,
+  0xFF0044A7, 0xFFEDF2F8, 0xFFEE762D, 0xFFD31406,
+  0xFFE32718, 0xFFDB2416, 0xFFD9DAE5, 0xFFFB8884,
+  0xFFDDE1EC, 0xFFF2BC00, 0xFFED433A, 0xFFF97A74,
+  0xFF014AB3, 0xFFFA827C, 0xFF05419B, 0xFFF56964,
+  0xFF00AD77, 0xFF174497, 0xFFD9D4DC, 0xFFE1E4EC,
+  0xFF053D98, 0xFFF46658, 0xFF00B386, 0xFFD9CCD6,
+  0xFFF4C101, 0xFFBAC5D9, 0xFFDD2E26, 0xFFF8726B,
+  0xFF00B17A, 0xFFDCE5F6, 0xFFDB6B6F, 0xFFEB8757,
+  0xFFC6D2DC, 0xFF23499B, 0xFFEDB902, 0xFFF28347,
+  0xFFC3CADB, 0xFF2855A9, 0xFFBCD2D9, 0xFFE9B938,
+  0xFFE5BB57, 0xFFF78339, 0xFFEC8248, 0xFF003DA6,
+  0xFF375AA7, 0xFFE8BA46, 0xFF184AA3, 0xFFEBBA28,
+  0xFF38B695, 0xFFF18956, 0xFFEA8B65, 0xFF48B495,
+  0xFF1951AA, 0xFFDC5352, 0xFFE85E61, 0xFF02AD83,
+  0xFF44AA8C, 0xFFF59495, 0xFFF78202, 0xFF07348D,
+  0xFF003DB1, 0xFFE7D7D7, 0xFFF5E8E7, 0xFFE21B0C,
+  0xFFF04D0E, 0xFFE99779, 0xFF163C96, 0xFF27B693,
+  0xFFF3A7A8, 0xFFF5E7C8, 0xFFCAD4E0, 0xFFE2DDE4,
+  0xFFAF5333, 0xFF00B46E, 0xFFDBB56A, 0xFF889BC4,
+  0xFFF3C4C4, 0xFFF8F2E9, 0xFFCD552C, 0xFFF3BE22,
+  0xFFF2C313, 0xFFE2BC68, 0xFF224CA1, 0xFFE8B8B8,
+  0xFFB3BDD7, 0xFFCC5818, 0xFFE27678, 0xFFE9B71A,
+  0xFFEA9569, 0xFFDDBB76, 0xFFEAC356, 0xFF006A95,
+  0xFF05B592, 0xFF29A687, 0xFF64B29A, 0xFFE39698,
+  0xFFEAA995, 0xFFE4D9B9, 0xFF97D3C3, 0xFFA9D1C6,
+  0xFFF3D6D7, 0xFF524172, 0xFFD86016, 0xFFDD6B33,
+  0xFF8F4D49, 0xFFF0BD16, 0xFFDAAB44, 0xFFDEB254,
+  0xFFF08D65, 0xFFE4C376, 0xFF363D83, 0xFF03778C,
+  0xFF5877B5, 0xFF14AB85, 0xFF14B38D, 0xFF18B594,
+  0xFF26B38F, 0xFFDB9298, 0xFFF7908E, 0xFFF39EA1,
+  0xFF84C5B7, 0xFFEAD682, 0xFFE3CA95, 0xFFE5D4A9,
+  0xFFAAB7D5, 0xFFDBC1C6, 0xFFCAE5DC, 0xFFE8E2CB,
+  0xFFF5E9DA, 0xFF754659, 0xFF6A4A6E, 0xFFDA1D21,
+  0xFFAD5846, 0xFFDC6D52, 0xFFDC5F60, 0xFF009779,
+  0xFF1BA87B, 0xFFEDC13B, 0xFFDEB047, 0xFFD9AE59,
+  0xFF3C4488, 0xFF374C99, 0xFF0554A7, 0xFF2A55B0,
+  0xFF4765A6, 0xFF657AB4, 0xFF35AC8A, 0xFF778BB9,
+  0xFF75C3AD, 0xFF7D92C1, 0xFFDA8787, 0xFFE49B81,
+  0xFFE48E91, 0xFFEBB59B, 0xFFEA9CA4, 0xFFEBB8A8,
+  0xFFDAC39A, 0xFFE8C887, 0xFF8CA0C9, 0xFFE9BCC2,
+  0xFFB6D7CE, 0xFFEEC9CC, 0xFFEED2C7, 0xFFE9CDD6,
+  0xFFE4E4D9, 0xFFC7CEE0, 0xFF3E3D7C, 0xFF8C5560,
+  0xFFE66C71, 0xFF00AC6F, 0xFF6AAC6C, 0xFF93AE19,
+  0xFFACB539, 0xFFF68012, 0xFFFA8722, 0xFFDBAB3B,
+  0xFFFBBC3C, 0xFFEFC025, 0xFFF4C226, 0xFFF1C83B,
+  0xFFB8B748, 0xFFABB958, 0xFF9BB66A, 0xFFE8925B,
+  0xFFF9BB51, 0xFFF29069, 0xFFF39773, 0xFFD6AF64,
+  0xFFF6BB60, 0xFFEEC346, 0xFFF1D34D, 0xFFEFD45C,
+  0xFFE6C166, 0xFFEED271, 0xFF002F8A, 0xFF12388D,
+  0xFF1139A2, 0xFF3A579F, 0xFF137397, 0xFF2E6D94,
+  0xFF36629C, 0xFF194CB3, 0xFF224DB0, 0xFF3256B2,
+  0xFF5A4D87, 0xFF40589B, 0xFF535A93, 0xFF415FA0,
+  0xFF5F75AE, 0xFFDF7F85, 0xFF008387, 0xFF248A83,
+  0xFF37B08C, 0xFF4BAE92, 0xFF51AD91, 0xFF57B79C,
+  0xFF6F88BF, 0xFF64BAA0, 0xFF7DBDA9, 0xFF68C2A8,
+  0xFF798FC0, 0xFFEC8082, 0xFFEAA48C, 0xFFDEA4AA,
+  0xFFDFB5A5, 0xFFDEABB3, 0xFFDDBCB8, 0xFFE3A2A6,
+  0xFFF2B7A4, 0xFFF0B2B3, 0xFF84C1AE, 0xFFDEC18E,
+  0xFFEBDD99, 0xFFDCC0BE, 0xFFE1CCA9, 0xFFE0C1BD,
+  0xFFF1DFB4, 0xFFE8E3BF, 0xFF95A7CB, 0xFFA5B0CD,
+  0xFFD9B8C2, 0xFFF5BCC0, 0xFF8BCAC0, 0xFF97CBC2,
+  0xFF8AD4C0, 0xFFF7D9CF, 0xFFD1E4DD, 0xFFF9F0D7,
+  0xFFDDDFF7, 0xFFDFF0E4, 0xFFDFF2FD, 0xFFFEFEFE
+#endif
+
+};
+
+static GUI_CONST_STORAGE GUI_LOGPALETTE _Palbmball_rle = {
+  256,  // Number of entries
+  0,    // No transparency
+  (const LCD_COLOR *)&_Colorsball[0]
+};
+
+static GUI_CONST_STORAGE unsigned char _acbmball_rle[] = {
+  0xAB, 0xFF, 0x01, 0x51, 0xFB, 0x83, 0x49, 0x00, 0xFB, 0x80, 0x51, 0xD3, 0xFF, 0x01, 0x05, 0x01,
+  0x80, 0x0C, 0x80, 0x0A, 0x03, 0x16, 0x65, 0x7F, 0x71, 0x80, 0x5E, 0x80, 0x2C, 0x80, 0x55, 0x04,
+  0x71, 0x7E, 0x7F, 0x49, 0x51, 0xC9, 0xFF, 0x00, 0x05, 0x85, 0x01, 0x01, 0x21, 0x17, 0x82, 0x21,
+  0x04, 0xA8, 0xC5, 0xB6, 0x8D, 0xC1, 0x80, 0x5E, 0x00, 0xC4, 0x80, 0x55, 0x03, 0x4E, 0x5D, 0x7E,
+  0x49, 0xC3, 0xFF, 0x00, 0x05, 0x8C, 0x01, 0x80, 0x17, 0x80, 0x21, 0x01, 0xA8, 0x54, 0x81, 0x1C,
+  0x04, 0x54, 0xB5, 0x8D, 0x5E, 0x2C, 0x80, 0x55, 0x02, 0x4E, 0x71, 0xF0, 0xBD, 0xFF, 0x00, 0x05,
+  0x8F, 0x01, 0x06, 0x21, 0x01, 0x17, 0x01, 0x21, 0xFE, 0x7D, 0x84, 0x1C, 0x02, 0x54, 0xB5, 0x31,
+  0x80, 0x2C, 0x03, 0x31, 0x2B, 0xA1, 0x51, 0xB8, 0xFF, 0x00, 0x05, 0x96, 0x01, 0x02, 0x17, 0x21,
+  0xF1, 0x85, 0x1C, 0x02, 0x0D, 0x54, 0xB5, 0x80, 0x31, 0x03, 0x33, 0x2B, 0xA0, 0x51, 0xB4, 0xFF,
+  0x00, 0x05, 0x98, 0x01, 0x80, 0x17, 0x01, 0x21, 0x17, 0x85, 0x1C, 0x81, 0x0D, 0x06, 0x6D, 0x33,
+  0x2B, 0x2C, 0xBF, 0xA0, 0x51, 0xB0, 0xFF, 0x01, 0x05, 0x17, 0x9A, 0x01, 0x80, 0x17, 0x01, 0x21,
+  0x01, 0x82, 0x1C, 0x84, 0x0D, 0x80, 0x26, 0x04, 0x5B, 0x31, 0x6F, 0xBF, 0xEE, 0xAE, 0xFF, 0x9D,
+  0x01, 0x81, 0x17, 0x01, 0x21, 0x01, 0x83, 0x1C, 0x84, 0x0D, 0x80, 0x26, 0x04, 0x5B, 0x31, 0x6F,
+  0x4E, 0x83, 0xAA, 0xFF, 0x00, 0x05, 0xA1, 0x01, 0x02, 0x17, 0x01, 0x17, 0x82, 0x1C, 0x84, 0x0D,
+  0x01, 0x26, 0x0D, 0x80, 0x26, 0x03, 0x33, 0x8E, 0x8F, 0xEB, 0xA8, 0xFF, 0x00, 0x05, 0x9E, 0x01,
+  0x80, 0x17, 0x80, 0x01, 0x80, 0x17, 0x01, 0x21, 0x83, 0x82, 0x1C, 0x83, 0x0D, 0x01, 0x26, 0x0D,
+  0x82, 0x26, 0x03, 0x33, 0x8E, 0xBF, 0x84, 0xA5, 0xFF, 0x89, 0x01, 0x82, 0x05, 0x80, 0x01, 0x81,
+  0x05, 0x8E, 0x01, 0x83, 0x17, 0x01, 0x21, 0xEC, 0x81, 0x1C, 0x86, 0x0D, 0x82, 0x26, 0x03, 0x5B,
+  0x2B, 0x6E, 0x65, 0xA3, 0xFF, 0x87, 0x01, 0x80, 0x05, 0x04, 0x01, 0x05, 0x01, 0x05, 0x01, 0x80,
+  0x05, 0x91, 0x01, 0x84, 0x17, 0x01, 0x21, 0xC2, 0x80, 0x1C, 0x85, 0x0D, 0x00, 0x26, 0x80, 0x0D,
+  0x00, 0x26, 0x81, 0x33, 0x02, 0x2B, 0x6E, 0x7E, 0xA0, 0xFF, 0x00, 0x05, 0x86, 0x01, 0x8A, 0x05,
+  0x01, 0x01, 0x05, 0x8F, 0x01, 0x84, 0x17, 0x01, 0x21, 0x54, 0x89, 0x0D, 0x03, 0x1C, 0xB5, 0x2B,
+  0x8D, 0x80, 0x2B, 0x01, 0xB3, 0x5D, 0x9E, 0xFF, 0x00, 0x05, 0x80, 0x01, 0x01, 0x05, 0x01, 0x80,
+  0x05, 0x00, 0x01, 0x8C, 0x05, 0x8F, 0x01, 0x86, 0x17, 0x02, 0x21, 0x83, 0x1C, 0x86, 0x0D, 0x81,
+  0x1C, 0x03, 0x6D, 0xB5, 0x8D, 0x31, 0x80, 0x2C, 0x01, 0x6E, 0x4E, 0x9C, 0xFF, 0x00, 0x05, 0x82,
+  0x01, 0x80, 0x05, 0x00, 0x01, 0x8D, 0x05, 0x8D, 0x01, 0x89, 0x17, 0x01, 0x21, 0xC3, 0x86, 0x0D,
+  0x81, 0x1C, 0x01, 0x54, 0x53, 0x80, 0x8D, 0x00, 0x31, 0x80, 0x2C, 0x01, 0x8E, 0x4E, 0x9A, 0xFF,
+  0x00, 0x05, 0x84, 0x01, 0x90, 0x05, 0x8E, 0x01, 0x85, 0x17, 0x80, 0x0C, 0x02, 0x17, 0x21, 0x1C,
+  0x83, 0x0D, 0x84, 0x1C, 0x02, 0x54, 0xB5, 0x2B, 0x80, 0x31, 0x80, 0x2C, 0x01, 0x6F, 0x5D, 0x99,
+  0xFF, 0x82, 0x01, 0x95, 0x05, 0x8A, 0x01, 0x86, 0x17, 0x82, 0x0C, 0x01, 0x21, 0x65, 0x83, 0x0D,
+  0x85, 0x1C, 0x02, 0x6D, 0xB5, 0x8D, 0x80, 0x31, 0x80, 0x2C, 0x01, 0x6F, 0xA1, 0x97, 0xFF, 0x82,
+  0x01, 0x96, 0x05, 0x88, 0x01, 0x80, 0x17, 0x00, 0x01, 0x83, 0x17, 0x85, 0x0C, 0x00, 0x21, 0x80,
+  0x41, 0x04, 0xA8, 0x41, 0x65, 0x7D, 0xB7, 0x84, 0x1C, 0x03, 0x6D, 0x33, 0x8D, 0x31, 0x80, 0x2C,
+  0x02, 0xC0, 0xAE, 0x66, 0x95, 0xFF, 0x81, 0x01, 0x99, 0x05, 0x88, 0x01, 0x84, 0x17, 0x83, 0x0C,
+  0x80, 0x17, 0x80, 0x0C, 0x00, 0x17, 0x82, 0x4B, 0x03, 0x0C, 0x21, 0x0C, 0x7D, 0x82, 0x1C, 0x09,
+  0x0D, 0x53, 0x2B, 0x8D, 0x31, 0xBC, 0xBA, 0x77, 0x61, 0x82, 0x93, 0xFF, 0x01, 0x05, 0x01, 0x9D,
+  0x05, 0x85, 0x01, 0x82, 0x17, 0x01, 0x0C, 0x17, 0x83, 0x0C, 0x00, 0x17, 0x83, 0x0C, 0x83, 0x4B,
+  0x04, 0x16, 0x4B, 0x0C, 0xFC, 0x5E, 0x80, 0x0D, 0x09, 0x1C, 0x54, 0xB5, 0x2B, 0xB4, 0xB9, 0x60,
+  0x77, 0x34, 0xD8, 0x93, 0xFF, 0x00, 0x01, 0x9F, 0x05, 0x83, 0x01, 0x83, 0x17, 0x84, 0x0C, 0x02,
+  0x17, 0x0C, 0x17, 0x81, 0x0C, 0x80, 0x17, 0x85, 0x4B, 0x02, 0x0A, 0xFC, 0x7F, 0x81, 0x0D, 0x02,
+  0x6D, 0x53, 0xB8, 0x81, 0x60, 0x02, 0x47, 0x34, 0xDD, 0x91, 0xFF, 0x00, 0x01, 0xA0, 0x05, 0x82,
+  0x01, 0x84, 0x17, 0x83, 0x0C, 0x00, 0x17, 0x81, 0x0C, 0x01, 0x0A, 0x0C, 0x87, 0x17, 0x00, 0x4B,
+  0x80, 0x16, 0x06, 0x0C, 0x4B, 0x26, 0x0D, 0x1C, 0xB0, 0x60, 0x80, 0x1A, 0x04, 0x60, 0x76, 0x34,
+  0xD8, 0xA4, 0x8F, 0xFF, 0x01, 0x05, 0x01, 0xA1, 0x05, 0x81, 0x01, 0x82, 0x17, 0x85, 0x0C, 0x80,
+  0x17, 0x81, 0x0C, 0x01, 0x17, 0x0C, 0x82, 0x17, 0x84, 0x4B, 0x80, 0x16, 0x03, 0x0A, 0x4B, 0x1C,
+  0xAF, 0x83, 0x1A, 0x03, 0x60, 0x47, 0x34, 0x3C, 0x8F, 0xFF, 0x00, 0x01, 0x8C, 0x05, 0x04, 0x42,
+  0x68, 0xA5, 0xF5, 0x48, 0x80, 0x7B, 0x80, 0x3D, 0x80, 0x48, 0x06, 0x7B, 0xE9, 0xA3, 0xA5, 0xA7,
+  0x41, 0x01, 0x80, 0x05, 0x82, 0xFE, 0x81, 0x01, 0x80, 0x17, 0x83, 0x0C, 0x00, 0x0A, 0x81, 0x0C,
+  0x01, 0x17, 0x0C, 0x81, 0x17, 0x80, 0x0C, 0x01, 0x17, 0x0C, 0x85, 0x4B, 0x80, 0x16, 0x02, 0x4B,
+  0x4A, 0x14, 0x80, 0x20, 0x82, 0x1A, 0x03, 0x60, 0x47, 0x37, 0x98, 0x8D, 0xFF, 0x00, 0x01, 0x87,
+  0x05, 0x04, 0x68, 0x50, 0x48, 0x3D, 0x0B, 0x85, 0x11, 0x89, 0x0B, 0x0B, 0x11, 0x0F, 0x1F, 0x0F,
+  0xE1, 0x9C, 0x9E, 0xA3, 0xA7, 0x4B, 0x01, 0xFE, 0x80, 0x21, 0x81, 0x0C, 0x01, 0x0A, 0x17, 0x80,
+  0x0C, 0x00, 0x0A, 0x81, 0x17, 0x81, 0x0C, 0x01, 0x17, 0x0C, 0x84, 0x4B, 0x00, 0x0A, 0x80, 0x16,
+  0x03, 0xA4, 0xA9, 0x37, 0x14, 0x80, 0x20, 0x82, 0x1A, 0x03, 0x76, 0x34, 0x3C, 0xFD, 0x8B, 0xFF,
+  0x01, 0x05, 0x01, 0x83, 0x05, 0x03, 0x68, 0x48, 0x0B, 0x1F, 0x80, 0x11, 0x81, 0x0B, 0x00, 0x7A,
+  0x8C, 0x0B, 0x00, 0x7A, 0x81, 0x3D, 0x0F, 0x7A, 0x0B, 0x0F, 0x1F, 0x03, 0x0E, 0x02, 0x43, 0x08,
+  0x02, 0x03, 0x63, 0x81, 0x0C, 0xFE, 0x21, 0x82, 0x0C, 0x01, 0x0A, 0x17, 0x83, 0x0C, 0x00, 0x17,
+  0x81, 0x0C, 0x00, 0x0A, 0x80, 0x4B, 0x81, 0x0A, 0x82, 0x2A, 0x00, 0x14, 0x81, 0x20, 0x82, 0x1A,
+  0x02, 0x47, 0x37, 0xDD, 0x8B, 0xFF, 0x00, 0x01, 0x81, 0x05, 0x03, 0xA7, 0x3D, 0x1F, 0x13, 0x80,
+  0x0F, 0x00, 0x11, 0x81, 0x0B, 0x00, 0x7A, 0x8E, 0x0B, 0x83, 0x7A, 0x04, 0x11, 0x0F, 0x13, 0x03,
+  0x0E, 0x80, 0x02, 0x81, 0x08, 0x81, 0x43, 0x02, 0x0E, 0x22, 0xE5, 0x8B, 0x0C, 0x83, 0x0A, 0x02,
+  0x16, 0x4A, 0x24, 0x80, 0x2A, 0x02, 0x4A, 0x47, 0x14, 0x81, 0x20, 0x81, 0x1A, 0x03, 0x60, 0x34,
+  0x3C, 0x82, 0x89, 0xFF, 0x07, 0x05, 0xFE, 0x05, 0x50, 0x0F, 0x19, 0x13, 0x1F, 0x80, 0x0F, 0x80,
+  0x11, 0x81, 0x0B, 0x00, 0x7A, 0x93, 0x0B, 0x04, 0x0F, 0x1F, 0x19, 0x03, 0x0E, 0x82, 0x02, 0x83,
+  0x08, 0x02, 0x43, 0x03, 0x0C, 0x80, 0x16, 0x00, 0x0A, 0x86, 0x0C, 0x84, 0x0A, 0x02, 0x16, 0x4A,
+  0x24, 0x80, 0x2A, 0x02, 0x4A, 0xF7, 0x14, 0x81, 0x20, 0x00, 0x3B, 0x81, 0x1A, 0x02, 0x47, 0x37,
+  0x62, 0x89, 0xFF, 0x03, 0xFE, 0x41, 0x1F, 0x19, 0x81, 0x13, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x11,
+  0x82, 0x0B, 0x80, 0x7A, 0x87, 0x0B, 0x80, 0x11, 0x84, 0x0B, 0x80, 0x11, 0x04, 0x1F, 0x13, 0x19,
+  0x03, 0x0E, 0x81, 0x02, 0x84, 0x08, 0x02, 0x43, 0x8A, 0xFC, 0x81, 0x16, 0x81, 0x0A, 0x00, 0x0C,
+  0x87, 0x0A, 0x02, 0x16, 0x0A, 0x4A, 0x80, 0x24, 0x80, 0x2A, 0x00, 0x4A, 0x83, 0x20, 0x81, 0x1A,
+  0x03, 0x60, 0x34, 0x3C, 0xFA, 0x88, 0xFF, 0x01, 0x9E, 0x19, 0x83, 0x13, 0x00, 0x1F, 0x80, 0x0F,
+  0x80, 0x11, 0x88, 0x0B, 0x80, 0x11, 0x00, 0x0B, 0x89, 0x11, 0x02, 0x0F, 0x13, 0x19, 0x80, 0x03,
+  0x00, 0x0E, 0x81, 0x02, 0x84, 0x08, 0x02, 0x43, 0x39, 0x0C, 0x81, 0x16, 0x8B, 0x0A, 0x80, 0x16,
+  0x00, 0x4A, 0x80, 0x24, 0x80, 0x2A, 0x02, 0x4A, 0x34, 0x14, 0x82, 0x20, 0x81, 0x1A, 0x02, 0x78,
+  0x37, 0xDE, 0x87, 0xFF, 0x00, 0x3D, 0x81, 0x13, 0x80, 0x19, 0x80, 0x13, 0x00, 0x1F, 0x80, 0x0F,
+  0x81, 0x11, 0x87, 0x0B, 0x80, 0x11, 0x00, 0x0B, 0x86, 0x11, 0x80, 0x0F, 0x80, 0x1F, 0x80, 0x19,
+  0x01, 0x03, 0x0E, 0x81, 0x02, 0x85, 0x08, 0x02, 0x43, 0x0E, 0x21, 0x80, 0x16, 0x00, 0x1B, 0x8C,
+  0x0A, 0x01, 0x16, 0x4A, 0x80, 0x24, 0x80, 0x2A, 0x02, 0x4A, 0x98, 0x14, 0x82, 0x20, 0x00, 0x3B,
+  0x80, 0x1A, 0x02, 0x76, 0x34, 0xD9, 0x87, 0xFF, 0x81, 0x13, 0x81, 0x19, 0x80, 0x13, 0x80, 0x1F,
+  0x80, 0x0F, 0x80, 0x11, 0x80, 0x0B, 0x00, 0x11, 0x84, 0x0B, 0x88, 0x11, 0x80, 0x0F, 0x80, 0x1F,
+  0x80, 0x19, 0x80, 0x03, 0x00, 0x0E, 0x81, 0x02, 0x85, 0x08, 0x80, 0x43, 0x00, 0x21, 0x80, 0x16,
+  0x00, 0x1B, 0x8A, 0x0A, 0x81, 0x16, 0x81, 0x24, 0x80, 0x2A, 0x02, 0x24, 0xEA, 0xAD, 0x80, 0x14,
+  0x81, 0x20, 0x81, 0x1A, 0x02, 0x34, 0xD9, 0x67, 0x85, 0xFF, 0x00, 0x50, 0x81, 0x13, 0x82, 0x19,
+  0x80, 0x13, 0x80, 0x1F, 0x00, 0x0F, 0x81, 0x11, 0x00, 0x0B, 0x8D, 0x11, 0x81, 0x0F, 0x80, 0x1F,
+  0x00, 0x13, 0x80, 0x19, 0x00, 0x03, 0x80, 0x0E, 0x80, 0x02, 0x86, 0x08, 0x02, 0x09, 0x43, 0xF4,
+  0x82, 0x16, 0x81, 0x0A, 0x80, 0x16, 0x80, 0x0A, 0x01, 0x16, 0x0A, 0x82, 0x16, 0x00, 0x4A, 0x80,
+  0x24, 0x81, 0x2A, 0x02, 0x24, 0x7C, 0xAD, 0x82, 0x14, 0x80, 0x20, 0x04, 0x3B, 0x1A, 0x76, 0x37,
+  0x62, 0x85, 0xFF, 0x01, 0x7A, 0x13, 0x85, 0x19, 0x00, 0x13, 0x80, 0x1F, 0x80, 0x0F, 0x8F, 0x11,
+  0x82, 0x0F, 0x01, 0x1F, 0x13, 0x80, 0x19, 0x80, 0x03, 0x80, 0x0E, 0x00, 0x02, 0x86, 0x08, 0x04,
+  0x09, 0x43, 0x09, 0x22, 0x0C, 0x81, 0x1B, 0x88, 0x16, 0x80, 0x4A, 0x00, 0xA9, 0x81, 0x28, 0x81,
+  0x2A, 0x02, 0x24, 0xF6, 0xAD, 0x82, 0x14, 0x80, 0x20, 0x05, 0x3B, 0x1A, 0x60, 0x37, 0x3C, 0x05,
+  0x84, 0xFF, 0x02, 0x3A, 0x13, 0x19, 0x81, 0x03, 0x81, 0x19, 0x80, 0x13, 0x80, 0x1F, 0x80, 0x0F,
+  0x88, 0x11, 0x87, 0x0F, 0x01, 0x1F, 0x13, 0x80, 0x19, 0x80, 0x03, 0x80, 0x0E, 0x80, 0x02, 0x84,
+  0x08, 0x01, 0x09, 0x08, 0x81, 0x09, 0x01, 0x02, 0x0A, 0x82, 0x1B, 0x87, 0x16, 0x00, 0xA9, 0x83,
+  0x28, 0x80, 0x1D, 0x03, 0x2A, 0x24, 0x7C, 0xAD, 0x83, 0x14, 0x01, 0x20, 0x3B, 0x80, 0x1A, 0x02,
+  0x47, 0xD9, 0x67, 0x83, 0xFF, 0x00, 0x68, 0x80, 0x19, 0x83, 0x03, 0x81, 0x19, 0x80, 0x13, 0x00,
+  0x1F, 0x82, 0x0F, 0x86, 0x11, 0x86, 0x0F, 0x01, 0x1F, 0x13, 0x80, 0x19, 0x80, 0x03, 0x81, 0x0E,
+  0x01, 0x02, 0x1E, 0x84, 0x08, 0x82, 0x09, 0x03, 0x1E, 0x09, 0x9A, 0x0A, 0x82, 0x1B, 0x85, 0x16,
+  0x01, 0x1B, 0xA9, 0x83, 0x28, 0x80, 0x1D, 0x03, 0x58, 0x24, 0xDF, 0xAD, 0x83, 0x14, 0x80, 0x20,
+  0x04, 0x3B, 0x1A, 0x76, 0x37, 0xDB, 0x83, 0xFF, 0x00, 0x7B, 0x80, 0x19, 0x84, 0x03, 0x81, 0x19,
+  0x80, 0x13, 0x80, 0x1F, 0x84, 0x0F, 0x80, 0x11, 0x85, 0x0F, 0x81, 0x1F, 0x00, 0x13, 0x80, 0x19,
+  0x80, 0x03, 0x81, 0x0E, 0x80, 0x02, 0x83, 0x08, 0x84, 0x09, 0x81, 0x1E, 0x01, 0x1B, 0x16, 0x80,
+  0x1B, 0x84, 0x16, 0x00, 0x1B, 0x80, 0x16, 0x83, 0x28, 0x82, 0x1D, 0x02, 0x4A, 0x61, 0x4D, 0x84,
+  0x14, 0x05, 0x20, 0x3B, 0x1A, 0x60, 0x37, 0x3C, 0x83, 0xFF, 0x00, 0xE1, 0x80, 0x19, 0x84, 0x03,
+  0x82, 0x19, 0x80, 0x13, 0x82, 0x1F, 0x87, 0x0F, 0x82, 0x1F, 0x80, 0x13, 0x81, 0x19, 0x80, 0x03,
+  0x80, 0x0E, 0x80, 0x02, 0x83, 0x08, 0x80, 0x09, 0x00, 0x43, 0x82, 0x09, 0x81, 0x1E, 0x02, 0x39,
+  0x0C, 0x1B, 0x80, 0x16, 0x81, 0x1B, 0x80, 0x16, 0x81, 0x1B, 0x02, 0x28, 0x1D, 0x28, 0x83, 0x1D,
+  0x04, 0x28, 0x1D, 0x40, 0x5F, 0x4D, 0x84, 0x14, 0x05, 0x20, 0x3B, 0x1A, 0x34, 0xD9, 0xFA, 0x82,
+  0xFF, 0x01, 0x13, 0x19, 0x87, 0x03, 0x81, 0x19, 0x80, 0x13, 0x84, 0x1F, 0x80, 0x0F, 0x84, 0x1F,
+  0x80, 0x13, 0x81, 0x19, 0x81, 0x03, 0x80, 0x0E, 0x80, 0x02, 0x81, 0x08, 0x83, 0x09, 0x80, 0x43,
+  0x82, 0x09, 0x80, 0x1E, 0x03, 0x09, 0x23, 0x0A, 0x16, 0x87, 0x1B, 0x00, 0x28, 0x85, 0x1D, 0x01,
+  0x4A, 0x74, 0x80, 0x10, 0x02, 0x92, 0xAD, 0x4D, 0x83, 0x14, 0x04, 0x3B, 0x1A, 0x78, 0xD9, 0x67,
+  0x81, 0xFF, 0x01, 0x42, 0x3A, 0x89, 0x03, 0x81, 0x19, 0x82, 0x13, 0x88, 0x1F, 0x80, 0x13, 0x81,
+  0x19, 0x81, 0x03, 0x80, 0x0E, 0x80, 0x02, 0x82, 0x08, 0x81, 0x09, 0x83, 0x43, 0x82, 0x09, 0x04,
+  0x87, 0x00, 0x3E, 0x5C, 0x0A, 0x87, 0x1B, 0x01, 0x1D, 0x58, 0x83, 0x1D, 0x01, 0x28, 0xF3, 0x83,
+  0x10, 0x01, 0x8B, 0x4D, 0x82, 0x14, 0x04, 0x20, 0x3B, 0x76, 0x37, 0xEA, 0x81, 0xFF, 0x01, 0x50,
+  0x3A, 0x8A, 0x03, 0x82, 0x19, 0x8A, 0x13, 0x82, 0x19, 0x81, 0x03, 0x81, 0x0E, 0x00, 0x02, 0x82,
+  0x08, 0x81, 0x09, 0x82, 0x43, 0x82, 0x07, 0x08, 0x09, 0x87, 0x00, 0x3E, 0xB1, 0x3E, 0x27, 0x0A,
+  0x16, 0x85, 0x1B, 0x01, 0x28, 0x58, 0x80, 0x1D, 0x03, 0x58, 0x1D, 0x28, 0xA9, 0x84, 0x10, 0x02,
+  0x40, 0x73, 0x4D, 0x81, 0x14, 0x04, 0x20, 0x3B, 0x1A, 0x34, 0x62, 0x81, 0xFF, 0x01, 0x48, 0x3A,
+  0x8B, 0x03, 0x84, 0x19, 0x01, 0x13, 0x19, 0x82, 0x13, 0x84, 0x19, 0x81, 0x03, 0x81, 0x0E, 0x80,
+  0x02, 0x01, 0x08, 0x43, 0x81, 0x09, 0x83, 0x43, 0x84, 0x07, 0x00, 0x00, 0x80, 0x3E, 0x81, 0xB1,
+  0x03, 0x06, 0xE6, 0x0A, 0x16, 0x83, 0x1B, 0x02, 0x28, 0x1D, 0x58, 0x80, 0x1D, 0x02, 0x4A, 0x58,
+  0x04, 0x86, 0x10, 0x01, 0x5F, 0x4D, 0x81, 0x14, 0x03, 0x3B, 0x1A, 0xD8, 0xDA, 0x81, 0xFF, 0x01,
+  0x3D, 0x3A, 0x81, 0x03, 0x82, 0x0E, 0x85, 0x03, 0x8D, 0x19, 0x83, 0x03, 0x80, 0x0E, 0x80, 0x02,
+  0x01, 0x1E, 0x08, 0x81, 0x09, 0x82, 0x43, 0x85, 0x07, 0x00, 0x00, 0x82, 0x3E, 0x81, 0xB1, 0x02,
+  0x3E, 0xBB, 0xED, 0x80, 0x0A, 0x00, 0x16, 0x81, 0x1B, 0x05, 0x28, 0xA9, 0x0A, 0x28, 0x74, 0x04,
+  0x88, 0x10, 0x01, 0x5F, 0x4D, 0x80, 0x14, 0x80, 0x3B, 0x02, 0x78, 0x3C, 0x05, 0x80, 0xFF, 0x01,
+  0xE1, 0x3A, 0x81, 0x03, 0x84, 0x0E, 0x87, 0x03, 0x88, 0x19, 0x83, 0x03, 0x80, 0x0E, 0x80, 0x02,
+  0x02, 0x1E, 0x08, 0x09, 0x81, 0x43, 0x88, 0x07, 0x00, 0x00, 0x85, 0x3E, 0x80, 0xB1, 0x0B, 0x3E,
+  0x00, 0x06, 0x5C, 0xE4, 0xED, 0x1B, 0x81, 0xA2, 0xDC, 0xCF, 0x04, 0x8B, 0x10, 0x07, 0x5F, 0x4D,
+  0x14, 0x20, 0x3B, 0x75, 0x3C, 0xFD, 0x80, 0xFF, 0x01, 0x5A, 0x3A, 0x80, 0x03, 0x87, 0x0E, 0x92,
+  0x03, 0x82, 0x0E, 0x80, 0x02, 0x01, 0x1E, 0x09, 0x80, 0x43, 0x89, 0x07, 0x80, 0x3E, 0x00, 0x00,
+  0x85, 0x3E, 0x83, 0xB1, 0x81, 0x00, 0x01, 0x3E, 0xC8, 0x8F, 0x10, 0x02, 0x73, 0x4D, 0x14, 0x80,
+  0x3B, 0x01, 0x96, 0xFA, 0x80, 0xFF, 0x01, 0xAC, 0x3A, 0x80, 0x03, 0x88, 0x0E, 0x90, 0x03, 0x82,
+  0x0E, 0x80, 0x02, 0x03, 0x1E, 0x08, 0x09, 0x43, 0x88, 0x07, 0x00, 0x43, 0x80, 0x3E, 0x80, 0x00,
+  0x87, 0x3E, 0x85, 0xB1, 0x00, 0x91, 0x90, 0x10, 0x01, 0xD6, 0x14, 0x80, 0x3B, 0x01, 0x61, 0xA4,
+  0x80, 0xFF, 0x01, 0xAC, 0x3A, 0x80, 0x03, 0x8A, 0x0E, 0x8C, 0x03, 0x83, 0x0E, 0x81, 0x02, 0x01,
+  0x1E, 0x08, 0x80, 0x43, 0x87, 0x07, 0x01, 0x43, 0x3E, 0x82, 0x00, 0x88, 0x3E, 0x83, 0xB1, 0x01,
+  0x3E, 0xD0, 0x91, 0x10, 0x04, 0x8B, 0x20, 0x3B, 0x75, 0x66, 0x80, 0xFF, 0x01, 0xAC, 0x3A, 0x80,
+  0x03, 0x8D, 0x0E, 0x88, 0x03, 0x84, 0x0E, 0x80, 0x02, 0x03, 0x1E, 0x08, 0x09, 0x43, 0x87, 0x07,
+  0x01, 0x43, 0x3E, 0x83, 0x00, 0x8B, 0x3E, 0x80, 0xB1, 0x01, 0x3E, 0x86, 0x91, 0x10, 0x01, 0x92,
+  0x14, 0x80, 0x3B, 0x00, 0xF8, 0x80, 0xFF, 0x01, 0x22, 0x3A, 0x80, 0x03, 0x9C, 0x0E, 0x80, 0x02,
+  0x80, 0x1E, 0x01, 0x08, 0x09, 0x87, 0x07, 0x01, 0x43, 0x3E, 0x86, 0x00, 0x83, 0x3E, 0x01, 0x00,
+  0x3E, 0x84, 0x00, 0x01, 0x3E, 0xAB, 0x8A, 0x10, 0x00, 0x04, 0x83, 0x10, 0x05, 0x92, 0xCD, 0x73,
+  0x20, 0x75, 0x66, 0x80, 0xFF, 0x01, 0x22, 0x3A, 0x80, 0x03, 0x9B, 0x0E, 0x81, 0x02, 0x00, 0x1E,
+  0x80, 0x08, 0x00, 0x43, 0x86, 0x07, 0x01, 0x08, 0x3E, 0x89, 0x00, 0x00, 0x3E, 0x82, 0x00, 0x00,
+  0x3E, 0x83, 0x00, 0x01, 0x3E, 0x88, 0x83, 0x10, 0x01, 0x04, 0x10, 0x81, 0x04, 0x00, 0x10, 0x80,
+  0x04, 0x84, 0x10, 0x04, 0x38, 0xCE, 0x14, 0x61, 0x66, 0x80, 0xFF, 0x01, 0x22, 0x3A, 0x80, 0x03,
+  0x85, 0x0E, 0x80, 0x02, 0x92, 0x0E, 0x80, 0x02, 0x80, 0x1E, 0x80, 0x09, 0x86, 0x07, 0x01, 0x44,
+  0x3E, 0x95, 0x00, 0x01, 0x3E, 0x4C, 0x80, 0x10, 0x8B, 0x04, 0x82, 0x10, 0x04, 0x38, 0x93, 0xCA,
+  0x8C, 0x67, 0x80, 0xFF, 0x01, 0x5A, 0x3A, 0x80, 0x03, 0x82, 0x0E, 0x86, 0x02, 0x8B, 0x0E, 0x84,
+  0x02, 0x80, 0x1E, 0x80, 0x09, 0x85, 0x07, 0x01, 0x44, 0x3E, 0x96, 0x00, 0x02, 0x3E, 0x52, 0x40,
+  0x8D, 0x04, 0x80, 0x10, 0x01, 0x92, 0x29, 0x80, 0x93, 0x01, 0x8C, 0xA4, 0x80, 0xFF, 0x01, 0xD5,
+  0x3A, 0x80, 0x03, 0x81, 0x0E, 0x8D, 0x02, 0x82, 0x0E, 0x87, 0x02, 0x00, 0x1E, 0x80, 0x09, 0x00,
+  0x43, 0x84, 0x07, 0x01, 0x44, 0x3E, 0x98, 0x00, 0x01, 0x6A, 0x40, 0x8E, 0x04, 0x00, 0x10, 0x80,
+  0x38, 0x03, 0x93, 0xCF, 0xD7, 0x82, 0x80, 0xFF, 0x01, 0x9C, 0x3A, 0x80, 0x03, 0x80, 0x0E, 0x9A,
+  0x02, 0x80, 0x1E, 0x80, 0x09, 0x84, 0x07, 0x01, 0x44, 0x3E, 0x99, 0x00, 0x01, 0x6A, 0x40, 0x8F,
+  0x04, 0x80, 0x38, 0x03, 0x93, 0xCF, 0xCB, 0xFD, 0x80, 0xFF, 0x03, 0xE7, 0x8A, 0x3A, 0x03, 0x80,
+  0x0E, 0x97, 0x02, 0x83, 0x1E, 0x80, 0x09, 0x83, 0x07, 0x9C, 0x00, 0x01, 0x6A, 0x40, 0x8E, 0x04,
+  0x06, 0x92, 0x38, 0x29, 0x93, 0xCF, 0xCC, 0x05, 0x80, 0xFF, 0x03, 0x57, 0x8A, 0x39, 0x03, 0x80,
+  0x0E, 0x94, 0x02, 0x85, 0x1E, 0x80, 0x09, 0x83, 0x07, 0x9E, 0x00, 0x00, 0x40, 0x8E, 0x04, 0x05,
+  0x92, 0x38, 0x29, 0xCF, 0x30, 0x94, 0x81, 0xFF, 0x03, 0x68, 0x22, 0x3A, 0x03, 0x80, 0x0E, 0x92,
+  0x02, 0x87, 0x1E, 0x80, 0x09, 0x82, 0x07, 0x9F, 0x00, 0x00, 0x40, 0x8F, 0x04, 0x01, 0x38, 0x29,
+  0x80, 0x30, 0x00, 0xD4, 0x81, 0xFF, 0x03, 0x51, 0x22, 0x3A, 0x03, 0x80, 0x0E, 0x8F, 0x02, 0x89,
+  0x1E, 0x81, 0x09, 0x81, 0x07, 0xA0, 0x00, 0x00, 0x40, 0x8F, 0x04, 0x01, 0x38, 0x29, 0x80, 0x30,
+  0x00, 0x4F, 0x82, 0xFF, 0x04, 0xD5, 0x3A, 0x39, 0x03, 0x0E, 0x89, 0x02, 0x81, 0x1E, 0x80, 0x02,
+  0x82, 0x1E, 0x00, 0x08, 0x84, 0x1E, 0x82, 0x09, 0x01, 0x07, 0x43, 0xA1, 0x00, 0x00, 0x40, 0x8F,
+  0x04, 0x01, 0x38, 0x29, 0x80, 0x30, 0x00, 0x58, 0x82, 0xFF, 0x03, 0x79, 0x8A, 0x39, 0x03, 0x80,
+  0x0E, 0x85, 0x02, 0x85, 0x1E, 0x00, 0x08, 0x80, 0x1E, 0x00, 0x08, 0x85, 0x1E, 0x82, 0x09, 0x02,
+  0x07, 0x09, 0x3E, 0xA1, 0x00, 0x00, 0x40, 0x8F, 0x04, 0x04, 0x38, 0x29, 0x30, 0xC9, 0x17, 0x82,
+  0xFF, 0x03, 0xA3, 0x22, 0x39, 0x03, 0x80, 0x0E, 0x85, 0x02, 0x81, 0x08, 0x80, 0x1E, 0x84, 0x08,
+  0x00, 0x1E, 0x80, 0x08, 0x85, 0x09, 0x02, 0x87, 0x08, 0x3E, 0xA1, 0x00, 0x01, 0x6A, 0x40, 0x8E,
+  0x04, 0x04, 0x32, 0x56, 0x29, 0x30, 0xD1, 0x83, 0xFF, 0x03, 0x42, 0x22, 0x3A, 0x03, 0x80, 0x0E,
+  0x84, 0x02, 0x00, 0x1E, 0x8A, 0x08, 0x86, 0x09, 0x02, 0x87, 0x44, 0x3E, 0xA2, 0x00, 0x02, 0x6A,
+  0x40, 0x2F, 0x8C, 0x04, 0x02, 0x32, 0x56, 0x29, 0x80, 0x30, 0x00, 0x97, 0x84, 0xFF, 0x02, 0x5A,
+  0x8A, 0x39, 0x81, 0x0E, 0x82, 0x02, 0x00, 0x1E, 0x8D, 0x08, 0x83, 0x09, 0x02, 0x87, 0x44, 0x3E,
+  0xA3, 0x00, 0x04, 0x6A, 0x40, 0x2F, 0x04, 0x2F, 0x8A, 0x04, 0x05, 0x32, 0x56, 0x29, 0x30, 0xC9,
+  0x58, 0x84, 0xFF, 0x03, 0xE3, 0x22, 0x39, 0x03, 0x80, 0x0E, 0x82, 0x02, 0x00, 0x1E, 0x8A, 0x08,
+  0x85, 0x09, 0x02, 0x87, 0x44, 0x3E, 0xA4, 0x00, 0x01, 0x59, 0x40, 0x83, 0x2F, 0x01, 0x04, 0x2F,
+  0x86, 0x04, 0x04, 0x32, 0x56, 0x29, 0x30, 0x91, 0x85, 0xFF, 0x03, 0x68, 0x22, 0x3A, 0x39, 0x80,
+  0x0E, 0x82, 0x02, 0x8A, 0x08, 0x00, 0x87, 0x84, 0x09, 0x01, 0x87, 0x44, 0x81, 0x3E, 0xA3, 0x00,
+  0x01, 0x4C, 0x40, 0x80, 0x2F, 0x03, 0x04, 0x2F, 0x04, 0x2F, 0x86, 0x04, 0x05, 0x12, 0x32, 0x56,
+  0x29, 0x56, 0xD4, 0x86, 0xFF, 0x02, 0xD5, 0x8A, 0x39, 0x80, 0x0E, 0x80, 0x02, 0x01, 0x1E, 0x02,
+  0x80, 0x1E, 0x86, 0x08, 0x00, 0x87, 0x85, 0x09, 0x01, 0x87, 0x44, 0x81, 0x3E, 0xA4, 0x00, 0x01,
+  0x4C, 0x40, 0x83, 0x2F, 0x01, 0x04, 0x2F, 0x84, 0x04, 0x00, 0x12, 0x80, 0x32, 0x03, 0x56, 0x29,
+  0x25, 0x58, 0x86, 0xFF, 0x04, 0xE5, 0x22, 0x3A, 0x39, 0x0E, 0x82, 0x02, 0x80, 0x1E, 0x83, 0x08,
+  0x00, 0x87, 0x87, 0x09, 0x01, 0x87, 0x00, 0x82, 0x3E, 0xA4, 0x00, 0x01, 0x6C, 0x2F, 0x80, 0x12,
+  0x80, 0x2F, 0x80, 0x04, 0x80, 0x2F, 0x82, 0x04, 0x80, 0x12, 0x81, 0x32, 0x01, 0x56, 0x25, 0x87,
+  0xFF, 0x03, 0x05, 0x22, 0x8A, 0x39, 0x80, 0x0E, 0x82, 0x02, 0x00, 0x1E, 0x82, 0x08, 0x87, 0x09,
+  0x80, 0x87, 0x00, 0x00, 0x83, 0x3E, 0xA4, 0x00, 0x01, 0x85, 0x2F, 0x81, 0x12, 0x81, 0x2F, 0x80,
+  0x04, 0x03, 0x2F, 0x04, 0x2F, 0x04, 0x80, 0x12, 0x80, 0x32, 0x02, 0x56, 0x25, 0x99, 0x88, 0xFF,
+  0x02, 0x79, 0x8A, 0x39, 0x80, 0x0E, 0x82, 0x02, 0x00, 0x1E, 0x81, 0x08, 0x87, 0x09, 0x03, 0x87,
+  0x08, 0x00, 0x3E, 0x82, 0xB1, 0xA5, 0x00, 0x01, 0x69, 0x2F, 0x81, 0x12, 0x01, 0x2F, 0x12, 0x83,
+  0x2F, 0x81, 0x12, 0x80, 0x32, 0x80, 0x56, 0x01, 0x15, 0x05, 0x88, 0xFF, 0x03, 0x42, 0x22, 0x8A,
+  0x39, 0x80, 0x0E, 0x81, 0x02, 0x80, 0x1E, 0x80, 0x08, 0x87, 0x09, 0x00, 0x08, 0x80, 0x3E, 0x01,
+  0xB1, 0xB2, 0x80, 0xB1, 0x00, 0x3E, 0xA5, 0x00, 0x01, 0x72, 0x2F, 0x85, 0x12, 0x02, 0x2F, 0x12,
+  0x04, 0x81, 0x12, 0x01, 0x15, 0x56, 0x80, 0x25, 0x00, 0x95, 0x8A, 0xFF, 0x02, 0x79, 0x22, 0x39,
+  0x81, 0x0E, 0x81, 0x02, 0x80, 0x1E, 0x00, 0x08, 0x80, 0x87, 0x81, 0x08, 0x03, 0x09, 0x08, 0x09,
+  0x08, 0x80, 0x3E, 0x01, 0xB1, 0xB2, 0x81, 0xB1, 0xA6, 0x00, 0x01, 0x46, 0x2F, 0x8A, 0x12, 0x00,
+  0x15, 0x80, 0x25, 0x02, 0x56, 0x46, 0x01, 0x8A, 0xFF, 0x03, 0x42, 0x22, 0x8A, 0x39, 0x80, 0x0E,
+  0x81, 0x02, 0x81, 0x1E, 0x83, 0x08, 0x80, 0x87, 0x00, 0x08, 0x80, 0x3E, 0x01, 0xB1, 0xB2, 0x81,
+  0xB1, 0xA7, 0x00, 0x00, 0x2F, 0x8B, 0x12, 0x04, 0x15, 0x25, 0x56, 0x25, 0x95, 0x8C, 0xFF, 0x01,
+  0x63, 0x8A, 0x80, 0x39, 0x81, 0x0E, 0x80, 0x02, 0x85, 0x1E, 0x01, 0x87, 0x02, 0x81, 0x3E, 0x80,
+  0xB1, 0xA9, 0x00, 0x01, 0x59, 0x2F, 0x8A, 0x12, 0x80, 0x15, 0x80, 0x25, 0x01, 0x46, 0x05, 0x8D,
+  0xFF, 0x00, 0x8A, 0x81, 0x39, 0x81, 0x0E, 0x00, 0x02, 0x85, 0x1E, 0x00, 0x44, 0x81, 0x3E, 0x02,
+  0xB1, 0xB2, 0xB1, 0xA9, 0x00, 0x01, 0x4C, 0x2F, 0x8A, 0x12, 0x00, 0x15, 0x80, 0x25, 0x01, 0x15,
+  0xA2, 0x8E, 0xFF, 0x00, 0x57, 0x82, 0x39, 0x80, 0x0E, 0x80, 0x02, 0x83, 0x1E, 0x00, 0x44, 0x81,
+  0xB2, 0x81, 0xB1, 0xAA, 0x00, 0x01, 0x85, 0x2F, 0x89, 0x12, 0x80, 0x15, 0x80, 0x25, 0x00, 0x91,
+  0x90, 0xFF, 0x00, 0x5A, 0x82, 0x39, 0x80, 0x0E, 0x01, 0x02, 0x1E, 0x81, 0x02, 0x00, 0x06, 0x80,
+  0x2D, 0x00, 0xB2, 0x81, 0xB1, 0xAB, 0x00, 0x00, 0xAA, 0x80, 0x18, 0x87, 0x12, 0x81, 0x15, 0x02,
+  0x25, 0xC7, 0x0A, 0x90, 0xFF, 0x03, 0x51, 0x39, 0x3A, 0x8A, 0x80, 0x39, 0x80, 0x0E, 0x81, 0x02,
+  0x00, 0x06, 0x80, 0x2D, 0x01, 0x06, 0xB2, 0x82, 0xB1, 0xAA, 0x00, 0x01, 0x46, 0x12, 0x83, 0x18,
+  0x82, 0x12, 0x81, 0x15, 0x02, 0x25, 0x46, 0xE0, 0x92, 0xFF, 0x03, 0x50, 0x39, 0x22, 0x8A, 0x80,
+  0x39, 0x00, 0x0E, 0x80, 0x02, 0x00, 0x06, 0x80, 0x2D, 0x80, 0x06, 0x00, 0xB2, 0x83, 0xB1, 0xA8,
+  0x00, 0x01, 0x59, 0x2F, 0x84, 0x18, 0x80, 0x12, 0x84, 0x15, 0x00, 0x30, 0x94, 0xFF, 0x07, 0x63,
+  0x22, 0xAC, 0x8A, 0x39, 0x0E, 0x02, 0x06, 0x81, 0x2D, 0x80, 0x06, 0x00, 0xB2, 0x84, 0xB1, 0xA7,
+  0x00, 0x01, 0x6C, 0x2F, 0x84, 0x18, 0x80, 0x12, 0x81, 0x15, 0x03, 0x25, 0x15, 0x46, 0x05, 0x95,
+  0xFF, 0x04, 0x9C, 0x5A, 0x22, 0x8A, 0x03, 0x82, 0x2D, 0x82, 0x06, 0x87, 0xB1, 0xA4, 0x00, 0x02,
+  0x69, 0x12, 0x18, 0x80, 0x12, 0x81, 0x18, 0x80, 0x12, 0x80, 0x15, 0x80, 0x25, 0x01, 0x3F, 0x4A,
+  0x97, 0xFF, 0x03, 0xD5, 0x5A, 0xAC, 0x35, 0x82, 0x2D, 0x83, 0x06, 0x88, 0xB1, 0xA2, 0x00, 0x00,
+  0xC8, 0x86, 0x18, 0x80, 0x15, 0x80, 0x25, 0x01, 0xC7, 0xF3, 0x98, 0xFF, 0x03, 0x05, 0x5A, 0xBE,
+  0x35, 0x80, 0x27, 0x81, 0x2D, 0x84, 0x06, 0x88, 0xB1, 0x9F, 0x00, 0x01, 0x4C, 0x2F, 0x85, 0x18,
+  0x81, 0x15, 0x02, 0x25, 0x3F, 0x4F, 0x9A, 0xFF, 0x02, 0x51, 0x45, 0xBD, 0x80, 0x35, 0x80, 0x27,
+  0x80, 0x2D, 0x85, 0x06, 0x88, 0xB1, 0x9D, 0x00, 0x01, 0x86, 0x12, 0x84, 0x18, 0x00, 0x46, 0x81,
+  0x15, 0x01, 0xC7, 0xE0, 0x9C, 0xFF, 0x02, 0x51, 0x45, 0x70, 0x80, 0x35, 0x80, 0x27, 0x80, 0x2D,
+  0x86, 0x06, 0x87, 0xB1, 0x9C, 0x00, 0x00, 0xC8, 0x84, 0x18, 0x82, 0x15, 0x01, 0x3F, 0x99, 0x9F,
+  0xFF, 0x01, 0x45, 0x70, 0x80, 0x35, 0x80, 0x27, 0x82, 0x2D, 0x87, 0x06, 0x84, 0xB1, 0x9A, 0x00,
+  0x01, 0x4C, 0x2F, 0x81, 0x18, 0x81, 0x46, 0x81, 0x15, 0x01, 0x3F, 0xA2, 0xA1, 0xFF, 0x02, 0x64,
+  0x36, 0x70, 0x80, 0x35, 0x80, 0x27, 0x81, 0x2D, 0x8B, 0x06, 0x80, 0xB1, 0x99, 0x00, 0x00, 0x72,
+  0x81, 0x18, 0x00, 0x46, 0x82, 0x15, 0x02, 0x46, 0x3F, 0x58, 0xA3, 0xFF, 0x02, 0x9F, 0x36, 0x70,
+  0x80, 0x35, 0x80, 0x27, 0x82, 0x2D, 0x88, 0x06, 0x83, 0xB1, 0x96, 0x00, 0x01, 0x52, 0x12, 0x80,
+  0x46, 0x00, 0x18, 0x82, 0x15, 0x02, 0xC7, 0x15, 0x0C, 0xA5, 0xFF, 0x04, 0xF9, 0x45, 0xBD, 0x70,
+  0x35, 0x81, 0x27, 0x81, 0x2D, 0x89, 0x06, 0x81, 0xB1, 0x96, 0x00, 0x09, 0x69, 0x12, 0x15, 0x18,
+  0x46, 0x15, 0x18, 0x46, 0x3F, 0x94, 0xA9, 0xFF, 0x02, 0x64, 0x5C, 0xBD, 0x80, 0x35, 0x81, 0x27,
+  0x81, 0x2D, 0x89, 0x06, 0x00, 0xB1, 0x95, 0x00, 0x01, 0x52, 0xC8, 0x83, 0x15, 0x02, 0x3F, 0xC6,
+  0xF2, 0xAB, 0xFF, 0x03, 0xA6, 0x9B, 0x5C, 0x70, 0x80, 0x35, 0x00, 0x2E, 0x80, 0x27, 0x81, 0x2D,
+  0x87, 0x06, 0x82, 0xB1, 0x92, 0x00, 0x00, 0x90, 0x82, 0x15, 0x03, 0x46, 0xC6, 0xC9, 0x05, 0xAE,
+  0xFF, 0x00, 0x9F, 0x80, 0x36, 0x00, 0x23, 0x80, 0x35, 0x00, 0x2E, 0x80, 0x27, 0x80, 0x2D, 0x8B,
+  0x06, 0x00, 0xB1, 0x8C, 0x00, 0x80, 0x6A, 0x02, 0x00, 0x6C, 0xC8, 0x80, 0x25, 0x03, 0x15, 0x3F,
+  0xC7, 0x58, 0xB1, 0xFF, 0x01, 0x42, 0xE2, 0x80, 0x36, 0x81, 0x23, 0x81, 0x2E, 0x80, 0x2D, 0x8B,
+  0x06, 0x01, 0xB1, 0x06, 0x86, 0x00, 0x82, 0x6A, 0x02, 0x00, 0x52, 0x46, 0x80, 0x15, 0x02, 0xC7,
+  0x3F, 0x4F, 0xB5, 0xFF, 0x02, 0x42, 0x64, 0x36, 0x82, 0x23, 0x82, 0x2E, 0x00, 0x2D, 0x8F, 0x06,
+  0x82, 0x6A, 0x82, 0x06, 0x05, 0x6B, 0x90, 0x15, 0x3F, 0x25, 0x4F, 0xB9, 0xFF, 0x01, 0x51, 0xE8,
+  0x83, 0x23, 0x86, 0x2E, 0x8E, 0x06, 0x80, 0x6B, 0x05, 0x06, 0x6B, 0x72, 0xC7, 0xD3, 0x80, 0xBE,
+  0xFF, 0x02, 0xF9, 0x9D, 0x36, 0x81, 0x23, 0x87, 0x2E, 0x89, 0x06, 0x82, 0x6B, 0x03, 0x88, 0xD2,
+  0x4F, 0x01, 0xC3, 0xFF, 0x04, 0x84, 0x9F, 0x9B, 0x36, 0x23, 0x87, 0x2E, 0x81, 0x06, 0x85, 0x6B,
+  0x03, 0x89, 0x9B, 0xEF, 0xFE, 0xCA, 0xFF, 0x04, 0x42, 0xA6, 0x9D, 0x45, 0x36, 0x80, 0x2E, 0x85,
+  0x6B, 0x05, 0x2E, 0x23, 0x9B, 0x9D, 0xA6, 0x51, 0xFF, 0xFF, 0x89, 0xFF,
+};
+
+GUI_CONST_STORAGE GUI_BITMAP bmball_rle = {
+  100, // xSize
+  99, // ySize
+  100, // BytesPerLine
+  8, // BitsPerPixel
+  (const unsigned char *)_acbmball_rle,  // Pointer to run-length stream
+  &_Palbmball_rle,  // Pointer to palette
+  &LCD_RLE_METHODS_8BPP
+};
+
+/* [] END OF FILE */
@@ -48,6 +48,7 @@ Purpose     : Display controller initialization
 
 #include "GUI.h"
 #include "LCDConf.h"
+#include "GUIPool.h"
 
 #if defined(__cplusplus)
 extern "C"
@@ -64,13 +65,10 @@ extern "C"
 //
 // Define the available number of bytes available for the GUI
 //
+// Sized for one composition band, see GUIPool.h
+//
 #if !defined(GUI_NUMBYTES)
-    #if ((MTB_DISPLAY_SIZE_X * MTB_DISPLAY_SIZE_Y * MTB_DISPLAY_COLOR_BITS / 4) > 0x7800)
-        #define GUI_NUMBYTES  (1024*32)
-    #else
-        #define GUI_NUMBYTES  ((MTB_DISPLAY_SIZE_X * MTB_DISPLAY_SIZE_Y * \
-                                MTB_DISPLAY_COLOR_BITS / 4) + 2048)
-    #endif
+    #define GUI_NUMBYTES  GUI_POOL_BYTES
 #endif
 
 /*********************************************************************
@@ -0,0 +1,63 @@
+/*
+ * GUIPool.h
+ *
+ *  Size of the emWin pool (GUI_NUMBYTES) and of the application arena that
+ *  gets the SRAM the pool does not need. The band device is the only large
+ *  block emWin allocates, so the pool is one band plus emWin's own overhead,
+ *  which is the peak measured in configs/GUIPoolProfile.h plus a margin.
+ *  Re-measure with LCD_BENCHMARK=1: the pool benchmark walks every screen
+ *  and prints the profile to put there.
+ */
+
+#pragma once
+
+#include "lcd_band.h"
+#include "mtb_hx8347.h"
+#include "screens.h"
+#include "GUIPoolProfile.h"
+
+
+/* The shipped profile is an estimate until the pool benchmark has run on the
+ * board: every build says so until it is replaced */
+#if (GUI_POOL_PROFILE_SAMPLES == 0)
+#warning "configs/GUIPoolProfile.h was not measured, the emWin pool is sized from an estimate: build with LCD_BENCHMARK=1, run the pool benchmark on the kit and paste the profile it prints"
+#elif (GUI_POOL_PROFILE_BAND_LINES != LCD_BAND_LINES)
+#warning "configs/GUIPoolProfile.h was measured with another LCD_BAND_LINES, re-run the pool benchmark"
+#endif
+
+/* SRAM the pool used to take, split between the pool and the arena, and
+ * what the sprites of an animated screen take in the arena */
+#define GUI_POOL_BUDGET_BYTES           ((32 * 1024) + SCREEN_SPRITE_BYTES)
+
+/* Margin on top of the profiled peak, percent */
+#define GUI_POOL_MARGIN_PCT             (25)
+
+/* Most the pool may hold beside the band device before the profile is out
+ * of date: the profiled peak (allocator tables, device headers) plus the
+ * margin. lcd_pool_sample() counts the samples above it. */
+#define GUI_POOL_OVERHEAD_LIMIT         (GUI_POOL_PROFILE_PEAK_BYTES + \
+                                         (GUI_POOL_PROFILE_PEAK_BYTES * GUI_POOL_MARGIN_PCT) / 100)
+
+/* The limit and the LCD_BAND_POOL_RESERVE kept free next to the band,
+ * rounded up to 256 bytes. The slide strips are smaller than a band and
+ * never allocated together with one. */
+#ifndef GUI_POOL_OVERHEAD_BYTES
+#define GUI_POOL_OVERHEAD_BYTES         (((GUI_POOL_OVERHEAD_LIMIT + LCD_BAND_POOL_RESERVE) + 255) / 256 * 256)
+#endif
+
+#if (GUI_POOL_OVERHEAD_BYTES < (GUI_POOL_OVERHEAD_LIMIT + LCD_BAND_POOL_RESERVE))
+#error "GUI_POOL_OVERHEAD_BYTES is below the profiled peak plus margin, see GUIPoolProfile.h"
+#endif
+
+/* One band of full-width lines, the long side at most */
+#ifndef GUI_POOL_BYTES
+#define GUI_POOL_BYTES                  ((LCD_BAND_LINES * LCD_HEIGHT * 2) + GUI_POOL_OVERHEAD_BYTES)
+#endif
+
+#if (GUI_POOL_BYTES > GUI_POOL_BUDGET_BYTES)
+#error "The emWin pool does not fit GUI_POOL_BUDGET_BYTES, lower LCD_BAND_LINES"
+#endif
+
+#define APP_ARENA_BYTES                 (GUI_POOL_BUDGET_BYTES - GUI_POOL_BYTES)
+
+/* [] END OF FILE */
@@ -0,0 +1,23 @@
+/*
+ * GUIPoolProfile.h
+ *
+ *  emWin pool profile read by configs/GUIPool.h. Generated: build with
+ *  LCD_BENCHMARK=1, let the pool benchmark walk every screen and replace the
+ *  definitions below with the ones it prints after "Pool: profile".
+ *  A profile with no samples has not been measured on the board yet, and
+ *  GUIPool.h warns about it on every build.
+ */
+
+#pragma once
+
+
+/* Peak use of the pool beside the band device over every screen, bytes */
+#define GUI_POOL_PROFILE_PEAK_BYTES     (1638)
+
+/* LCD_BAND_LINES the profile was taken with */
+#define GUI_POOL_PROFILE_BAND_LINES     (32)
+
+/* Pool samples the peak was taken from, 0 if not measured */
+#define GUI_POOL_PROFILE_SAMPLES        (0)
+
+/* [] END OF FILE */
@@ -125,7 +125,8 @@ void GUI_X_Delay(int ms)
         int tEnd = emwin_time_ms + ms;
         while ((tEnd - emwin_time_ms) > 0)
         {
-            /* Wait */
+            /* Sleep until the next emWin tick or any other interrupt */
+            cyhal_syspm_sleep();
         }
     #else
         cy_rslt_t status = cy_rtos_delay_milliseconds((cy_time_t)ms);
@@ -166,6 +167,9 @@ void GUI_X_ExecIdle(void)
         cy_rslt_t status = cy_rtos_delay_milliseconds((cy_time_t)1u);
         CY_UNUSED_PARAMETER(status); /* CY_ASSERT only processes in DEBUG, ignores for others */
         CY_ASSERT(CY_RSLT_SUCCESS == status);
+    #else
+        /* Nothing to do before the next tick or input */
+        cyhal_syspm_sleep();
     #endif
 }
 
@@ -50,6 +50,8 @@ Purpose     : Generic  configuration file for GUIDRV_FlexColor
 #include "GUIDRV_FlexColor.h"
 #include "LCDConf.h"
 #include "mtb_hx8347.h"
+#include "lcd_dma.h"
+#include "lcd_accel.h"
 
 #if defined(__cplusplus)
 extern "C"
@@ -135,24 +137,52 @@ void LCD_X_Config(void)
     //
     // Display size configuration
     //
-    LCD_SetSizeEx (0, XSIZE_PHYS,  YSIZE_PHYS);
-    LCD_SetVSizeEx(0, VXSIZE_PHYS, VYSIZE_PHYS);
+    //   The controller scans in the orientation selected in the driver
+    //   (register 0x16), so emWin sees the rotated size directly.
+    //
+    LCD_SetSizeEx (0, mtb_hx8347_get_width(), mtb_hx8347_get_height());
+    LCD_SetVSizeEx(0, mtb_hx8347_get_width(), mtb_hx8347_get_height());
     //
     // Orientation
     //
-    Config.Orientation   = GUI_MIRROR_Y | GUI_SWAP_XY;
+    Config.Orientation   = 0;
     GUIDRV_FlexColor_Config(pDevice, &Config);
     //
     // Set controller and operation mode
     //
+#if (LCD_PORT_WIDTH == 16)
+    //
+    //   One callback per pixel or pixel array instead of one per byte
+    //
+    PortAPI.pfWrite16_A0  = mtb_hx8347_write_command16;
+    PortAPI.pfWrite16_A1  = mtb_hx8347_write_data16;
+#if (LCD_DMA_ENABLE)
+    PortAPI.pfWriteM16_A1 = lcd_dma_write_data16_stream;
+#else
+    PortAPI.pfWriteM16_A1 = mtb_hx8347_write_data16_stream;
+#endif
+    PortAPI.pfRead16_A1   = mtb_hx8347_read_data16;
+    PortAPI.pfReadM16_A1  = mtb_hx8347_read_data16_stream;
+
+    GUIDRV_FlexColor_SetFunc(pDevice, &PortAPI, GUIDRV_FLEXCOLOR_F66712, GUIDRV_FLEXCOLOR_M16C0B16);
+#else
     PortAPI.pfWrite8_A0  = mtb_hx8347_write_command;
     PortAPI.pfWrite8_A1  = mtb_hx8347_write_data;
+#if (LCD_DMA_ENABLE)
+    PortAPI.pfWriteM8_A1 = lcd_dma_write_data_stream;
+#else
     PortAPI.pfWriteM8_A1 = mtb_hx8347_write_data_stream;
+#endif
     PortAPI.pfRead8_A1   = mtb_hx8347_read_data;
     PortAPI.pfReadM8_A1  = mtb_hx8347_read_data_stream;
 
     //GUIDRV_FlexColor_SetFunc(pDevice, &PortAPI, GUIDRV_FLEXCOLOR_F66709, GUIDRV_FLEXCOLOR_M16C0B8);
     GUIDRV_FlexColor_SetFunc(pDevice, &PortAPI, GUIDRV_FLEXCOLOR_F66712, GUIDRV_FLEXCOLOR_M16C0B8);
+#endif
+    //
+    // Route fills to the windowed driver paths
+    //
+    lcd_accel_install(pDevice);
 }
 
 
@@ -167,6 +197,7 @@ int LCD_X_DisplayDriver(unsigned LayerIndex, unsigned Cmd, void * pData)
     {
         case LCD_X_INITCONTROLLER:
         	mtb_hx8347_init();
+        	lcd_dma_init();
             r = 0;
             break;
 
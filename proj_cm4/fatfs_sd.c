@@ -7,6 +7,7 @@
 #include "fatfs_sd.h"
 
 #include "cy_retarget_io.h"
+#include "spi_bus.h"
 
 #define TRUE  1
 #define FALSE 0
@@ -21,13 +22,49 @@ static volatile DSTATUS Stat = STA_NOINIT;
 static uint8_t CardType;
 static uint8_t PowerFlag = 0;
 
+/* Shared SPI bus registration, the card starts in its 400 kHz phase */
+static const spi_bus_config_t SD_BusConfig =
+{
+  .name = "sd",
+  .frequency_hz = SD_SPI_INIT_HZ,
+  .mode = CYHAL_SPI_MODE_11_MSB,
+  .cs_pin = SD_CS_PIN,
+  .drain = NULL,
+};
+static int SD_BusId = -1;
+static bool SD_Selected = false;
+
 
 extern cyhal_spi_t mSPI;
 
 
-/* SPI Chip Select */
+/* Registers the card on the shared bus on first use */
+static int SD_Bus(void)
+{
+  if (SD_BusId < 0)
+    SD_BusId = spi_bus_register(&SD_BusConfig);
+  return SD_BusId;
+}
+
+/* Take the shared bus, switches SCLK away from the LCD clock if needed */
+static void SD_BusAcquire(void)
+{
+  spi_bus_acquire(SD_Bus());
+}
+
+static void SD_BusRelease(void)
+{
+  spi_bus_release(SD_BusId);
+}
+
+/* SPI Chip Select, the bus is held until DESELECT() */
 static void SELECT(void)
 {
+  if (!SD_Selected)
+  {
+    SD_BusAcquire();
+    SD_Selected = true;
+  }
   __SD_CS_CLR();
 }
 
@@ -35,12 +72,19 @@ static void SELECT(void)
 static void DESELECT(void)
 {
   __SD_CS_SET();
+  if (SD_Selected)
+  {
+    SD_Selected = false;
+    SD_BusRelease();
+  }
 }
 
 /* SPI data transmission */
 static void SPI_TxByte(BYTE data)
 {
+  SD_BusAcquire();
   cyhal_spi_send(&mSPI, data);
+  SD_BusRelease();
 }
 
 /* SPI return type function for sending and receiving data */
@@ -48,7 +92,9 @@ static uint8_t SPI_RxByte(void)
 {
   uint8_t data;
   data = 0;
+  SD_BusAcquire();
   cyhal_spi_recv(&mSPI, &data);
+  SD_BusRelease();
   //printf("%d\r\n\n", data);
   return data;
 }
@@ -153,8 +199,6 @@ static bool SD_RxDataBlock(BYTE *buff, UINT btr)
 {
   uint8_t token;
   
-  printf("from rx dtat block\r\n\n");
-
   /* waiting for response till 100ms */
   UINT tmr;
   
@@ -194,9 +238,8 @@ static bool SD_TxDataBlock(const BYTE *buff, BYTE token)
   uint8_t resp = 0, wc;
   uint8_t i = 0;
 
-  printf("from tx dtat block\r\n\n");
-  /* Waiting for SD card ready */
-  if (SD_ReadyWait() != 0xFF)
+  /* Waiting for SD card ready, SD_ReadyWait() returns 1 when it is */
+  if (!SD_ReadyWait())
     return FALSE;
   
   /* token transfer */
@@ -233,7 +276,8 @@ static bool SD_TxDataBlock(const BYTE *buff, BYTE token)
     while (SPI_RxByte() == 0);
   }
   
-  if ((resp & 0x1F) == 0x05)
+  /* The stop token has no data response */
+  if ((token == 0xFD) || ((resp & 0x1F) == 0x05))
     return TRUE;
   else
     return FALSE;
@@ -299,6 +343,7 @@ DSTATUS SD_disk_initialize(BYTE drv)
   uint8_t status;
   
   uint32_t arg;
+  spi_bus_set_frequency(SD_Bus(), SD_SPI_INIT_HZ);
   DESELECT();
 
   uint8_t i;
@@ -374,7 +419,7 @@ DSTATUS SD_disk_initialize(BYTE drv)
   CardType = type;
   if (type) {			/* OK */
   		Stat &= ~STA_NOINIT;
-  		printf("clock high\r\n\n");
+  		spi_bus_set_frequency(SD_BusId, SD_SPI_FAST_HZ);
   } else {			/* Failed */
   		Stat = STA_NOINIT;
   		printf("failed\r\n\n");
@@ -467,7 +512,6 @@ uint32_t cardSize(void) {
 /* Check disk status */
 DSTATUS SD_disk_status(BYTE drv) 
 {
-  printf("from disk status block\r\n\n");
   if (drv)
     return STA_NOINIT; 
   
@@ -478,7 +522,6 @@ DSTATUS SD_disk_status(BYTE drv)
 /* sector read */
 DRESULT SD_disk_read(BYTE pdrv, BYTE* buff, DWORD sector, UINT count) 
 {
-  printf("from disk read block\r\n\n");
   if (pdrv || !count)
     return RES_PARERR;
   
@@ -526,7 +569,6 @@ DRESULT SD_disk_read(BYTE pdrv, BYTE* buff, DWORD sector, UINT count)
 #if _READONLY == 0
 DRESULT SD_disk_write(BYTE pdrv, const BYTE* buff, DWORD sector, UINT count) 
 {
-	printf("from disk write block\r\n\n");
   if (pdrv || !count)
     return RES_PARERR;
   
@@ -583,7 +625,6 @@ DRESULT SD_disk_write(BYTE pdrv, const BYTE* buff, DWORD sector, UINT count)
 /* other functions */
 DRESULT SD_disk_ioctl(BYTE drv, BYTE ctrl, void *buff) 
 {
-	printf("from ioct block\r\n\n");
   DRESULT res;
   BYTE n, csd[16], *ptr = buff;
   WORD csize;
@@ -653,7 +694,7 @@ DRESULT SD_disk_ioctl(BYTE drv, BYTE ctrl, void *buff)
       
     case CTRL_SYNC: 
       /* sync write */
-      if (SD_ReadyWait() == 0xFF)
+      if (SD_ReadyWait())
         res = RES_OK;
       break;
       
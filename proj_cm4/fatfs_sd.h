@@ -4,6 +4,11 @@
 #include "integer.h"
 #include "diskio.h"
 
+/** SPI clock during card identification, at most 400 kHz */
+#define SD_SPI_INIT_HZ  400000UL
+/** SPI clock once the card is initialized */
+#define SD_SPI_FAST_HZ  20000000UL
+
 /** init timeout ms */
 #define SD_INIT_TIMEOUT 2000
 #define SD_ERASE_TIMEOUT  10000
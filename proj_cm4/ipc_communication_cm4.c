@@ -49,6 +49,16 @@
 #include "system_psoc6.h"
 
 
+/* Messages to the CM4 arrive on the system pipe. Under FreeRTOS its callback
+ * posts to a queue, which the kernel only allows below
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY. */
+#if (LCD_RTOS)
+    #define CM4_CYPIPE_PRIOR_EP1        (6UL)
+#else
+    #define CM4_CYPIPE_PRIOR_EP1        CY_SYS_INTR_CYPIPE_PRIOR_EP1
+#endif
+
+
 /*******************************************************************************
  * Function definitions
  ******************************************************************************/
@@ -100,7 +110,7 @@ void setup_ipc_communication_cm4(void)
     /* .ep1ConfigData */
         {
             CY_IPC_INTR_CYPIPE_EP1,         /* .ipcNotifierNumber    */
-            CY_SYS_INTR_CYPIPE_PRIOR_EP1,   /* .ipcNotifierPriority  */
+            CM4_CYPIPE_PRIOR_EP1,           /* .ipcNotifierPriority  */
             0u,                             /* .ipcNotifierMuxNumber */
             CY_IPC_EP_CYPIPE_CM4_ADDR,      /* .epAddress            */
             CY_SYS_CYPIPE_CONFIG_EP1        /* .epConfig             */
@@ -0,0 +1,354 @@
+/*
+ * lcd_accel.c
+ *
+ *  emWin device API hooks for the HX8347 panel.
+ *
+ *  The hooks receive logical coordinates, already clipped by emWin. The
+ *  controller scans in the selected orientation (register 0x16), so a logical
+ *  point is a GRAM address and a logical row is one contiguous GRAM write.
+ *  Everything runs through mtb_hx8347_set_window(), which skips window
+ *  registers that already hold the right value.
+ */
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "mtb_hx8347.h"
+#include "lcd_dma.h"
+#include "lcd_accel.h"
+#include "lcd_bitmap.h"
+#include "lcd_glyph.h"
+#include "lcd_prof.h"
+
+
+static GUI_DEVICE_API lcd_accel_api;
+static const GUI_DEVICE_API *lcd_accel_driver;
+static GUI_DEVICE *lcd_accel_device;
+
+/* Bitmap rows in wire order, as many whole rows as fit one landscape line */
+static uint32_t lcd_accel_line[LCD_HEIGHT / 2];
+
+
+/*******************************************************************************
+ * Solid rectangle fill, used by GUI_Clear(), GUI_FillRect() and the span
+ * fills emWin generates for circles and polygons.
+ *******************************************************************************/
+static void lcd_accel_fill_rect(GUI_DEVICE *pDevice, int x0, int y0, int x1, int y1)
+{
+    if (GUI_GetDrawMode() & GUI_DRAWMODE_XOR)
+    {
+        lcd_accel_driver->pfFillRect(pDevice, x0, y0, x1, y1);
+        return;
+    }
+
+    mtb_hx8347_fill_rect((uint16_t)x0, (uint16_t)y0, (uint16_t)x1, (uint16_t)y1,
+                         (uint16_t)LCD_GetColorIndex());
+}
+
+
+/*******************************************************************************
+ * Horizontal and vertical lines are one pixel wide fills.
+ *******************************************************************************/
+static void lcd_accel_draw_hline(GUI_DEVICE *pDevice, int x0, int y, int x1)
+{
+    lcd_accel_fill_rect(pDevice, x0, y, x1, y);
+}
+
+static void lcd_accel_draw_vline(GUI_DEVICE *pDevice, int x, int y0, int y1)
+{
+    lcd_accel_fill_rect(pDevice, x, y0, x, y1);
+}
+
+
+/*******************************************************************************
+ * Returns the colour index of bitmap pixel (x, 0) in a row.
+ *******************************************************************************/
+static LCD_PIXELINDEX lcd_accel_pixel(const U8 *pRow, int x, int BitsPerPixel,
+                                      int Diff, const LCD_PIXELINDEX *pTrans)
+{
+    LCD_PIXELINDEX index;
+
+    switch (BitsPerPixel)
+    {
+        case 1:
+            x += Diff;
+            index = pTrans[(pRow[x >> 3] >> (7 - (x & 7))) & 1u];
+            break;
+        case 8:
+            index = pTrans[pRow[x]];
+            break;
+        default:
+            index = ((const U16 *)pRow)[x];
+            break;
+    }
+
+    return index;
+}
+
+
+/*******************************************************************************
+ * Expands one row of an 8bpp bitmap through a wire-order table, two pixels
+ * per 32-bit store once the destination is word aligned.
+ *******************************************************************************/
+static void lcd_accel_lut_row(uint16_t *pDst, const U8 *pSrc, int xSize, const uint16_t *pLut)
+{
+    uint32_t *pDst32;
+    int x = 0;
+
+    if (((uintptr_t)pDst & 2u) && (xSize > 0))
+    {
+        *pDst++ = pLut[pSrc[x++]];
+    }
+    pDst32 = (uint32_t *)pDst;
+    for (; x + 1 < xSize; x += 2)
+    {
+        *pDst32++ = pLut[pSrc[x]] | ((uint32_t)pLut[pSrc[x + 1]] << 16);
+    }
+    if (x < xSize)
+    {
+        *(uint16_t *)pDst32 = pLut[pSrc[x]];
+    }
+}
+
+
+/*******************************************************************************
+ * Expands one row of a cached glyph, runs of the two wire-order colours.
+ *******************************************************************************/
+static const uint8_t *lcd_accel_span_row(uint16_t *pDst, const uint8_t *pSpans, int xSize,
+                                         const uint16_t *pWire)
+{
+    uint16_t c;
+    int x, n;
+    unsigned i;
+
+    for (x = 0, i = 0u; x < xSize; i ^= 1u)
+    {
+        c = pWire[i];
+        for (n = *pSpans++, x += n; n > 0; n--)
+        {
+            *pDst++ = c;
+        }
+    }
+    return pSpans;
+}
+
+
+/*******************************************************************************
+ * Checks whether a bitmap may go out in the 12bpp format: glyphs whose two
+ * colours fit and memory device output made of flat colours only. Palette
+ * images stay 16bpp.
+ *******************************************************************************/
+static bool lcd_accel_fits_444(int xSize, int ySize, int BitsPerPixel, int BytesPerLine,
+                               const U8 *pData, const LCD_PIXELINDEX *pTrans)
+{
+    const U16 *pRow;
+    int x, y;
+
+    if (!mtb_hx8347_get_color12() || ((uint32_t)(xSize * ySize) < LCD_COLOR12_MIN_PIXELS))
+    {
+        return false;
+    }
+    if (BitsPerPixel == 1)
+    {
+        return lcd_color_fits_444((uint16_t)pTrans[0]) && lcd_color_fits_444((uint16_t)pTrans[1]);
+    }
+    if (BitsPerPixel != 16)
+    {
+        return false;
+    }
+    for (y = 0; y < ySize; y++, pData += BytesPerLine)
+    {
+        pRow = (const U16 *)pData;
+        for (x = 0; x < xSize; x++)
+        {
+            if (!lcd_color_fits_444(pRow[x]))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+/*******************************************************************************
+ * Sends a bitmap in the 12bpp format, two pixels in three bytes. The pairs
+ * run on across rows; an odd total is padded with the first pixel, which the
+ * wrapping address counter writes back onto itself.
+ *******************************************************************************/
+static void lcd_accel_draw_bitmap12(int xSize, int ySize, int BitsPerPixel, int BytesPerLine,
+                                    const U8 *pData, int Diff, const LCD_PIXELINDEX *pTrans)
+{
+    uint8_t *buf = (uint8_t *)lcd_accel_line;
+    uint8_t *p = buf;
+    uint16_t c, first = 0u, pending = 0u;
+    bool odd = false;
+    int x, y;
+
+    for (y = 0; y < ySize; y++, pData += BytesPerLine)
+    {
+        for (x = 0; x < xSize; x++)
+        {
+            c = lcd_rgb565_to_444((uint16_t)lcd_accel_pixel(pData, x, BitsPerPixel, Diff, pTrans));
+            if ((x | y) == 0)
+            {
+                first = c;
+            }
+            if (!odd)
+            {
+                pending = c;
+                odd = true;
+                continue;
+            }
+            *p++ = (uint8_t)(pending >> 4);
+            *p++ = (uint8_t)((pending << 4) | (c >> 8));
+            *p++ = (uint8_t)c;
+            odd = false;
+            if (p + 3 > buf + sizeof(lcd_accel_line))
+            {
+                lcd_dma_write_data_stream(buf, (int)(p - buf));
+                p = buf;
+            }
+        }
+    }
+    if (odd)
+    {
+        *p++ = (uint8_t)(pending >> 4);
+        *p++ = (uint8_t)((pending << 4) | (first >> 8));
+        *p++ = (uint8_t)first;
+    }
+    if (p != buf)
+    {
+        lcd_dma_write_data_stream(buf, (int)(p - buf));
+    }
+}
+
+
+/*******************************************************************************
+ * Bitmaps (1bpp font glyphs, 8bpp palette images, 16bpp memory devices) are
+ * sent through one GRAM window, row by row. Narrow rows such as glyphs are
+ * packed into the line buffer so that each DMA kick carries several of them.
+ *******************************************************************************/
+static void lcd_accel_draw_bitmap(GUI_DEVICE *pDevice, int x0, int y0, int xSize, int ySize,
+                                  int BitsPerPixel, int BytesPerLine, const U8 *pData,
+                                  int Diff, const LCD_PIXELINDEX *pTrans)
+{
+    bool supported;
+    LCD_PIXELINDEX index;
+    const uint16_t *pLut;
+    const uint8_t *pSpans;
+    uint16_t wire[2];
+    uint16_t *p;
+    int x, y, r, rows, n;
+    LCD_PROF_BEGIN(LCD_PROF_BITMAP);
+
+    supported = ((GUI_GetDrawMode() & (GUI_DRAWMODE_XOR | GUI_DRAWMODE_TRANS)) == 0) &&
+                (((BitsPerPixel == 1 || BitsPerPixel == 8) && (pTrans != NULL)) ||
+                 ((BitsPerPixel == 16) && (pTrans == NULL)));
+    if (!supported)
+    {
+        lcd_accel_driver->pfDrawBitmap(pDevice, x0, y0, xSize, ySize, BitsPerPixel,
+                                       BytesPerLine, pData, Diff, pTrans);
+        LCD_PROF_END(LCD_PROF_BITMAP);
+        return;
+    }
+
+    if (lcd_accel_fits_444(xSize, ySize, BitsPerPixel, BytesPerLine, pData, pTrans))
+    {
+        mtb_hx8347_select_depth(12);
+        mtb_hx8347_set_window((uint16_t)x0, (uint16_t)y0,
+                              (uint16_t)(x0 + xSize - 1), (uint16_t)(y0 + ySize - 1));
+        lcd_accel_draw_bitmap12(xSize, ySize, BitsPerPixel, BytesPerLine, pData, Diff, pTrans);
+        LCD_PROF_END(LCD_PROF_BITMAP);
+        return;
+    }
+
+    mtb_hx8347_select_depth(16);
+    mtb_hx8347_set_window((uint16_t)x0, (uint16_t)y0,
+                          (uint16_t)(x0 + xSize - 1), (uint16_t)(y0 + ySize - 1));
+
+    /* 8bpp images drawn by lcd_bitmap_draw() bring a ready wire-order table */
+    pLut = (BitsPerPixel == 8) ? lcd_bitmap_get_wire_lut(pTrans) : NULL;
+    rows = (int)(sizeof(lcd_accel_line) / 2u) / xSize;
+
+    /* Font glyphs come out of the glyph cache as runs of the two colours */
+    pSpans = NULL;
+    if (BitsPerPixel == 1)
+    {
+        pSpans = lcd_glyph_lookup(pData, xSize, ySize, BytesPerLine, Diff);
+        wire[0] = (uint16_t)(((pTrans[0] & 0xFFu) << 8) | ((pTrans[0] >> 8) & 0xFFu));
+        wire[1] = (uint16_t)(((pTrans[1] & 0xFFu) << 8) | ((pTrans[1] >> 8) & 0xFFu));
+    }
+
+    for (y = 0; y < ySize; y += n)
+    {
+        n = ((ySize - y) < rows) ? (ySize - y) : rows;
+        p = (uint16_t *)lcd_accel_line;
+        for (r = 0; r < n; r++, pData += BytesPerLine)
+        {
+            if (pLut != NULL)
+            {
+                lcd_accel_lut_row(p, pData, xSize, pLut);
+                p += xSize;
+                continue;
+            }
+            if (pSpans != NULL)
+            {
+                pSpans = lcd_accel_span_row(p, pSpans, xSize, wire);
+                p += xSize;
+                continue;
+            }
+            for (x = 0; x < xSize; x++)
+            {
+                index = lcd_accel_pixel(pData, x, BitsPerPixel, Diff, pTrans);
+                ((uint8_t *)p)[0] = (uint8_t)(index >> 8);
+                ((uint8_t *)p)[1] = (uint8_t)index;
+                p++;
+            }
+        }
+        lcd_dma_write_data_stream((uint8_t *)lcd_accel_line, 2 * n * xSize);
+    }
+    LCD_PROF_END(LCD_PROF_BITMAP);
+}
+
+
+/*******************************************************************************
+ * Rotates the panel and resizes the emWin layer to match.
+ *******************************************************************************/
+void lcd_accel_set_rotation(mtb_hx8347_rotation_t rotation)
+{
+    mtb_hx8347_set_rotation(rotation);
+    LCD_SetSizeEx(0, mtb_hx8347_get_width(), mtb_hx8347_get_height());
+    LCD_SetVSizeEx(0, mtb_hx8347_get_width(), mtb_hx8347_get_height());
+    LCD_SetClipRectMax();
+}
+
+
+/*******************************************************************************
+ * Installs the hooks on the display device.
+ *******************************************************************************/
+void lcd_accel_install(GUI_DEVICE *pDevice)
+{
+    lcd_accel_device = pDevice;
+    lcd_accel_driver = pDevice->pDeviceAPI;
+    lcd_accel_api = *lcd_accel_driver;
+    lcd_accel_api.pfFillRect = lcd_accel_fill_rect;
+    lcd_accel_api.pfDrawHLine = lcd_accel_draw_hline;
+    lcd_accel_api.pfDrawVLine = lcd_accel_draw_vline;
+    lcd_accel_api.pfDrawBitmap = lcd_accel_draw_bitmap;
+    pDevice->pDeviceAPI = &lcd_accel_api;
+}
+
+
+/*******************************************************************************
+ * Switches between the hooks and the plain driver API.
+ *******************************************************************************/
+void lcd_accel_set_enabled(bool enable)
+{
+    if (lcd_accel_device != NULL)
+    {
+        lcd_dma_fence();
+        lcd_accel_device->pDeviceAPI = enable ? &lcd_accel_api : lcd_accel_driver;
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,47 @@
+/*
+ * lcd_accel.h
+ *
+ *  emWin device API hooks that route drawing primitives to the windowed
+ *  HX8347 driver paths instead of the generic GUIDRV_FlexColor sequences.
+ */
+
+#pragma once
+
+#include "GUI.h"
+#include "mtb_hx8347.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/**
+ * Replaces the device API of the display driver with a copy whose fill, line
+ * and bitmap functions go through the windowed driver paths. Operations the
+ * fast paths do not cover (XOR and transparent drawing, unusual bitmap
+ * formats) are passed on to the original driver.
+ * @param[in] pDevice Device returned by GUI_DEVICE_CreateAndLink()
+ */
+void lcd_accel_install(GUI_DEVICE *pDevice);
+
+/**
+ * Bypasses the hooks, e.g. to time the GUIDRV_FlexColor port sequences.
+ * @param[in] enable false to hand every operation to the original driver
+ */
+void lcd_accel_set_enabled(bool enable);
+
+/**
+ * Changes the orientation at runtime. The panel switches its scan direction
+ * and the emWin layer takes the new size; the screen content is not redrawn.
+ * @param[in] rotation One of mtb_hx8347_rotation_t
+ */
+void lcd_accel_set_rotation(mtb_hx8347_rotation_t rotation);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,189 @@
+/*
+ * lcd_band.c
+ *
+ *  Banded frame composition with emWin memory devices.
+ */
+
+#include "cy_pdl.h"
+#include "mtb_hx8347.h"
+#include "lcd_dma.h"
+#include "lcd_band.h"
+#include "lcd_prof.h"
+#include "lcd_pool.h"
+#include "GUI.h"
+
+#include <string.h>
+
+
+static int lcd_band_lines = LCD_BAND_LINES;
+static lcd_band_stats_t lcd_band_stats;
+
+/** Draw call wrapped by lcd_band_call() */
+typedef struct
+{
+    void (*draw)(void *data);
+    void *data;
+    uint32_t band_bytes;
+    lcd_band_capture_t capture;
+    void *arg;
+    int xsize;
+    int ysize;
+    int lines;
+    int y;                  /* First line of the next band */
+    bool missed;            /* A band had no device to capture from */
+} lcd_band_call_t;
+
+
+/*******************************************************************************
+ * Bytes put on the wire so far: blocking streams, DMA streams and the two
+ * bytes of every register write.
+ *******************************************************************************/
+static uint32_t lcd_band_wire_bytes(void)
+{
+    mtb_hx8347_stats_t stats;
+    lcd_dma_stats_t dma;
+
+    mtb_hx8347_get_stats(&stats);
+    lcd_dma_get_stats(&dma);
+    return stats.bytes + dma.bytes + 2u * stats.reg_writes;
+}
+
+
+/*******************************************************************************
+ * Returns the band height for the next frame, limited by the largest free
+ * block of the emWin pool.
+ *******************************************************************************/
+static int lcd_band_fit_lines(int xsize)
+{
+    int bytes_per_line = xsize * (int)sizeof(U16);
+    int fit = ((int)GUI_ALLOC_GetMaxSize() - LCD_BAND_POOL_RESERVE) / bytes_per_line;
+
+    if (fit < 1)
+    {
+        return 0;
+    }
+    return (lcd_band_lines < fit) ? lcd_band_lines : fit;
+}
+
+
+/*******************************************************************************
+ * Runs the draw function for one band, sampling the emWin pool while the band
+ * device is allocated.
+ *******************************************************************************/
+static void lcd_band_call(void *p)
+{
+    lcd_band_call_t *call = (lcd_band_call_t *)p;
+
+    GUI_MEMDEV_Handle hMem;
+    int n;
+
+    lcd_pool_sample(call->band_bytes);
+    call->draw(call->data);
+
+    /* GUI_MEMDEV_Draw() runs the bands top down, the last one may be short */
+    if (call->capture != NULL)
+    {
+        hMem = GUI_MEMDEV_GetSelMemdev();
+        n = call->ysize - call->y;
+        n = (n < call->lines) ? n : call->lines;
+        if ((hMem == 0) || (n <= 0))
+        {
+            call->missed = true;
+            return;
+        }
+        call->capture((const uint16_t *)GUI_MEMDEV_GetDataPtr(hMem), call->xsize, n, call->arg);
+        call->y += n;
+    }
+}
+
+
+/*******************************************************************************
+ * Draws a frame band by band through one memory device, handing each band to
+ * the capture function when there is one. Falls back to drawing straight to
+ * the panel when banding is off or the pool is exhausted.
+ *******************************************************************************/
+static bool lcd_band_compose(void (*draw)(void *data), void *data, lcd_band_capture_t capture, void *arg)
+{
+    GUI_RECT rect;
+    lcd_band_call_t call;
+    uint32_t start = DWT->CYCCNT;
+    uint32_t bytes = lcd_band_wire_bytes();
+    int lines = 0;
+
+    rect.x0 = 0;
+    rect.y0 = 0;
+    rect.x1 = LCD_GetXSize() - 1;
+    rect.y1 = LCD_GetYSize() - 1;
+
+    if (lcd_band_lines > 0)
+    {
+        lines = lcd_band_fit_lines(rect.x1 + 1);
+    }
+
+    memset(&call, 0, sizeof(call));
+    call.draw = draw;
+    call.data = data;
+    call.band_bytes = (uint32_t)((rect.x1 + 1) * lines) * sizeof(U16);
+    call.capture = capture;
+    call.arg = arg;
+    call.xsize = rect.x1 + 1;
+    call.ysize = rect.y1 + 1;
+    call.lines = lines;
+
+    /* GUI_MEMDEV_Draw() itself draws directly if the device cannot be created */
+    if ((lines == 0) || (GUI_MEMDEV_Draw(&rect, lcd_band_call, &call, lines, GUI_MEMDEV_NOTRANS) != 0))
+    {
+        if (lines == 0)
+        {
+            draw(data);
+        }
+        lcd_band_stats.fallbacks++;
+        lines = 0;
+    }
+
+    lcd_band_stats.frames++;
+    lcd_band_stats.band_lines = (uint32_t)lines;
+    lcd_band_stats.last_bytes = lcd_band_wire_bytes() - bytes;
+    lcd_band_stats.last_cycles = DWT->CYCCNT - start;
+    LCD_PROF_RECORD(LCD_PROF_BAND, lcd_band_stats.last_cycles);
+
+    return (lines > 0) && !call.missed && (call.y == call.ysize);
+}
+
+
+/*******************************************************************************
+ * Draws a frame.
+ *******************************************************************************/
+void lcd_band_draw(void (*draw)(void *data), void *data)
+{
+    (void)lcd_band_compose(draw, data, NULL, NULL);
+}
+
+
+/*******************************************************************************
+ * Draws a frame and hands every band to the capture function.
+ *******************************************************************************/
+bool lcd_band_draw_capture(void (*draw)(void *data), void *data, lcd_band_capture_t capture, void *arg)
+{
+    return lcd_band_compose(draw, data, capture, arg);
+}
+
+
+/*******************************************************************************
+ * Sets the band height.
+ *******************************************************************************/
+void lcd_band_set_lines(int lines)
+{
+    lcd_band_lines = (lines > 0) ? lines : 0;
+}
+
+
+/*******************************************************************************
+ * Copies the composition counters.
+ *******************************************************************************/
+void lcd_band_get_stats(lcd_band_stats_t *stats)
+{
+    *stats = lcd_band_stats;
+}
+
+/* [] END OF FILE */
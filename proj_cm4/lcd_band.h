@@ -0,0 +1,88 @@
+/*
+ * lcd_band.h
+ *
+ *  Banded frame composition. A screen is drawn into a memory device a few
+ *  lines high, band by band, and every band is pushed to the panel once.
+ *  A full 320x240 RGB565 frame (150 KB) does not fit in the emWin pool.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Default band height in lines, 0 draws straight to the panel */
+#ifndef LCD_BAND_LINES
+#define LCD_BAND_LINES              (32)
+#endif
+
+/* Pool bytes kept free next to the band for emWin's own allocations */
+#define LCD_BAND_POOL_RESERVE       (2048)
+
+/**
+ * Receives one band of a frame before it goes to the panel.
+ * @param[in] pixels Band lines of xsize RGB565 pixels, top down
+ * @param[in] xsize  Pixels per line
+ * @param[in] lines  Lines of the band
+ * @param[in] arg    Passed to lcd_band_draw_capture()
+ */
+typedef void (*lcd_band_capture_t)(const uint16_t *pixels, int xsize, int lines, void *arg);
+
+/** Composition counters */
+typedef struct
+{
+    uint32_t frames;        /**< Frames composed since the last reset */
+    uint32_t fallbacks;     /**< Frames drawn directly, no memory for a band */
+    uint32_t band_lines;    /**< Band height used for the last frame */
+    uint32_t last_bytes;    /**< Bytes pushed to the panel by the last frame */
+    uint32_t last_cycles;   /**< CPU cycles spent on the last frame */
+} lcd_band_stats_t;
+
+
+/**
+ * Draws a frame. The draw function is called once per band with the clip
+ * rectangle set to that band, so it must paint every pixel it is responsible
+ * for (start with GUI_Clear()) and must not keep state between calls.
+ * @param[in] draw Function that draws the whole screen
+ * @param[in] data Passed to the draw function
+ */
+void lcd_band_draw(void (*draw)(void *data), void *data);
+
+/**
+ * Draws a frame like lcd_band_draw() and hands every band to a capture
+ * function on its way to the panel, the frame is drawn only once.
+ * @param[in] draw    Function that draws the whole screen
+ * @param[in] data    Passed to the draw function
+ * @param[in] capture Called once per band, top down
+ * @param[in] arg     Passed to the capture function
+ * @return true if every line went through the capture function, false if
+ *         the frame had to be drawn straight to the panel
+ */
+bool lcd_band_draw_capture(void (*draw)(void *data), void *data, lcd_band_capture_t capture, void *arg);
+
+/**
+ * Sets the band height. It is clamped to what fits in the emWin pool when a
+ * frame is drawn.
+ * @param[in] lines Band height in lines, 0 to draw straight to the panel
+ */
+void lcd_band_set_lines(int lines);
+
+/**
+ * Copies the composition counters.
+ * @param[out] stats Where to store the counters
+ */
+void lcd_band_get_stats(lcd_band_stats_t *stats);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
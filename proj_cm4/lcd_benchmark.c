@@ -0,0 +1,569 @@
+/*
+ * lcd_benchmark.c
+ *
+ *  On-target timing of the LCD paths, printed over the debug UART.
+ */
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "mtb_hx8347.h"
+#include "lcd_benchmark.h"
+#include "lcd_shadow.h"
+#include "lcd_bitmap.h"
+#include "lcd_dma.h"
+#include "lcd_accel.h"
+#include "lcd_dlist.h"
+#include "lcd_pool.h"
+#include "lcd_glyph.h"
+#include "lcd_snap.h"
+#include "lcd_prof.h"
+#include "lcd_region.h"
+#include "screens.h"
+#include "lcd_sprite.h"
+#include "GUI.h"
+
+#include <stdio.h>
+
+
+extern cyhal_spi_t mSPI;
+
+extern GUI_CONST_STORAGE GUI_BITMAP bma_apple;
+extern GUI_CONST_STORAGE GUI_BITMAP bma;
+extern GUI_CONST_STORAGE GUI_BITMAP bmball;
+extern GUI_CONST_STORAGE GUI_BITMAP bmb;
+extern GUI_CONST_STORAGE GUI_BITMAP bma_apple_rle;
+extern GUI_CONST_STORAGE GUI_BITMAP bma_rle;
+extern GUI_CONST_STORAGE GUI_BITMAP bmball_rle;
+extern GUI_CONST_STORAGE GUI_BITMAP bmb_rle;
+
+
+
+/*******************************************************************************
+ * Converts DWT cycles to microseconds.
+ *******************************************************************************/
+uint32_t lcd_benchmark_us(uint32_t cycles)
+{
+    return (uint32_t)(((uint64_t)cycles * 1000000u) / SystemCoreClock);
+}
+
+
+/*******************************************************************************
+ * Bytes sent to the panel since boot, by the CPU and by DMA, counting the
+ * command byte in front of every register write.
+ *******************************************************************************/
+static uint32_t lcd_benchmark_wire_bytes(void)
+{
+    mtb_hx8347_stats_t stats;
+    lcd_dma_stats_t dma;
+
+    mtb_hx8347_get_stats(&stats);
+    lcd_dma_get_stats(&dma);
+    return stats.bytes + dma.bytes + 2u * stats.reg_writes;
+}
+
+
+/*******************************************************************************
+ * The full-screen clear as it was before the windowed fill: cursor only, then
+ * two blocking HAL calls per pixel. Relies on the window left by a full fill.
+ *******************************************************************************/
+static void lcd_benchmark_clear_legacy(uint16_t color)
+{
+    uint32_t i;
+    uint8_t hval = color >> 8;
+    uint8_t lval = color & 0xFF;
+
+    __LCD_BUS_ACQUIRE();
+    mtb_hx8347_select_depth(16);
+    lcd_set_cursor(0, 0);
+    lcd_write_byte(0x22, LCD_CMD);
+    lcd_shadow_fill(color, (uint32_t)LCD_WIDTH * LCD_HEIGHT);
+
+    __LCD_DC_SET();
+    __LCD_CS_CLR();
+    for (i = 0; i < (uint32_t)LCD_WIDTH * LCD_HEIGHT; i++) {
+        cyhal_spi_send(&mSPI, hval);
+        cyhal_spi_send(&mSPI, lval);
+    }
+    __LCD_CS_SET();
+    __LCD_BUS_RELEASE();
+}
+
+
+/*******************************************************************************
+ * Full-screen clear, windowed fill against the legacy per-pixel loop.
+ *******************************************************************************/
+static void lcd_benchmark_clear(void)
+{
+    uint32_t start, fill, legacy;
+
+    start = DWT->CYCCNT;
+    lcd_clear_screen(BLACK);
+    fill = DWT->CYCCNT - start;
+
+    start = DWT->CYCCNT;
+    lcd_benchmark_clear_legacy(WHITE);
+    legacy = DWT->CYCCNT - start;
+
+    printf("  clear 240x320   legacy %7lu us   fill %7lu us\r\n",
+           (unsigned long)lcd_benchmark_us(legacy),
+           (unsigned long)lcd_benchmark_us(fill));
+}
+
+
+/*******************************************************************************
+ * Register traffic per rectangle: a first fill programs the whole window, a
+ * second one of the same size only reloads the start registers.
+ *******************************************************************************/
+static void lcd_benchmark_rect_cost(void)
+{
+    mtb_hx8347_stats_t stats;
+    uint32_t first, second;
+
+    mtb_hx8347_reset_stats();
+    mtb_hx8347_fill_rect(10, 10, 59, 59, WHITE);
+    mtb_hx8347_get_stats(&stats);
+    first = stats.reg_writes;
+
+    mtb_hx8347_reset_stats();
+    mtb_hx8347_fill_rect(20, 10, 59, 59, BLACK);
+    mtb_hx8347_get_stats(&stats);
+    second = stats.reg_writes;
+
+    printf("  rect cost       %lu cmd bytes, repeated %lu cmd bytes (%lu skipped)\r\n",
+           (unsigned long)(2u * first + 1u), (unsigned long)(2u * second + 1u),
+           (unsigned long)stats.reg_skipped);
+}
+
+
+/*******************************************************************************
+ * Time per 8bpp bitmap through emWin's palette conversion and through the
+ * cached tables, until the last pixel is on the panel. The second cached
+ * draw is the steady state, the first one also converts the palette. The
+ * run-length coded copy goes through the same cached tables band by band.
+ *******************************************************************************/
+static void lcd_benchmark_bitmaps(void)
+{
+    static const struct
+    {
+        const char *name;
+        const GUI_BITMAP *pBM;
+        const GUI_BITMAP *pRLE;
+    } bitmaps[] =
+    {
+        { "bma",       &bma,       &bma_rle },
+        { "bma_apple", &bma_apple, &bma_apple_rle },
+        { "bmb",       &bmb,       &bmb_rle },
+        { "bmball",    &bmball,    &bmball_rle },
+    };
+    uint32_t start, emwin, first, cached, rle;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(bitmaps) / sizeof(bitmaps[0]); i++) {
+        start = DWT->CYCCNT;
+        GUI_DrawBitmap(bitmaps[i].pBM, 0, 0);
+        lcd_dma_fence();
+        emwin = DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        lcd_bitmap_draw(bitmaps[i].pBM, 0, 0);
+        lcd_dma_fence();
+        first = DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        lcd_bitmap_draw(bitmaps[i].pBM, 0, 0);
+        lcd_dma_fence();
+        cached = DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        GUI_DrawBitmap(bitmaps[i].pRLE, 0, 0);
+        lcd_dma_fence();
+        rle = DWT->CYCCNT - start;
+
+        printf("  bitmap %-9s %3ux%-3u emWin %6lu us   lut %6lu us (first %lu us)   rle %6lu us\r\n",
+               bitmaps[i].name, bitmaps[i].pBM->XSize, bitmaps[i].pBM->YSize,
+               (unsigned long)lcd_benchmark_us(emwin), (unsigned long)lcd_benchmark_us(cached),
+               (unsigned long)lcd_benchmark_us(first), (unsigned long)lcd_benchmark_us(rle));
+    }
+}
+
+
+/*******************************************************************************
+ * GUI_FillRect() and GUI_DrawBitmap() through GUIDRV_FlexColor's own port
+ * sequences, hooks off. Build once with LCD_PORT_WIDTH=8 and once with 16 to
+ * compare the byte and pixel callbacks.
+ *******************************************************************************/
+static void lcd_benchmark_port(void)
+{
+    uint32_t start, fill, bitmap;
+    uint32_t fill_px = 160u * 120u;
+    uint32_t bitmap_px = (uint32_t)bma.XSize * bma.YSize;
+
+    lcd_accel_set_enabled(false);
+
+    start = DWT->CYCCNT;
+    GUI_SetColor(GUI_BLUE);
+    GUI_FillRect(0, 0, 159, 119);
+    lcd_dma_fence();
+    fill = lcd_benchmark_us(DWT->CYCCNT - start);
+
+    start = DWT->CYCCNT;
+    GUI_DrawBitmap(&bma, 0, 0);
+    lcd_dma_fence();
+    bitmap = lcd_benchmark_us(DWT->CYCCNT - start);
+
+    lcd_accel_set_enabled(true);
+
+    printf("  port %2u-bit      FillRect %6lu us (%lu kpx/s)   DrawBitmap %6lu us (%lu kpx/s)\r\n",
+           (unsigned)LCD_PORT_WIDTH,
+           (unsigned long)fill, (unsigned long)(fill ? (fill_px * 1000u) / fill : 0u),
+           (unsigned long)bitmap, (unsigned long)(bitmap ? (bitmap_px * 1000u) / bitmap : 0u));
+}
+
+
+/*******************************************************************************
+ * The menu and number screens with every pixel in 16bpp and with flat colours
+ * in the 12bpp format: time until the last pixel is on the panel and bytes
+ * put on the wire.
+ *******************************************************************************/
+static void lcd_benchmark_color12(void)
+{
+    static const struct
+    {
+        const char *name;
+        void (*draw)(void);
+    } screens[] =
+    {
+        { "menu_screen",   menu_screen },
+        { "number_screen", number_screen },
+    };
+    bool saved = mtb_hx8347_get_color12();
+    uint32_t start, us[2], bytes[2];
+    uint32_t i, mode;
+
+    for (i = 0; i < sizeof(screens) / sizeof(screens[0]); i++) {
+        for (mode = 0; mode < 2u; mode++) {
+            mtb_hx8347_set_color12(mode != 0u);
+            bytes[mode] = lcd_benchmark_wire_bytes();
+            start = DWT->CYCCNT;
+            screens[i].draw();
+            lcd_dma_fence();
+            us[mode] = lcd_benchmark_us(DWT->CYCCNT - start);
+            bytes[mode] = lcd_benchmark_wire_bytes() - bytes[mode];
+        }
+        printf("  %-13s  16bpp %6lu us %6lu B   12bpp %6lu us %6lu B (%lu%% of the bytes)\r\n",
+               screens[i].name, (unsigned long)us[0], (unsigned long)bytes[0],
+               (unsigned long)us[1], (unsigned long)bytes[1],
+               (unsigned long)(bytes[0] ? (100u * bytes[1]) / bytes[0] : 0u));
+    }
+
+    mtb_hx8347_set_color12(saved);
+}
+
+
+/*******************************************************************************
+ * Draws the flat screens with their display list replayed as recorded and
+ * then optimized, and compares the pixels sent.
+ *******************************************************************************/
+static void lcd_benchmark_dlist(void)
+{
+    static const struct
+    {
+        const char *name;
+        void (*draw)(void);
+    } screens[] =
+    {
+        { "menu_screen",   menu_screen },
+        { "number_screen", number_screen },
+    };
+    lcd_dlist_stats_t stats[2];
+    uint32_t start, us[2];
+    uint32_t i, mode;
+
+    for (i = 0; i < sizeof(screens) / sizeof(screens[0]); i++) {
+        for (mode = 0; mode < 2u; mode++) {
+            lcd_dlist_set_optimize(mode != 0u);
+            start = DWT->CYCCNT;
+            screens[i].draw();
+            lcd_dma_fence();
+            us[mode] = lcd_benchmark_us(DWT->CYCCNT - start);
+            lcd_dlist_get_stats(&stats[mode]);
+        }
+        printf("  %-13s  replay %6lu px %6lu us   optimized %6lu px %6lu us, %lu rects, %lu culled (%lu%% of the pixels)\r\n",
+               screens[i].name, (unsigned long)stats[0].pixels_out, (unsigned long)us[0],
+               (unsigned long)stats[1].pixels_out, (unsigned long)us[1],
+               (unsigned long)stats[1].rects, (unsigned long)stats[1].culled,
+               (unsigned long)(stats[0].pixels_out ? (100u * stats[1].pixels_out) / stats[0].pixels_out : 0u));
+    }
+
+    lcd_dlist_set_optimize(true);
+}
+
+
+/*******************************************************************************
+ * Draws the text screens with glyphs expanded from the font, then twice from
+ * the glyph cache, cold and warm.
+ *******************************************************************************/
+static void lcd_benchmark_glyph(void)
+{
+    static const char *const pass[] = { "font", "cold", "warm" };
+    lcd_glyph_stats_t before, after;
+    uint32_t start, us;
+    uint32_t i;
+
+    for (i = 0; i < 3u; i++) {
+        lcd_glyph_set_enabled(i != 0u);
+        lcd_glyph_get_stats(&before);
+        start = DWT->CYCCNT;
+        menu_screen();
+        number_screen();
+        lcd_dma_fence();
+        us = lcd_benchmark_us(DWT->CYCCNT - start);
+        lcd_glyph_get_stats(&after);
+        printf("  glyphs %s    %6lu us, %lu hits, %lu misses, %lu uncached, %lu entries in %lu bytes\r\n",
+               pass[i], (unsigned long)us, (unsigned long)(after.hits - before.hits),
+               (unsigned long)(after.misses - before.misses),
+               (unsigned long)(after.uncached - before.uncached),
+               (unsigned long)after.entries, (unsigned long)after.bytes_used);
+    }
+}
+
+
+/*******************************************************************************
+ * Shows the static screens drawn, then through snapshots: the first visit
+ * captures (or replays a file left by an earlier boot of this build), the
+ * second replays. Screen ids 2 and 3 keep the runtime snapshots current.
+ *******************************************************************************/
+static void lcd_benchmark_snap(void)
+{
+    static const char inputs[] = __FILE__ " " __DATE__ " " __TIME__;
+    static const screen_id_t screens[] = { SCREEN_MENU, SCREEN_NUMBERS };
+    const screen_t *s;
+    lcd_snap_stats_t stats;
+    uint32_t start, us[3];
+    uint32_t i, pass;
+
+    for (i = 0; i < sizeof(screens) / sizeof(screens[0]); i++) {
+        s = screen_get(screens[i]);
+        for (pass = 0; pass < 3u; pass++) {
+            lcd_snap_set_enabled(pass != 0u);
+            start = DWT->CYCCNT;
+            lcd_snap_show(2u + i, s->draw, (void *)s->data, inputs, sizeof(inputs));
+            lcd_dma_fence();
+            us[pass] = lcd_benchmark_us(DWT->CYCCNT - start);
+        }
+        lcd_snap_get_stats(&stats);
+        printf("  %-13s  drawn %6lu us   first visit %6lu us   snapshot %6lu us, %lu bytes, %lu failures\r\n",
+               s->name, (unsigned long)us[0], (unsigned long)us[1], (unsigned long)us[2],
+               (unsigned long)stats.last_bytes, (unsigned long)stats.failures);
+    }
+
+    lcd_snap_set_enabled(true);
+}
+
+
+/*******************************************************************************
+ * Walks the number screens from 1 to 6, each drawn whole and then each
+ * repainted from the one before (the first still whole), and compares the
+ * bytes sent.
+ *******************************************************************************/
+static void lcd_benchmark_region(void)
+{
+    uint32_t start, bytes, us[2], sent[2];
+    uint32_t mode;
+    int id;
+
+    for (mode = 0; mode < 2u; mode++) {
+        lcd_region_invalidate();
+        lcd_dma_fence();
+        bytes = lcd_benchmark_wire_bytes();
+        start = DWT->CYCCNT;
+        for (id = SCREEN_NUMBER_1; id <= SCREEN_NUMBER_6; id++) {
+            if (mode == 0u) {
+                lcd_region_invalidate();
+            }
+            screen_show((screen_id_t)id);
+        }
+        lcd_dma_fence();
+        us[mode] = lcd_benchmark_us(DWT->CYCCNT - start);
+        sent[mode] = lcd_benchmark_wire_bytes() - bytes;
+    }
+    lcd_region_invalidate();
+
+    printf("  number walk    whole %7lu bytes %6lu us   regions %7lu bytes %6lu us (%lu%%)\r\n",
+           (unsigned long)sent[0], (unsigned long)us[0], (unsigned long)sent[1], (unsigned long)us[1],
+           (unsigned long)(sent[0] ? (100u * sent[1]) / sent[0] : 0u));
+}
+
+
+/*******************************************************************************
+ * Shows every screen of the table in order with the pool counters cleared
+ * and prints what the emWin pool went through, see configs/GUIPool.h.
+ *******************************************************************************/
+static void lcd_benchmark_pool(void)
+{
+    int id;
+
+    lcd_pool_reset();
+    for (id = 0; id < SCREEN_COUNT; id++) {
+        screen_show((screen_id_t)id);
+        lcd_dma_fence();
+        lcd_pool_sample(0u);
+    }
+
+    lcd_pool_report();
+}
+
+
+/*******************************************************************************
+ * Redraws the letter B screen whole, the way any motion used to cost, then
+ * runs its bouncing ball for LCD_BENCHMARK_FRAMES frames back to back.
+ *******************************************************************************/
+static void lcd_benchmark_sprite(void)
+{
+    lcd_sprite_stats_t before, after;
+    uint32_t start, whole, bytes, tpu;
+    uint32_t frames;
+
+    lcd_sprite_get_stats(&before);
+    start = DWT->CYCCNT;
+    screen_show(SCREEN_LETTER_B);
+    lcd_dma_fence();
+    whole = lcd_benchmark_us(DWT->CYCCNT - start);
+    if (lcd_sprite_next_ms() == UINT32_MAX) {
+        printf("  sprites        off (LCD_SPRITE=%u)\r\n", (unsigned)LCD_SPRITE_ENABLE);
+        return;
+    }
+
+    bytes = lcd_benchmark_wire_bytes();
+    lcd_sprite_run(LCD_BENCHMARK_FRAMES);
+    bytes = lcd_benchmark_wire_bytes() - bytes;
+    lcd_sprite_stop();
+    lcd_sprite_get_stats(&after);
+
+    tpu = lcd_prof_ticks_per_us();
+    frames = after.frames - before.frames;
+    printf("  ball frames    whole screen %6lu us   %lu frames avg %lu us, max %lu us, %lu late of %lu us, %lu bytes/frame\r\n",
+           (unsigned long)whole, (unsigned long)frames,
+           (unsigned long)(frames ? (after.total_ticks - before.total_ticks) / frames / tpu : 0u),
+           (unsigned long)(after.max_ticks / tpu), (unsigned long)(after.late - before.late),
+           (unsigned long)(after.budget_ticks / tpu), (unsigned long)(frames ? bytes / frames : 0u));
+}
+
+
+#if (LCD_SHADOW_ENABLE)
+/*******************************************************************************
+ * Writes a gradient block and a fill over part of it through the driver, then
+ * reads the window back through the GRAM read path and compares.
+ *******************************************************************************/
+static void lcd_benchmark_shadow_check(void)
+{
+    static uint8_t pattern[2 * 24 * 24];
+    static uint8_t readback[1 + sizeof(pattern)];
+    lcd_shadow_stats_t stats;
+    uint32_t i, errors = 0u;
+    uint32_t start, cycles;
+
+    for (i = 0; i < sizeof(pattern); i += 2u) {
+        pattern[i] = (uint8_t)(i >> 3);
+        pattern[i + 1u] = (uint8_t)i;
+    }
+    mtb_hx8347_blit565(100, 100, 123, 123, pattern);
+    mtb_hx8347_fill_rect(100, 100, 123, 103, BLUE);
+    for (i = 0; i < 2u * 24u * 4u; i += 2u) {
+        pattern[i] = BLUE >> 8;
+        pattern[i + 1u] = BLUE & 0xFF;
+    }
+
+    start = DWT->CYCCNT;
+    mtb_hx8347_set_window(100, 100, 123, 123);
+    mtb_hx8347_read_data_stream(readback, sizeof(readback));
+    cycles = DWT->CYCCNT - start;
+
+    for (i = 0; i < sizeof(pattern); i++) {
+        if (readback[i + 1u] != pattern[i]) {
+            errors++;
+        }
+    }
+    lcd_shadow_get_stats(&stats);
+    printf("  shadow read     %u px in %lu us, %lu mismatches, %lu/%lu slots, %lu overflows\r\n",
+           (unsigned)(sizeof(pattern) / 2u), (unsigned long)lcd_benchmark_us(cycles),
+           (unsigned long)errors, (unsigned long)stats.slots_used,
+           (unsigned long)stats.slots_total, (unsigned long)stats.overflows);
+}
+
+
+/*******************************************************************************
+ * Marks the top-left pixel of every orientation with a fill and its top-right
+ * pixel with a blit, then reads both back in portrait, where logical and GRAM
+ * addresses are the same, at the GRAM column and row mtb_hx8347_rotation_t
+ * documents for them.
+ *******************************************************************************/
+static void lcd_benchmark_rotation_check(void)
+{
+    /* Column and row of logical (0, 0) and (width - 1, 0) per orientation */
+    static const uint16_t corner[MTB_HX8347_ROTATION_COUNT][2][2] = {
+        [MTB_HX8347_ROTATION_0]   = { { 0, 0 },                          { LCD_WIDTH - 1, 0 } },
+        [MTB_HX8347_ROTATION_90]  = { { 0, LCD_HEIGHT - 1 },             { 0, 0 } },
+        [MTB_HX8347_ROTATION_180] = { { LCD_WIDTH - 1, LCD_HEIGHT - 1 }, { 0, LCD_HEIGHT - 1 } },
+        [MTB_HX8347_ROTATION_270] = { { LCD_WIDTH - 1, 0 },              { LCD_WIDTH - 1, LCD_HEIGHT - 1 } },
+    };
+    static const uint8_t marker[2] = { 0xF8, 0x1F };
+    mtb_hx8347_rotation_t rotation = mtb_hx8347_get_rotation();
+    uint8_t readback[3];
+    uint16_t want[2] = { BLUE, 0xF81F };
+    uint32_t errors = 0u;
+    int r, i;
+    uint16_t w;
+
+    for (r = 0; r < MTB_HX8347_ROTATION_COUNT; r++) {
+        mtb_hx8347_set_rotation((mtb_hx8347_rotation_t)r);
+        w = mtb_hx8347_get_width();
+        mtb_hx8347_fill_rect(0, 0, 0, 0, BLUE);
+        mtb_hx8347_blit565(w - 1u, 0, w - 1u, 0, marker);
+
+        mtb_hx8347_set_rotation(MTB_HX8347_ROTATION_0);
+        for (i = 0; i < 2; i++) {
+            mtb_hx8347_set_window(corner[r][i][0], corner[r][i][1], corner[r][i][0], corner[r][i][1]);
+            mtb_hx8347_read_data_stream(readback, sizeof(readback));
+            if ((uint16_t)((readback[1] << 8) | readback[2]) != want[i]) {
+                printf("  rotation %d      corner %d not at GRAM column %u row %u\r\n", r * 90, i,
+                       (unsigned)corner[r][i][0], (unsigned)corner[r][i][1]);
+                errors++;
+            }
+        }
+    }
+    mtb_hx8347_set_rotation(rotation);
+    printf("  rotation check  %d orientations, %lu misplaced corners\r\n",
+           (int)MTB_HX8347_ROTATION_COUNT, (unsigned long)errors);
+}
+#endif
+
+
+/*******************************************************************************
+ * Runs all LCD benchmarks.
+ *******************************************************************************/
+void lcd_benchmark_run(void)
+{
+    printf("\r\nLCD benchmark (%lu Hz core)\r\n", (unsigned long)SystemCoreClock);
+
+    lcd_benchmark_clear();
+    lcd_benchmark_rect_cost();
+    lcd_benchmark_bitmaps();
+    lcd_benchmark_port();
+    lcd_benchmark_color12();
+    lcd_benchmark_dlist();
+    lcd_benchmark_glyph();
+    lcd_benchmark_snap();
+    lcd_benchmark_region();
+    lcd_benchmark_pool();
+    lcd_benchmark_sprite();
+#if (LCD_SHADOW_ENABLE)
+    lcd_benchmark_shadow_check();
+    lcd_benchmark_rotation_check();
+#endif
+
+    GUI_Clear();
+}
+
+/* [] END OF FILE */
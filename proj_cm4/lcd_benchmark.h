@@ -0,0 +1,47 @@
+/*
+ * lcd_benchmark.h
+ *
+ *  On-target timing of the LCD paths, printed over the debug UART.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Enabled from the Makefile with LCD_BENCHMARK=1 */
+#ifndef LCD_BENCHMARK
+#define LCD_BENCHMARK               0
+#endif
+
+/* Sprite frames run back to back by the sprite benchmark */
+#ifndef LCD_BENCHMARK_FRAMES
+#define LCD_BENCHMARK_FRAMES        (300u)
+#endif
+
+
+/**
+ * Converts DWT cycles to microseconds at the current core clock.
+ * @param[in] cycles Cycle count
+ * @return Time in microseconds
+ */
+uint32_t lcd_benchmark_us(uint32_t cycles);
+
+/**
+ * Runs all LCD benchmarks and prints the results. Needs GUI_Init() to have
+ * run. Leaves the panel content undefined.
+ */
+void lcd_benchmark_run(void);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,124 @@
+/*
+ * lcd_bitmap.c
+ *
+ *  Palette bitmaps with cached colour tables, see lcd_bitmap.h.
+ */
+
+#include "cy_pdl.h"
+#include "lcd_bitmap.h"
+#include "lcd_prof.h"
+
+
+typedef struct
+{
+    const LCD_LOGPALETTE *pPal;
+    LCD_PIXELINDEX trans[256];      /* Colour indices for LCD_DrawBitmap() */
+    uint16_t wire[256];             /* Same colours in panel byte order */
+} lcd_bitmap_lut_t;
+
+static lcd_bitmap_lut_t lcd_bitmap_cache[LCD_BITMAP_CACHE_SIZE];
+static uint32_t lcd_bitmap_next;
+
+
+/*******************************************************************************
+ * Returns the converted tables of a palette, converting it on a miss into the
+ * oldest cache entry.
+ *******************************************************************************/
+static lcd_bitmap_lut_t *lcd_bitmap_lookup(const LCD_LOGPALETTE *pPal)
+{
+    lcd_bitmap_lut_t *lut;
+    LCD_PIXELINDEX index;
+    int i, num;
+
+    for (i = 0; i < LCD_BITMAP_CACHE_SIZE; i++)
+    {
+        if (lcd_bitmap_cache[i].pPal == pPal)
+        {
+            return &lcd_bitmap_cache[i];
+        }
+    }
+
+    LCD_PROF_BEGIN(LCD_PROF_PALETTE);
+    lut = &lcd_bitmap_cache[lcd_bitmap_next];
+    lcd_bitmap_next = (lcd_bitmap_next + 1u) % LCD_BITMAP_CACHE_SIZE;
+
+    num = (pPal->NumEntries < 256) ? pPal->NumEntries : 256;
+    for (i = 0; i < 256; i++)
+    {
+        index = (i < num) ? GUI_Color2Index(pPal->pPalEntries[i]) : 0u;
+        lut->trans[i] = index;
+        lut->wire[i] = (uint16_t)(((index & 0xFFu) << 8) | ((index >> 8) & 0xFFu));
+    }
+    lut->pPal = pPal;
+    LCD_PROF_END(LCD_PROF_PALETTE);
+
+    return lut;
+}
+
+
+/*******************************************************************************
+ * GUI_BITMAP_METHODS draw function. LCD_DrawBitmap() still clips and routes
+ * to the selected device, only the palette conversion is skipped.
+ *******************************************************************************/
+static void lcd_bitmap_draw_8bpp(int x0, int y0, int xsize, int ysize, const U8 *pPixel,
+                                 const LCD_LOGPALETTE *pLogPal, int xMag, int yMag)
+{
+    lcd_bitmap_lut_t *lut = lcd_bitmap_lookup(pLogPal);
+
+    LCD_DrawBitmap(x0, y0, xsize, ysize, xMag, yMag, 8, xsize, pPixel, lut->trans);
+}
+
+static const GUI_BITMAP_METHODS lcd_bitmap_methods_8bpp =
+{
+    .pfDraw = lcd_bitmap_draw_8bpp,
+};
+
+
+/*******************************************************************************
+ * Draws a bitmap, through the cached tables when it is an opaque 8bpp
+ * palette image.
+ *******************************************************************************/
+void lcd_bitmap_draw(const GUI_BITMAP *pBM, int x0, int y0)
+{
+    GUI_BITMAP bm;
+
+    if ((pBM->BitsPerPixel != 8) || (pBM->BytesPerLine != pBM->XSize) ||
+        (pBM->pPal == NULL) || pBM->pPal->HasTrans || (pBM->pMethods != NULL))
+    {
+        GUI_DrawBitmap(pBM, x0, y0);
+        return;
+    }
+
+    bm = *pBM;
+    bm.pMethods = &lcd_bitmap_methods_8bpp;
+    GUI_DrawBitmap(&bm, x0, y0);
+}
+
+
+/*******************************************************************************
+ * Returns the cached translation table of a palette.
+ *******************************************************************************/
+const LCD_PIXELINDEX *lcd_bitmap_get_trans(const LCD_LOGPALETTE *pPal)
+{
+    return lcd_bitmap_lookup(pPal)->trans;
+}
+
+
+/*******************************************************************************
+ * Maps a translation table back to its wire-order twin.
+ *******************************************************************************/
+const uint16_t *lcd_bitmap_get_wire_lut(const LCD_PIXELINDEX *pTrans)
+{
+    int i;
+
+    for (i = 0; i < LCD_BITMAP_CACHE_SIZE; i++)
+    {
+        if ((lcd_bitmap_cache[i].pPal != NULL) && (pTrans == lcd_bitmap_cache[i].trans))
+        {
+            return lcd_bitmap_cache[i].wire;
+        }
+    }
+    return NULL;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,61 @@
+/*
+ * lcd_bitmap.h
+ *
+ *  Palette bitmaps with cached colour tables. emWin converts all 256 palette
+ *  entries of an 8bpp image through GUICC_565 on every GUI_DrawBitmap().
+ *  Here each palette is converted once, to colour indices for emWin and to
+ *  byte-swapped RGB565 that the bitmap hook stores straight into the SPI
+ *  line buffer.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "GUI.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Number of palettes kept converted, 1.5 KB each */
+#ifndef LCD_BITMAP_CACHE_SIZE
+#define LCD_BITMAP_CACHE_SIZE       (4)
+#endif
+
+
+/**
+ * Draws a bitmap like GUI_DrawBitmap(). Opaque 8bpp palette images use the
+ * cached tables, everything else goes to GUI_DrawBitmap().
+ * @param[in] pBM Bitmap
+ * @param[in] x0  Left edge
+ * @param[in] y0  Top edge
+ */
+void lcd_bitmap_draw(const GUI_BITMAP *pBM, int x0, int y0);
+
+/**
+ * Returns the cached translation table of a palette, converting it on a miss.
+ * Passing it to LCD_DrawBitmap() lets the bitmap hook use the wire-order
+ * twin of the table.
+ * @param[in] pPal Palette with up to 256 entries
+ * @return 256 colour indices
+ */
+const LCD_PIXELINDEX *lcd_bitmap_get_trans(const LCD_LOGPALETTE *pPal);
+
+/**
+ * Looks up the wire-order table that belongs to a translation table handed
+ * out by this module.
+ * @param[in] pTrans Translation table passed to the device bitmap function
+ * @return 256 RGB565 values, high byte first in memory, or NULL if pTrans
+ *         was not produced by the cache
+ */
+const uint16_t *lcd_bitmap_get_wire_lut(const LCD_PIXELINDEX *pTrans);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
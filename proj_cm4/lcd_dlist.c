@@ -0,0 +1,744 @@
+/*
+ * lcd_dlist.c
+ *
+ *  Display list for flat screens, see lcd_dlist.h.
+ *
+ *  The list is cut into segments wherever a fill overlaps text or a bitmap
+ *  recorded before it in the same segment, so every fill of a segment can go
+ *  out before its text and bitmaps without changing what ends up on the glass.
+ *  Inside a segment each scanline is resolved into disjoint runs in painter's
+ *  order; opaque text cells and bitmaps cut holes the fills do not have to
+ *  paint. Runs that repeat on the next line grow into one rectangle, so a
+ *  ring of two circles goes out as a stack of thin rectangles and the blue
+ *  disc is never painted white first.
+ */
+
+#include "cy_pdl.h"
+#include "lcd_dlist.h"
+#include "lcd_prof.h"
+
+#include <string.h>
+
+
+typedef enum
+{
+    LCD_DLIST_CLEAR,
+    LCD_DLIST_RECT,
+    LCD_DLIST_CIRCLE,
+    LCD_DLIST_TEXT,
+    LCD_DLIST_BITMAP
+} lcd_dlist_kind_t;
+
+typedef struct
+{
+    uint8_t kind;
+    bool culled;
+    bool opaque;                /* Paints every pixel of rect */
+    GUI_RECT rect;              /* Pixels surely painted, clipped to the screen */
+    GUI_RECT bound;             /* Pixels possibly painted */
+    GUI_COLOR color;
+    GUI_COLOR bk;
+    const GUI_FONT *font;
+    const void *p;              /* String or bitmap */
+    int16_t x, y, r;
+    uint16_t hw;                /* First half width of a circle in lcd_dlist_hw[] */
+} lcd_dlist_op_t;
+
+typedef struct
+{
+    int16_t x0, x1;
+    bool hole;
+    GUI_COLOR color;
+} lcd_dlist_run_t;
+
+typedef struct
+{
+    int16_t x0, x1, y0;
+    GUI_COLOR color;
+} lcd_dlist_open_t;
+
+static lcd_dlist_op_t lcd_dlist_ops[LCD_DLIST_MAX_OPS];
+static int lcd_dlist_count;
+static int16_t lcd_dlist_hw[LCD_DLIST_CIRCLE_POOL];
+static uint32_t lcd_dlist_hw_used;
+static bool lcd_dlist_full;
+static bool lcd_dlist_optimize = true;
+
+static lcd_dlist_run_t lcd_dlist_runs[LCD_DLIST_MAX_RUNS];
+static lcd_dlist_run_t lcd_dlist_tmp[LCD_DLIST_MAX_RUNS];
+static int lcd_dlist_nruns;
+static lcd_dlist_open_t lcd_dlist_open[LCD_DLIST_MAX_RUNS];
+static int lcd_dlist_nopen;
+
+static lcd_dlist_stats_t lcd_dlist_stats;
+
+static void lcd_dlist_spill(void);
+
+
+/*******************************************************************************
+ * Clips a rectangle to the screen, returns false if nothing is left.
+ *******************************************************************************/
+static bool lcd_dlist_clip(GUI_RECT *rect)
+{
+    int xmax = LCD_GetXSize() - 1;
+    int ymax = LCD_GetYSize() - 1;
+
+    if (rect->x0 < 0) rect->x0 = 0;
+    if (rect->y0 < 0) rect->y0 = 0;
+    if (rect->x1 > xmax) rect->x1 = (I16)xmax;
+    if (rect->y1 > ymax) rect->y1 = (I16)ymax;
+    return (rect->x0 <= rect->x1) && (rect->y0 <= rect->y1);
+}
+
+
+static uint32_t lcd_dlist_area(const GUI_RECT *rect)
+{
+    return (uint32_t)(rect->x1 - rect->x0 + 1) * (uint32_t)(rect->y1 - rect->y0 + 1);
+}
+
+
+static bool lcd_dlist_inside(const GUI_RECT *in, const GUI_RECT *out)
+{
+    return (in->x0 >= out->x0) && (in->x1 <= out->x1) && (in->y0 >= out->y0) && (in->y1 <= out->y1);
+}
+
+
+static bool lcd_dlist_overlap(const GUI_RECT *a, const GUI_RECT *b)
+{
+    return (a->x0 <= b->x1) && (b->x0 <= a->x1) && (a->y0 <= b->y1) && (b->y0 <= a->y1);
+}
+
+
+static bool lcd_dlist_is_fill(const lcd_dlist_op_t *op)
+{
+    return op->kind <= LCD_DLIST_CIRCLE;
+}
+
+
+/*******************************************************************************
+ * Takes the next entry with the current emWin state, spilling a full list.
+ *******************************************************************************/
+static lcd_dlist_op_t *lcd_dlist_add(lcd_dlist_kind_t kind)
+{
+    lcd_dlist_op_t *op;
+
+    if (lcd_dlist_count >= LCD_DLIST_MAX_OPS)
+    {
+        lcd_dlist_spill();
+    }
+    op = &lcd_dlist_ops[lcd_dlist_count++];
+    memset(op, 0, sizeof(*op));
+    op->kind = (uint8_t)kind;
+    op->color = GUI_GetColor();
+    op->bk = GUI_GetBkColor();
+    op->font = GUI_GetFont();
+    return op;
+}
+
+
+/*******************************************************************************
+ * Starts a new list.
+ *******************************************************************************/
+void lcd_dlist_begin(void)
+{
+    uint32_t lists = lcd_dlist_stats.lists;
+
+    memset(&lcd_dlist_stats, 0, sizeof(lcd_dlist_stats));
+    lcd_dlist_stats.lists = lists;
+    lcd_dlist_count = 0;
+    lcd_dlist_hw_used = 0u;
+    lcd_dlist_full = false;
+}
+
+
+/*******************************************************************************
+ * Records a clear of the whole screen.
+ *******************************************************************************/
+void lcd_dlist_clear(void)
+{
+    lcd_dlist_op_t *op = lcd_dlist_add(LCD_DLIST_CLEAR);
+
+    op->rect.x0 = 0;
+    op->rect.y0 = 0;
+    op->rect.x1 = (I16)(LCD_GetXSize() - 1);
+    op->rect.y1 = (I16)(LCD_GetYSize() - 1);
+    op->bound = op->rect;
+    op->color = op->bk;
+    op->opaque = true;
+}
+
+
+/*******************************************************************************
+ * Records a rectangle fill.
+ *******************************************************************************/
+void lcd_dlist_fill_rect(int x0, int y0, int x1, int y1)
+{
+    lcd_dlist_op_t *op = lcd_dlist_add(LCD_DLIST_RECT);
+
+    op->rect.x0 = (I16)x0;
+    op->rect.y0 = (I16)y0;
+    op->rect.x1 = (I16)x1;
+    op->rect.y1 = (I16)y1;
+    op->culled = !lcd_dlist_clip(&op->rect);
+    op->bound = op->rect;
+    op->opaque = true;
+}
+
+
+/*******************************************************************************
+ * Records a circle fill with the half width of every line, computed the way
+ * emWin's GL_FillCircle() walks the circle.
+ *******************************************************************************/
+void lcd_dlist_fill_circle(int x0, int y0, int r)
+{
+    lcd_dlist_op_t *op;
+    int16_t *hw;
+    int32_t i, x, imax, sqmax;
+
+    if ((r < 0) || ((uint32_t)r >= LCD_DLIST_CIRCLE_POOL))
+    {
+        return;
+    }
+    if ((lcd_dlist_hw_used + (uint32_t)r + 1u) > LCD_DLIST_CIRCLE_POOL)
+    {
+        lcd_dlist_spill();
+    }
+    op = lcd_dlist_add(LCD_DLIST_CIRCLE);
+    op->x = (int16_t)x0;
+    op->y = (int16_t)y0;
+    op->r = (int16_t)r;
+    op->hw = (uint16_t)lcd_dlist_hw_used;
+    lcd_dlist_hw_used += (uint32_t)r + 1u;
+
+    hw = &lcd_dlist_hw[op->hw];
+    for (i = 0; i <= r; i++)
+    {
+        hw[i] = -1;
+    }
+    hw[0] = (int16_t)r;
+    imax = (r * 707) / 1000 + 1;
+    sqmax = r * r + r / 2;
+    x = r;
+    for (i = 1; i <= imax; i++)
+    {
+        if ((i * i + x * x) > sqmax)
+        {
+            if (x > imax)
+            {
+                hw[x] = (int16_t)(i - 1);
+            }
+            x--;
+        }
+        if (i <= r)
+        {
+            hw[i] = (int16_t)x;
+        }
+    }
+
+    op->rect.x0 = (I16)(x0 - r);
+    op->rect.y0 = (I16)(y0 - r);
+    op->rect.x1 = (I16)(x0 + r);
+    op->rect.y1 = (I16)(y0 + r);
+    op->culled = !lcd_dlist_clip(&op->rect);
+    op->bound = op->rect;
+}
+
+
+/*******************************************************************************
+ * Records centred text. The cell is only trusted one pixel in from the ends,
+ * the rounding of the centring is emWin's.
+ *******************************************************************************/
+void lcd_dlist_text_hcenter(const char *s, int x, int y)
+{
+    lcd_dlist_op_t *op = lcd_dlist_add(LCD_DLIST_TEXT);
+    int width, height, left;
+
+    width = GUI_GetStringDistX(s);
+    height = GUI_GetFontSizeY();
+    left = x - width / 2;
+    op->p = s;
+    op->x = (int16_t)x;
+    op->y = (int16_t)y;
+
+    op->bound.x0 = (I16)(left - 1);
+    op->bound.x1 = (I16)(left + width);
+    op->bound.y0 = (I16)y;
+    op->bound.y1 = (I16)(y + ((GUI_GetFontDistY() > height) ? GUI_GetFontDistY() : height) - 1);
+    op->culled = !lcd_dlist_clip(&op->bound);
+
+    op->rect.x0 = (I16)(left + 1);
+    op->rect.x1 = (I16)(left + width - 2);
+    op->rect.y0 = (I16)y;
+    op->rect.y1 = (I16)(y + height - 1);
+    op->opaque = lcd_dlist_clip(&op->rect) && (GUI_GetTextMode() == GUI_TM_NORMAL);
+}
+
+
+/*******************************************************************************
+ * Records a bitmap. Only palette bitmaps without a transparent entry are
+ * known to cover their rectangle.
+ *******************************************************************************/
+void lcd_dlist_bitmap(const GUI_BITMAP *pBM, int x, int y)
+{
+    lcd_dlist_op_t *op = lcd_dlist_add(LCD_DLIST_BITMAP);
+
+    op->p = pBM;
+    op->x = (int16_t)x;
+    op->y = (int16_t)y;
+    op->rect.x0 = (I16)x;
+    op->rect.y0 = (I16)y;
+    op->rect.x1 = (I16)(x + pBM->XSize - 1);
+    op->rect.y1 = (I16)(y + pBM->YSize - 1);
+    op->culled = !lcd_dlist_clip(&op->rect);
+    op->bound = op->rect;
+    op->opaque = (pBM->pMethods == NULL) && (pBM->pPal != NULL) && !pBM->pPal->HasTrans;
+}
+
+
+/*******************************************************************************
+ * Pixels an operation sends when replayed.
+ *******************************************************************************/
+static uint32_t lcd_dlist_op_pixels(const lcd_dlist_op_t *op)
+{
+    uint32_t pixels = 0u;
+    int i;
+
+    if (op->kind == LCD_DLIST_CIRCLE)
+    {
+        for (i = -op->r; i <= op->r; i++)
+        {
+            if (lcd_dlist_hw[op->hw + ((i < 0) ? -i : i)] >= 0)
+            {
+                pixels += (uint32_t)(2 * lcd_dlist_hw[op->hw + ((i < 0) ? -i : i)] + 1);
+            }
+        }
+        return pixels;
+    }
+    return lcd_dlist_area(&op->bound);
+}
+
+
+/*******************************************************************************
+ * Draws one operation as recorded.
+ *******************************************************************************/
+static void lcd_dlist_replay(const lcd_dlist_op_t *op)
+{
+    switch (op->kind)
+    {
+        case LCD_DLIST_CLEAR:
+            GUI_SetBkColor(op->bk);
+            GUI_Clear();
+            break;
+        case LCD_DLIST_RECT:
+            GUI_SetColor(op->color);
+            GUI_FillRect(op->rect.x0, op->rect.y0, op->rect.x1, op->rect.y1);
+            break;
+        case LCD_DLIST_CIRCLE:
+            GUI_SetColor(op->color);
+            GUI_FillCircle(op->x, op->y, op->r);
+            break;
+        case LCD_DLIST_TEXT:
+            GUI_SetFont(op->font);
+            GUI_SetColor(op->color);
+            GUI_SetBkColor(op->bk);
+            GUI_DispStringHCenterAt((const char *)op->p, op->x, op->y);
+            break;
+        default:
+            GUI_DrawBitmap((const GUI_BITMAP *)op->p, op->x, op->y);
+            break;
+    }
+    lcd_dlist_stats.pixels_out += lcd_dlist_op_pixels(op);
+}
+
+
+/*******************************************************************************
+ * Sends one merged rectangle.
+ *******************************************************************************/
+static void lcd_dlist_send(const lcd_dlist_open_t *open, int y1)
+{
+    GUI_SetColor(open->color);
+    GUI_FillRect(open->x0, open->y0, open->x1, y1);
+    lcd_dlist_stats.rects++;
+    lcd_dlist_stats.pixels_out += (uint32_t)(open->x1 - open->x0 + 1) * (uint32_t)(y1 - open->y0 + 1);
+}
+
+
+/*******************************************************************************
+ * Paints a run over the runs of the line so far, false if the table is full.
+ *******************************************************************************/
+static bool lcd_dlist_insert(int x0, int x1, GUI_COLOR color, bool hole)
+{
+    lcd_dlist_run_t *out = lcd_dlist_tmp;
+    lcd_dlist_run_t *run;
+    lcd_dlist_run_t add;
+    bool placed = false;
+    int i, n = 0;
+
+    add.x0 = (int16_t)x0;
+    add.x1 = (int16_t)x1;
+    add.hole = hole;
+    add.color = color;
+
+    for (i = 0; i < lcd_dlist_nruns; i++)
+    {
+        run = &lcd_dlist_runs[i];
+        if ((n + 3) > LCD_DLIST_MAX_RUNS)
+        {
+            return false;
+        }
+        if (run->x1 < x0)
+        {
+            out[n++] = *run;
+            continue;
+        }
+        if (run->x0 > x1)
+        {
+            if (!placed)
+            {
+                out[n++] = add;
+                placed = true;
+            }
+            out[n++] = *run;
+            continue;
+        }
+        if (run->x0 < x0)
+        {
+            out[n] = *run;
+            out[n++].x1 = (int16_t)(x0 - 1);
+        }
+        if (!placed)
+        {
+            out[n++] = add;
+            placed = true;
+        }
+        if (run->x1 > x1)
+        {
+            out[n] = *run;
+            out[n++].x0 = (int16_t)(x1 + 1);
+        }
+    }
+    if (!placed)
+    {
+        if (n >= LCD_DLIST_MAX_RUNS)
+        {
+            return false;
+        }
+        out[n++] = add;
+    }
+
+    memcpy(lcd_dlist_runs, out, (size_t)n * sizeof(lcd_dlist_run_t));
+    lcd_dlist_nruns = n;
+    return true;
+}
+
+
+/*******************************************************************************
+ * Resolves one scanline of a segment into runs, false on overflow.
+ *******************************************************************************/
+static bool lcd_dlist_line(int first, int last, int y)
+{
+    const lcd_dlist_op_t *op;
+    int i, n, dy, half, xmax = LCD_GetXSize() - 1;
+    int x0, x1;
+
+    lcd_dlist_nruns = 0;
+    for (i = first; i < last; i++)
+    {
+        op = &lcd_dlist_ops[i];
+        if (op->culled || (y < op->rect.y0) || (y > op->rect.y1))
+        {
+            continue;
+        }
+        if (op->kind == LCD_DLIST_CIRCLE)
+        {
+            dy = (y < op->y) ? (op->y - y) : (y - op->y);
+            half = lcd_dlist_hw[op->hw + dy];
+            if (half < 0)
+            {
+                continue;
+            }
+            x0 = (op->x - half < 0) ? 0 : (op->x - half);
+            x1 = (op->x + half > xmax) ? xmax : (op->x + half);
+            if (x0 > x1)
+            {
+                continue;
+            }
+        }
+        else if (lcd_dlist_is_fill(op) || op->opaque)
+        {
+            x0 = op->rect.x0;
+            x1 = op->rect.x1;
+        }
+        else
+        {
+            continue;
+        }
+        if (!lcd_dlist_insert(x0, x1, op->color, !lcd_dlist_is_fill(op)))
+        {
+            return false;
+        }
+    }
+
+    /* Neighbours of the same colour, from different fills, become one run */
+    for (i = 1, n = 0; i < lcd_dlist_nruns; i++)
+    {
+        if (!lcd_dlist_runs[n].hole && !lcd_dlist_runs[i].hole &&
+            (lcd_dlist_runs[n].color == lcd_dlist_runs[i].color) &&
+            (lcd_dlist_runs[n].x1 + 1 == lcd_dlist_runs[i].x0))
+        {
+            lcd_dlist_runs[n].x1 = lcd_dlist_runs[i].x1;
+        }
+        else
+        {
+            lcd_dlist_runs[++n] = lcd_dlist_runs[i];
+        }
+    }
+    if (lcd_dlist_nruns > 0)
+    {
+        lcd_dlist_nruns = n + 1;
+    }
+    return true;
+}
+
+
+/*******************************************************************************
+ * Extends the open rectangles that continue on this line, sends the ones that
+ * stop and opens one for every new run.
+ *******************************************************************************/
+static void lcd_dlist_merge(int y)
+{
+    bool claimed[LCD_DLIST_MAX_RUNS];
+    lcd_dlist_run_t *run;
+    int i, j, n = 0;
+
+    memset(claimed, 0, sizeof(claimed));
+    for (i = 0; i < lcd_dlist_nopen; i++)
+    {
+        for (j = 0; j < lcd_dlist_nruns; j++)
+        {
+            run = &lcd_dlist_runs[j];
+            if (!claimed[j] && !run->hole && (run->x0 == lcd_dlist_open[i].x0) &&
+                (run->x1 == lcd_dlist_open[i].x1) && (run->color == lcd_dlist_open[i].color))
+            {
+                break;
+            }
+        }
+        if (j < lcd_dlist_nruns)
+        {
+            claimed[j] = true;
+            lcd_dlist_open[n++] = lcd_dlist_open[i];
+        }
+        else
+        {
+            lcd_dlist_send(&lcd_dlist_open[i], y - 1);
+        }
+    }
+
+    for (j = 0; j < lcd_dlist_nruns; j++)
+    {
+        run = &lcd_dlist_runs[j];
+        if (!claimed[j] && !run->hole)
+        {
+            lcd_dlist_open[n].x0 = run->x0;
+            lcd_dlist_open[n].x1 = run->x1;
+            lcd_dlist_open[n].y0 = (int16_t)y;
+            lcd_dlist_open[n].color = run->color;
+            n++;
+        }
+    }
+    lcd_dlist_nopen = n;
+}
+
+
+/*******************************************************************************
+ * Sends the operations [first, last): the fills as merged rectangles, then
+ * text and bitmaps in recorded order.
+ *******************************************************************************/
+static void lcd_dlist_segment(int first, int last)
+{
+    const lcd_dlist_op_t *op;
+    int i, y, y0 = LCD_GetYSize(), y1 = -1;
+
+    lcd_dlist_stats.segments++;
+    for (i = first; i < last; i++)
+    {
+        op = &lcd_dlist_ops[i];
+        if (!op->culled && lcd_dlist_is_fill(op))
+        {
+            y0 = (op->rect.y0 < y0) ? op->rect.y0 : y0;
+            y1 = (op->rect.y1 > y1) ? op->rect.y1 : y1;
+        }
+    }
+
+    lcd_dlist_nopen = 0;
+    for (y = y0; y <= y1; y++)
+    {
+        if (!lcd_dlist_line(first, last, y))
+        {
+            /* Replaying paints over whatever went out already */
+            lcd_dlist_stats.overflow = true;
+            for (i = first; i < last; i++)
+            {
+                if (!lcd_dlist_ops[i].culled)
+                {
+                    lcd_dlist_replay(&lcd_dlist_ops[i]);
+                }
+            }
+            return;
+        }
+        lcd_dlist_merge(y);
+    }
+    for (i = 0; i < lcd_dlist_nopen; i++)
+    {
+        lcd_dlist_send(&lcd_dlist_open[i], y1);
+    }
+
+    for (i = first; i < last; i++)
+    {
+        op = &lcd_dlist_ops[i];
+        if (!op->culled && !lcd_dlist_is_fill(op))
+        {
+            lcd_dlist_replay(op);
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Drops what a later opaque rectangle covers, then cuts the list where a fill
+ * would have to go out after text or a bitmap it overlaps.
+ *******************************************************************************/
+static void lcd_dlist_optimize_list(void)
+{
+    lcd_dlist_op_t *op;
+    int i, j, first = 0;
+
+    for (i = 0; i < lcd_dlist_count; i++)
+    {
+        op = &lcd_dlist_ops[i];
+        for (j = i + 1; !op->culled && (j < lcd_dlist_count); j++)
+        {
+            if (lcd_dlist_ops[j].opaque && !lcd_dlist_ops[j].culled &&
+                (lcd_dlist_ops[j].kind != LCD_DLIST_CIRCLE) &&
+                lcd_dlist_inside(&op->bound, &lcd_dlist_ops[j].rect))
+            {
+                op->culled = true;
+                lcd_dlist_stats.culled++;
+            }
+        }
+    }
+
+    for (i = 0; i < lcd_dlist_count; i++)
+    {
+        op = &lcd_dlist_ops[i];
+        if (op->culled || !lcd_dlist_is_fill(op))
+        {
+            continue;
+        }
+        for (j = first; j < i; j++)
+        {
+            if (!lcd_dlist_ops[j].culled && !lcd_dlist_is_fill(&lcd_dlist_ops[j]) &&
+                lcd_dlist_overlap(&op->bound, &lcd_dlist_ops[j].bound))
+            {
+                lcd_dlist_segment(first, i);
+                first = i;
+                break;
+            }
+        }
+    }
+    lcd_dlist_segment(first, lcd_dlist_count);
+}
+
+
+/*******************************************************************************
+ * Replays the operations recorded so far, leaving emWin's colours and font as
+ * they were.
+ *******************************************************************************/
+static void lcd_dlist_flush(bool optimize)
+{
+    GUI_COLOR color = GUI_GetColor();
+    GUI_COLOR bk = GUI_GetBkColor();
+    const GUI_FONT *font = GUI_GetFont();
+    int i;
+
+    lcd_dlist_stats.ops += (uint32_t)lcd_dlist_count;
+    for (i = 0; i < lcd_dlist_count; i++)
+    {
+        if (!lcd_dlist_ops[i].culled)
+        {
+            lcd_dlist_stats.pixels_in += lcd_dlist_op_pixels(&lcd_dlist_ops[i]);
+        }
+    }
+
+    if (optimize)
+    {
+        lcd_dlist_optimize_list();
+    }
+    else
+    {
+        for (i = 0; i < lcd_dlist_count; i++)
+        {
+            if (!lcd_dlist_ops[i].culled)
+            {
+                lcd_dlist_replay(&lcd_dlist_ops[i]);
+            }
+        }
+    }
+
+    GUI_SetColor(color);
+    GUI_SetBkColor(bk);
+    GUI_SetFont(font);
+    lcd_dlist_count = 0;
+    lcd_dlist_hw_used = 0u;
+}
+
+
+/*******************************************************************************
+ * Makes room in a full list. What was recorded goes out as it is, and so does
+ * the rest of the list: a later operation may cover it, which the optimizer
+ * can no longer see.
+ *******************************************************************************/
+static void lcd_dlist_spill(void)
+{
+    uint32_t start = DWT->CYCCNT;
+
+    lcd_dlist_full = true;
+    lcd_dlist_stats.overflow = true;
+    lcd_dlist_flush(false);
+    lcd_dlist_stats.cycles += DWT->CYCCNT - start;
+}
+
+
+/*******************************************************************************
+ * Sends the list.
+ *******************************************************************************/
+void lcd_dlist_end(void)
+{
+    uint32_t start = DWT->CYCCNT;
+    LCD_PROF_BEGIN(LCD_PROF_DLIST);
+
+    lcd_dlist_flush(lcd_dlist_optimize && !lcd_dlist_full);
+    lcd_dlist_stats.lists++;
+    lcd_dlist_stats.cycles += DWT->CYCCNT - start;
+    LCD_PROF_END(LCD_PROF_DLIST);
+}
+
+
+/*******************************************************************************
+ * Switches the optimizer.
+ *******************************************************************************/
+void lcd_dlist_set_optimize(bool enable)
+{
+    lcd_dlist_optimize = enable;
+}
+
+
+/*******************************************************************************
+ * Copies the counters of the last list.
+ *******************************************************************************/
+void lcd_dlist_get_stats(lcd_dlist_stats_t *stats)
+{
+    *stats = lcd_dlist_stats;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,98 @@
+/*
+ * lcd_dlist.h
+ *
+ *  Display list for flat screens. Clears, rectangle and circle fills, text
+ *  and bitmaps are recorded instead of drawn; lcd_dlist_end() drops what is
+ *  hidden, resolves the overlapping fills scanline by scanline and sends
+ *  each visible pixel once, as rectangles merged from identical spans.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "GUI.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Recorded operations per list */
+#ifndef LCD_DLIST_MAX_OPS
+#define LCD_DLIST_MAX_OPS           (32)
+#endif
+
+/* Visible runs per scanline, more falls back to plain replay */
+#ifndef LCD_DLIST_MAX_RUNS
+#define LCD_DLIST_MAX_RUNS          (32)
+#endif
+
+/* Circle half-width entries shared by all circles of a list */
+#define LCD_DLIST_CIRCLE_POOL       (512)
+
+/** Optimizer counters of the last list */
+typedef struct
+{
+    uint32_t lists;         /**< Lists sent since boot */
+    uint32_t ops;           /**< Operations recorded */
+    uint32_t culled;        /**< Operations hidden by a later opaque rectangle */
+    uint32_t segments;      /**< Parts optimized separately because a fill covers earlier text */
+    uint32_t rects;         /**< Fill rectangles sent */
+    uint32_t pixels_in;     /**< Pixels the recorded operations would send */
+    uint32_t pixels_out;    /**< Pixels actually sent */
+    uint32_t cycles;        /**< CPU cycles spent in lcd_dlist_end() */
+    bool overflow;          /**< List or run table full, replayed as recorded */
+} lcd_dlist_stats_t;
+
+
+/**
+ * Starts recording a list. The recording functions take the colours and the
+ * font currently set in emWin, like the drawing functions they replace.
+ */
+void lcd_dlist_begin(void);
+
+/** Records GUI_Clear() with the current background colour. */
+void lcd_dlist_clear(void);
+
+/** Records GUI_FillRect() with the current colour. */
+void lcd_dlist_fill_rect(int x0, int y0, int x1, int y1);
+
+/** Records GUI_FillCircle() with the current colour. */
+void lcd_dlist_fill_circle(int x0, int y0, int r);
+
+/**
+ * Records GUI_DispStringHCenterAt() with the current font and colours. The
+ * string must stay valid until lcd_dlist_end().
+ */
+void lcd_dlist_text_hcenter(const char *s, int x, int y);
+
+/** Records GUI_DrawBitmap(). */
+void lcd_dlist_bitmap(const GUI_BITMAP *pBM, int x, int y);
+
+/**
+ * Sends the list to the panel, optimized unless that was switched off.
+ */
+void lcd_dlist_end(void);
+
+/**
+ * Switches the optimizer. Off, lists are replayed as recorded, which is what
+ * the screens did before; the benchmark compares the two.
+ * @param[in] enable false to replay
+ */
+void lcd_dlist_set_optimize(bool enable);
+
+/**
+ * Copies the counters of the last list.
+ * @param[out] stats Where to store the counters
+ */
+void lcd_dlist_get_stats(lcd_dlist_stats_t *stats);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
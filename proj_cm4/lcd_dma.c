@@ -0,0 +1,241 @@
+/*
+ * lcd_dma.c
+ *
+ *  Background pixel streaming for the HX8347 panel.
+ *
+ *  Two line buffers are used. While buffer N is on the wire the CPU returns
+ *  to emWin, which rasterizes the next band and hands it over through
+ *  lcd_dma_write_data_stream(). The copy into buffer N+1 overlaps with the
+ *  transfer, only the kick of N+1 waits for N to finish. LCD_CS is raised in
+ *  the transfer-done event, the panel keeps writing GRAM across CS cycles.
+ */
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "cybsp.h"
+#include "mtb_hx8347.h"
+#include "lcd_dma.h"
+#include "lcd_shadow.h"
+#include "lcd_prof.h"
+#include <string.h>
+
+
+extern cyhal_spi_t mSPI;
+
+static uint8_t lcd_dma_buf[2][LCD_DMA_BUF_SIZE] __attribute__((aligned(4)));
+static uint8_t lcd_dma_fill;
+static bool lcd_dma_ready = false;
+static bool lcd_dma_dirty = false;
+static volatile bool lcd_dma_active = false;
+static volatile uint32_t lcd_dma_queued;
+static volatile uint32_t lcd_dma_done;
+static volatile uint32_t lcd_dma_kick_cycles;
+static lcd_dma_stats_t lcd_dma_stats;
+
+
+/*******************************************************************************
+ * SPI transfer-done event. Ends the CS cycle of the finished buffer.
+ *******************************************************************************/
+static void lcd_dma_event(void *callback_arg, cyhal_spi_event_t event)
+{
+    (void) callback_arg;
+
+    if (0u != (event & CYHAL_SPI_IRQ_DONE))
+    {
+        __LCD_CS_SET();
+        lcd_dma_stats.busy_cycles += DWT->CYCCNT - lcd_dma_kick_cycles;
+        lcd_dma_done++;
+        lcd_dma_active = false;
+    }
+}
+
+
+/*******************************************************************************
+ * Waits for the transfer on the wire, if any.
+ *******************************************************************************/
+static void lcd_dma_wait_idle(void)
+{
+    uint32_t start;
+
+    if (lcd_dma_active)
+    {
+        start = DWT->CYCCNT;
+        while (lcd_dma_active)
+        {
+            /* Wait for the transfer-done event */
+        }
+        lcd_dma_stats.wait_cycles += DWT->CYCCNT - start;
+        LCD_PROF_RECORD(LCD_PROF_DMA_WAIT, DWT->CYCCNT - start);
+    }
+}
+
+
+/*******************************************************************************
+ * Sets up DMA based asynchronous transfers on the LCD SPI block.
+ *******************************************************************************/
+cy_rslt_t lcd_dma_init(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+#if (LCD_DMA_ENABLE)
+    result = cyhal_spi_set_async_mode(&mSPI, CYHAL_ASYNC_DMA, CYHAL_DMA_PRIORITY_DEFAULT);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        cyhal_spi_register_callback(&mSPI, lcd_dma_event, NULL);
+        cyhal_spi_enable_event(&mSPI, CYHAL_SPI_IRQ_DONE, LCD_DMA_IRQ_PRIORITY, true);
+        lcd_dma_ready = true;
+    }
+#endif
+
+    return result;
+}
+
+
+/*******************************************************************************
+ * Starts the transfer of a filled line buffer once the other one is done.
+ *******************************************************************************/
+static void lcd_dma_kick(uint8_t *buf, uint32_t chunk)
+{
+    lcd_dma_wait_idle();
+
+    __LCD_DC_SET();
+    __LCD_CS_CLR();
+    lcd_dma_active = true;
+    lcd_dma_dirty = true;
+    lcd_dma_queued++;
+    lcd_dma_kick_cycles = DWT->CYCCNT;
+    if (CY_RSLT_SUCCESS != cyhal_spi_transfer_async(&mSPI, buf, chunk, NULL, 0u))
+    {
+        /* Bus refused the transfer, fall back to the blocking path */
+        lcd_dma_active = false;
+        lcd_dma_done++;
+        mtb_hx8347_write_data_stream(buf, (int)chunk);
+    }
+    else
+    {
+        lcd_shadow_data(buf, chunk);
+        lcd_dma_stats.transfers++;
+        lcd_dma_stats.bytes += chunk;
+    }
+
+    lcd_dma_fill ^= 1u;
+}
+
+
+/*******************************************************************************
+ * Queues a pixel stream. Streams larger than one line buffer are split, each
+ * chunk is copied while the previous one is still being sent.
+ *******************************************************************************/
+void lcd_dma_write_data_stream(uint8_t *data, int num)
+{
+    uint32_t chunk;
+    uint8_t *buf;
+
+    if (!lcd_dma_ready || (num < LCD_DMA_MIN_BYTES))
+    {
+        mtb_hx8347_write_data_stream(data, num);
+        return;
+    }
+
+    /* The bus stays with the LCD after the release, SD waits through the drain */
+    __LCD_BUS_ACQUIRE();
+    while (num > 0)
+    {
+        chunk = ((uint32_t)num > LCD_DMA_BUF_SIZE) ? LCD_DMA_BUF_SIZE : (uint32_t)num;
+        buf = lcd_dma_buf[lcd_dma_fill];
+        memcpy(buf, data, chunk);
+        lcd_dma_kick(buf, chunk);
+        data += chunk;
+        num -= (int)chunk;
+    }
+    __LCD_BUS_RELEASE();
+}
+
+
+/*******************************************************************************
+ * GUI_PORT_API multi-pixel write for the 16-bit port. The pixels are swapped
+ * into wire order while they are copied to the line buffer, so the array
+ * costs one pass and one kick per buffer.
+ *******************************************************************************/
+void lcd_dma_write_data16_stream(uint16_t *data, int num)
+{
+    uint32_t chunk, i;
+    uint8_t *buf;
+
+    if (!lcd_dma_ready || (2 * num < LCD_DMA_MIN_BYTES))
+    {
+        mtb_hx8347_write_data16_stream(data, num);
+        return;
+    }
+
+    __LCD_BUS_ACQUIRE();
+    while (num > 0)
+    {
+        chunk = ((uint32_t)num > LCD_DMA_BUF_SIZE / 2u) ? (LCD_DMA_BUF_SIZE / 2u) : (uint32_t)num;
+        buf = lcd_dma_buf[lcd_dma_fill];
+        for (i = 0; i < chunk; i++)
+        {
+            buf[2u * i] = (uint8_t)(data[i] >> 8);
+            buf[2u * i + 1u] = (uint8_t)data[i];
+        }
+        lcd_dma_kick(buf, 2u * chunk);
+        data += chunk;
+        num -= (int)chunk;
+    }
+    __LCD_BUS_RELEASE();
+}
+
+
+/*******************************************************************************
+ * Returns the fence of the most recently queued transfer.
+ *******************************************************************************/
+uint32_t lcd_dma_get_fence(void)
+{
+    return lcd_dma_queued;
+}
+
+
+/*******************************************************************************
+ * Checks whether all transfers up to a fence have completed.
+ *******************************************************************************/
+bool lcd_dma_fence_reached(uint32_t fence)
+{
+    return ((int32_t)(lcd_dma_done - fence) >= 0);
+}
+
+
+/*******************************************************************************
+ * Waits until all transfers up to a fence have completed.
+ *******************************************************************************/
+void lcd_dma_wait_fence(uint32_t fence)
+{
+    if (!lcd_dma_fence_reached(fence))
+    {
+        lcd_dma_wait_idle();
+    }
+}
+
+
+/*******************************************************************************
+ * Drains the DMA queue and leaves an empty RX FIFO for blocking HAL users.
+ *******************************************************************************/
+void lcd_dma_fence(void)
+{
+    if (lcd_dma_dirty)
+    {
+        lcd_dma_wait_idle();
+        Cy_SCB_SPI_ClearRxFifo(mSPI.base);
+        lcd_dma_dirty = false;
+    }
+}
+
+
+/*******************************************************************************
+ * Copies the DMA streaming counters.
+ *******************************************************************************/
+void lcd_dma_get_stats(lcd_dma_stats_t *stats)
+{
+    *stats = lcd_dma_stats;
+}
+
+/* [] END OF FILE */
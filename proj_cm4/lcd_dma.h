@@ -0,0 +1,105 @@
+/*
+ * lcd_dma.h
+ *
+ *  Background pixel streaming for the HX8347 panel. Pixel data handed over by
+ *  emWin is copied into one of two line buffers and clocked out by the SCB
+ *  DMA while the CPU goes back to rasterizing the next band.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Set to 0 to send every pixel stream with the blocking burst path */
+#ifndef LCD_DMA_ENABLE
+#define LCD_DMA_ENABLE              1
+#endif
+
+/* Size of each of the two line buffers in bytes (one 320 pixel line = 640) */
+#define LCD_DMA_BUF_SIZE            (1024u)
+
+/* Streams shorter than this go out blocking, DMA setup costs more */
+#define LCD_DMA_MIN_BYTES           (32)
+
+/* Interrupt priority of the transfer-done event */
+#define LCD_DMA_IRQ_PRIORITY        (3u)
+
+/** DMA streaming counters */
+typedef struct
+{
+    uint32_t transfers;     /**< DMA transfers started */
+    uint32_t bytes;         /**< Bytes sent by DMA */
+    uint32_t busy_cycles;   /**< CPU cycles a transfer was on the wire */
+    uint32_t wait_cycles;   /**< CPU cycles spent waiting for the DMA */
+} lcd_dma_stats_t;
+
+
+/**
+ * Switches the LCD SPI block to DMA driven asynchronous transfers. Must be
+ * called after the SPI block has been initialized.
+ * @return CY_RSLT_SUCCESS if DMA streaming is available
+ */
+cy_rslt_t lcd_dma_init(void);
+
+/**
+ * GUI_PORT_API compatible multi-byte data write (LCD_DC = 1). Returns as soon
+ * as the data has been copied to a free line buffer.
+ * @param[in] data Pointer to the data to send to the display
+ * @param[in] num  The number of bytes in the data array
+ */
+void lcd_dma_write_data_stream(uint8_t *data, int num);
+
+/**
+ * GUI_PORT_API compatible multi-pixel write for the 16-bit port. The pixels
+ * are converted to wire order on the way into the line buffer.
+ * @param[in] data Pointer to the pixels to send to the display
+ * @param[in] num  The number of pixels in the data array
+ */
+void lcd_dma_write_data16_stream(uint16_t *data, int num);
+
+/**
+ * Returns the fence of the most recently queued transfer.
+ * @return Fence value to pass to lcd_dma_wait_fence()
+ */
+uint32_t lcd_dma_get_fence(void);
+
+/**
+ * Checks whether the transfer identified by a fence has completed.
+ * @param[in] fence Value returned by lcd_dma_get_fence()
+ * @return true once all data up to the fence is on the panel
+ */
+bool lcd_dma_fence_reached(uint32_t fence);
+
+/**
+ * Waits until the transfer identified by a fence has completed.
+ * @param[in] fence Value returned by lcd_dma_get_fence()
+ */
+void lcd_dma_wait_fence(uint32_t fence);
+
+/**
+ * Waits for all queued transfers and hands the SPI bus back to blocking
+ * users. Every other user of the LCD or the shared SPI bus calls this first.
+ */
+void lcd_dma_fence(void);
+
+/**
+ * Copies the DMA streaming counters.
+ * @param[out] stats Where to store the counters
+ */
+void lcd_dma_get_stats(lcd_dma_stats_t *stats);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,187 @@
+/*
+ * lcd_glyph.c
+ *
+ *  Glyph cache, see lcd_glyph.h.
+ *
+ *  The entries sit back to back in the span buffer in slot order. Evicting
+ *  one moves the entries behind it down, so free space is always at the top
+ *  and a miss never fails for fragmentation.
+ */
+
+#include <string.h>
+#include "lcd_glyph.h"
+#include "app_arena.h"
+
+
+typedef struct
+{
+    const U8 *pData;
+    uint16_t xSize;
+    uint16_t ySize;
+    uint16_t BytesPerLine;
+    uint8_t Diff;
+    uint16_t offset;
+    uint16_t length;
+    uint32_t used;                  /* lcd_glyph_clock at the last hit */
+} lcd_glyph_slot_t;
+
+static lcd_glyph_slot_t lcd_glyph_slots[LCD_GLYPH_SLOTS];
+static uint8_t *lcd_glyph_spans;
+static bool lcd_glyph_no_arena;
+static bool lcd_glyph_enabled = true;
+static uint32_t lcd_glyph_clock;
+static lcd_glyph_stats_t lcd_glyph_stats;
+
+
+/*******************************************************************************
+ * Encodes a glyph into spans, or only counts the bytes when pDst is NULL.
+ * Runs longer than 255 are split by an empty run of the other colour.
+ *******************************************************************************/
+static uint32_t lcd_glyph_encode(uint8_t *pDst, const U8 *pData, int xSize, int ySize,
+                                 int BytesPerLine, int Diff)
+{
+    uint32_t bytes = 0u;
+    unsigned bit, cur;
+    int x, y, n;
+
+    for (y = 0; y < ySize; y++, pData += BytesPerLine)
+    {
+        cur = 0u;
+        for (x = 0; x < xSize; cur ^= 1u)
+        {
+            for (n = 0; x + n < xSize; n++)
+            {
+                bit = (pData[(x + n + Diff) >> 3] >> (7 - ((x + n + Diff) & 7))) & 1u;
+                if (bit != cur)
+                {
+                    break;
+                }
+            }
+            x += n;
+            for (; n > 255; n -= 255, bytes += 2u)
+            {
+                if (pDst != NULL)
+                {
+                    *pDst++ = 255u;
+                    *pDst++ = 0u;
+                }
+            }
+            if (pDst != NULL)
+            {
+                *pDst++ = (uint8_t)n;
+            }
+            bytes++;
+        }
+    }
+    return bytes;
+}
+
+
+/*******************************************************************************
+ * Drops one entry and closes the gap it leaves.
+ *******************************************************************************/
+static void lcd_glyph_evict(uint32_t i)
+{
+    lcd_glyph_slot_t *s = &lcd_glyph_slots[i];
+    uint32_t top = lcd_glyph_stats.bytes_used;
+    uint32_t j;
+
+    memmove(&lcd_glyph_spans[s->offset], &lcd_glyph_spans[s->offset + s->length],
+            top - s->offset - s->length);
+    lcd_glyph_stats.bytes_used -= s->length;
+    for (j = i + 1u; j < lcd_glyph_stats.entries; j++)
+    {
+        lcd_glyph_slots[j].offset -= s->length;
+    }
+    memmove(s, s + 1, (lcd_glyph_stats.entries - i - 1u) * sizeof(lcd_glyph_slot_t));
+    lcd_glyph_stats.entries--;
+    lcd_glyph_stats.evictions++;
+}
+
+
+/*******************************************************************************
+ * Returns the spans of a glyph, encoding it on a miss.
+ *******************************************************************************/
+const uint8_t *lcd_glyph_lookup(const U8 *pData, int xSize, int ySize, int BytesPerLine, int Diff)
+{
+    lcd_glyph_slot_t *s;
+    uint32_t i, lru, length;
+
+    if (!lcd_glyph_enabled)
+    {
+        return NULL;
+    }
+
+    lcd_glyph_clock++;
+    for (i = 0; i < lcd_glyph_stats.entries; i++)
+    {
+        s = &lcd_glyph_slots[i];
+        if ((s->pData == pData) && (s->xSize == xSize) && (s->ySize == ySize) &&
+            (s->BytesPerLine == BytesPerLine) && (s->Diff == Diff))
+        {
+            s->used = lcd_glyph_clock;
+            lcd_glyph_stats.hits++;
+            return &lcd_glyph_spans[s->offset];
+        }
+    }
+
+    lcd_glyph_stats.misses++;
+    if ((lcd_glyph_spans == NULL) && !lcd_glyph_no_arena)
+    {
+        lcd_glyph_spans = app_arena_alloc(LCD_GLYPH_CACHE_BYTES);
+        lcd_glyph_no_arena = (lcd_glyph_spans == NULL);
+    }
+    length = lcd_glyph_encode(NULL, pData, xSize, ySize, BytesPerLine, Diff);
+    if ((lcd_glyph_spans == NULL) || (length > LCD_GLYPH_MAX_BYTES))
+    {
+        lcd_glyph_stats.uncached++;
+        return NULL;
+    }
+
+    while ((lcd_glyph_stats.entries == LCD_GLYPH_SLOTS) ||
+           (lcd_glyph_stats.bytes_used + length > LCD_GLYPH_CACHE_BYTES))
+    {
+        for (i = 1u, lru = 0u; i < lcd_glyph_stats.entries; i++)
+        {
+            if (lcd_glyph_slots[i].used < lcd_glyph_slots[lru].used)
+            {
+                lru = i;
+            }
+        }
+        lcd_glyph_evict(lru);
+    }
+
+    s = &lcd_glyph_slots[lcd_glyph_stats.entries++];
+    s->pData = pData;
+    s->xSize = (uint16_t)xSize;
+    s->ySize = (uint16_t)ySize;
+    s->BytesPerLine = (uint16_t)BytesPerLine;
+    s->Diff = (uint8_t)Diff;
+    s->offset = (uint16_t)lcd_glyph_stats.bytes_used;
+    s->length = (uint16_t)length;
+    s->used = lcd_glyph_clock;
+    lcd_glyph_stats.bytes_used += length;
+
+    lcd_glyph_encode(&lcd_glyph_spans[s->offset], pData, xSize, ySize, BytesPerLine, Diff);
+    return &lcd_glyph_spans[s->offset];
+}
+
+
+/*******************************************************************************
+ * Switches the cache.
+ *******************************************************************************/
+void lcd_glyph_set_enabled(bool enable)
+{
+    lcd_glyph_enabled = enable;
+}
+
+
+/*******************************************************************************
+ * Copies the counters.
+ *******************************************************************************/
+void lcd_glyph_get_stats(lcd_glyph_stats_t *stats)
+{
+    *stats = lcd_glyph_stats;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,81 @@
+/*
+ * lcd_glyph.h
+ *
+ *  Glyph cache. emWin hands every character to the bitmap hook as a 1bpp
+ *  image straight out of the font; the cache keeps hot glyphs as run spans
+ *  (alternating background and foreground run lengths per row) so the hook
+ *  expands them with plain stores instead of testing each bit. Spans carry
+ *  no colour, one entry serves a glyph in every colour. The RAM comes from
+ *  the application arena, entries are evicted least recently used first.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "GUI.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Span bytes kept, taken from the application arena at the first miss */
+#ifndef LCD_GLYPH_CACHE_BYTES
+#define LCD_GLYPH_CACHE_BYTES       (4096)
+#endif
+
+/* Glyphs kept at most */
+#ifndef LCD_GLYPH_SLOTS
+#define LCD_GLYPH_SLOTS             (64)
+#endif
+
+/* Largest entry, glyphs with more span bytes are drawn from the font */
+#define LCD_GLYPH_MAX_BYTES         (LCD_GLYPH_CACHE_BYTES / 4)
+
+/** Cache counters */
+typedef struct
+{
+    uint32_t hits;          /**< Glyphs drawn from the cache */
+    uint32_t misses;        /**< Glyphs encoded */
+    uint32_t evictions;     /**< Entries dropped to make room */
+    uint32_t uncached;      /**< Glyphs too large for an entry, or no arena */
+    uint32_t entries;       /**< Entries held now */
+    uint32_t bytes_used;    /**< Span bytes held now */
+} lcd_glyph_stats_t;
+
+
+/**
+ * Returns the spans of a 1bpp glyph, encoding it on a miss. The glyph is
+ * identified by its rows in the font, so a clipped glyph is a separate
+ * entry. The spans stay valid until the next lookup.
+ * @param[in] pData        First row as passed to the device bitmap function
+ * @param[in] xSize        Pixels per row
+ * @param[in] ySize        Rows
+ * @param[in] BytesPerLine Row pitch
+ * @param[in] Diff         Bit offset of the first pixel in pData
+ * @return Per row, run lengths starting with the background (0 when the row
+ *         starts with foreground), or NULL to draw from the font
+ */
+const uint8_t *lcd_glyph_lookup(const U8 *pData, int xSize, int ySize, int BytesPerLine, int Diff);
+
+/**
+ * Switches the cache, for the benchmark. Off, every lookup returns NULL.
+ * @param[in] enable false to draw every glyph from the font
+ */
+void lcd_glyph_set_enabled(bool enable);
+
+/**
+ * Copies the counters.
+ * @param[out] stats Where to store the counters
+ */
+void lcd_glyph_get_stats(lcd_glyph_stats_t *stats);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,111 @@
+/*
+ * lcd_pool.c
+ *
+ *  emWin pool profiler, see lcd_pool.h.
+ */
+
+#include "lcd_pool.h"
+#include "lcd_band.h"
+#include "GUI.h"
+#include "GUIPool.h"
+
+#include <stdio.h>
+#include <string.h>
+
+
+static lcd_pool_stats_t lcd_pool_stats;
+
+
+/*******************************************************************************
+ * Samples the pool.
+ *******************************************************************************/
+void lcd_pool_sample(uint32_t band_bytes)
+{
+    uint32_t used = (uint32_t)GUI_ALLOC_GetNumUsedBytes();
+    uint32_t avail = (uint32_t)GUI_ALLOC_GetNumFreeBytes();
+    uint32_t largest = (uint32_t)GUI_ALLOC_GetMaxSize();
+    uint32_t frag = 0u;
+
+    if ((avail > 0u) && (largest < avail))
+    {
+        frag = (100u * (avail - largest)) / avail;
+    }
+
+    if ((lcd_pool_stats.samples == 0u) || (largest < lcd_pool_stats.min_largest))
+    {
+        lcd_pool_stats.min_largest = largest;
+    }
+    if (used > lcd_pool_stats.peak_used)
+    {
+        lcd_pool_stats.peak_used = used;
+    }
+    if ((used > band_bytes) && (used - band_bytes > lcd_pool_stats.peak_overhead))
+    {
+        lcd_pool_stats.peak_overhead = used - band_bytes;
+    }
+    if ((used > band_bytes) && (used - band_bytes > GUI_POOL_OVERHEAD_LIMIT))
+    {
+        lcd_pool_stats.over_limit++;
+    }
+    if (frag > lcd_pool_stats.worst_frag)
+    {
+        lcd_pool_stats.worst_frag = frag;
+    }
+    lcd_pool_stats.samples++;
+}
+
+
+/*******************************************************************************
+ * Copies the counters.
+ *******************************************************************************/
+void lcd_pool_get_stats(lcd_pool_stats_t *stats)
+{
+    *stats = lcd_pool_stats;
+    stats->size = GUI_POOL_BYTES;
+    stats->emwin_peak = (uint32_t)GUI_ALLOC_GetMaxUsedBytes();
+}
+
+
+/*******************************************************************************
+ * Clears the counters.
+ *******************************************************************************/
+void lcd_pool_reset(void)
+{
+    memset(&lcd_pool_stats, 0, sizeof(lcd_pool_stats));
+}
+
+
+/*******************************************************************************
+ * Prints the counters, the overhead the measured peak calls for (plus the
+ * margin and the reserve the band keeps free, rounded up to 256 bytes like
+ * configs/GUIPool.h does) and the profile to put in configs/GUIPoolProfile.h.
+ *******************************************************************************/
+void lcd_pool_report(void)
+{
+    lcd_pool_stats_t stats;
+    uint32_t overhead;
+
+    lcd_pool_get_stats(&stats);
+    overhead = stats.peak_overhead + (stats.peak_overhead * GUI_POOL_MARGIN_PCT) / 100u + LCD_BAND_POOL_RESERVE;
+    overhead = (overhead + 255u) & ~255u;
+
+    printf("Pool: %lu bytes, peak %lu (emWin %lu), beside the band %lu, largest free block %lu, fragmentation %lu%%, %lu samples\r\n",
+           (unsigned long)stats.size, (unsigned long)stats.peak_used, (unsigned long)stats.emwin_peak,
+           (unsigned long)stats.peak_overhead, (unsigned long)stats.min_largest,
+           (unsigned long)stats.worst_frag, (unsigned long)stats.samples);
+    printf("Pool: GUI_POOL_OVERHEAD_BYTES %lu in use, %lu measured\r\n",
+           (unsigned long)GUI_POOL_OVERHEAD_BYTES, (unsigned long)overhead);
+    if ((stats.over_limit != 0u) || (GUI_POOL_PROFILE_SAMPLES == 0) ||
+        (GUI_POOL_PROFILE_BAND_LINES != LCD_BAND_LINES))
+    {
+        printf("Pool: %lu samples above the profiled %lu bytes plus margin, profile of %lu samples at %lu lines, regenerate it\r\n",
+               (unsigned long)stats.over_limit, (unsigned long)GUI_POOL_PROFILE_PEAK_BYTES,
+               (unsigned long)GUI_POOL_PROFILE_SAMPLES, (unsigned long)GUI_POOL_PROFILE_BAND_LINES);
+    }
+    printf("Pool: profile for configs/GUIPoolProfile.h\r\n");
+    printf("#define GUI_POOL_PROFILE_PEAK_BYTES     (%lu)\r\n", (unsigned long)stats.peak_overhead);
+    printf("#define GUI_POOL_PROFILE_BAND_LINES     (%lu)\r\n", (unsigned long)LCD_BAND_LINES);
+    printf("#define GUI_POOL_PROFILE_SAMPLES        (%lu)\r\n", (unsigned long)stats.samples);
+}
+
+/* [] END OF FILE */
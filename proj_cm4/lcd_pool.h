@@ -0,0 +1,60 @@
+/*
+ * lcd_pool.h
+ *
+ *  emWin pool profiler. Samples the GUI_ALLOC pool inside every band and
+ *  after every screen and keeps the peak use, the peak beside the band
+ *  device and the worst fragmentation; lcd_pool_report() prints them with
+ *  the profile to put in configs/GUIPoolProfile.h and says when the pool
+ *  went past the profile it was built with, see configs/GUIPool.h.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/** Pool counters since the last reset, in bytes */
+typedef struct
+{
+    uint32_t size;          /**< GUI_POOL_BYTES */
+    uint32_t samples;       /**< Samples taken */
+    uint32_t peak_used;     /**< Highest use seen by a sample */
+    uint32_t emwin_peak;    /**< Highest use seen by emWin, since boot */
+    uint32_t peak_overhead; /**< Highest use beside the band device */
+    uint32_t min_largest;   /**< Smallest largest free block */
+    uint32_t worst_frag;    /**< Highest share of the free bytes outside the largest block, percent */
+    uint32_t over_limit;    /**< Samples beside the band above the profiled peak plus margin */
+} lcd_pool_stats_t;
+
+
+/**
+ * Samples the pool.
+ * @param[in] band_bytes Bytes of the band device allocated now, 0 outside a band
+ */
+void lcd_pool_sample(uint32_t band_bytes);
+
+/**
+ * Copies the counters.
+ * @param[out] stats Where to store the counters
+ */
+void lcd_pool_get_stats(lcd_pool_stats_t *stats);
+
+/** Clears the counters. */
+void lcd_pool_reset(void);
+
+/** Prints the counters and the profile to put in configs/GUIPoolProfile.h. */
+void lcd_pool_report(void);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
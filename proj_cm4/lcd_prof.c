@@ -0,0 +1,134 @@
+/*
+ * lcd_prof.c
+ *
+ *  Profiling zones, see lcd_prof.h.
+ */
+
+#include "lcd_prof.h"
+
+#include <stdio.h>
+#include <string.h>
+
+
+static lcd_prof_stats_t lcd_prof_zones[LCD_PROF_COUNT] =
+{
+    [LCD_PROF_DISPATCH] = { "dispatch" },
+    [LCD_PROF_BAND]     = { "band_draw" },
+    [LCD_PROF_DLIST]    = { "dlist_end" },
+    [LCD_PROF_SLIDE]    = { "scroll_slide" },
+    [LCD_PROF_BITMAP]   = { "draw_bitmap" },
+    [LCD_PROF_PALETTE]  = { "palette" },
+    [LCD_PROF_PORT]     = { "port" },
+    [LCD_PROF_DMA_WAIT] = { "dma_wait" },
+    [LCD_PROF_WAKE]     = { "wake" },
+    [LCD_PROF_RESPONSE] = { "response" },
+    [LCD_PROF_SPRITE]   = { "sprite_frame" },
+};
+
+
+/*******************************************************************************
+ * Returns the clock rate of the ticks.
+ *******************************************************************************/
+uint32_t lcd_prof_ticks_per_us(void)
+{
+#if (LCD_PROF_HOST)
+    return 1000u;
+#else
+    return SystemCoreClock / 1000000u;
+#endif
+}
+
+
+/*******************************************************************************
+ * Adds one sample to a zone.
+ *******************************************************************************/
+void lcd_prof_record(lcd_prof_zone_t zone, uint32_t ticks)
+{
+    lcd_prof_stats_t *z = &lcd_prof_zones[zone];
+    uint32_t edge = LCD_PROF_BUCKET0_US * lcd_prof_ticks_per_us();
+    int b;
+
+    if ((z->count == 0u) || (ticks < z->min))
+    {
+        z->min = ticks;
+    }
+    if (ticks > z->max)
+    {
+        z->max = ticks;
+    }
+    z->count++;
+    z->total += ticks;
+
+    for (b = 0; (b < LCD_PROF_BUCKETS - 1) && (ticks >= edge); b++)
+    {
+        edge *= 4u;
+    }
+    z->hist[b]++;
+}
+
+
+/*******************************************************************************
+ * Copies the counters of one zone.
+ *******************************************************************************/
+void lcd_prof_get_stats(lcd_prof_zone_t zone, lcd_prof_stats_t *stats)
+{
+    *stats = lcd_prof_zones[zone];
+}
+
+
+/*******************************************************************************
+ * Clears all zones, keeping their names.
+ *******************************************************************************/
+void lcd_prof_reset(void)
+{
+    const char *name;
+    int i;
+
+    for (i = 0; i < LCD_PROF_COUNT; i++)
+    {
+        name = lcd_prof_zones[i].name;
+        memset(&lcd_prof_zones[i], 0, sizeof(lcd_prof_stats_t));
+        lcd_prof_zones[i].name = name;
+    }
+}
+
+
+/*******************************************************************************
+ * Prints every zone that has samples.
+ *******************************************************************************/
+void lcd_prof_dump(void)
+{
+    const lcd_prof_stats_t *z;
+    uint32_t tpu = lcd_prof_ticks_per_us();
+    uint32_t edge;
+    int i, b;
+
+    printf("Zone            count   min us   avg us   max us   total ms\r\n");
+    for (i = 0; i < LCD_PROF_COUNT; i++)
+    {
+        z = &lcd_prof_zones[i];
+        if (z->count == 0u)
+        {
+            continue;
+        }
+        printf("%-13s %7lu %8lu %8lu %8lu %10lu\r\n", z->name, (unsigned long)z->count,
+               (unsigned long)(z->min / tpu), (unsigned long)((z->total / z->count) / tpu),
+               (unsigned long)(z->max / tpu), (unsigned long)(z->total / tpu / 1000u));
+
+        printf("             ");
+        for (b = 0, edge = LCD_PROF_BUCKET0_US; b < LCD_PROF_BUCKETS; b++, edge *= 4u)
+        {
+            if (b < LCD_PROF_BUCKETS - 1)
+            {
+                printf(" <%lu:%lu", (unsigned long)edge, (unsigned long)z->hist[b]);
+            }
+            else
+            {
+                printf(" more:%lu", (unsigned long)z->hist[b]);
+            }
+        }
+        printf("\r\n");
+    }
+}
+
+/* [] END OF FILE */
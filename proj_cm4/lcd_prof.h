@@ -0,0 +1,136 @@
+/*
+ * lcd_prof.h
+ *
+ *  Profiling zones. A zone times a block of code and keeps the count,
+ *  min/avg/max and a histogram of its durations; lcd_prof_dump() prints them
+ *  over retarget-io. On the target the clock is the DWT cycle counter, in a
+ *  host build it is clock_gettime(), so the same report comes out of both.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Set to 0 from the Makefile (LCD_PROF=0) to compile the zones out */
+#ifndef LCD_PROF_ENABLE
+#define LCD_PROF_ENABLE             1
+#endif
+
+/* Anything that is not the Cortex-M4 is a host build */
+#ifndef LCD_PROF_HOST
+#if defined(__arm__)
+#define LCD_PROF_HOST               0
+#else
+#define LCD_PROF_HOST               1
+#endif
+#endif
+
+/* Histogram buckets, each four times wider than the one before */
+#define LCD_PROF_BUCKETS            (8)
+
+/* Upper edge of the first bucket in microseconds */
+#define LCD_PROF_BUCKET0_US         (4u)
+
+/** Timed zones */
+typedef enum
+{
+    LCD_PROF_DISPATCH,      /**< Main loop, one screen change */
+    LCD_PROF_BAND,          /**< lcd_band_draw(), emWin into memory devices */
+    LCD_PROF_DLIST,         /**< lcd_dlist_end() */
+    LCD_PROF_SLIDE,         /**< lcd_scroll_slide() */
+    LCD_PROF_BITMAP,        /**< emWin bitmap and glyph rows, rasterized and sent */
+    LCD_PROF_PALETTE,       /**< Palette conversion on a cache miss */
+    LCD_PROF_PORT,          /**< GUIDRV_FlexColor port callbacks, SPI */
+    LCD_PROF_DMA_WAIT,      /**< Waiting for a DMA transfer to leave */
+    LCD_PROF_WAKE,          /**< IPC message to the main loop or render task picking it up */
+    LCD_PROF_RESPONSE,      /**< IPC message to the new screen on the panel */
+    LCD_PROF_SPRITE,        /**< One sprite frame, until its pixels left */
+    LCD_PROF_COUNT
+} lcd_prof_zone_t;
+
+/** Durations of one zone, in clock ticks */
+typedef struct
+{
+    const char *name;                   /**< Zone name for the report */
+    uint32_t count;                     /**< Samples since the last reset */
+    uint32_t min;                       /**< Shortest sample */
+    uint32_t max;                       /**< Longest sample */
+    uint64_t total;                     /**< Sum of the samples */
+    uint32_t hist[LCD_PROF_BUCKETS];    /**< Samples per bucket */
+} lcd_prof_stats_t;
+
+
+#if (LCD_PROF_HOST)
+#include <time.h>
+
+/** Current time in ticks, nanoseconds on the host */
+static inline uint32_t lcd_prof_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+#else
+#include "cy_pdl.h"
+
+/** Current time in ticks, CPU cycles on the target */
+static inline uint32_t lcd_prof_now(void)
+{
+    return DWT->CYCCNT;
+}
+#endif
+
+/* Code that already times itself hands its duration to LCD_PROF_RECORD() */
+#if (LCD_PROF_ENABLE)
+#define LCD_PROF_BEGIN(zone)        uint32_t lcd_prof_start_##zone = lcd_prof_now()
+#define LCD_PROF_END(zone)          lcd_prof_record((zone), lcd_prof_now() - lcd_prof_start_##zone)
+#define LCD_PROF_RECORD(zone, t)    lcd_prof_record((zone), (t))
+#else
+#define LCD_PROF_BEGIN(zone)        do { } while (0)
+#define LCD_PROF_END(zone)          do { } while (0)
+#define LCD_PROF_RECORD(zone, t)    do { } while (0)
+#endif
+
+
+/**
+ * Adds one sample to a zone. Normally called through LCD_PROF_END() or
+ * LCD_PROF_RECORD().
+ * @param[in] zone  Zone
+ * @param[in] ticks Duration
+ */
+void lcd_prof_record(lcd_prof_zone_t zone, uint32_t ticks);
+
+/**
+ * Returns the clock rate of the ticks.
+ * @return Ticks per microsecond
+ */
+uint32_t lcd_prof_ticks_per_us(void);
+
+/**
+ * Copies the counters of one zone.
+ * @param[in]  zone  Zone
+ * @param[out] stats Where to store the counters
+ */
+void lcd_prof_get_stats(lcd_prof_zone_t zone, lcd_prof_stats_t *stats);
+
+/** Clears all zones. */
+void lcd_prof_reset(void);
+
+/** Prints every zone that has samples, times in microseconds. */
+void lcd_prof_dump(void);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,166 @@
+/*
+ * lcd_region.c
+ *
+ *  Incremental redraw, see lcd_region.h.
+ */
+
+#include "cy_pdl.h"
+#include "lcd_band.h"
+#include "lcd_region.h"
+#include "GUI.h"
+
+#include <string.h>
+
+
+/* What is on the panel, screen -1 when unknown */
+static int lcd_region_screen = -1;
+static lcd_region_t lcd_region_shown[LCD_REGION_MAX];
+static int lcd_region_count;
+
+static lcd_region_stats_t lcd_region_stats;
+
+
+static uint32_t lcd_region_area(const GUI_RECT *r)
+{
+    return (uint32_t)(r->x1 - r->x0 + 1) * (uint32_t)(r->y1 - r->y0 + 1);
+}
+
+
+static bool lcd_region_same(const lcd_region_t *a, const lcd_region_t *b)
+{
+    return (a->key == b->key) && (a->rect.x0 == b->rect.x0) && (a->rect.y0 == b->rect.y0) &&
+           (a->rect.x1 == b->rect.x1) && (a->rect.y1 == b->rect.y1);
+}
+
+
+/*******************************************************************************
+ * Checks whether a region is in a list unchanged.
+ *******************************************************************************/
+static bool lcd_region_find(const lcd_region_t *r, const lcd_region_t *list, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (lcd_region_same(r, &list[i]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/*******************************************************************************
+ * Adds a rectangle to the dirty list, merging it with every rectangle it
+ * overlaps into their bounding box until no two overlap.
+ *******************************************************************************/
+static int lcd_region_add_dirty(GUI_RECT *dirty, int count, GUI_RECT r)
+{
+    int i;
+
+    for (i = 0; i < count; i++)
+    {
+        if ((r.x0 <= dirty[i].x1) && (dirty[i].x0 <= r.x1) &&
+            (r.y0 <= dirty[i].y1) && (dirty[i].y0 <= r.y1))
+        {
+            if (dirty[i].x0 < r.x0) r.x0 = dirty[i].x0;
+            if (dirty[i].y0 < r.y0) r.y0 = dirty[i].y0;
+            if (dirty[i].x1 > r.x1) r.x1 = dirty[i].x1;
+            if (dirty[i].y1 > r.y1) r.y1 = dirty[i].y1;
+            dirty[i] = dirty[--count];
+            i = -1;
+        }
+    }
+    dirty[count] = r;
+    return count + 1;
+}
+
+
+/*******************************************************************************
+ * Repaints one rectangle through a memory device, straight to the panel if
+ * the pool has no room for it.
+ *******************************************************************************/
+static void lcd_region_repaint(GUI_RECT *rect, void (*draw)(void *data), void *data)
+{
+    if (GUI_MEMDEV_Draw(rect, draw, data, 0, GUI_MEMDEV_NOTRANS) != 0)
+    {
+        GUI_SetClipRect(rect);
+        draw(data);
+        GUI_SetClipRect(NULL);
+    }
+}
+
+
+/*******************************************************************************
+ * Shows a screen, repainting only the regions that changed when the same
+ * screen is on the panel.
+ *******************************************************************************/
+void lcd_region_show(int screen, const lcd_region_t *regions, int count,
+                     void (*draw)(void *data), void *data)
+{
+    GUI_RECT dirty[2 * LCD_REGION_MAX];
+    int ndirty = 0;
+    int i;
+
+    count = (count < LCD_REGION_MAX) ? count : LCD_REGION_MAX;
+
+    if (screen != lcd_region_screen)
+    {
+        lcd_band_draw(draw, data);
+        lcd_region_stats.full++;
+        lcd_region_stats.rects = 1u;
+        lcd_region_stats.pixels = (uint32_t)LCD_GetXSize() * (uint32_t)LCD_GetYSize();
+    }
+    else
+    {
+        /* Old regions are erased where they were, new ones painted */
+        for (i = 0; i < lcd_region_count; i++)
+        {
+            if (!lcd_region_find(&lcd_region_shown[i], regions, count))
+            {
+                ndirty = lcd_region_add_dirty(dirty, ndirty, lcd_region_shown[i].rect);
+            }
+        }
+        for (i = 0; i < count; i++)
+        {
+            if (!lcd_region_find(&regions[i], lcd_region_shown, lcd_region_count))
+            {
+                ndirty = lcd_region_add_dirty(dirty, ndirty, regions[i].rect);
+            }
+        }
+
+        lcd_region_stats.partial++;
+        lcd_region_stats.rects = (uint32_t)ndirty;
+        lcd_region_stats.pixels = 0u;
+        for (i = 0; i < ndirty; i++)
+        {
+            lcd_region_repaint(&dirty[i], draw, data);
+            lcd_region_stats.pixels += lcd_region_area(&dirty[i]);
+        }
+    }
+
+    lcd_region_screen = screen;
+    lcd_region_count = count;
+    memcpy(lcd_region_shown, regions, (size_t)count * sizeof(lcd_region_t));
+}
+
+
+/*******************************************************************************
+ * Forgets what is on the panel.
+ *******************************************************************************/
+void lcd_region_invalidate(void)
+{
+    lcd_region_screen = -1;
+}
+
+
+/*******************************************************************************
+ * Copies the redraw counters.
+ *******************************************************************************/
+void lcd_region_get_stats(lcd_region_stats_t *stats)
+{
+    *stats = lcd_region_stats;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,74 @@
+/*
+ * lcd_region.h
+ *
+ *  Incremental redraw for screens built from regions. A screen declares the
+ *  rectangles it paints and a key per rectangle that changes whenever the
+ *  pixels inside would; when the same screen is shown again, only the
+ *  rectangles of regions that appeared, vanished or changed their key are
+ *  repainted, everything else stays on the panel.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "GUI.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Regions per screen */
+#define LCD_REGION_MAX              (8)
+
+/** One region of a screen */
+typedef struct
+{
+    GUI_RECT rect;          /**< Everything the region paints lies inside */
+    uint32_t key;           /**< Same key, same pixels */
+} lcd_region_t;
+
+/** Redraw counters */
+typedef struct
+{
+    uint32_t full;          /**< Screens drawn whole */
+    uint32_t partial;       /**< Screens updated by their changed regions */
+    uint32_t rects;         /**< Rectangles repainted by the last update */
+    uint32_t pixels;        /**< Pixels repainted by the last screen */
+} lcd_region_stats_t;
+
+
+/**
+ * Shows a screen. The draw function has the contract of lcd_band_draw():
+ * it paints the whole screen, background included, and is called with the
+ * clip rectangle set to the part that is repainted.
+ * @param[in] screen  Screen kind; a different kind than last time draws whole
+ * @param[in] regions Regions of the screen, at most LCD_REGION_MAX
+ * @param[in] count   Number of regions
+ * @param[in] draw    Function that draws the whole screen
+ * @param[in] data    Passed to the draw function
+ */
+void lcd_region_show(int screen, const lcd_region_t *regions, int count,
+                     void (*draw)(void *data), void *data);
+
+/**
+ * Forgets what is on the panel, the next lcd_region_show() draws whole. To be
+ * called whenever something else draws over the screen.
+ */
+void lcd_region_invalidate(void);
+
+/**
+ * Copies the redraw counters.
+ * @param[out] stats Where to store the counters
+ */
+void lcd_region_get_stats(lcd_region_stats_t *stats);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
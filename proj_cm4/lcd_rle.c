@@ -0,0 +1,172 @@
+/*
+ * lcd_rle.c
+ *
+ *  Run-length coded 8bpp palette bitmaps, see lcd_rle.h and tools/bmp_rle.py.
+ */
+
+#include "cy_pdl.h"
+#include "lcd_rle.h"
+#include "lcd_bitmap.h"
+#include "GUI_Private.h"
+
+#include <string.h>
+
+
+static uint8_t lcd_rle_band[LCD_RLE_BAND_BYTES];
+
+
+/*******************************************************************************
+ * Starts decoding a stream.
+ *******************************************************************************/
+void lcd_rle_init(lcd_rle_decoder_t *dec, const uint8_t *stream)
+{
+    dec->p = stream;
+    dec->left = 0u;
+    dec->value = 0u;
+    dec->literal = false;
+}
+
+
+/*******************************************************************************
+ * Reads the control byte of the next run or literal.
+ *******************************************************************************/
+static void lcd_rle_block(lcd_rle_decoder_t *dec)
+{
+    uint8_t c = *dec->p++;
+
+    if (c < 0x80u)
+    {
+        dec->literal = true;
+        dec->left = (uint32_t)c + 1u;
+    }
+    else
+    {
+        dec->literal = false;
+        dec->left = (uint32_t)c - 0x80u + 2u;
+        dec->value = *dec->p++;
+    }
+}
+
+
+/*******************************************************************************
+ * Decodes the next num indices. Runs are written with memset(), literals with
+ * memcpy() straight from flash.
+ *******************************************************************************/
+void lcd_rle_decode(lcd_rle_decoder_t *dec, uint8_t *dst, uint32_t num)
+{
+    uint32_t n;
+
+    while (num > 0u)
+    {
+        if (dec->left == 0u)
+        {
+            lcd_rle_block(dec);
+        }
+
+        n = (dec->left < num) ? dec->left : num;
+        if (dec->literal)
+        {
+            memcpy(dst, dec->p, n);
+            dec->p += n;
+        }
+        else
+        {
+            memset(dst, dec->value, n);
+        }
+        dst += n;
+        num -= n;
+        dec->left -= n;
+    }
+}
+
+
+/*******************************************************************************
+ * Skips the next num indices: whole runs and literals are stepped over by
+ * their control byte.
+ *******************************************************************************/
+void lcd_rle_skip(lcd_rle_decoder_t *dec, uint32_t num)
+{
+    uint32_t n;
+
+    while (num > 0u)
+    {
+        if (dec->left == 0u)
+        {
+            lcd_rle_block(dec);
+        }
+
+        n = (dec->left < num) ? dec->left : num;
+        if (dec->literal)
+        {
+            dec->p += n;
+        }
+        num -= n;
+        dec->left -= n;
+    }
+}
+
+
+/*******************************************************************************
+ * GUI_BITMAP_METHODS draw function. Only the rows inside the clip rectangle
+ * of the current context are decoded, a band drawing one slice of a screen
+ * does not expand the image above or below it. Decodes as many rows as fit
+ * in the band and draws them with the cached palette table, LCD_DrawBitmap()
+ * clips the columns and routes to the selected device.
+ *******************************************************************************/
+static void lcd_rle_draw_8bpp(int x0, int y0, int xsize, int ysize, const U8 *pPixel,
+                              const LCD_LOGPALETTE *pLogPal, int xMag, int yMag)
+{
+    const LCD_PIXELINDEX *pTrans = lcd_bitmap_get_trans(pLogPal);
+    lcd_rle_decoder_t dec;
+    GUI_DRAWMODE mode = 0;
+    int rows, band;
+    int y, first, last;
+
+    band = (int)(LCD_RLE_BAND_BYTES / (uint32_t)xsize);
+    if ((band == 0) || (yMag <= 0))
+    {
+        return;
+    }
+
+    /* Rows first..last-1 land inside the clip rectangle */
+    first = 0;
+    last = ysize;
+    if (GUI_pContext->ClipRect.y0 > y0)
+    {
+        first = (GUI_pContext->ClipRect.y0 - y0) / yMag;
+    }
+    if (GUI_pContext->ClipRect.y1 < (y0 + ysize * yMag - 1))
+    {
+        last = (GUI_pContext->ClipRect.y1 - y0) / yMag + 1;
+    }
+    if (first >= last)
+    {
+        return;
+    }
+
+    if (pLogPal->HasTrans)
+    {
+        mode = GUI_SetDrawMode(GUI_GetDrawMode() | GUI_DRAWMODE_TRANS);
+    }
+
+    lcd_rle_init(&dec, pPixel);
+    lcd_rle_skip(&dec, (uint32_t)(first * xsize));
+    for (y = first; y < last; y += rows)
+    {
+        rows = ((last - y) < band) ? (last - y) : band;
+        lcd_rle_decode(&dec, lcd_rle_band, (uint32_t)(rows * xsize));
+        LCD_DrawBitmap(x0, y0 + y * yMag, xsize, rows, xMag, yMag, 8, xsize, lcd_rle_band, pTrans);
+    }
+
+    if (pLogPal->HasTrans)
+    {
+        GUI_SetDrawMode(mode);
+    }
+}
+
+const GUI_BITMAP_METHODS LCD_RLE_METHODS_8BPP =
+{
+    .pfDraw = lcd_rle_draw_8bpp,
+};
+
+/* [] END OF FILE */
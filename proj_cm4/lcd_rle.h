@@ -0,0 +1,70 @@
+/*
+ * lcd_rle.h
+ *
+ *  Run-length coded 8bpp palette bitmaps. The images are produced by
+ *  tools/bmp_rle.py and drawn with GUI_DrawBitmap() like any other bitmap;
+ *  their pMethods points at LCD_RLE_METHODS_8BPP, which decodes a few rows at
+ *  a time into a small band buffer and hands each band to LCD_DrawBitmap().
+ *  Rows above the clip rectangle are skipped without being stored and
+ *  decoding stops at its bottom edge.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "GUI.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Size of the decode band, a whole number of bitmap rows is decoded into it */
+#ifndef LCD_RLE_BAND_BYTES
+#define LCD_RLE_BAND_BYTES          (2048u)
+#endif
+
+/** Decoder state, runs carry over from one call to the next */
+typedef struct
+{
+    const uint8_t *p;       /**< Next control or payload byte */
+    uint32_t left;          /**< Bytes left in the current run or literal */
+    uint8_t value;          /**< Value of the current run */
+    bool literal;           /**< Current block is a literal */
+} lcd_rle_decoder_t;
+
+/** Bitmap methods for run-length coded 8bpp images */
+extern const GUI_BITMAP_METHODS LCD_RLE_METHODS_8BPP;
+
+
+/**
+ * Starts decoding a stream.
+ * @param[out] dec    Decoder state
+ * @param[in]  stream Run-length coded indices
+ */
+void lcd_rle_init(lcd_rle_decoder_t *dec, const uint8_t *stream);
+
+/**
+ * Decodes the next bytes of a stream.
+ * @param[in,out] dec Decoder state
+ * @param[out]    dst Where to store the indices
+ * @param[in]     num Number of indices to produce
+ */
+void lcd_rle_decode(lcd_rle_decoder_t *dec, uint8_t *dst, uint32_t num);
+
+/**
+ * Moves past the next bytes of a stream without storing them.
+ * @param[in,out] dec Decoder state
+ * @param[in]     num Number of indices to skip
+ */
+void lcd_rle_skip(lcd_rle_decoder_t *dec, uint32_t num);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
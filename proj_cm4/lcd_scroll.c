@@ -0,0 +1,102 @@
+/*
+ * lcd_scroll.c
+ *
+ *  Slide transitions on the panel's hardware scroll, see lcd_scroll.h.
+ *
+ *  At offset o the glass shows GRAM position (p + o) % 320 at position p of
+ *  the scroll axis. Sliding forward moves o from 0 up to 320: the GRAM lines
+ *  [0, o) that wrapped around to the far edge are the ones in view, so the new
+ *  screen is rendered there, at its own coordinates. Once o is back at 0 GRAM
+ *  holds the new screen and the glass shows it unscrolled.
+ */
+
+#include "cy_pdl.h"
+#include "mtb_hx8347.h"
+#include "lcd_dma.h"
+#include "lcd_scroll.h"
+#include "lcd_prof.h"
+#include "GUI.h"
+
+
+static lcd_scroll_stats_t lcd_scroll_stats;
+
+
+/*******************************************************************************
+ * Renders the part of the new screen between two positions of the scroll
+ * axis, through a memory device when the pool allows it.
+ *******************************************************************************/
+static void lcd_scroll_strip(void (*draw)(void *data), void *data, int p0, int p1)
+{
+    GUI_RECT rect;
+
+    if (mtb_hx8347_get_rotation() & 1)
+    {
+        rect.x0 = p0;
+        rect.x1 = p1;
+        rect.y0 = 0;
+        rect.y1 = LCD_GetYSize() - 1;
+    }
+    else
+    {
+        rect.x0 = 0;
+        rect.x1 = LCD_GetXSize() - 1;
+        rect.y0 = p0;
+        rect.y1 = p1;
+    }
+
+    if (GUI_MEMDEV_Draw(&rect, draw, data, 0, GUI_MEMDEV_NOTRANS) != 0)
+    {
+        GUI_SetClipRect(&rect);
+        draw(data);
+        GUI_SetClipRect(NULL);
+    }
+    lcd_scroll_stats.strips++;
+}
+
+
+/*******************************************************************************
+ * Slides a new screen in, one strip per step. The offset only moves once the
+ * strip it uncovers is on the panel.
+ *******************************************************************************/
+void lcd_scroll_slide(void (*draw)(void *data), void *data, lcd_scroll_dir_t dir)
+{
+    uint32_t start = DWT->CYCCNT;
+    int done, step;
+
+    lcd_scroll_stats.strips = 0u;
+    mtb_hx8347_scroll_enable(true);
+
+    for (done = 0; done < LCD_HEIGHT; done += step)
+    {
+        step = ((LCD_HEIGHT - done) < LCD_SCROLL_STEP) ? (LCD_HEIGHT - done) : LCD_SCROLL_STEP;
+        if (dir == LCD_SCROLL_FORWARD)
+        {
+            lcd_scroll_strip(draw, data, done, done + step - 1);
+            lcd_dma_fence();
+            mtb_hx8347_scroll_to((uint16_t)(done + step));
+        }
+        else
+        {
+            lcd_scroll_strip(draw, data, LCD_HEIGHT - done - step, LCD_HEIGHT - done - 1);
+            lcd_dma_fence();
+            mtb_hx8347_scroll_to((uint16_t)(LCD_HEIGHT - done - step));
+        }
+    }
+
+    mtb_hx8347_scroll_enable(false);
+
+    lcd_scroll_stats.transitions++;
+    lcd_scroll_stats.last_cycles = DWT->CYCCNT - start;
+    LCD_PROF_RECORD(LCD_PROF_SLIDE, lcd_scroll_stats.last_cycles);
+}
+
+
+/*******************************************************************************
+ * Copies the transition counters.
+ *******************************************************************************/
+void lcd_scroll_get_stats(lcd_scroll_stats_t *stats)
+{
+    *stats = lcd_scroll_stats;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,63 @@
+/*
+ * lcd_scroll.h
+ *
+ *  Slide transitions on the panel's hardware scroll. The old screen stays in
+ *  GRAM and moves out by changing the scroll offset, only the strip of the new
+ *  screen that comes into view is rendered at each step.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Pixels the screen moves per step */
+#ifndef LCD_SCROLL_STEP
+#define LCD_SCROLL_STEP             (16)
+#endif
+
+/** Direction the old screen leaves in */
+typedef enum
+{
+    LCD_SCROLL_FORWARD,     /**< New screen comes in from the right (bottom in portrait) */
+    LCD_SCROLL_BACK         /**< New screen comes in from the left (top in portrait) */
+} lcd_scroll_dir_t;
+
+/** Transition counters */
+typedef struct
+{
+    uint32_t transitions;   /**< Slides since the last reset */
+    uint32_t strips;        /**< Strips rendered by the last slide */
+    uint32_t last_cycles;   /**< CPU cycles spent on the last slide */
+} lcd_scroll_stats_t;
+
+
+/**
+ * Slides a new screen in. The draw function has the same contract as for
+ * lcd_band_draw(): it is called once per strip with the clip rectangle set
+ * to that strip and must paint every pixel of it.
+ * @param[in] draw Function that draws the whole screen
+ * @param[in] data Passed to the draw function
+ * @param[in] dir  Direction of the slide
+ */
+void lcd_scroll_slide(void (*draw)(void *data), void *data, lcd_scroll_dir_t dir);
+
+/**
+ * Copies the transition counters.
+ * @param[out] stats Where to store the counters
+ */
+void lcd_scroll_get_stats(lcd_scroll_stats_t *stats);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,533 @@
+/*
+ * lcd_shadow.c
+ *
+ *  Tiled RAM shadow of the HX8347 GRAM, see lcd_shadow.h.
+ */
+
+#include "cy_pdl.h"
+#include "mtb_hx8347.h"
+#include "lcd_shadow.h"
+
+#include <string.h>
+
+#if (LCD_SHADOW_ENABLE)
+
+
+/* Tiles hold GRAM as the panel stores it, LCD_WIDTH columns by LCD_HEIGHT
+ * rows; the scan order only changes how the address counter walks it */
+#define LCD_SHADOW_GRID             (LCD_HEIGHT / LCD_SHADOW_TILE)
+#define LCD_SHADOW_TILE_PIXELS      (LCD_SHADOW_TILE * LCD_SHADOW_TILE)
+#define LCD_SHADOW_SLOTS            (LCD_SHADOW_MAX_BYTES / (LCD_SHADOW_TILE_PIXELS * 2u))
+#define LCD_SHADOW_NO_SLOT          (0xFFFFu)
+
+typedef enum
+{
+    LCD_TILE_UNKNOWN,       /* Never written or dropped, reads miss */
+    LCD_TILE_SOLID,         /* Every pixel holds color */
+    LCD_TILE_PIXELS         /* Pixels live in slot */
+} lcd_tile_state_t;
+
+typedef struct
+{
+    uint16_t color;
+    uint16_t slot;
+    uint8_t state;
+} lcd_shadow_tile_t;
+
+static lcd_shadow_tile_t lcd_tiles[LCD_SHADOW_GRID * LCD_SHADOW_GRID];
+static uint16_t lcd_slots[LCD_SHADOW_SLOTS][LCD_SHADOW_TILE_PIXELS];
+static uint16_t lcd_slot_next[LCD_SHADOW_SLOTS];
+static uint16_t lcd_slot_free = LCD_SHADOW_NO_SLOT;
+static bool lcd_shadow_ready = false;
+
+static lcd_shadow_stats_t lcd_shadow_stats;
+
+/* Controller state mirrored from the byte stream */
+static struct
+{
+    uint8_t reg;            /* Last command byte */
+    uint8_t madctl;         /* Register 0x16 */
+    uint8_t colmod;         /* Register 0x17 */
+    uint16_t sc, ec;        /* Column start/end, 0x02-0x05 */
+    uint16_t sp, ep;        /* Row start/end, 0x06-0x09 */
+    uint16_t x, y;          /* Address counter */
+    uint16_t width, height; /* GRAM size in the current scan order */
+    bool high_seen;         /* First byte of a GRAM pixel received */
+    uint8_t high;
+    uint8_t pack[2];        /* Bytes of an incomplete 12bpp pixel pair */
+    uint8_t pack_len;
+    bool read_dummy;        /* Next GRAM read byte is the dummy */
+    bool read_low;          /* Next GRAM read byte is a low byte */
+} lcd_ctl;
+
+
+/*******************************************************************************
+ * Puts every slot on the free list and marks all tiles unknown.
+ *******************************************************************************/
+void lcd_shadow_invalidate(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < LCD_SHADOW_GRID * LCD_SHADOW_GRID; i++)
+    {
+        lcd_tiles[i].state = LCD_TILE_UNKNOWN;
+        lcd_tiles[i].slot = LCD_SHADOW_NO_SLOT;
+    }
+    for (i = 0; i < LCD_SHADOW_SLOTS; i++)
+    {
+        lcd_slot_next[i] = (i + 1u < LCD_SHADOW_SLOTS) ? (uint16_t)(i + 1u) : LCD_SHADOW_NO_SLOT;
+    }
+    lcd_slot_free = (LCD_SHADOW_SLOTS > 0u) ? 0u : LCD_SHADOW_NO_SLOT;
+    lcd_shadow_stats.slots_used = 0u;
+    lcd_shadow_stats.slots_total = LCD_SHADOW_SLOTS;
+}
+
+
+static void lcd_shadow_setup(void)
+{
+    lcd_ctl.madctl = 0u;
+    lcd_ctl.colmod = LCD_COLMOD_16BPP;
+    lcd_ctl.width = LCD_WIDTH;
+    lcd_ctl.height = LCD_HEIGHT;
+    lcd_ctl.ec = LCD_WIDTH - 1;
+    lcd_ctl.ep = LCD_HEIGHT - 1;
+    lcd_shadow_invalidate();
+    lcd_shadow_ready = true;
+}
+
+
+static void lcd_slot_release(lcd_shadow_tile_t *tile)
+{
+    if (tile->slot != LCD_SHADOW_NO_SLOT)
+    {
+        lcd_slot_next[tile->slot] = lcd_slot_free;
+        lcd_slot_free = tile->slot;
+        tile->slot = LCD_SHADOW_NO_SLOT;
+        lcd_shadow_stats.slots_used--;
+    }
+}
+
+
+/*******************************************************************************
+ * Turns tiles whose slot holds a single colour back into solid tiles.
+ *******************************************************************************/
+static void lcd_shadow_compact(void)
+{
+    uint32_t i, j;
+
+    for (i = 0; i < LCD_SHADOW_GRID * LCD_SHADOW_GRID; i++)
+    {
+        lcd_shadow_tile_t *tile = &lcd_tiles[i];
+        const uint16_t *pixels;
+
+        if (tile->state != LCD_TILE_PIXELS)
+        {
+            continue;
+        }
+        pixels = lcd_slots[tile->slot];
+        for (j = 1; (j < LCD_SHADOW_TILE_PIXELS) && (pixels[j] == pixels[0]); j++)
+        {
+        }
+        if (j == LCD_SHADOW_TILE_PIXELS)
+        {
+            tile->color = pixels[0];
+            tile->state = LCD_TILE_SOLID;
+            lcd_slot_release(tile);
+        }
+    }
+}
+
+
+static bool lcd_slot_alloc(lcd_shadow_tile_t *tile)
+{
+    if (lcd_slot_free == LCD_SHADOW_NO_SLOT)
+    {
+        lcd_shadow_compact();
+    }
+    if (lcd_slot_free == LCD_SHADOW_NO_SLOT)
+    {
+        return false;
+    }
+    tile->slot = lcd_slot_free;
+    lcd_slot_free = lcd_slot_next[tile->slot];
+    lcd_shadow_stats.slots_used++;
+    return true;
+}
+
+
+static inline lcd_shadow_tile_t *lcd_shadow_tile(uint16_t x, uint16_t y)
+{
+    return &lcd_tiles[(y / LCD_SHADOW_TILE) * LCD_SHADOW_GRID + (x / LCD_SHADOW_TILE)];
+}
+
+
+/*******************************************************************************
+ * Maps an address in the current scan order to the GRAM column and row: MX
+ * and MY mirror the column and row addresses, MV then exchanges them.
+ *******************************************************************************/
+static inline void lcd_shadow_gram(uint16_t x, uint16_t y, uint16_t *col, uint16_t *row)
+{
+    if (lcd_ctl.madctl & LCD_MADCTL_MX)
+    {
+        x = lcd_ctl.width - 1u - x;
+    }
+    if (lcd_ctl.madctl & LCD_MADCTL_MY)
+    {
+        y = lcd_ctl.height - 1u - y;
+    }
+    *col = (lcd_ctl.madctl & LCD_MADCTL_MV) ? y : x;
+    *row = (lcd_ctl.madctl & LCD_MADCTL_MV) ? x : y;
+}
+
+
+static void lcd_shadow_set_pixel(uint16_t x, uint16_t y, uint16_t color)
+{
+    lcd_shadow_tile_t *tile = lcd_shadow_tile(x, y);
+    uint32_t i;
+
+    if (tile->state == LCD_TILE_SOLID)
+    {
+        if (tile->color == color)
+        {
+            return;
+        }
+        if (!lcd_slot_alloc(tile))
+        {
+            tile->state = LCD_TILE_UNKNOWN;
+            lcd_shadow_stats.overflows++;
+            return;
+        }
+        for (i = 0; i < LCD_SHADOW_TILE_PIXELS; i++)
+        {
+            lcd_slots[tile->slot][i] = tile->color;
+        }
+        tile->state = LCD_TILE_PIXELS;
+    }
+    if (tile->state == LCD_TILE_PIXELS)
+    {
+        lcd_slots[tile->slot][(y % LCD_SHADOW_TILE) * LCD_SHADOW_TILE + (x % LCD_SHADOW_TILE)] = color;
+    }
+}
+
+
+static uint16_t lcd_shadow_get_pixel(uint16_t x, uint16_t y)
+{
+    const lcd_shadow_tile_t *tile = lcd_shadow_tile(x, y);
+
+    if (tile->state == LCD_TILE_SOLID)
+    {
+        return tile->color;
+    }
+    if (tile->state == LCD_TILE_PIXELS)
+    {
+        return lcd_slots[tile->slot][(y % LCD_SHADOW_TILE) * LCD_SHADOW_TILE + (x % LCD_SHADOW_TILE)];
+    }
+    lcd_shadow_stats.misses++;
+    return 0u;
+}
+
+
+/*******************************************************************************
+ * Advances the address counter within the window, wrapping like the panel.
+ *******************************************************************************/
+static inline void lcd_shadow_advance(void)
+{
+    if (++lcd_ctl.x > lcd_ctl.ec)
+    {
+        lcd_ctl.x = lcd_ctl.sc;
+        if (++lcd_ctl.y > lcd_ctl.ep)
+        {
+            lcd_ctl.y = lcd_ctl.sp;
+        }
+    }
+}
+
+
+static inline void lcd_shadow_put(uint16_t color)
+{
+    uint16_t col, row;
+
+    if ((lcd_ctl.x < lcd_ctl.width) && (lcd_ctl.y < lcd_ctl.height))
+    {
+        lcd_shadow_gram(lcd_ctl.x, lcd_ctl.y, &col, &row);
+        lcd_shadow_set_pixel(col, row, color);
+    }
+    lcd_shadow_stats.pixels_written++;
+    lcd_shadow_advance();
+}
+
+
+/*******************************************************************************
+ * Fills a window of the current scan order, whole tiles become solid and give
+ * their slot back.
+ *******************************************************************************/
+static void lcd_shadow_fill_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+    uint16_t tx, ty, x, y;
+
+    if (x1 >= lcd_ctl.width)
+    {
+        x1 = lcd_ctl.width - 1;
+    }
+    if (y1 >= lcd_ctl.height)
+    {
+        y1 = lcd_ctl.height - 1;
+    }
+    /* A window is a rectangle of GRAM too, with its corners moved */
+    lcd_shadow_gram(x0, y0, &tx, &ty);
+    lcd_shadow_gram(x1, y1, &x, &y);
+    x0 = (tx < x) ? tx : x;
+    x1 = (tx < x) ? x : tx;
+    y0 = (ty < y) ? ty : y;
+    y1 = (ty < y) ? y : ty;
+    for (ty = y0 - (y0 % LCD_SHADOW_TILE); ty <= y1; ty += LCD_SHADOW_TILE)
+    {
+        for (tx = x0 - (x0 % LCD_SHADOW_TILE); tx <= x1; tx += LCD_SHADOW_TILE)
+        {
+            if ((tx >= x0) && (ty >= y0) &&
+                (tx + LCD_SHADOW_TILE - 1 <= x1) && (ty + LCD_SHADOW_TILE - 1 <= y1))
+            {
+                lcd_shadow_tile_t *tile = lcd_shadow_tile(tx, ty);
+
+                lcd_slot_release(tile);
+                tile->color = color;
+                tile->state = LCD_TILE_SOLID;
+                continue;
+            }
+            for (y = (ty > y0) ? ty : y0; (y < ty + LCD_SHADOW_TILE) && (y <= y1); y++)
+            {
+                for (x = (tx > x0) ? tx : x0; (x < tx + LCD_SHADOW_TILE) && (x <= x1); x++)
+                {
+                    lcd_shadow_set_pixel(x, y, color);
+                }
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Tracks the register index and arms the GRAM read dummy byte.
+ *******************************************************************************/
+void lcd_shadow_command(uint8_t command)
+{
+    if (!lcd_shadow_ready)
+    {
+        lcd_shadow_setup();
+    }
+    lcd_ctl.reg = command;
+    lcd_ctl.high_seen = false;
+    lcd_ctl.pack_len = 0u;
+    lcd_ctl.read_dummy = true;
+    lcd_ctl.read_low = false;
+}
+
+
+/*******************************************************************************
+ * Applies one data byte to a controller register.
+ *******************************************************************************/
+static void lcd_shadow_register(uint8_t value)
+{
+    switch (lcd_ctl.reg)
+    {
+        case 0x02: lcd_ctl.sc = (lcd_ctl.sc & 0x00FF) | (value << 8); lcd_ctl.x = lcd_ctl.sc; break;
+        case 0x03: lcd_ctl.sc = (lcd_ctl.sc & 0xFF00) | value;        lcd_ctl.x = lcd_ctl.sc; break;
+        case 0x04: lcd_ctl.ec = (lcd_ctl.ec & 0x00FF) | (value << 8); break;
+        case 0x05: lcd_ctl.ec = (lcd_ctl.ec & 0xFF00) | value;        break;
+        case 0x06: lcd_ctl.sp = (lcd_ctl.sp & 0x00FF) | (value << 8); lcd_ctl.y = lcd_ctl.sp; break;
+        case 0x07: lcd_ctl.sp = (lcd_ctl.sp & 0xFF00) | value;        lcd_ctl.y = lcd_ctl.sp; break;
+        case 0x08: lcd_ctl.ep = (lcd_ctl.ep & 0x00FF) | (value << 8); break;
+        case 0x09: lcd_ctl.ep = (lcd_ctl.ep & 0xFF00) | value;        break;
+        case 0x16:
+            /* GRAM keeps its content, only the address mapping changes */
+            lcd_ctl.madctl = value;
+            lcd_ctl.width = (value & LCD_MADCTL_MV) ? LCD_HEIGHT : LCD_WIDTH;
+            lcd_ctl.height = (value & LCD_MADCTL_MV) ? LCD_WIDTH : LCD_HEIGHT;
+            break;
+        case 0x17:
+            lcd_ctl.colmod = value;
+            break;
+        default:
+            break;
+    }
+}
+
+
+/*******************************************************************************
+ * GRAM bytes in 12bpp mode, two pixels in three bytes. The pixels are stored
+ * as the RGB565 value the panel shows for them.
+ *******************************************************************************/
+static void lcd_shadow_data12(const uint8_t *data, uint32_t num)
+{
+    uint32_t i;
+
+    for (i = 0; i < num; i++)
+    {
+        if (lcd_ctl.pack_len < 2u)
+        {
+            lcd_ctl.pack[lcd_ctl.pack_len++] = data[i];
+            continue;
+        }
+        lcd_shadow_put(lcd_rgb444_to_565((uint16_t)((lcd_ctl.pack[0] << 4) | (lcd_ctl.pack[1] >> 4))));
+        lcd_shadow_put(lcd_rgb444_to_565((uint16_t)(((lcd_ctl.pack[1] & 0x0Fu) << 8) | data[i])));
+        lcd_ctl.pack_len = 0u;
+    }
+}
+
+
+/*******************************************************************************
+ * Records data bytes for the current register.
+ *******************************************************************************/
+void lcd_shadow_data(const uint8_t *data, uint32_t num)
+{
+    uint32_t i;
+
+    if (!lcd_shadow_ready)
+    {
+        lcd_shadow_setup();
+    }
+    if (lcd_ctl.reg != 0x22)
+    {
+        for (i = 0; i < num; i++)
+        {
+            lcd_shadow_register(data[i]);
+        }
+        return;
+    }
+    if (lcd_ctl.colmod == LCD_COLMOD_12BPP)
+    {
+        lcd_shadow_data12(data, num);
+        return;
+    }
+
+    i = 0;
+    if (lcd_ctl.high_seen && (num > 0u))
+    {
+        lcd_shadow_put((uint16_t)((lcd_ctl.high << 8) | data[0]));
+        lcd_ctl.high_seen = false;
+        i = 1;
+    }
+    for (; i + 1u < num; i += 2u)
+    {
+        lcd_shadow_put((uint16_t)((data[i] << 8) | data[i + 1u]));
+    }
+    if (i < num)
+    {
+        lcd_ctl.high = data[i];
+        lcd_ctl.high_seen = true;
+    }
+}
+
+
+/*******************************************************************************
+ * Records a single-colour run, as a rectangle fill when it covers the window.
+ *******************************************************************************/
+void lcd_shadow_fill(uint16_t color, uint32_t pixels)
+{
+    uint8_t wire[2] = { (uint8_t)(color >> 8), (uint8_t)color };
+    uint32_t area;
+
+    if (!lcd_shadow_ready)
+    {
+        lcd_shadow_setup();
+    }
+    area = (uint32_t)(lcd_ctl.ec - lcd_ctl.sc + 1) * (uint32_t)(lcd_ctl.ep - lcd_ctl.sp + 1);
+    if ((lcd_ctl.reg == 0x22) && !lcd_ctl.high_seen && (lcd_ctl.pack_len == 0u) && (pixels == area) &&
+        (lcd_ctl.x == lcd_ctl.sc) && (lcd_ctl.y == lcd_ctl.sp))
+    {
+        /* The counter wraps back to the window start */
+        lcd_shadow_fill_rect(lcd_ctl.sc, lcd_ctl.sp, lcd_ctl.ec, lcd_ctl.ep, color);
+        lcd_shadow_stats.pixels_written += pixels;
+        return;
+    }
+
+    while (pixels-- > 0u)
+    {
+        if (lcd_ctl.colmod == LCD_COLMOD_12BPP)
+        {
+            lcd_shadow_put(color);
+        }
+        else
+        {
+            lcd_shadow_data(wire, 2u);
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Serves GRAM reads from the tiles, high byte first.
+ *******************************************************************************/
+void lcd_shadow_read(uint8_t *data, uint32_t num)
+{
+    static uint16_t pixel;
+    uint16_t col, row;
+    uint32_t i;
+
+    if (!lcd_shadow_ready)
+    {
+        lcd_shadow_setup();
+    }
+    for (i = 0; i < num; i++)
+    {
+        if ((lcd_ctl.reg != 0x22) || lcd_ctl.read_dummy)
+        {
+            lcd_ctl.read_dummy = false;
+            data[i] = 0u;
+            continue;
+        }
+        if (!lcd_ctl.read_low)
+        {
+            pixel = 0u;
+            if ((lcd_ctl.x < lcd_ctl.width) && (lcd_ctl.y < lcd_ctl.height))
+            {
+                lcd_shadow_gram(lcd_ctl.x, lcd_ctl.y, &col, &row);
+                pixel = lcd_shadow_get_pixel(col, row);
+            }
+            data[i] = (uint8_t)(pixel >> 8);
+            lcd_ctl.read_low = true;
+        }
+        else
+        {
+            data[i] = (uint8_t)pixel;
+            lcd_ctl.read_low = false;
+            lcd_shadow_stats.pixels_read++;
+            lcd_shadow_advance();
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Answers a 16-bit GRAM read, one whole pixel per word.
+ *******************************************************************************/
+void lcd_shadow_read16(uint16_t *data, uint32_t num)
+{
+    uint8_t wire[2];
+    uint32_t i;
+
+    if ((num > 0u) && lcd_ctl.read_dummy)
+    {
+        lcd_shadow_read(wire, 1u);
+        *data++ = 0u;
+        num--;
+    }
+    for (i = 0; i < num; i++)
+    {
+        lcd_shadow_read(wire, 2u);
+        data[i] = (uint16_t)((wire[0] << 8) | wire[1]);
+    }
+}
+
+
+/*******************************************************************************
+ * Copies the shadow counters.
+ *******************************************************************************/
+void lcd_shadow_get_stats(lcd_shadow_stats_t *stats)
+{
+    *stats = lcd_shadow_stats;
+}
+
+#endif /* LCD_SHADOW_ENABLE */
+
+/* [] END OF FILE */
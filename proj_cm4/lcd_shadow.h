@@ -0,0 +1,113 @@
+/*
+ * lcd_shadow.h
+ *
+ *  RAM shadow of the HX8347 GRAM. The driver feeds it every command and data
+ *  byte it sends, and GRAM reads are answered from it instead of the panel.
+ *  The frame is kept as GRAM stores it, whatever the scan order the
+ *  rotation selects, in 16x16 tiles: a tile is either one colour or owns a
+ *  512 byte slot from a fixed pool, so the RAM cost follows the screen
+ *  content rather than the 150 KB of a full frame.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Enabled from the Makefile with LCD_SHADOW=1, GRAM reads assert otherwise */
+#ifndef LCD_SHADOW_ENABLE
+#define LCD_SHADOW_ENABLE           0
+#endif
+
+/* RAM cap for the tile slots in bytes, 512 bytes per non-solid tile */
+#ifndef LCD_SHADOW_MAX_BYTES
+#define LCD_SHADOW_MAX_BYTES        (32u * 1024u)
+#endif
+
+#define LCD_SHADOW_TILE             (16)
+
+/** Shadow counters */
+typedef struct
+{
+    uint32_t pixels_written;    /**< Pixels recorded from the write path */
+    uint32_t pixels_read;       /**< Pixels served to the read path */
+    uint32_t misses;            /**< Pixels read from tiles with unknown content */
+    uint32_t overflows;         /**< Tiles dropped because the slot pool was full */
+    uint32_t slots_used;        /**< Slots currently holding a tile */
+    uint32_t slots_total;       /**< Size of the slot pool */
+} lcd_shadow_stats_t;
+
+
+#if (LCD_SHADOW_ENABLE)
+
+/**
+ * Records a command byte (LCD_DC = 0).
+ * @param[in] command Register index sent to the panel
+ */
+void lcd_shadow_command(uint8_t command);
+
+/**
+ * Records data bytes (LCD_DC = 1) for the current register. Window registers
+ * move the address counter, GRAM data (0x22) lands in the tiles.
+ * @param[in] data Bytes sent to the panel
+ * @param[in] num  Number of bytes
+ */
+void lcd_shadow_data(const uint8_t *data, uint32_t num);
+
+/**
+ * Records a run of one colour written to GRAM from the address counter on.
+ * A run that covers the whole window is stored as solid tiles.
+ * @param[in] color  RGB565 colour as sent on the wire
+ * @param[in] pixels Number of pixels
+ */
+void lcd_shadow_fill(uint16_t color, uint32_t pixels);
+
+/**
+ * Serves a GRAM read. The first byte after 0x22 is a dummy, as on the panel.
+ * @param[out] data Where to store the bytes
+ * @param[in]  num  Number of bytes
+ */
+void lcd_shadow_read(uint8_t *data, uint32_t num);
+
+/**
+ * Serves a GRAM read on the 16-bit port. The first word after 0x22 is the
+ * dummy.
+ * @param[out] data Where to store the pixels
+ * @param[in]  num  Number of pixels
+ */
+void lcd_shadow_read16(uint16_t *data, uint32_t num);
+
+/**
+ * Forgets the frame content, e.g. after the panel was written behind the
+ * driver's back.
+ */
+void lcd_shadow_invalidate(void);
+
+/**
+ * Copies the shadow counters.
+ * @param[out] stats Where to store the counters
+ */
+void lcd_shadow_get_stats(lcd_shadow_stats_t *stats);
+
+#else
+
+static inline void lcd_shadow_command(uint8_t command) { (void)command; }
+static inline void lcd_shadow_data(const uint8_t *data, uint32_t num) { (void)data; (void)num; }
+static inline void lcd_shadow_fill(uint16_t color, uint32_t pixels) { (void)color; (void)pixels; }
+static inline void lcd_shadow_invalidate(void) { }
+
+#endif /* LCD_SHADOW_ENABLE */
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
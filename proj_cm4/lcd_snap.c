@@ -0,0 +1,558 @@
+/*
+ * lcd_snap.c
+ *
+ *  Screen snapshots, see lcd_snap.h.
+ *
+ *  A snapshot file is a header followed by the pixels in GRAM order, coded
+ *  with the control bytes of lcd_rle.c over 16-bit values: 0x00-0x7F is a
+ *  literal of 1 to 128 pixels, 0x80-0xFF a run of 2 to 129 copies of the
+ *  pixel that follows. Pixels are stored high byte first, the order they go
+ *  on the wire. The card is only touched from the storage task, through
+ *  storage_call().
+ */
+
+#include "cy_pdl.h"
+#include "mtb_hx8347.h"
+#include "lcd_dma.h"
+#include "lcd_band.h"
+#include "lcd_snap.h"
+#include "app_arena.h"
+#include "GUI.h"
+#include "ff.h"
+
+#include <string.h>
+
+
+#define LCD_SNAP_MAGIC              (0x31504E53u)   /* "SNP1" */
+
+/* Longest token: control byte and 128 literal pixels */
+#define LCD_SNAP_TOKEN_MAX          (1u + 2u * 128u)
+
+extern bool storage_call(void (*run)(void *arg), void *arg);
+
+/** File header */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t hash;          /* Of the inputs, the panel geometry and colour mode */
+    uint16_t width;
+    uint16_t height;
+    uint32_t bytes;         /* Coded pixels after the header, 0 while incomplete */
+} lcd_snap_header_t;
+
+/** What is known about a screen's file */
+typedef enum
+{
+    LCD_SNAP_UNKNOWN,       /* Not looked at since boot */
+    LCD_SNAP_ABSENT,        /* No usable file */
+    LCD_SNAP_PRESENT        /* Header in lcd_snap_index */
+} lcd_snap_state_t;
+
+/** File operation run by the storage task */
+typedef enum
+{
+    LCD_SNAP_OPEN_READ,
+    LCD_SNAP_OPEN_WRITE,
+    LCD_SNAP_READ,
+    LCD_SNAP_WRITE,
+    LCD_SNAP_REWIND,
+    LCD_SNAP_CLOSE
+} lcd_snap_op_t;
+
+typedef struct
+{
+    lcd_snap_op_t op;
+    unsigned id;
+    void *buf;
+    UINT len;
+    UINT done;
+    FRESULT res;
+} lcd_snap_io_t;
+
+/** Encoder state, pixels carry over from one band to the next */
+typedef struct
+{
+    uint16_t lit[128];
+    uint32_t nlit;
+    uint16_t run;
+    uint32_t nrun;
+    uint32_t fill;          /* Bytes in lcd_snap_buf */
+    uint32_t bytes;         /* Bytes written to the file */
+    bool error;
+} lcd_snap_encoder_t;
+
+static FATFS lcd_snap_fs;
+static FIL lcd_snap_file;
+static bool lcd_snap_mounted;
+static bool lcd_snap_no_card;
+
+static lcd_snap_state_t lcd_snap_state[LCD_SNAP_SCREENS];
+static lcd_snap_header_t lcd_snap_index[LCD_SNAP_SCREENS];
+
+/* LCD_SNAP_BUF_BYTES of file data and one line of wire-order pixels */
+static uint8_t *lcd_snap_buf;
+static uint8_t *lcd_snap_line;
+static bool lcd_snap_no_arena;
+
+static bool lcd_snap_enabled = true;
+static lcd_snap_encoder_t lcd_snap_enc;
+static lcd_snap_stats_t lcd_snap_stats;
+
+
+/*******************************************************************************
+ * File operation, runs on the storage task. Mounts the card on first use.
+ *******************************************************************************/
+static void lcd_snap_io(void *arg)
+{
+    lcd_snap_io_t *io = (lcd_snap_io_t *)arg;
+    char name[] = "SNAP0.BIN";
+
+    io->done = 0u;
+    if (!lcd_snap_mounted)
+    {
+        io->res = f_mount(&lcd_snap_fs, "", 1);
+        if (io->res != FR_OK)
+        {
+            /* No card, or not FAT formatted: stop trying until reset */
+            lcd_snap_no_card = true;
+            return;
+        }
+        lcd_snap_mounted = true;
+    }
+
+    switch (io->op)
+    {
+        case LCD_SNAP_OPEN_READ:
+        case LCD_SNAP_OPEN_WRITE:
+            name[4] = (char)('0' + io->id);
+            io->res = f_open(&lcd_snap_file, name, (io->op == LCD_SNAP_OPEN_READ) ?
+                             FA_READ : (FA_WRITE | FA_CREATE_ALWAYS));
+            break;
+        case LCD_SNAP_READ:
+            io->res = f_read(&lcd_snap_file, io->buf, io->len, &io->done);
+            break;
+        case LCD_SNAP_WRITE:
+            io->res = f_write(&lcd_snap_file, io->buf, io->len, &io->done);
+            if ((io->res == FR_OK) && (io->done != io->len))
+            {
+                io->res = FR_DENIED;
+            }
+            break;
+        case LCD_SNAP_REWIND:
+            io->res = f_lseek(&lcd_snap_file, 0u);
+            break;
+        default:
+            io->res = f_close(&lcd_snap_file);
+            break;
+    }
+}
+
+
+/*******************************************************************************
+ * Runs a file operation on the storage task and waits for it.
+ *******************************************************************************/
+static bool lcd_snap_call(lcd_snap_op_t op, unsigned id, void *buf, uint32_t len, uint32_t *done)
+{
+    lcd_snap_io_t io = { op, id, buf, (UINT)len, 0u, FR_INT_ERR };
+
+    if (!storage_call(lcd_snap_io, &io))
+    {
+        return false;
+    }
+    if (done != NULL)
+    {
+        *done = io.done;
+    }
+    return io.res == FR_OK;
+}
+
+
+/*******************************************************************************
+ * FNV-1a over the inputs, the screen number, the panel geometry and the
+ * colour mode.
+ *******************************************************************************/
+static uint32_t lcd_snap_hash(unsigned id, const void *inputs, uint32_t size)
+{
+    const uint8_t *p = (const uint8_t *)inputs;
+    uint32_t geometry[6];
+    uint32_t h = 2166136261u;
+    uint32_t i;
+
+    geometry[0] = id;
+    geometry[1] = (uint32_t)LCD_GetXSize();
+    geometry[2] = (uint32_t)LCD_GetYSize();
+    geometry[3] = (uint32_t)mtb_hx8347_get_rotation();
+    geometry[4] = (uint32_t)mtb_hx8347_get_color12();
+    geometry[5] = (uint32_t)LCD_PORT_WIDTH;
+
+    for (i = 0; i < size; i++)
+    {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    p = (const uint8_t *)geometry;
+    for (i = 0; i < sizeof(geometry); i++)
+    {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+
+/*******************************************************************************
+ * Reads the header of a screen's file into the index.
+ *******************************************************************************/
+static void lcd_snap_probe(unsigned id)
+{
+    lcd_snap_header_t *hdr = &lcd_snap_index[id];
+    uint32_t done = 0u;
+
+    lcd_snap_state[id] = LCD_SNAP_ABSENT;
+    if (!lcd_snap_call(LCD_SNAP_OPEN_READ, id, NULL, 0u, NULL))
+    {
+        return;
+    }
+    if (lcd_snap_call(LCD_SNAP_READ, id, hdr, sizeof(*hdr), &done) && (done == sizeof(*hdr)) &&
+        (hdr->magic == LCD_SNAP_MAGIC) && (hdr->bytes != 0u))
+    {
+        lcd_snap_state[id] = LCD_SNAP_PRESENT;
+    }
+    (void)lcd_snap_call(LCD_SNAP_CLOSE, id, NULL, 0u, NULL);
+}
+
+
+/*******************************************************************************
+ * Appends one token to the write buffer, writing the buffer out first when
+ * the longest token might not fit.
+ *******************************************************************************/
+static void lcd_snap_emit(uint8_t control, const uint16_t *pixels, uint32_t num)
+{
+    lcd_snap_encoder_t *enc = &lcd_snap_enc;
+    uint8_t *p;
+    uint32_t i;
+
+    if (enc->fill + LCD_SNAP_TOKEN_MAX > LCD_SNAP_BUF_BYTES)
+    {
+        enc->error |= !lcd_snap_call(LCD_SNAP_WRITE, 0u, lcd_snap_buf, enc->fill, NULL);
+        enc->bytes += enc->fill;
+        enc->fill = 0u;
+    }
+
+    p = &lcd_snap_buf[enc->fill];
+    *p++ = control;
+    for (i = 0; i < num; i++)
+    {
+        *p++ = (uint8_t)(pixels[i] >> 8);
+        *p++ = (uint8_t)pixels[i];
+    }
+    enc->fill = (uint32_t)(p - lcd_snap_buf);
+}
+
+
+static void lcd_snap_flush_literal(void)
+{
+    if (lcd_snap_enc.nlit > 0u)
+    {
+        lcd_snap_emit((uint8_t)(lcd_snap_enc.nlit - 1u), lcd_snap_enc.lit, lcd_snap_enc.nlit);
+        lcd_snap_enc.nlit = 0u;
+    }
+}
+
+
+static void lcd_snap_flush_run(void)
+{
+    lcd_snap_encoder_t *enc = &lcd_snap_enc;
+
+    if (enc->nrun >= 2u)
+    {
+        lcd_snap_flush_literal();
+        lcd_snap_emit((uint8_t)(0x80u + enc->nrun - 2u), &enc->run, 1u);
+    }
+    else if (enc->nrun == 1u)
+    {
+        enc->lit[enc->nlit++] = enc->run;
+        if (enc->nlit == 128u)
+        {
+            lcd_snap_flush_literal();
+        }
+    }
+    enc->nrun = 0u;
+}
+
+
+/*******************************************************************************
+ * Codes a row of pixels.
+ *******************************************************************************/
+static void lcd_snap_encode(const uint16_t *row, int num)
+{
+    lcd_snap_encoder_t *enc = &lcd_snap_enc;
+    int x;
+
+    for (x = 0; x < num; x++)
+    {
+        if ((enc->nrun > 0u) && (row[x] == enc->run) && (enc->nrun < 129u))
+        {
+            enc->nrun++;
+            continue;
+        }
+        lcd_snap_flush_run();
+        enc->run = row[x];
+        enc->nrun = 1u;
+    }
+}
+
+
+/*******************************************************************************
+ * Codes a band of the screen on its way to the panel.
+ *******************************************************************************/
+static void lcd_snap_band(const uint16_t *pixels, int xsize, int lines, void *arg)
+{
+    int r;
+
+    (void)arg;
+    for (r = 0; (r < lines) && !lcd_snap_enc.error; r++)
+    {
+        lcd_snap_encode(pixels + (uint32_t)r * (uint32_t)xsize, xsize);
+    }
+}
+
+
+/*******************************************************************************
+ * Draws the screen once, in the bands of lcd_band.c, and writes each band to
+ * the screen's file before it goes to the panel. The header goes in last, so
+ * an interrupted capture leaves a file that is never replayed.
+ *******************************************************************************/
+static bool lcd_snap_capture(unsigned id, void (*draw)(void *data), void *data, uint32_t hash)
+{
+    lcd_snap_header_t hdr = { LCD_SNAP_MAGIC, hash, 0u, 0u, 0u };
+
+    hdr.width = (uint16_t)LCD_GetXSize();
+    hdr.height = (uint16_t)LCD_GetYSize();
+    lcd_snap_state[id] = LCD_SNAP_ABSENT;
+    if (!lcd_snap_call(LCD_SNAP_OPEN_WRITE, id, NULL, 0u, NULL))
+    {
+        draw(data);
+        return false;
+    }
+
+    memset(&lcd_snap_enc, 0, sizeof(lcd_snap_enc));
+    memcpy(lcd_snap_buf, &hdr, sizeof(hdr));
+    lcd_snap_enc.fill = sizeof(hdr);
+
+    /* Drawn straight to the panel when no band fits the pool */
+    if (!lcd_band_draw_capture(draw, data, lcd_snap_band, NULL))
+    {
+        lcd_snap_enc.error = true;
+    }
+
+    lcd_snap_flush_run();
+    lcd_snap_flush_literal();
+    if (!lcd_snap_enc.error && (lcd_snap_enc.fill > 0u))
+    {
+        lcd_snap_enc.error = !lcd_snap_call(LCD_SNAP_WRITE, id, lcd_snap_buf, lcd_snap_enc.fill, NULL);
+        lcd_snap_enc.bytes += lcd_snap_enc.fill;
+    }
+
+    hdr.bytes = lcd_snap_enc.bytes - (uint32_t)sizeof(hdr);
+    if (!lcd_snap_enc.error)
+    {
+        lcd_snap_enc.error = !lcd_snap_call(LCD_SNAP_REWIND, id, NULL, 0u, NULL) ||
+                             !lcd_snap_call(LCD_SNAP_WRITE, id, &hdr, sizeof(hdr), NULL);
+    }
+    lcd_snap_enc.error |= !lcd_snap_call(LCD_SNAP_CLOSE, id, NULL, 0u, NULL);
+    if (lcd_snap_enc.error)
+    {
+        return false;
+    }
+
+    lcd_snap_index[id] = hdr;
+    lcd_snap_state[id] = LCD_SNAP_PRESENT;
+    lcd_snap_stats.captures++;
+    lcd_snap_stats.last_bytes = hdr.bytes;
+    return true;
+}
+
+
+/*******************************************************************************
+ * Streams a snapshot into a full screen window. Tokens are decoded from the
+ * read buffer into the line buffer, which is handed to the DMA whenever it
+ * holds a full line; the buffer is topped up while a whole token may still
+ * be missing from it.
+ *******************************************************************************/
+static bool lcd_snap_replay(unsigned id)
+{
+    const lcd_snap_header_t *hdr = &lcd_snap_index[id];
+    uint32_t line_bytes = (uint32_t)hdr->width * 2u;
+    uint32_t pixels = (uint32_t)hdr->width * hdr->height;
+    uint32_t file_left = hdr->bytes;
+    uint32_t avail = 0u, fill = 0u;
+    uint32_t done, num, n;
+    const uint8_t *p = lcd_snap_buf;
+    uint8_t control;
+    bool ok;
+
+    ok = lcd_snap_call(LCD_SNAP_OPEN_READ, id, NULL, 0u, NULL) &&
+         lcd_snap_call(LCD_SNAP_READ, id, lcd_snap_buf, sizeof(lcd_snap_header_t), &done) &&
+         (done == sizeof(lcd_snap_header_t));
+
+    if (ok)
+    {
+        mtb_hx8347_select_depth(16);
+        mtb_hx8347_set_window(0u, 0u, (uint16_t)(hdr->width - 1u), (uint16_t)(hdr->height - 1u));
+    }
+
+    while (ok && (pixels > 0u))
+    {
+        if ((avail < LCD_SNAP_TOKEN_MAX) && (file_left > 0u))
+        {
+            memmove(lcd_snap_buf, p, avail);
+            n = LCD_SNAP_BUF_BYTES - avail;
+            n = (file_left < n) ? file_left : n;
+            ok = lcd_snap_call(LCD_SNAP_READ, id, lcd_snap_buf + avail, n, &done) && (done == n);
+            file_left -= n;
+            avail += n;
+            p = lcd_snap_buf;
+            if (!ok)
+            {
+                break;
+            }
+        }
+
+        if (avail == 0u)
+        {
+            ok = false;
+            break;
+        }
+        control = *p++;
+        num = (control < 0x80u) ? (control + 1u) : (control - 0x80u + 2u);
+        n = (control < 0x80u) ? (2u * num) : 2u;
+        if ((avail < 1u + n) || (num > pixels))
+        {
+            ok = false;
+            break;
+        }
+        avail -= 1u + n;
+        pixels -= num;
+
+        while (num > 0u)
+        {
+            n = (line_bytes - fill) / 2u;
+            n = (num < n) ? num : n;
+            if (control < 0x80u)
+            {
+                memcpy(&lcd_snap_line[fill], p, 2u * n);
+                p += 2u * n;
+            }
+            else
+            {
+                for (done = 0u; done < n; done++)
+                {
+                    lcd_snap_line[fill + 2u * done] = p[0];
+                    lcd_snap_line[fill + 2u * done + 1u] = p[1];
+                }
+            }
+            fill += 2u * n;
+            num -= n;
+            if (fill == line_bytes)
+            {
+                lcd_dma_write_data_stream(lcd_snap_line, (int)fill);
+                fill = 0u;
+            }
+        }
+        if (control >= 0x80u)
+        {
+            p += 2;
+        }
+    }
+
+    if (ok && (fill > 0u))
+    {
+        lcd_dma_write_data_stream(lcd_snap_line, (int)fill);
+    }
+    (void)lcd_snap_call(LCD_SNAP_CLOSE, id, NULL, 0u, NULL);
+    if (ok)
+    {
+        lcd_snap_stats.replays++;
+        lcd_snap_stats.last_bytes = hdr->bytes;
+    }
+    return ok;
+}
+
+
+/*******************************************************************************
+ * Shows a static screen, from its snapshot when there is a current one,
+ * otherwise drawn once and captured on the way.
+ *******************************************************************************/
+void lcd_snap_show(unsigned id, void (*draw)(void *data), void *data,
+                   const void *inputs, uint32_t size)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t hash;
+
+    if (!LCD_SNAP_ENABLE || !lcd_snap_enabled || lcd_snap_no_card || (id >= LCD_SNAP_SCREENS))
+    {
+        draw(data);
+        return;
+    }
+
+    if ((lcd_snap_buf == NULL) && !lcd_snap_no_arena)
+    {
+        lcd_snap_buf = app_arena_alloc(LCD_SNAP_BUF_BYTES + 2u * LCD_HEIGHT);
+        lcd_snap_line = lcd_snap_buf + LCD_SNAP_BUF_BYTES;
+        lcd_snap_no_arena = (lcd_snap_buf == NULL);
+    }
+    if (lcd_snap_buf == NULL)
+    {
+        lcd_snap_stats.failures++;
+        draw(data);
+        return;
+    }
+
+    hash = lcd_snap_hash(id, inputs, size);
+    if (lcd_snap_state[id] == LCD_SNAP_UNKNOWN)
+    {
+        lcd_snap_probe(id);
+    }
+    if ((lcd_snap_state[id] == LCD_SNAP_PRESENT) && (lcd_snap_index[id].hash != hash))
+    {
+        lcd_snap_stats.stale++;
+        lcd_snap_state[id] = LCD_SNAP_ABSENT;
+    }
+
+    if (lcd_snap_state[id] == LCD_SNAP_PRESENT)
+    {
+        if (lcd_snap_replay(id))
+        {
+            lcd_dma_fence();
+            lcd_snap_stats.last_cycles = DWT->CYCCNT - start;
+            return;
+        }
+        lcd_snap_stats.failures++;
+        lcd_snap_state[id] = LCD_SNAP_ABSENT;
+    }
+
+    if (!lcd_snap_capture(id, draw, data, hash))
+    {
+        lcd_snap_stats.failures++;
+    }
+    lcd_snap_stats.last_cycles = DWT->CYCCNT - start;
+}
+
+
+/*******************************************************************************
+ * Switches the snapshots.
+ *******************************************************************************/
+void lcd_snap_set_enabled(bool enable)
+{
+    lcd_snap_enabled = enable;
+}
+
+
+/*******************************************************************************
+ * Copies the counters.
+ *******************************************************************************/
+void lcd_snap_get_stats(lcd_snap_stats_t *stats)
+{
+    *stats = lcd_snap_stats;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,77 @@
+/*
+ * lcd_snap.h
+ *
+ *  Snapshots of static screens on the SD card. The first time a screen is
+ *  shown it is drawn once, band by band through the memory device of
+ *  lcd_band.c, and each band is stored run-length coded on its way to the
+ *  panel; later visits stream the file into one GRAM window instead of
+ *  running the drawing code. A file is only replayed while the hash of the
+ *  screen's inputs matches the one it was captured with.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Set to 0 from the Makefile (LCD_SNAP=0) to always run the drawing code */
+#ifndef LCD_SNAP_ENABLE
+#define LCD_SNAP_ENABLE             1
+#endif
+
+/* Screens with a snapshot, ids 0 to LCD_SNAP_SCREENS - 1, at most 10 */
+#define LCD_SNAP_SCREENS            (4)
+
+/* File read and write buffer, taken from the application arena */
+#define LCD_SNAP_BUF_BYTES          (1024u)
+
+/** Snapshot counters */
+typedef struct
+{
+    uint32_t replays;       /**< Screens streamed from a snapshot */
+    uint32_t captures;      /**< Snapshots written */
+    uint32_t stale;         /**< Snapshots found with another input hash */
+    uint32_t failures;      /**< Card, file or memory errors, the screen was drawn */
+    uint32_t last_bytes;    /**< Size of the last snapshot replayed or written */
+    uint32_t last_cycles;   /**< CPU cycles spent in the last lcd_snap_show() */
+} lcd_snap_stats_t;
+
+
+/**
+ * Shows a static screen, from its snapshot when there is a current one.
+ * @param[in] id     Screen number, names the file SNAP<id>.BIN
+ * @param[in] draw   Draws the whole screen; called once per band when the
+ *                   screen is captured
+ * @param[in] data   Passed to the draw function
+ * @param[in] inputs Everything the drawing depends on besides the panel
+ *                   geometry and colour mode, hashed to tell stale snapshots
+ * @param[in] size   Bytes of inputs
+ */
+void lcd_snap_show(unsigned id, void (*draw)(void *data), void *data,
+                   const void *inputs, uint32_t size);
+
+/**
+ * Switches the snapshots, for the benchmark. Off, lcd_snap_show() only draws.
+ * @param[in] enable false to draw every time
+ */
+void lcd_snap_set_enabled(bool enable);
+
+/**
+ * Copies the counters.
+ * @param[out] stats Where to store the counters
+ */
+void lcd_snap_get_stats(lcd_snap_stats_t *stats);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
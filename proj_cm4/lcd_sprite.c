@@ -0,0 +1,581 @@
+/*
+ * lcd_sprite.c
+ *
+ *  Sprite animation, see lcd_sprite.h.
+ */
+
+#include "cy_pdl.h"
+#include "mtb_hx8347.h"
+#include "lcd_band.h"
+#include "lcd_bitmap.h"
+#include "lcd_dma.h"
+#include "lcd_prof.h"
+#include "lcd_rle.h"
+#include "lcd_sprite.h"
+#include "app_arena.h"
+#include "GUI.h"
+
+#include <string.h>
+
+
+/* Longest row on either orientation */
+#define LCD_SPRITE_ROW_MAX          ((LCD_WIDTH > LCD_HEIGHT) ? LCD_WIDTH : LCD_HEIGHT)
+
+typedef struct
+{
+    const U8 *pixels;           /* Indices, in flash or decoded into the arena */
+    uint32_t stride;            /* Bytes per row of pixels */
+    int xsize, ysize;
+    const uint16_t *lut;        /* Palette in wire order, copied */
+    bool trans;                 /* Index 0 is not drawn */
+    GUI_RECT bounds;
+    int x, y;                   /* Place in the next frame */
+    int dx, dy;
+    GUI_RECT shown;             /* Place on the panel, what save holds */
+    bool saved;                 /* save holds the background of shown */
+    bool drawn;                 /* false until the first frame sent it */
+    uint16_t *save;             /* Background under shown, wire order */
+} lcd_sprite_t;
+
+static lcd_sprite_t lcd_sprites[LCD_SPRITE_MAX];
+static int lcd_sprite_count;
+
+static void (*lcd_sprite_background)(void *data);
+static void *lcd_sprite_data;
+
+/* Due time of the next frame in GUI_GetTime() milliseconds */
+static GUI_TIMER_TIME lcd_sprite_due;
+
+/* Arena level before the first sprite and after the last, valid while
+ * lcd_sprite_marked */
+static uint32_t lcd_sprite_mark;
+static uint32_t lcd_sprite_top;
+static bool lcd_sprite_marked;
+
+/* One row in wire order on its way to the panel */
+static uint16_t lcd_sprite_row[LCD_SPRITE_ROW_MAX];
+
+static lcd_sprite_stats_t lcd_sprite_stats;
+
+
+/*******************************************************************************
+ * Gives everything the sprites allocated back to the arena. The glyph cache
+ * and the snapshot buffer take their blocks on first use, which the start
+ * screen makes happen before any animation; should one come in on top of the
+ * sprites all the same, their memory is kept rather than freed under it.
+ *******************************************************************************/
+static void lcd_sprite_release(void)
+{
+    if (lcd_sprite_marked)
+    {
+        if (app_arena_mark() == lcd_sprite_top)
+        {
+            app_arena_release(lcd_sprite_mark);
+        }
+        else
+        {
+            lcd_sprite_stats.failures++;
+        }
+        lcd_sprite_marked = false;
+    }
+}
+
+
+static bool lcd_sprite_intersect(const GUI_RECT *a, const GUI_RECT *b, GUI_RECT *r)
+{
+    r->x0 = (a->x0 > b->x0) ? a->x0 : b->x0;
+    r->y0 = (a->y0 > b->y0) ? a->y0 : b->y0;
+    r->x1 = (a->x1 < b->x1) ? a->x1 : b->x1;
+    r->y1 = (a->y1 < b->y1) ? a->y1 : b->y1;
+    return (r->x0 <= r->x1) && (r->y0 <= r->y1);
+}
+
+
+/*******************************************************************************
+ * Splits a minus b into at most four rectangles: full-width bands above and
+ * below b, then the parts left and right of it.
+ *******************************************************************************/
+static int lcd_sprite_subtract(const GUI_RECT *a, const GUI_RECT *b, GUI_RECT *out)
+{
+    GUI_RECT i;
+    int n = 0;
+
+    if (!lcd_sprite_intersect(a, b, &i))
+    {
+        out[0] = *a;
+        return 1;
+    }
+    if (a->y0 < i.y0)
+    {
+        out[n].x0 = a->x0;
+        out[n].y0 = a->y0;
+        out[n].x1 = a->x1;
+        out[n].y1 = (I16)(i.y0 - 1);
+        n++;
+    }
+    if (i.y1 < a->y1)
+    {
+        out[n].x0 = a->x0;
+        out[n].y0 = (I16)(i.y1 + 1);
+        out[n].x1 = a->x1;
+        out[n].y1 = a->y1;
+        n++;
+    }
+    if (a->x0 < i.x0)
+    {
+        out[n].x0 = a->x0;
+        out[n].y0 = i.y0;
+        out[n].x1 = (I16)(i.x0 - 1);
+        out[n].y1 = i.y1;
+        n++;
+    }
+    if (i.x1 < a->x1)
+    {
+        out[n].x0 = (I16)(i.x1 + 1);
+        out[n].y0 = i.y0;
+        out[n].x1 = a->x1;
+        out[n].y1 = i.y1;
+        n++;
+    }
+    return n;
+}
+
+
+static void lcd_sprite_place(const lcd_sprite_t *s, GUI_RECT *r)
+{
+    r->x0 = (I16)s->x;
+    r->y0 = (I16)s->y;
+    r->x1 = (I16)(s->x + s->xsize - 1);
+    r->y1 = (I16)(s->y + s->ysize - 1);
+}
+
+
+/*******************************************************************************
+ * Advances one axis by one frame, reflecting off the bounds.
+ *******************************************************************************/
+static void lcd_sprite_bounce(int *pos, int *vel, int lo, int hi)
+{
+    *pos += *vel;
+    if (*pos < lo)
+    {
+        *pos = 2 * lo - *pos;
+        *vel = -*vel;
+    }
+    else if (*pos > hi)
+    {
+        *pos = 2 * hi - *pos;
+        *vel = -*vel;
+    }
+    *pos = (*pos < lo) ? lo : ((*pos > hi) ? hi : *pos);
+}
+
+
+/*******************************************************************************
+ * Paints the sprite's pixels on row y over the part of lcd_sprite_row that
+ * holds columns x0 to x1.
+ *******************************************************************************/
+static void lcd_sprite_overlay(const lcd_sprite_t *s, int y, int x0, int x1)
+{
+    const U8 *src;
+    uint16_t *dst;
+    int sx0 = (x0 > s->x) ? x0 : s->x;
+    int sx1 = s->x + s->xsize - 1;
+    int n;
+
+    sx1 = (x1 < sx1) ? x1 : sx1;
+    if ((y < s->y) || (y >= s->y + s->ysize) || (sx0 > sx1))
+    {
+        return;
+    }
+
+    src = s->pixels + (uint32_t)(y - s->y) * s->stride + (uint32_t)(sx0 - s->x);
+    dst = &lcd_sprite_row[sx0 - x0];
+    if (s->trans)
+    {
+        for (n = sx1 - sx0 + 1; n > 0; n--, src++, dst++)
+        {
+            if (*src != 0u)
+            {
+                *dst = s->lut[*src];
+            }
+        }
+    }
+    else
+    {
+        for (n = sx1 - sx0 + 1; n > 0; n--)
+        {
+            *dst++ = s->lut[*src++];
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Sends one rectangle in one GRAM window: the background from a save-under
+ * that covers it, every sprite on top in their order.
+ *******************************************************************************/
+static void lcd_sprite_send(const GUI_RECT *r, const uint16_t *save, const GUI_RECT *org)
+{
+    uint32_t stride = (uint32_t)(org->x1 - org->x0 + 1);
+    uint32_t w = (uint32_t)(r->x1 - r->x0 + 1);
+    int y, i;
+
+    mtb_hx8347_select_depth(16);
+    mtb_hx8347_set_window((uint16_t)r->x0, (uint16_t)r->y0, (uint16_t)r->x1, (uint16_t)r->y1);
+    for (y = r->y0; y <= r->y1; y++)
+    {
+        memcpy(lcd_sprite_row, &save[(uint32_t)(y - org->y0) * stride + (uint32_t)(r->x0 - org->x0)],
+               2u * w);
+        for (i = 0; i < lcd_sprite_count; i++)
+        {
+            lcd_sprite_overlay(&lcd_sprites[i], y, r->x0, r->x1);
+        }
+        lcd_dma_write_data_stream((uint8_t *)lcd_sprite_row, (int)(2u * w));
+    }
+
+    lcd_sprite_stats.rects++;
+    lcd_sprite_stats.pixels += w * (uint32_t)(r->y1 - r->y0 + 1);
+}
+
+
+/*******************************************************************************
+ * Renders the background of part of a sprite's place into its save-under.
+ * Memory devices get an even width, the rows of odd 16bpp devices may be
+ * padded.
+ *******************************************************************************/
+static void lcd_sprite_render(lcd_sprite_t *s, const GUI_RECT *r)
+{
+    uint32_t stride = (uint32_t)(s->shown.x1 - s->shown.x0 + 1);
+    int w = r->x1 - r->x0 + 1;
+    int xm = r->x0;
+    int lines, y, n, row, x;
+    GUI_MEMDEV_Handle hMem;
+    const uint16_t *pData;
+    uint16_t *dst;
+    uint16_t v;
+
+    if ((w & 1) != 0)
+    {
+        w++;
+        xm = (xm + w > LCD_GetXSize()) ? (xm - 1) : xm;
+    }
+    lines = ((LCD_BAND_LINES > 0) ? LCD_BAND_LINES : 1) * LCD_SPRITE_ROW_MAX / w;
+    lines = (lines > 0) ? lines : 1;
+
+    for (y = r->y0; y <= r->y1; y += n)
+    {
+        n = ((r->y1 - y + 1) < lines) ? (r->y1 - y + 1) : lines;
+        hMem = GUI_MEMDEV_Create(xm, y, w, n);
+        if (hMem == 0)
+        {
+            lcd_sprite_stats.failures++;
+            continue;
+        }
+        GUI_MEMDEV_Select(hMem);
+        lcd_sprite_background(lcd_sprite_data);
+        GUI_MEMDEV_Select(0);
+
+        pData = (const uint16_t *)GUI_MEMDEV_GetDataPtr(hMem);
+        for (row = 0; row < n; row++)
+        {
+            dst = &s->save[(uint32_t)(y + row - s->shown.y0) * stride + (uint32_t)(r->x0 - s->shown.x0)];
+            for (x = r->x0; x <= r->x1; x++)
+            {
+                v = pData[row * w + (x - xm)];
+                *dst++ = (uint16_t)((v >> 8) | (v << 8));
+            }
+        }
+        GUI_MEMDEV_Delete(hMem);
+    }
+    lcd_sprite_stats.rendered += (uint32_t)(r->x1 - r->x0 + 1) * (uint32_t)(r->y1 - r->y0 + 1);
+}
+
+
+/*******************************************************************************
+ * Moves the save-under to a new place: the background both places share is
+ * shifted inside the buffer, only the rest is rendered.
+ *******************************************************************************/
+static void lcd_sprite_resave(lcd_sprite_t *s, const GUI_RECT *to)
+{
+    uint32_t stride = (uint32_t)(s->shown.x1 - s->shown.x0 + 1);
+    GUI_RECT from = s->shown;
+    GUI_RECT i, parts[4];
+    uint16_t *src, *dst;
+    uint32_t cols;
+    int n, y;
+
+    s->shown = *to;
+    if (lcd_sprite_intersect(&from, to, &i))
+    {
+        cols = (uint32_t)(i.x1 - i.x0 + 1);
+        src = &s->save[(uint32_t)(i.y0 - from.y0) * stride + (uint32_t)(i.x0 - from.x0)];
+        dst = &s->save[(uint32_t)(i.y0 - to->y0) * stride + (uint32_t)(i.x0 - to->x0)];
+        /* Every row moves by the same offset, copy away from the overlap */
+        if (dst <= src)
+        {
+            for (y = i.y0; y <= i.y1; y++, src += stride, dst += stride)
+            {
+                memmove(dst, src, 2u * cols);
+            }
+        }
+        else
+        {
+            src += (uint32_t)(i.y1 - i.y0) * stride;
+            dst += (uint32_t)(i.y1 - i.y0) * stride;
+            for (y = i.y1; y >= i.y0; y--, src -= stride, dst -= stride)
+            {
+                memmove(dst, src, 2u * cols);
+            }
+        }
+        n = lcd_sprite_subtract(to, &from, parts);
+    }
+    else
+    {
+        parts[0] = *to;
+        n = 1;
+    }
+
+    for (y = 0; y < n; y++)
+    {
+        lcd_sprite_render(s, &parts[y]);
+    }
+}
+
+
+/*******************************************************************************
+ * Advances the sprites and sends what changed on the panel.
+ *******************************************************************************/
+static void lcd_sprite_frame(uint32_t steps)
+{
+    lcd_sprite_t *s;
+    GUI_RECT to, parts[4];
+    uint32_t start = lcd_prof_now();
+    uint32_t ticks, k;
+    int i, n;
+
+    lcd_sprite_stats.rects = 0u;
+    lcd_sprite_stats.pixels = 0u;
+    for (i = 0; i < lcd_sprite_count; i++)
+    {
+        s = &lcd_sprites[i];
+        for (k = 0; k < steps; k++)
+        {
+            lcd_sprite_bounce(&s->x, &s->dx, s->bounds.x0, s->bounds.x1 - s->xsize + 1);
+            lcd_sprite_bounce(&s->y, &s->dy, s->bounds.y0, s->bounds.y1 - s->ysize + 1);
+        }
+    }
+
+    for (i = 0; i < lcd_sprite_count; i++)
+    {
+        s = &lcd_sprites[i];
+        if (!s->saved)
+        {
+            lcd_sprite_render(s, &s->shown);
+            s->saved = true;
+        }
+        lcd_sprite_place(s, &to);
+        if (s->drawn && (to.x0 == s->shown.x0) && (to.y0 == s->shown.y0))
+        {
+            continue;
+        }
+        /* The area left behind, from the old background, before it shifts */
+        n = lcd_sprite_subtract(&s->shown, &to, parts);
+        while (n-- > 0)
+        {
+            lcd_sprite_send(&parts[n], s->save, &s->shown);
+        }
+        lcd_sprite_resave(s, &to);
+        lcd_sprite_send(&to, s->save, &to);
+        s->drawn = true;
+    }
+
+    lcd_dma_fence();
+    ticks = lcd_prof_now() - start;
+    LCD_PROF_RECORD(LCD_PROF_SPRITE, ticks);
+    lcd_sprite_stats.frames++;
+    lcd_sprite_stats.last_ticks = ticks;
+    lcd_sprite_stats.total_ticks += ticks;
+    if (ticks > lcd_sprite_stats.max_ticks)
+    {
+        lcd_sprite_stats.max_ticks = ticks;
+    }
+    if (ticks > lcd_sprite_stats.budget_ticks)
+    {
+        lcd_sprite_stats.late++;
+    }
+}
+
+
+/*******************************************************************************
+ * Starts animating over a screen. The sprites of the screen before are
+ * released, the arena level is kept for lcd_sprite_stop().
+ *******************************************************************************/
+void lcd_sprite_begin(void (*background)(void *data), void *data)
+{
+    lcd_sprite_count = 0;
+    lcd_sprite_release();
+    lcd_sprite_mark = app_arena_mark();
+    lcd_sprite_top = lcd_sprite_mark;
+    lcd_sprite_marked = true;
+    lcd_sprite_background = background;
+    lcd_sprite_data = data;
+    lcd_sprite_stats.budget_ticks = LCD_SPRITE_PERIOD_MS * 1000u * lcd_prof_ticks_per_us();
+    lcd_sprite_due = GUI_GetTime() + (GUI_TIMER_TIME)LCD_SPRITE_PERIOD_MS;
+}
+
+
+/*******************************************************************************
+ * Adds a bouncing sprite. Its palette, save-under and, for a run-length coded
+ * bitmap, the decoded indices are allocated from the arena to the size of
+ * the bitmap. The save-under is filled by the first frame, which also draws
+ * it.
+ *******************************************************************************/
+int lcd_sprite_add(const GUI_BITMAP *bm, int x, int y, int dx, int dy, const GUI_RECT *bounds)
+{
+    lcd_sprite_t *s = &lcd_sprites[lcd_sprite_count];
+    uint32_t pixels = (uint32_t)bm->XSize * bm->YSize;
+    uint32_t mark = app_arena_mark();
+    bool rle = (bm->pMethods == &LCD_RLE_METHODS_8BPP);
+    const LCD_PIXELINDEX *pTrans;
+    const uint16_t *wire;
+    lcd_rle_decoder_t dec;
+    uint16_t *lut, *save;
+    U8 *indices = NULL;
+
+    if (!LCD_SPRITE_ENABLE)
+    {
+        return -1;
+    }
+    if ((lcd_sprite_background == NULL) || (lcd_sprite_count >= LCD_SPRITE_MAX) ||
+        (mark != lcd_sprite_top) ||
+        (bm->BitsPerPixel != 8u) || ((bm->pMethods != NULL) && !rle) || (bm->pPal == NULL) ||
+        (bounds->x0 < 0) || (bounds->y0 < 0) ||
+        (bounds->x1 >= LCD_GetXSize()) || (bounds->y1 >= LCD_GetYSize()) ||
+        (x < bounds->x0) || (y < bounds->y0) ||
+        (x + bm->XSize - 1 > bounds->x1) || (y + bm->YSize - 1 > bounds->y1))
+    {
+        lcd_sprite_stats.failures++;
+        return -1;
+    }
+
+    pTrans = lcd_bitmap_get_trans(bm->pPal);
+    wire = lcd_bitmap_get_wire_lut(pTrans);
+    lut = app_arena_alloc(256u * sizeof(uint16_t));
+    save = app_arena_alloc(pixels * sizeof(uint16_t));
+    if (rle)
+    {
+        indices = app_arena_alloc(pixels);
+    }
+    if ((wire == NULL) || (lut == NULL) || (save == NULL) || (rle && (indices == NULL)))
+    {
+        app_arena_release(mark);
+        lcd_sprite_stats.failures++;
+        return -1;
+    }
+    lcd_sprite_top = app_arena_mark();
+    /* The palette cache recycles its tables, keep a copy */
+    memcpy(lut, wire, 256u * sizeof(uint16_t));
+
+    memset(s, 0, sizeof(*s));
+    if (rle)
+    {
+        lcd_rle_init(&dec, bm->pData);
+        lcd_rle_decode(&dec, indices, pixels);
+        s->pixels = indices;
+        s->stride = bm->XSize;
+    }
+    else
+    {
+        s->pixels = bm->pData;
+        s->stride = bm->BytesPerLine;
+    }
+    s->xsize = bm->XSize;
+    s->ysize = bm->YSize;
+    s->lut = lut;
+    s->trans = (bm->pPal->HasTrans != 0);
+    s->bounds = *bounds;
+    s->x = x;
+    s->y = y;
+    s->dx = dx;
+    s->dy = dy;
+    s->save = save;
+    lcd_sprite_place(s, &s->shown);
+    return lcd_sprite_count++;
+}
+
+
+/*******************************************************************************
+ * Stops animating.
+ *******************************************************************************/
+void lcd_sprite_stop(void)
+{
+    lcd_sprite_count = 0;
+    lcd_sprite_background = NULL;
+    lcd_sprite_release();
+}
+
+
+/*******************************************************************************
+ * Draws a frame when its slot has come, catching up on missed slots.
+ *******************************************************************************/
+bool lcd_sprite_poll(void)
+{
+    GUI_TIMER_TIME late;
+    uint32_t steps;
+
+    if (lcd_sprite_count == 0)
+    {
+        return false;
+    }
+    late = GUI_GetTime() - lcd_sprite_due;
+    if (late < 0)
+    {
+        return false;
+    }
+
+    steps = 1u + (uint32_t)late / LCD_SPRITE_PERIOD_MS;
+    lcd_sprite_due += (GUI_TIMER_TIME)(steps * LCD_SPRITE_PERIOD_MS);
+    lcd_sprite_stats.dropped += steps - 1u;
+    lcd_sprite_frame(steps);
+    return true;
+}
+
+
+/*******************************************************************************
+ * Returns the time to the next frame.
+ *******************************************************************************/
+uint32_t lcd_sprite_next_ms(void)
+{
+    GUI_TIMER_TIME left;
+
+    if (lcd_sprite_count == 0)
+    {
+        return UINT32_MAX;
+    }
+    left = lcd_sprite_due - GUI_GetTime();
+    return (left > 0) ? (uint32_t)left : 0u;
+}
+
+
+/*******************************************************************************
+ * Draws frames back to back and puts the next slot one period out.
+ *******************************************************************************/
+void lcd_sprite_run(uint32_t frames)
+{
+    while ((frames-- > 0u) && (lcd_sprite_count > 0))
+    {
+        lcd_sprite_frame(1u);
+    }
+    lcd_sprite_due = GUI_GetTime() + (GUI_TIMER_TIME)LCD_SPRITE_PERIOD_MS;
+}
+
+
+/*******************************************************************************
+ * Copies the frame counters.
+ *******************************************************************************/
+void lcd_sprite_get_stats(lcd_sprite_stats_t *stats)
+{
+    *stats = lcd_sprite_stats;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,128 @@
+/*
+ * lcd_sprite.h
+ *
+ *  Sprite animation over a still screen. Frames run at a fixed rate on
+ *  GUI_GetTime(), the emwin_timer millisecond tick of GUI_X.c (the RTOS tick
+ *  in the LCD_RTOS build). Each sprite keeps a save-under buffer with the
+ *  background beneath it; a frame sends only the area a sprite left,
+ *  restored from that buffer, and the area it moved to, each as one GRAM
+ *  window. Background the buffer does not hold yet is rendered by the
+ *  screen's draw function into a memory device of just that area. The
+ *  save-unders, palettes and decoded bitmaps are allocated from the
+ *  application arena when a sprite is added and released together when the
+ *  animation stops.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "GUI.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Animated sprites, 0 keeps every screen still */
+#ifndef LCD_SPRITE_ENABLE
+#define LCD_SPRITE_ENABLE           (1)
+#endif
+
+/* Arena bytes a sprite of xsize by ysize pixels takes at most: its palette
+ * in wire order, its save-under, the indices of a run-length coded bitmap
+ * and the alignment of those blocks */
+#define LCD_SPRITE_BYTES(xsize, ysize)  (512u + 3u * (xsize) * (ysize) + 16u)
+
+/* Frame rate */
+#ifndef LCD_SPRITE_FPS
+#define LCD_SPRITE_FPS              (25u)
+#endif
+
+#define LCD_SPRITE_PERIOD_MS        (1000u / LCD_SPRITE_FPS)
+
+/* Sprites at most, drawn in the order they were added */
+#define LCD_SPRITE_MAX              (4)
+
+/** Frame counters, times in lcd_prof ticks */
+typedef struct
+{
+    uint32_t frames;        /**< Frames drawn */
+    uint32_t dropped;       /**< Frame slots that passed without a frame */
+    uint32_t late;          /**< Frames that took longer than a slot */
+    uint32_t budget_ticks;  /**< One slot, LCD_SPRITE_PERIOD_MS */
+    uint32_t last_ticks;    /**< Last frame, until its pixels left */
+    uint32_t max_ticks;     /**< Longest frame */
+    uint64_t total_ticks;   /**< All frames */
+    uint32_t rects;         /**< Windows sent by the last frame */
+    uint32_t pixels;        /**< Pixels sent by the last frame */
+    uint32_t rendered;      /**< Background pixels rendered into save-unders */
+    uint32_t failures;      /**< Sprites refused, memory devices not created and arena blocks kept */
+} lcd_sprite_stats_t;
+
+
+/**
+ * Starts animating over a screen, dropping the sprites of the one before.
+ * @param[in] background Draws the screen without its sprites, with the
+ *                       contract of lcd_band_draw()
+ * @param[in] data       Passed to the background function
+ */
+void lcd_sprite_begin(void (*background)(void *data), void *data);
+
+/**
+ * Adds a sprite that bounces inside a rectangle. The panel under it must
+ * show the background or the sprite itself; the next frame draws it.
+ * @param[in] bm     8bpp palette bitmap, uncompressed or run-length coded
+ *                   (lcd_rle.h) and then decoded here once; index 0 is
+ *                   transparent when the palette has transparency
+ * @param[in] x      Left edge
+ * @param[in] y      Top edge
+ * @param[in] dx     Pixels per frame to the right
+ * @param[in] dy     Pixels per frame down
+ * @param[in] bounds Area the sprite stays in, on the screen
+ * @return Sprite number, -1 if the bitmap, the place or the memory does
+ *         not allow it
+ */
+int lcd_sprite_add(const GUI_BITMAP *bm, int x, int y, int dx, int dy, const GUI_RECT *bounds);
+
+/**
+ * Stops animating and gives the sprites' memory back to the arena. The
+ * sprites stay on the panel where they are.
+ */
+void lcd_sprite_stop(void);
+
+/**
+ * Draws a frame when one is due. Slots that passed while the caller was busy
+ * are counted as dropped and their motion is applied in one go, so the
+ * sprites keep to real time.
+ * @return true if a frame was drawn
+ */
+bool lcd_sprite_poll(void);
+
+/**
+ * Returns the time to the next frame, for a caller that sleeps.
+ * @return Milliseconds, 0 if a frame is due, UINT32_MAX with no sprites
+ */
+uint32_t lcd_sprite_next_ms(void);
+
+/**
+ * Draws frames back to back, not waiting for their slots, for the
+ * benchmark. Frames that take longer than a slot still count as late.
+ * @param[in] frames Number of frames
+ */
+void lcd_sprite_run(uint32_t frames);
+
+/**
+ * Copies the frame counters.
+ * @param[out] stats Where to store the counters
+ */
+void lcd_sprite_get_stats(lcd_sprite_stats_t *stats);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
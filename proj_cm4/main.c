@@ -13,6 +13,21 @@
 #include "cybsp.h"
 #include "cy_retarget_io.h"
 #include "mtb_hx8347.h"
+#include "lcd_benchmark.h"
+#include "lcd_dma.h"
+#include "lcd_band.h"
+#include "spi_bus.h"
+#include "lcd_bitmap.h"
+#include "lcd_dlist.h"
+#include "lcd_prof.h"
+#include "lcd_pool.h"
+#include "app_arena.h"
+#include "app_handoff.h"
+#include "lcd_glyph.h"
+#include "lcd_snap.h"
+#include "lcd_region.h"
+#include "screens.h"
+#include "lcd_sprite.h"
 #include "GUI.h"
 //#include "BUTTON.h"
 #include "ipc_communication.h"
@@ -24,16 +39,40 @@
 #include "ff.h"
 #include "diskio.h"
 
+#if (LCD_RTOS)
+#include "cyabs_rtos.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#endif
+
 
 /*******************************************************************************
 * Macros
 *******************************************************************************/
-/* SPI baud rate in Hz */
-#define SPI_FREQ_HZ                (10000000UL)
 /* Delay of 1000ms between commands */
 #define CMD_TO_CMD_DELAY           (1000UL)
 /* SPI transfer bits per frame */
 #define BITS_PER_FRAME             (8)
+/* Set to 0 from the Makefile to poll for messages like before */
+#ifndef LCD_IDLE_SLEEP
+#define LCD_IDLE_SLEEP             (1)
+#endif
+/* Set to 1 from the Makefile to run input, rendering and SD work as tasks */
+#ifndef LCD_RTOS
+#define LCD_RTOS                   (0)
+#endif
+
+/* Task setup for LCD_RTOS. Input preempts rendering, which preempts SD work */
+#define INPUT_TASK_STACK           (1024u)
+#define INPUT_TASK_PRIORITY        (CY_RTOS_PRIORITY_HIGH)
+#define INPUT_QUEUE_LEN            (8u)
+/* Console poll period of the input task */
+#define INPUT_POLL_MS              (50u)
+#define RENDER_TASK_STACK          (4096u)
+#define RENDER_TASK_PRIORITY       (CY_RTOS_PRIORITY_NORMAL)
+#define STORAGE_TASK_STACK         (2048u)
+#define STORAGE_TASK_PRIORITY      (CY_RTOS_PRIORITY_LOW)
+#define STORAGE_QUEUE_LEN          (4u)
 
 
 cy_rslt_t result;
@@ -51,18 +90,8 @@ void handle_error(uint32_t status)
 * Functions Prototypes
 *****************************************************************************/
 void cm4_msg_callback(uint32_t *msg);
-void number_screen(void);
-void display_number(int digit, int color);
-void draw_symbol(int digit);
-void draw_triangle();
-
-void menu_screen();
-void display_a(void);
-void display_b(void);
-void display_c(void);
-void display_d(void);
-void display_e(void);
-void display_f(void);
+bool storage_post(void (*run)(void *arg), void *arg);
+bool storage_call(void (*run)(void *arg), void *arg);
 
 /****************************************************************************
 * Global Variables
@@ -71,6 +100,34 @@ void display_f(void);
 /* Message variables */
 volatile bool msg_flag = false;
 volatile uint32_t msg_value;
+/* CYCCNT when the message arrived. The counter stops while the CPU sleeps,
+ * so latencies are taken from the interrupt, which runs once awake. */
+volatile uint32_t msg_cycles;
+
+/* Screen asked for by the CM0+ messages so far */
+static screen_id_t screen_req = SCREEN_MENU;
+
+#if (LCD_RTOS)
+/* CM0+ message as queued by the IPC callback */
+typedef struct {
+    uint32_t value;
+    uint32_t cycles;            /* CYCCNT on arrival */
+} app_msg_t;
+
+/* Work for the storage task */
+typedef struct {
+    void (*run)(void *arg);
+    void *arg;
+    bool wait;                  /* Queued by storage_call(), give storage_done */
+} storage_job_t;
+
+static cy_queue_t input_queue;
+static cy_queue_t storage_queue;
+/* Given by the storage task when a storage_call() job is done */
+static cy_semaphore_t storage_done;
+
+static cy_thread_t input_thread, render_thread, storage_thread;
+#endif
 
 
 extern GUI_CONST_STORAGE GUI_BITMAP bma_apple;
@@ -78,6 +135,361 @@ extern GUI_CONST_STORAGE GUI_BITMAP bma;
 extern GUI_CONST_STORAGE GUI_BITMAP bmball;
 extern GUI_CONST_STORAGE GUI_BITMAP bmb;
 
+/*******************************************************************************
+* Function Name: navigate
+********************************************************************************
+* Summary:
+*   Moves the requested screen according to a message from CM0+. Next on
+*   the last lesson leads to SCREEN_NONE and leaves the request as it is.
+*
+* Parameters:
+*   value: message value, 1 next, 0 back, tens pick a screen
+*
+* Return:
+*   true if there is a screen to draw
+*
+*******************************************************************************/
+static bool navigate(int value)
+{
+    screen_id_t to = screen_req;
+
+    if(value==1) to = (screen_id_t)screen_get(screen_req)->next;
+    else if(value==0) to = (screen_id_t)screen_get(screen_req)->back;
+    else if(value > 1) to = screen_pick(screen_req, value/10);
+    if(to == SCREEN_NONE) return false;
+    screen_req = to;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: render
+********************************************************************************
+* Summary:
+*   Draws a screen, times it and preloads what the screens around it need.
+*   The cost of the last screen is on the 'h' console key.
+*
+* Parameters:
+*   id:    screen to draw
+*   since: CYCCNT when the message that asked for it arrived
+*
+*******************************************************************************/
+static void render(screen_id_t id, uint32_t since)
+{
+    LCD_PROF_BEGIN(LCD_PROF_DISPATCH);
+    screen_show(id);
+    lcd_dma_fence();
+    LCD_PROF_END(LCD_PROF_DISPATCH);
+    LCD_PROF_RECORD(LCD_PROF_RESPONSE, DWT->CYCCNT - since);
+    lcd_pool_sample(0u);
+
+    screen_prefetch(id);
+}
+
+/*******************************************************************************
+* Function Name: print_screen_stats
+********************************************************************************
+* Summary:
+*   Prints what the last band frame, display list, snapshot and region
+*   repaint cost.
+*
+*******************************************************************************/
+static void print_screen_stats(void)
+{
+    lcd_band_stats_t band;
+    lcd_dlist_stats_t list;
+    lcd_snap_stats_t snap;
+    lcd_region_stats_t region;
+    uint32_t cpu = SystemCoreClock / 1000000u;
+
+    lcd_band_get_stats(&band);
+    lcd_dlist_get_stats(&list);
+    lcd_snap_get_stats(&snap);
+    lcd_region_get_stats(&region);
+
+    if(band.frames != 0u) printf("Frame: %lu bytes, %lu lines/band, %lu us\r\n",
+           (unsigned long)band.last_bytes, (unsigned long)band.band_lines,
+           (unsigned long)(band.last_cycles / cpu));
+    if(list.lists != 0u) printf("List: %lu ops, %lu of %lu px in %lu rects, %lu us\r\n",
+           (unsigned long)list.ops, (unsigned long)list.pixels_out, (unsigned long)list.pixels_in,
+           (unsigned long)list.rects, (unsigned long)(list.cycles / cpu));
+    if(snap.replays != 0u || snap.captures != 0u) printf("Snap: %lu replayed, %lu captured, last %lu bytes, %lu us\r\n",
+           (unsigned long)snap.replays, (unsigned long)snap.captures, (unsigned long)snap.last_bytes,
+           (unsigned long)(snap.last_cycles / cpu));
+    if(region.partial != 0u) printf("Regions: %lu rects, %lu px\r\n",
+           (unsigned long)region.rects, (unsigned long)region.pixels);
+}
+
+/*******************************************************************************
+* Function Name: poll_console
+********************************************************************************
+* Summary:
+*   Profiling report on demand from the debug UART: 'p' zones and sprite
+*   frames, 'r' reset,
+*   'h' emWin pool, application arena, glyph cache and the last screen.
+*
+*******************************************************************************/
+static void poll_console(void)
+{
+    if (cyhal_uart_readable(&cy_retarget_io_uart_obj) > 0u)
+    {
+        uint8_t key;
+        if (CY_RSLT_SUCCESS == cyhal_uart_getc(&cy_retarget_io_uart_obj, &key, 1u))
+        {
+            if (key == 'p') {
+                lcd_sprite_stats_t sprite;
+                uint32_t tpu = lcd_prof_ticks_per_us();
+                lcd_prof_dump();
+                lcd_sprite_get_stats(&sprite);
+                if (sprite.frames != 0u)
+                    printf("Sprites: %lu frames, %lu dropped, %lu late, avg %lu us, max %lu us of %lu us\r\n",
+                           (unsigned long)sprite.frames, (unsigned long)sprite.dropped,
+                           (unsigned long)sprite.late,
+                           (unsigned long)(sprite.total_ticks / sprite.frames / tpu),
+                           (unsigned long)(sprite.max_ticks / tpu),
+                           (unsigned long)(sprite.budget_ticks / tpu));
+            }
+            else if (key == 'r') lcd_prof_reset();
+            else if (key == 'h') {
+                app_arena_stats_t arena;
+                lcd_glyph_stats_t glyph;
+                app_arena_get_stats(&arena);
+                lcd_glyph_get_stats(&glyph);
+                lcd_pool_report();
+                printf("Arena: %lu bytes, %lu used, peak %lu, %lu failed\r\n",
+                       (unsigned long)arena.size, (unsigned long)arena.used,
+                       (unsigned long)arena.peak, (unsigned long)arena.failures);
+                printf("Glyphs: %lu hits, %lu misses, %lu evicted, %lu uncached, %lu entries in %lu of %u bytes\r\n",
+                       (unsigned long)glyph.hits, (unsigned long)glyph.misses,
+                       (unsigned long)glyph.evictions, (unsigned long)glyph.uncached,
+                       (unsigned long)glyph.entries, (unsigned long)glyph.bytes_used,
+                       (unsigned)LCD_GLYPH_CACHE_BYTES);
+                print_screen_stats();
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: gui_start
+********************************************************************************
+* Summary:
+*   Brings up emWin, shows the menu and prints the boot counters.
+*
+*******************************************************************************/
+static void gui_start(void)
+{
+    GUI_Init();
+#if (LCD_BENCHMARK)
+    lcd_benchmark_run();
+#endif
+    mtb_hx8347_reset_stats();
+    spi_bus_reset_stats();
+    screen_show(SCREEN_MENU);
+
+    uint32_t init_us, first_pixel_us;
+    mtb_hx8347_get_boot_timing(&init_us, &first_pixel_us);
+    printf("LCD: init %lu us, first pixel after %lu us\r\n",
+           (unsigned long)init_us, (unsigned long)first_pixel_us);
+
+    mtb_hx8347_stats_t lcd_stats;
+    mtb_hx8347_get_stats(&lcd_stats);
+    printf("LCD: %lu bytes, %lu bursts, %lu HAL calls, %lu bytes/s\r\n",
+           (unsigned long)lcd_stats.bytes, (unsigned long)lcd_stats.bursts,
+           (unsigned long)lcd_stats.hal_calls,
+           (unsigned long)mtb_hx8347_get_bytes_per_second());
+
+    const mtb_hx8347_call_stats_t *lcd_calls = mtb_hx8347_get_call_stats();
+    for (int i = 0; i < MTB_HX8347_CALL_COUNT; i++)
+    {
+        if (lcd_calls[i].calls != 0u)
+        {
+            printf("LCD: %-20s %6lu calls, %lu cycles/call\r\n", lcd_calls[i].name,
+                   (unsigned long)lcd_calls[i].calls,
+                   (unsigned long)(lcd_calls[i].cycles / lcd_calls[i].calls));
+        }
+    }
+
+    spi_bus_stats_t bus;
+    const char *bus_name;
+    for (int i = 0; (bus_name = spi_bus_get_stats(i, &bus)) != NULL; i++)
+    {
+        printf("SPI: %-4s %lu acquisitions, %lu switches (%lu us), busy %lu us\r\n", bus_name,
+               (unsigned long)bus.acquisitions, (unsigned long)bus.switches,
+               (unsigned long)(bus.switch_cycles / (SystemCoreClock / 1000000u)),
+               (unsigned long)(bus.busy_cycles / (SystemCoreClock / 1000000u)));
+    }
+    printf("Press 'p' for the profiling zones, 'r' to clear them\r\n");
+    printf("\r\n");
+}
+
+#if (LCD_RTOS)
+/*******************************************************************************
+* Function Name: input_task
+********************************************************************************
+* Summary:
+*   Turns CM0+ messages into the requested screen. It never draws, so
+*   navigation keeps up while a screen is being rendered or the card is busy;
+*   the renderer skips straight to the newest request.
+*
+*******************************************************************************/
+static void input_task(cy_thread_arg_t arg)
+{
+    app_msg_t msg;
+    (void)arg;
+
+    for (;;)
+    {
+        /* Only this task moves screen_req, the renderer gets a copy */
+        if ((CY_RSLT_SUCCESS == cy_rtos_get_queue(&input_queue, &msg, INPUT_POLL_MS, false)) &&
+            navigate((int)msg.value))
+        {
+            app_handoff_post(screen_req, msg.cycles);
+        }
+        poll_console();
+    }
+}
+
+/*******************************************************************************
+* Function Name: render_task
+********************************************************************************
+* Summary:
+*   Owns emWin and the panel, draws the newest requested screen and the
+*   sprite frames of the screen on the panel.
+*
+*******************************************************************************/
+static void render_task(cy_thread_arg_t arg)
+{
+    screen_id_t id;
+    uint32_t since, wait;
+    (void)arg;
+
+    gui_start();
+    for (;;)
+    {
+        /* Between requests the renderer wakes for the sprite frames */
+        wait = lcd_sprite_next_ms();
+        if (!app_handoff_wait((wait == UINT32_MAX) ? CY_RTOS_NEVER_TIMEOUT : wait, &id, &since))
+        {
+            (void)lcd_sprite_poll();
+            continue;
+        }
+        render(id, since);
+    }
+}
+
+/*******************************************************************************
+* Function Name: storage_task
+********************************************************************************
+* Summary:
+*   Runs SD card work in the background, starting with the card size. The
+*   bus is shared with the panel, the renderer waits at most for the sector
+*   in progress.
+*
+*******************************************************************************/
+static void storage_task(cy_thread_arg_t arg)
+{
+    storage_job_t job;
+    (void)arg;
+
+    uint32_t size = cardSize();
+    printf("Card size: %lu\r\n\n", (unsigned long)size);
+
+    for (;;)
+    {
+        if (CY_RSLT_SUCCESS == cy_rtos_get_queue(&storage_queue, &job, CY_RTOS_NEVER_TIMEOUT, false))
+        {
+            job.run(job.arg);
+            if (job.wait)
+                (void)cy_rtos_set_semaphore(&storage_done, false);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: storage_post
+********************************************************************************
+* Summary:
+*   Queues work for the storage task.
+*
+* Parameters:
+*   run: function to call from the storage task
+*   arg: passed to it
+*
+* Return:
+*   false if the queue is full
+*
+*******************************************************************************/
+bool storage_post(void (*run)(void *arg), void *arg)
+{
+    storage_job_t job = { run, arg, false };
+
+    return CY_RSLT_SUCCESS == cy_rtos_put_queue(&storage_queue, &job, 0u, false);
+}
+
+/*******************************************************************************
+* Function Name: storage_call
+********************************************************************************
+* Summary:
+*   Runs work on the storage task and waits for it, for the render task's
+*   snapshot files. One caller at a time.
+*
+* Parameters:
+*   run: function to call from the storage task
+*   arg: passed to it
+*
+* Return:
+*   false if the job could not be queued
+*
+*******************************************************************************/
+bool storage_call(void (*run)(void *arg), void *arg)
+{
+    storage_job_t job = { run, arg, true };
+
+    if (CY_RSLT_SUCCESS != cy_rtos_put_queue(&storage_queue, &job, CY_RTOS_NEVER_TIMEOUT, false))
+        return false;
+    return CY_RSLT_SUCCESS == cy_rtos_get_semaphore(&storage_done, CY_RTOS_NEVER_TIMEOUT, false);
+}
+
+#if (LCD_IDLE_SLEEP)
+/* Nothing ready to run: sleep until the tick or an interrupt */
+void vApplicationIdleHook(void)
+{
+    cyhal_syspm_sleep();
+}
+#endif
+
+void vApplicationStackOverflowHook(TaskHandle_t task, char *name)
+{
+    (void)task;
+    (void)name;
+    CY_ASSERT(0);
+}
+
+void vApplicationMallocFailedHook(void)
+{
+    CY_ASSERT(0);
+}
+#else
+/*******************************************************************************
+* Function Name: storage_post, storage_call
+********************************************************************************
+* Summary:
+*   Without the storage task SD work runs at once, in the caller.
+*
+*******************************************************************************/
+bool storage_post(void (*run)(void *arg), void *arg)
+{
+    run(arg);
+    return true;
+}
+
+bool storage_call(void (*run)(void *arg), void *arg)
+{
+    run(arg);
+    return true;
+}
+#endif
+
 int main(void)
 {
     cy_rslt_t result;
@@ -95,6 +507,12 @@ int main(void)
     /* Initialize retarget-io to use the debug UART port */
     cy_retarget_io_init(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX, CY_RETARGET_IO_BAUDRATE);
 
+#if (LCD_RTOS)
+    /* The callback posts to this queue, it has to exist first */
+    result = cy_rtos_init_queue(&input_queue, INPUT_QUEUE_LEN, sizeof(app_msg_t));
+    handle_error(result);
+#endif
+
     /* Register the Message Callback */
 
 	Cy_IPC_Pipe_RegisterCallback(CY_IPC_EP_CYPIPE_CM4_ADDR,
@@ -106,18 +524,41 @@ int main(void)
 	                                    CYHAL_SPI_MODE_11_MSB,false);
 	handle_error(result);
 
-	result = cyhal_spi_set_frequency(&mSPI, SPI_FREQ_HZ);
+	//LCD and SD card switch the bus to their own clock when they take it,
+	//until then it runs at the identification clock of the card
+	result = spi_bus_init(&mSPI, SD_SPI_INIT_HZ, CYHAL_SPI_MODE_11_MSB);
 	handle_error(result);
 
 	//SD card chip select pin
 	cyhal_gpio_init(CYBSP_D5, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, false);
 
+#if (LCD_RTOS)
+    result = app_handoff_init();
+    handle_error(result);
+    result = cy_rtos_init_semaphore(&storage_done, 1u, 0u);
+    handle_error(result);
+    result = cy_rtos_init_queue(&storage_queue, STORAGE_QUEUE_LEN, sizeof(storage_job_t));
+    handle_error(result);
+
+    result = cy_rtos_create_thread(&input_thread, input_task, "input", NULL,
+                                   INPUT_TASK_STACK, INPUT_TASK_PRIORITY, NULL);
+    handle_error(result);
+    result = cy_rtos_create_thread(&render_thread, render_task, "render", NULL,
+                                   RENDER_TASK_STACK, RENDER_TASK_PRIORITY, NULL);
+    handle_error(result);
+    result = cy_rtos_create_thread(&storage_thread, storage_task, "storage", NULL,
+                                   STORAGE_TASK_STACK, STORAGE_TASK_PRIORITY, NULL);
+    handle_error(result);
+
+    vTaskStartScheduler();
+    /* Only returns if the idle task could not be created */
+    CY_ASSERT(0);
+#else
 	//read the size of the sd card
 	uint32_t size = cardSize();
 	printf("Card size: %d\r\n\n", size);
 
-    GUI_Init();
-    menu_screen();
+    gui_start();
     //cyhal_system_delay_ms(5000);
     //number_screen();
 
@@ -138,47 +579,40 @@ int main(void)
     //GUI_DrawBitmap(&bmball, 220, 141);
     //GUI_DrawBitmap(&bmb, 0, 0);
 
-    int menu = 0, number = 0;
     for (;;)
     {
-        //cyhal_syspm_sleep();
+#if (LCD_IDLE_SLEEP)
+        /* Sleep until the IPC message or the emWin tick. A pending interrupt
+         * ends WFI even while masked, so a message that arrives between the
+         * check and the sleep is not slept through. */
+        __disable_irq();
+        if (!msg_flag)
+        {
+            cyhal_syspm_sleep();
+        }
+        __enable_irq();
+#endif
+
+        poll_console();
+        /* The emWin tick wakes the loop every millisecond */
+        (void)lcd_sprite_poll();
 
         /* Check if a message was received from CM0+ */
         if (msg_flag)
         {
             msg_flag = false;
-            int value = (unsigned int) msg_value;
-            if(value==1) {
-            	if(menu==0) number = 1;
-            	menu++;
-            	if(menu > 25) menu = 25;
-            }
-            else if(value==0) {
-            	if(menu==0){
-            		menu = 3;
-            	    number = 0;
-            	}
-            	menu--;
-            	if(menu < 0) menu = 0;
-            }
-            else if(value > 1){
-            	value = value/10;
-            	menu = value;
-            }
+            LCD_PROF_RECORD(LCD_PROF_WAKE, DWT->CYCCNT - msg_cycles);
             /* Print random number received from CM0+ */
             //printf("Number value = %d\n\r", number);
-            if(menu == 0) menu_screen();
-            else if(menu == 1) number_screen();
-            else if(menu == 2) number?display_number(1, 3):display_a();
-            else if(menu == 3) number?display_number(2, 1):display_b();
-            else if(menu == 4) number?display_number(3, 2):display_c();
-            else if(menu == 5) number?display_number(4, 4):display_d();
-            else if(menu == 6) number?display_number(5, 5):display_e();
-            else if(menu == 7) number?display_number(6, 6):display_f();
+            if (navigate((int)msg_value))
+            {
+                render(screen_req, msg_cycles);
+            }
         }
 
 
     }
+#endif
 }
 
 /*******************************************************************************
@@ -200,11 +634,18 @@ void cm4_msg_callback(uint32_t *msg)
         /* Cast received message to the IPC message structure */
         ipc_recv_msg = (ipc_msg_t *) msg;
 
+#if (LCD_RTOS)
+        /* Hand the message to the input task */
+        app_msg_t m = { ipc_recv_msg->value, DWT->CYCCNT };
+        (void)cy_rtos_put_queue(&input_queue, &m, 0u, true);
+#else
         /* Extract the message value */
         msg_value = ipc_recv_msg->value;
 
         /* Set message flag */
+        msg_cycles = DWT->CYCCNT;
         msg_flag = true;
+#endif
     }
 
 }
@@ -212,37 +653,6 @@ void cm4_msg_callback(uint32_t *msg)
 
 
 
-void display_a(void){
-	GUI_Clear();
-	GUI_DrawBitmap(&bma_apple, 220, 112);
-	GUI_DrawBitmap(&bma, 0, 0);
-}
-
-void display_b(void){
-	GUI_Clear();
-	GUI_DrawBitmap(&bmball, 220, 141);
-    GUI_DrawBitmap(&bmb, 0, 0);
-}
-
-void display_c(void){
-	;
-}
-
-void display_d(void){
-	;
-}
-
-void display_e(void){
-	;
-}
-
-void display_f(void){
-	;
-}
-
-
-
-
 /*
 void start_screen(void) {
   GUI_SetBkColor(GUI_BLACK);
@@ -274,164 +684,5 @@ void start_screen(void) {
 }
 */
 
-void menu_screen(){
-	GUI_SetBkColor(GUI_BLACK);
-	GUI_Clear();
-	GUI_SetColor(GUI_WHITE);
-	GUI_SetFont(&GUI_Font32B_ASCII);
-    //GUI_SetFont(&GUI_Font32B_1);
-	GUI_DispStringHCenterAt("Kids Learning Kit", 160, 20);
-	GUI_SetFont(&GUI_Font8x16);
-	GUI_DispStringHCenterAt("Touch a Capsense Button to Start", 160, 120);
-	//GUI_SetColor(GUI_RED);
-    GUI_FillCircle(70, 175, 30);
-    GUI_FillCircle(240, 175, 30);
-    GUI_SetColor(GUI_BLUE);
-    GUI_FillCircle(70, 175, 25);
-    GUI_FillCircle(240, 175, 25);
-    GUI_SetColor(GUI_WHITE);
-    GUI_SetFont(&GUI_Font20_ASCII);
-    GUI_DispStringHCenterAt("Numbers", 70, 210);
-    GUI_DispStringHCenterAt("Alphabets", 240, 210);
-
-}
-
-
-void number_screen(void){
-   GUI_SetBkColor(GUI_BLACK);
-   GUI_Clear();
-   GUI_SetColor(GUI_WHITE);
-   GUI_SetFont(&GUI_Font32B_ASCII);
-   //GUI_SetFont(&GUI_Font32B_1);
-   //GUI_SetFont(&GUI_Font);
-   GUI_DispStringHCenterAt("Numbers", 160, 20);
-
-   GUI_SetFont(&GUI_Font8x16);
-   GUI_DispStringHCenterAt("Use Slider (>>>) to Change Color", 160, 100);
-   GUI_SetFont(&GUI_Font8x16);
-   GUI_DispStringHCenterAt("Touch Capsense Button to Start", 160, 120);
-
-   GUI_FillCircle(70, 175, 30);
-   GUI_FillCircle(240, 175, 30);
-   GUI_SetColor(GUI_BLUE);
-   GUI_FillCircle(70, 175, 25);
-   GUI_FillCircle(240, 175, 25);
-   GUI_SetColor(GUI_WHITE);
-   GUI_SetFont(&GUI_Font20_ASCII);
-   GUI_DispStringHCenterAt("Next", 70, 210);
-   GUI_DispStringHCenterAt("Back", 240, 210);
-
-}
-
-void display_number(int digit, int color){
-   GUI_SetBkColor(GUI_BLACK);
-   GUI_Clear();
-   switch(color){
-   case 0:
-	   GUI_SetColor(GUI_WHITE);
-	   break;
-   case 1:
-   	   GUI_SetColor(GUI_RED);
-   	   break;
-   case 2:
-   	   GUI_SetColor(GUI_BLUE);
-   	   break;
-   case 3:
-   	   GUI_SetColor(GUI_YELLOW);
-   	   break;
-   case 4:
-   	   GUI_SetColor(GUI_GREEN);
-   	   break;
-   case 5:
-   	   GUI_SetColor(GUI_MAGENTA);
-   	   break;
-   case 6:
-       GUI_SetColor(GUI_GRAY);
-       break;
-   case 7:
-       GUI_SetColor(GUI_CYAN);
-       break;
-   }
-   GUI_SetFont(&GUI_FontD80);
-   GUI_DispDecAt(digit, 30, 30, 1);
-   //GUI_SetColor(GUI_BLUE);
-
-   draw_symbol(digit);
-
-}
-
-void draw_symbol(int digit){
-	switch(digit+1){
-	   case 0:
-		   GUI_SetColor(GUI_WHITE);
-		   break;
-	   case 1:
-	   	   GUI_SetColor(GUI_RED);
-	   	   break;
-	   case 2:
-	   	   GUI_SetColor(GUI_BLUE);
-	   	   break;
-	   case 3:
-	   	   GUI_SetColor(GUI_YELLOW);
-	   	   break;
-	   case 4:
-	   	   GUI_SetColor(GUI_GREEN);
-	   	   break;
-	   case 5:
-	   	   GUI_SetColor(GUI_MAGENTA);
-	   	   break;
-	   case 6:
-	       GUI_SetColor(GUI_CYAN);
-	       break;
-	   }
-	switch(digit){
-	   case 0:
-		   //GUI_DrawCircle(10, 50, 20);
-		   break;
-	   case 1:
-		   GUI_FillCircle(200, 160, 45);
-		   GUI_SetColor(GUI_RED);
-		   GUI_FillCircle(180, 140, 5);
-		   GUI_FillCircle(220, 140, 5);
-		   GUI_FillEllipse(200, 160, 7, 5);
-	   	   break;
-	   case 2:
-		   draw_triangle();
-	   	   break;
-	   case 3:
-		   GUI_FillRect(50, 140, 110, 200);
-		   GUI_FillRect(130, 140, 190, 200);
-		   GUI_FillRect(210, 140, 270, 200);
-	   	   break;
-	   case 4:
-		   GUI_FillCircle(40, 170, 35);
-		   GUI_FillCircle(120, 170, 35);
-		   GUI_FillCircle(200, 170, 35);
-		   GUI_FillCircle(280, 170, 35);
-	   	   break;
-	   case 5:
-		   GUI_FillRect(130, 70, 190, 130);
-		   GUI_FillRect(210, 70, 270, 130);
-		   GUI_FillRect(130, 150, 190, 210);
-		   GUI_FillRect(210, 150, 270, 210);
-		   GUI_FillRect(50, 150, 110, 210);
-	   	   break;
-	   }
-
-}
-
-void draw_triangle(){
-	const GUI_POINT aPoints[] = {
-			      { 40, 20}, //x1, y1
-			      { 0, 20},//x1, y2
-			      { 20, 0} //
-			      };
-	GUI_POINT aEnlargedPoints[GUI_COUNTOF(aPoints)];
-	GUI_EnlargePolygon(aEnlargedPoints, aPoints, GUI_COUNTOF(aPoints), 3 * 5);
-	//GUI_FillPolygon(aPoints, GUI_COUNTOF(aPoints), 140, 110);
-	GUI_FillPolygon(aEnlargedPoints, GUI_COUNTOF(aPoints), 90, 160);
-	GUI_FillPolygon(aEnlargedPoints, GUI_COUNTOF(aPoints), 220, 160);
-}
-
 
 /* [] END OF FILE */
@@ -9,22 +9,212 @@
 #include "cyhal.h"
 #include "cybsp.h"
 #include "mtb_hx8347.h"
+#include "lcd_dma.h"
+#include "lcd_shadow.h"
+#include "lcd_prof.h"
 #include "GUI.h"
+#include <string.h>
 
 
 
 extern cyhal_spi_t mSPI;
 
+static bool lcd_burst_mode = (LCD_SPI_BURST_ENABLE != 0);
+static mtb_hx8347_stats_t lcd_stats;
+
+/* One entry of the power-on register sequence */
+typedef struct
+{
+    uint8_t reg;
+    uint8_t value;
+    uint8_t delay_ms;       /* Settling time after the write */
+} lcd_init_entry_t;
+
+/* Boot timing probe, see mtb_hx8347_get_boot_timing() */
+static struct
+{
+    uint32_t init_start;
+    uint32_t init_cycles;
+    uint32_t first_pixel_cycles;
+    bool first_pixel_seen;
+} lcd_boot;
+
+/* Last programmed GRAM window end registers, see mtb_hx8347_set_window() */
+static uint16_t lcd_win_x1;
+static uint16_t lcd_win_y1;
+static bool lcd_win_valid = false;
+
+/* Orientation and the matching GRAM size, see mtb_hx8347_set_rotation() */
+static mtb_hx8347_rotation_t lcd_rotation = LCD_ROTATION;
+static uint16_t lcd_width = ((LCD_ROTATION) & 1) ? LCD_HEIGHT : LCD_WIDTH;
+static uint16_t lcd_height = ((LCD_ROTATION) & 1) ? LCD_WIDTH : LCD_HEIGHT;
+
+/*
+ * Scan direction per orientation. MV puts logical x on the panel rows, MX and
+ * MY reverse the column and row counters before the exchange.
+ */
+static const uint8_t lcd_madctl[MTB_HX8347_ROTATION_COUNT] =
+{
+    [MTB_HX8347_ROTATION_0]   = LCD_MADCTL_ML | LCD_MADCTL_BGR,
+    [MTB_HX8347_ROTATION_90]  = LCD_MADCTL_MX | LCD_MADCTL_MV | LCD_MADCTL_ML | LCD_MADCTL_BGR,
+    [MTB_HX8347_ROTATION_180] = LCD_MADCTL_MX | LCD_MADCTL_MY | LCD_MADCTL_ML | LCD_MADCTL_BGR,
+    [MTB_HX8347_ROTATION_270] = LCD_MADCTL_MY | LCD_MADCTL_MV | LCD_MADCTL_ML | LCD_MADCTL_BGR,
+};
+
+/* Vertical scroll state, see mtb_hx8347_scroll_to() */
+static bool lcd_scroll_on = false;
+static uint16_t lcd_scroll_offset;
+
+/* Pixel format in register 0x17 and whether flat colours may use 12bpp */
+static uint8_t lcd_colmod = LCD_COLMOD_16BPP;
+static bool lcd_color12 = (LCD_COLOR12_ENABLE != 0);
+
+/* Register selected by the last command byte, the 16-bit port needs it */
+static uint8_t lcd_reg;
+
+/* Mirror of the LCD_DC pin, see __LCD_DC_SET()/__LCD_DC_CLR() */
+uint8_t lcd_dc_level;
+
+/* Shared SPI bus registration, see __LCD_BUS_ACQUIRE() */
+int lcd_bus_id = -1;
+
+static const spi_bus_config_t lcd_bus_config =
+{
+    .name = "lcd",
+    .frequency_hz = LCD_SPI_FREQ_HZ,
+    .mode = CYHAL_SPI_MODE_11_MSB,
+    .cs_pin = LCD_CS_PIN,
+    .drain = lcd_dma_fence,
+};
+
+/* Per-call cycle counters, see mtb_hx8347_get_call_stats() */
+static mtb_hx8347_call_stats_t lcd_calls[MTB_HX8347_CALL_COUNT] =
+{
+    [MTB_HX8347_CALL_COMMAND]        = { "write_command" },
+    [MTB_HX8347_CALL_DATA]           = { "write_data" },
+    [MTB_HX8347_CALL_COMMAND_STREAM] = { "write_command_stream" },
+    [MTB_HX8347_CALL_DATA_STREAM]    = { "write_data_stream" },
+    [MTB_HX8347_CALL_SET_WINDOW]     = { "set_window" },
+    [MTB_HX8347_CALL_FILL_RECT]      = { "fill_rect" },
+};
+
+
+/*******************************************************************************
+ * Starts the Cortex-M4 cycle counter used to time the stream functions.
+ *******************************************************************************/
+static void lcd_cycle_counter_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+
+/*******************************************************************************
+ * Charges the cycles since start to one entry of the per-call counters.
+ *******************************************************************************/
+static inline void lcd_call_end(mtb_hx8347_call_t call, uint32_t start)
+{
+    uint32_t cycles = DWT->CYCCNT - start;
+
+    lcd_calls[call].calls++;
+    lcd_calls[call].cycles += cycles;
+    /* Only the port callbacks, fills and windows have zones of their own */
+    if (call <= MTB_HX8347_CALL_DATA_STREAM)
+    {
+        LCD_PROF_RECORD(LCD_PROF_PORT, cycles);
+    }
+}
+
+
+/*******************************************************************************
+ * Pushes a whole buffer through the SCB TX FIFO. The caller owns LCD_CS and
+ * LCD_DC. lcd_spi_burst_finish() returns once the last bit has left the
+ * shifter, and drops the bytes
+ * clocked back into the RX FIFO so that later cyhal_spi_send() calls see an
+ * empty FIFO.
+ *******************************************************************************/
+static void lcd_spi_burst_finish(void)
+{
+    while (!Cy_SCB_SPI_IsTxComplete(mSPI.base))
+    {
+        /* Wait for the shifter to drain */
+    }
+    Cy_SCB_SPI_ClearRxFifo(mSPI.base);
+    Cy_SCB_SPI_ClearRxFifoStatus(mSPI.base, CY_SCB_SPI_RX_OVERFLOW);
+}
+
+static void lcd_spi_burst(const uint8_t *data, uint32_t num)
+{
+    Cy_SCB_SPI_WriteArrayBlocking(mSPI.base, (void *)data, num);
+    lcd_spi_burst_finish();
+}
+
+
+/*******************************************************************************
+ * Sends a stream with LCD_CS held low, either as one burst or byte by byte,
+ * and updates the traffic counters.
+ *******************************************************************************/
+static void lcd_spi_stream(const uint8_t *data, int num)
+{
+    uint32_t start = DWT->CYCCNT;
+    int i;
+
+    __LCD_BUS_ACQUIRE();
+    __LCD_CS_CLR();
+    if (lcd_burst_mode)
+    {
+        lcd_spi_burst(data, (uint32_t)num);
+        lcd_stats.bursts++;
+    }
+    else
+    {
+        for (i = 0; i < num; i++)
+        {
+            cyhal_spi_send(&mSPI, data[i]);
+        }
+        lcd_stats.hal_calls += (uint32_t)num;
+    }
+    __LCD_CS_SET();
+    __LCD_BUS_RELEASE();
+
+    lcd_stats.bytes += (uint32_t)num;
+    lcd_stats.cycles += DWT->CYCCNT - start;
+}
+
+/*******************************************************************************
+ * Records the time from the start of mtb_hx8347_init() to the first GRAM
+ * write command (0x22).
+ *******************************************************************************/
+static inline void lcd_boot_probe(uint8_t command)
+{
+    if (!lcd_boot.first_pixel_seen && command == 0x22)
+    {
+        lcd_boot.first_pixel_cycles = DWT->CYCCNT - lcd_boot.init_start;
+        lcd_boot.first_pixel_seen = true;
+    }
+}
+
+
 void lcd_write_byte(uint8_t chByte, uint8_t chCmd)
 {
+    lcd_dma_fence();
+    if (!chCmd) {
+        lcd_reg = chByte;
+        lcd_boot_probe(chByte);
+        lcd_shadow_command(chByte);
+    } else {
+        lcd_shadow_data(&chByte, 1u);
+    }
     if (chCmd) {
         __LCD_DC_SET();
     } else {
         __LCD_DC_CLR();
     }
+    __LCD_BUS_ACQUIRE();
     __LCD_CS_CLR();
         cyhal_spi_send(&mSPI, chByte);
     __LCD_CS_SET();
+    __LCD_BUS_RELEASE();
 }
 
 
@@ -32,11 +222,15 @@ void lcd_write_word(uint16_t hwData)
 {
 	uint8_t hval = hwData >> 8;
 	uint8_t lval = hwData & 0xFF;
+    lcd_dma_fence();
+    lcd_shadow_fill(hwData, 1u);
     __LCD_DC_SET();
+    __LCD_BUS_ACQUIRE();
     __LCD_CS_CLR();
         cyhal_spi_send(&mSPI, hval);
         cyhal_spi_send(&mSPI, lval);
     __LCD_CS_SET();
+    __LCD_BUS_RELEASE();
 }
 
 
@@ -44,13 +238,14 @@ void lcd_write_register(uint8_t chRegister, uint8_t chValue)
 {
 	lcd_write_byte(chRegister, LCD_CMD);
 	lcd_write_byte(chValue, LCD_DATA);
+	lcd_stats.reg_writes++;
 }
 
 
 void lcd_set_cursor(uint16_t hwXpos, uint16_t hwYpos)
 {
 
-	if (hwXpos >= LCD_WIDTH || hwYpos >= LCD_HEIGHT) {
+	if (hwXpos >= lcd_width || hwYpos >= lcd_height) {
 				return;
     }
 
@@ -61,32 +256,393 @@ void lcd_set_cursor(uint16_t hwXpos, uint16_t hwYpos)
 
 }
 
+/*******************************************************************************
+ * Programs the GRAM window (column 0x02-0x05, row 0x06-0x09) and opens a GRAM
+ * write with 0x22. Writing the start registers also loads the address
+ * counter, so they always go out. The end registers are skipped when they
+ * still hold the requested values.
+ *******************************************************************************/
+void mtb_hx8347_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	uint32_t call_start = DWT->CYCCNT;
+
+	__LCD_BUS_ACQUIRE();
+	lcd_write_register(0x02, x0 >> 8);
+	lcd_write_register(0x03, x0 & 0xFF); //Column Start
+	if (!lcd_win_valid || lcd_win_x1 != x1) {
+		lcd_write_register(0x04, x1 >> 8);
+		lcd_write_register(0x05, x1 & 0xFF); //Column End
+	} else {
+		lcd_stats.reg_skipped += 2u;
+	}
+	lcd_write_register(0x06, y0 >> 8);
+	lcd_write_register(0x07, y0 & 0xFF); //Row Start
+	if (!lcd_win_valid || lcd_win_y1 != y1) {
+		lcd_write_register(0x08, y1 >> 8);
+		lcd_write_register(0x09, y1 & 0xFF); //Row End
+	} else {
+		lcd_stats.reg_skipped += 2u;
+	}
+	lcd_write_byte(0x22, LCD_CMD);
+
+	lcd_win_x1 = x1;
+	lcd_win_y1 = y1;
+	lcd_win_valid = true;
+	__LCD_BUS_RELEASE();
+	lcd_call_end(MTB_HX8347_CALL_SET_WINDOW, call_start);
+}
+
+
+/*******************************************************************************
+ * Copies a rectangle of wire-order RGB565 pixels into GRAM.
+ *******************************************************************************/
+void mtb_hx8347_blit565(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, const uint8_t *data)
+{
+	if (x0 > x1 || y0 > y1 || x1 >= lcd_width || y1 >= lcd_height) {
+		return;
+	}
+
+	__LCD_BUS_ACQUIRE();
+	mtb_hx8347_select_depth(16);
+	mtb_hx8347_set_window(x0, y0, x1, y1);
+	lcd_shadow_data(data, 2u * (x1 - x0 + 1) * (y1 - y0 + 1));
+	__LCD_DC_SET();
+	lcd_spi_stream(data, 2 * (x1 - x0 + 1) * (y1 - y0 + 1));
+	__LCD_BUS_RELEASE();
+}
+
+
+//fill a rectangle with the specified color.
+void mtb_hx8347_fill_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+	static uint8_t pattern[LCD_FILL_PATTERN_SIZE];
+	static uint16_t pattern_color;
+	static uint8_t pattern_bits;
+	static bool pattern_valid = false;
+	uint32_t pixels, bytes, chunk, size, i;
+	uint32_t start;
+	uint8_t bits;
+	uint16_t c12;
+	uint32_t call_start = DWT->CYCCNT;
+
+	if (x1 >= lcd_width) {
+		x1 = lcd_width - 1;
+	}
+	if (y1 >= lcd_height) {
+		y1 = lcd_height - 1;
+	}
+	if (x0 > x1 || y0 > y1) {
+		return;
+	}
+
+	pixels = (uint32_t)(x1 - x0 + 1) * (uint32_t)(y1 - y0 + 1);
+	bits = (lcd_color12 && (pixels >= LCD_COLOR12_MIN_PIXELS) && lcd_color_fits_444(color)) ? 12u : 16u;
+
+	/* 12bpp repeats every three bytes, 16bpp every two */
+	size = (bits == 12u) ? (LCD_FILL_PATTERN_SIZE / 3u) * 3u : LCD_FILL_PATTERN_SIZE;
+	if (!pattern_valid || pattern_color != color || pattern_bits != bits) {
+		c12 = lcd_rgb565_to_444(color);
+		for (i = 0; i < size; i += (bits == 12u) ? 3u : 2u) {
+			if (bits == 12u) {
+				pattern[i] = c12 >> 4;
+				pattern[i + 1] = ((c12 & 0x0F) << 4) | (c12 >> 8);
+				pattern[i + 2] = c12 & 0xFF;
+			} else {
+				pattern[i] = color >> 8;
+				pattern[i + 1] = color & 0xFF;
+			}
+		}
+		pattern_color = color;
+		pattern_bits = bits;
+		pattern_valid = true;
+	}
+
+	__LCD_BUS_ACQUIRE();
+	mtb_hx8347_select_depth(bits);
+	mtb_hx8347_set_window(x0, y0, x1, y1);
+
+	/*
+	 * An odd pixel count in 12bpp sends one pixel more, the address counter
+	 * wraps and the extra pixel lands on the window start in the same colour.
+	 */
+	bytes = (bits == 12u) ? 3u * ((pixels + 1u) / 2u) : 2u * pixels;
+	lcd_shadow_fill(color, pixels);
+	start = DWT->CYCCNT;
+
+	/* Keep the TX FIFO topped up, only wait for the shifter once at the end */
+	__LCD_DC_SET();
+	__LCD_CS_CLR();
+	for (i = 0; i < bytes; i += chunk) {
+		chunk = ((bytes - i) > size) ? size : (bytes - i);
+		Cy_SCB_SPI_WriteArrayBlocking(mSPI.base, pattern, chunk);
+	}
+	lcd_spi_burst_finish();
+	__LCD_CS_SET();
+	__LCD_BUS_RELEASE();
+
+	lcd_stats.bytes += bytes;
+	lcd_stats.bursts++;
+	if (bits == 12u) {
+		lcd_stats.dense_pixels += pixels;
+	}
+	lcd_stats.cycles += DWT->CYCCNT - start;
+	lcd_call_end(MTB_HX8347_CALL_FILL_RECT, call_start);
+}
+
+
 //clear the lcd with the specified color.
 void lcd_clear_screen(uint16_t hwColor)
 {
-	uint32_t i, wCount = LCD_WIDTH;
-	uint8_t hval = hwColor >> 8;
-	uint8_t lval = hwColor & 0xFF;
-	wCount *= LCD_HEIGHT;
+	mtb_hx8347_fill_rect(0, 0, lcd_width - 1, lcd_height - 1, hwColor);
+}
 
 
-    lcd_set_cursor(0, 0);
-    lcd_write_byte(0x22, LCD_CMD);
+/*******************************************************************************
+ * Selects the pixel format, register 0x17 is only rewritten on a change.
+ *******************************************************************************/
+void mtb_hx8347_select_depth(uint8_t bits)
+{
+	uint8_t colmod = (bits == 12u) ? LCD_COLMOD_12BPP : LCD_COLMOD_16BPP;
+
+	if (colmod != lcd_colmod) {
+		__LCD_BUS_ACQUIRE();
+		lcd_write_register(0x17, colmod);
+		__LCD_BUS_RELEASE();
+		lcd_colmod = colmod;
+		lcd_stats.depth_switches++;
+	}
+}
 
-    __LCD_DC_SET();
+
+void mtb_hx8347_set_color12(bool enable)
+{
+	lcd_color12 = enable;
+}
+
+
+bool mtb_hx8347_get_color12(void)
+{
+	return lcd_color12;
+}
+
+
+/*******************************************************************************
+ * Selects the orientation through the memory access control register.
+ *******************************************************************************/
+void mtb_hx8347_set_rotation(mtb_hx8347_rotation_t rotation)
+{
+	if (rotation >= MTB_HX8347_ROTATION_COUNT) {
+		return;
+	}
+
+	__LCD_BUS_ACQUIRE();
+	lcd_write_register(0x16, lcd_madctl[rotation]);
+	__LCD_BUS_RELEASE();
+
+	lcd_rotation = rotation;
+	lcd_width = (rotation & 1) ? LCD_HEIGHT : LCD_WIDTH;
+	lcd_height = (rotation & 1) ? LCD_WIDTH : LCD_HEIGHT;
+	lcd_win_valid = false;
+
+	/* The start line depends on the direction of the scroll axis */
+	if (lcd_scroll_on) {
+		mtb_hx8347_scroll_to(lcd_scroll_offset);
+	}
+}
+
+
+/*******************************************************************************
+ * Vertical scroll. The panel scrolls along its 320 gate lines, top fixed area
+ * (0x0E-0x0F) and bottom fixed area (0x12-0x13) are left empty so the scroll
+ * area (0x10-0x11) is the whole panel. The start line (0x14-0x15) counts in
+ * physical line order; MX in landscape and MY in upside down portrait run the
+ * logical axis the other way, there the start line is 320 - offset.
+ *******************************************************************************/
+void mtb_hx8347_scroll_enable(bool enable)
+{
+	__LCD_BUS_ACQUIRE();
+	if (enable) {
+		lcd_write_register(0x0E, 0x00);
+		lcd_write_register(0x0F, 0x00);
+		lcd_write_register(0x10, LCD_HEIGHT >> 8);
+		lcd_write_register(0x11, LCD_HEIGHT & 0xFF);
+		lcd_write_register(0x12, 0x00);
+		lcd_write_register(0x13, 0x00);
+		lcd_scroll_on = true;
+		mtb_hx8347_scroll_to(0);
+		lcd_write_register(0x01, LCD_DMC_SCROLL);
+	} else {
+		mtb_hx8347_scroll_to(0);
+		lcd_write_register(0x01, 0x00);
+		lcd_scroll_on = false;
+	}
+	__LCD_BUS_RELEASE();
+}
+
+
+void mtb_hx8347_scroll_to(uint16_t offset)
+{
+	uint16_t line;
+
+	offset %= LCD_HEIGHT;
+	line = offset;
+	if ((lcd_rotation == MTB_HX8347_ROTATION_90 || lcd_rotation == MTB_HX8347_ROTATION_180) && (offset != 0)) {
+		line = LCD_HEIGHT - offset;
+	}
+
+	__LCD_BUS_ACQUIRE();
+	lcd_write_register(0x14, line >> 8);
+	lcd_write_register(0x15, line & 0xFF);
+	__LCD_BUS_RELEASE();
+	lcd_scroll_offset = offset;
+}
+
+
+uint16_t mtb_hx8347_get_scroll_offset(void)
+{
+	return lcd_scroll_offset;
+}
+
+
+uint16_t mtb_hx8347_scroll_map(uint16_t pos)
+{
+	return (uint16_t)((pos + lcd_scroll_offset) % LCD_HEIGHT);
+}
+
+
+mtb_hx8347_rotation_t mtb_hx8347_get_rotation(void)
+{
+	return lcd_rotation;
+}
+
+
+uint16_t mtb_hx8347_get_width(void)
+{
+	return lcd_width;
+}
+
+
+uint16_t mtb_hx8347_get_height(void)
+{
+	return lcd_height;
+}
+
+
+/*
+ * Power-on register sequence. Only the oscillator start, the deep sleep exit,
+ * the 0x1F PON steps and the first display-on step need settling time.
+ */
+static const lcd_init_entry_t lcd_init_table[] =
+{
+    { 0xEA, 0x00, 0 },       //PTBA[15:8]
+    { 0xEB, 0x20, 0 },       //PTBA[7:0]
+    { 0xEC, 0x0C, 0 },       //STBA[15:8]
+    { 0xED, 0xC4, 0 },       //STBA[7:0]
+    { 0xE8, 0x38, 0 },       //OPON[7:0]
+    { 0xE9, 0x10, 0 },       //OPON1[7:0]
+    { 0xF1, 0x01, 0 },       //OTPS1B
+    { 0xF2, 0x10, 0 },       //GEN
+    //Gamma 2.2 Setting
+    { 0x40, 0x01, 0 },
+    { 0x41, 0x00, 0 },
+    { 0x42, 0x00, 0 },
+    { 0x43, 0x10, 0 },
+    { 0x44, 0x0E, 0 },
+    { 0x45, 0x24, 0 },
+    { 0x46, 0x04, 0 },
+    { 0x47, 0x50, 0 },
+    { 0x48, 0x02, 0 },
+    { 0x49, 0x13, 0 },
+    { 0x4A, 0x19, 0 },
+    { 0x4B, 0x19, 0 },
+    { 0x4C, 0x16, 0 },
+    { 0x50, 0x1B, 0 },
+    { 0x51, 0x31, 0 },
+    { 0x52, 0x2F, 0 },
+    { 0x53, 0x3F, 0 },
+    { 0x54, 0x3F, 0 },
+    { 0x55, 0x3E, 0 },
+    { 0x56, 0x2F, 0 },
+    { 0x57, 0x7B, 0 },
+    { 0x58, 0x09, 0 },
+    { 0x59, 0x06, 0 },
+    { 0x5A, 0x06, 0 },
+    { 0x5B, 0x0C, 0 },
+    { 0x5C, 0x1D, 0 },
+    { 0x5D, 0xCC, 0 },
+    //Power Voltage Setting
+    { 0x1B, 0x1B, 0 },       //VRH=4.65V
+    { 0x1A, 0x01, 0 },       //BT (VGH~15V,VGL~-10V,DDVDH~5V)
+    { 0x24, 0x2F, 0 },       //VMH(VCOM High voltage ~3.2V)
+    { 0x25, 0x57, 0 },       //VML(VCOM Low voltage -1.2V)
+    //VCOM offset
+    { 0x23, 0x88, 0 },       //for Flicker adjust //can reload from OTP
+    //Power on Setting
+    { 0x18, 0x34, 0 },       //I/P_RADJ,N/P_RADJ, Normal mode 60Hz
+    { 0x19, 0x01, 5 },       //OSC_EN='1', start Osc
+    { 0x01, 0x00, 5 },       //DP_STB='0', out deep sleep
+    { 0x1F, 0x88, 5 },       // GAS=1, VOMG=00, PON=0, DK=1, XDK=0, DVDH_TRI=0, STB=0
+    { 0x1F, 0x80, 5 },       // GAS=1, VOMG=00, PON=0, DK=0, XDK=0, DVDH_TRI=0, STB=0
+    { 0x1F, 0x90, 5 },       // GAS=1, VOMG=00, PON=1, DK=0, XDK=0, DVDH_TRI=0, STB=0
+    { 0x1F, 0xD0, 5 },       // GAS=1, VOMG=10, PON=1, DK=0, XDK=0, DDVDH_TRI=0, STB=0
+    //262k/65k color selection
+    { 0x17, 0x05, 0 },       //default 0x06 262k color // 0x05 65k color
+    //SET PANEL
+    { 0x36, 0x00, 0 },       //SS_P, GS_P,REV_P,BGR_P
+    //Display ON Setting
+    { 0x28, 0x38, 5 },       //GON=1, DTE=1, D=1000
+    { 0x28, 0x3F, 0 },       //GON=1, DTE=1, D=1100
+    //Memory access control (0x16) follows, see mtb_hx8347_set_rotation()
+    //Set GRAM Area
+    { 0x02, 0x00, 0 },
+    { 0x03, 0x00, 0 },       //Column Start
+    { 0x04, 0x00, 0 },
+    { 0x05, 0xEF, 0 },       //Column End
+    { 0x06, 0x00, 0 },
+    { 0x07, 0x00, 0 },       //Row Start
+    { 0x08, 0x01, 0 },
+    { 0x09, 0x3F, 0 },       //Row End
+};
+
+
+/*******************************************************************************
+ * Sends a register/value table with LCD_CS held low for the whole sequence.
+ * LCD_DC only changes once the previous byte has left the shifter.
+ *******************************************************************************/
+static void lcd_write_register_table(const lcd_init_entry_t *table, uint32_t num)
+{
+    uint32_t i;
+
+    __LCD_BUS_ACQUIRE();
     __LCD_CS_CLR();
-    for (i = 0; i < wCount; i ++) {
-        cyhal_spi_send(&mSPI, hval);
-        cyhal_spi_send(&mSPI, lval);
+    for (i = 0; i < num; i++)
+    {
+        lcd_shadow_command(table[i].reg);
+        lcd_shadow_data(&table[i].value, 1u);
+        __LCD_DC_CLR();
+        lcd_spi_burst(&table[i].reg, 1u);
+        __LCD_DC_SET();
+        lcd_spi_burst(&table[i].value, 1u);
+        if (table[i].delay_ms != 0u)
+        {
+            cyhal_system_delay_ms(table[i].delay_ms);
+        }
     }
     __LCD_CS_SET();
+    __LCD_BUS_RELEASE();
 
+    lcd_stats.reg_writes += num;
 }
 
 
 void mtb_hx8347_init(void)
 {
+    lcd_cycle_counter_init();
+    lcd_boot.init_start = DWT->CYCCNT;
+    lcd_boot.first_pixel_seen = false;
+
     __LCD_DC_OUT();
+    lcd_dc_level = 0u;
     __LCD_DC_SET();
 
     __LCD_CS_OUT();
@@ -95,140 +651,15 @@ void mtb_hx8347_init(void)
     __LCD_BL_OUT();
     __LCD_BL_OFF();
 
-    __LCD_DC_CLR();
-    __LCD_CS_CLR();
+    if (lcd_bus_id < 0)
+    {
+        lcd_bus_id = spi_bus_register(&lcd_bus_config);
+    }
 
-
-    lcd_write_register(0xEA,0x00); //PTBA[15:8]
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0xEB,0x20); //PTBA[7:0]
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0xEC,0x0C); //STBA[15:8]
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0xED,0xC4); //STBA[7:0]
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0xE8,0x38); //OPON[7:0]
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0xE9,0x10); //OPON1[7:0]
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0xF1,0x01); //OTPS1B
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0xF2,0x10); //GEN
-    cyhal_system_delay_ms(5);
-    //Gamma 2.2 Setting
-    lcd_write_register(0x40,0x01); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x41,0x00); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x42,0x00); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x43,0x10); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x44,0x0E); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x45,0x24); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x46,0x04); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x47,0x50); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x48,0x02); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x49,0x13); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x4A,0x19); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x4B,0x19); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x4C,0x16); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x50,0x1B); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x51,0x31); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x52,0x2F); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x53,0x3F); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x54,0x3F); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x55,0x3E); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x56,0x2F); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x57,0x7B); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x58,0x09); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x59,0x06); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x5A,0x06); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x5B,0x0C); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x5C,0x1D); //
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x5D,0xCC); //
-    cyhal_system_delay_ms(5);
-    //Power Voltage Setting
-    lcd_write_register(0x1B,0x1B); //VRH=4.65V
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x1A,0x01); //BT (VGH~15V,VGL~-10V,DDVDH~5V)
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x24,0x2F); //VMH(VCOM High voltage ~3.2V)
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x25,0x57); //VML(VCOM Low voltage -1.2V)
-    cyhal_system_delay_ms(5);
-    //VCOM offset
-    lcd_write_register(0x23,0x88); //for Flicker adjust //can reload from OTP
-    cyhal_system_delay_ms(5);
-    //Power on Setting
-    lcd_write_register(0x18,0x34); //I/P_RADJ,N/P_RADJ, Normal mode 60Hz
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x19,0x01); //OSC_EN='1', start Osc
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x01,0x00); //DP_STB='0', out deep sleep
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x1F,0x88);// GAS=1, VOMG=00, PON=0, DK=1, XDK=0, DVDH_TRI=0, STB=0
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x1F,0x80);// GAS=1, VOMG=00, PON=0, DK=0, XDK=0, DVDH_TRI=0, STB=0
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x1F,0x90);// GAS=1, VOMG=00, PON=1, DK=0, XDK=0, DVDH_TRI=0, STB=0
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x1F,0xD0);// GAS=1, VOMG=10, PON=1, DK=0, XDK=0, DDVDH_TRI=0, STB=0
-    cyhal_system_delay_ms(5);
-    //262k/65k color selection
-    lcd_write_register(0x17,0x05); //default 0x06 262k color // 0x05 65k color
-    cyhal_system_delay_ms(5);
-    //SET PANEL
-    lcd_write_register(0x36,0x00); //SS_P, GS_P,REV_P,BGR_P
-    cyhal_system_delay_ms(5);
-    //Display ON Setting
-    lcd_write_register(0x28,0x38); //GON=1, DTE=1, D=1000
-    cyhal_system_delay_ms(5);
-    //delay(40);
-    lcd_write_register(0x28,0x3F); //GON=1, DTE=1, D=1100
-    cyhal_system_delay_ms(5);
-
-    lcd_write_register(0x16,0x18);
-    cyhal_system_delay_ms(5);
-    //Set GRAM Area
-    lcd_write_register(0x02,0x00);
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x03,0x00); //Column Start
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x04,0x00);
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x05,0xEF); //Column End
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x06,0x00);
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x07,0x00); //Row Start
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x08,0x01);
-    cyhal_system_delay_ms(5);
-    lcd_write_register(0x09,0x3F); //Row End
-    cyhal_system_delay_ms(5);
+    lcd_dma_fence();
+    lcd_write_register_table(lcd_init_table, sizeof(lcd_init_table) / sizeof(lcd_init_table[0]));
+    lcd_colmod = LCD_COLMOD_16BPP;
+    mtb_hx8347_set_rotation(lcd_rotation);
 
     //lcd_clear_screen(WHITE);
     //lcd_clear_screen(GUI_WHITE);
@@ -236,6 +667,7 @@ void mtb_hx8347_init(void)
 
     __LCD_BL_ON();
 
+    lcd_boot.init_cycles = DWT->CYCCNT - lcd_boot.init_start;
 }
 
 
@@ -244,12 +676,27 @@ void mtb_hx8347_init(void)
  *******************************************************************************/
 void mtb_hx8347_write_command(uint8_t data)
 {
+	uint32_t call_start = DWT->CYCCNT;
+
+	lcd_dma_fence();
+	/* GUIDRV_FlexColor programs its own windows and always sends 16bpp */
+	lcd_win_valid = false;
+	if (data == 0x22) {
+		mtb_hx8347_select_depth(16);
+	}
+	lcd_reg = data;
+	lcd_boot_probe(data);
+	lcd_shadow_command(data);
 
 	__LCD_DC_CLR();
 
+	__LCD_BUS_ACQUIRE();
 	__LCD_CS_CLR();
 	cyhal_spi_send(&mSPI, data);
 	__LCD_CS_SET();
+	__LCD_BUS_RELEASE();
+	lcd_stats.hal_calls++;
+	lcd_call_end(MTB_HX8347_CALL_COMMAND, call_start);
 }
 
 
@@ -258,12 +705,20 @@ void mtb_hx8347_write_command(uint8_t data)
  *******************************************************************************/
 void mtb_hx8347_write_data(uint8_t data)
 {
+	uint32_t call_start = DWT->CYCCNT;
+
+	lcd_dma_fence();
+	lcd_shadow_data(&data, 1u);
 
 	__LCD_DC_SET();
 
+    __LCD_BUS_ACQUIRE();
     __LCD_CS_CLR();
     cyhal_spi_send(&mSPI, data);
     __LCD_CS_SET();
+    __LCD_BUS_RELEASE();
+    lcd_stats.hal_calls++;
+    lcd_call_end(MTB_HX8347_CALL_DATA, call_start);
 }
 
 
@@ -273,16 +728,23 @@ void mtb_hx8347_write_data(uint8_t data)
  *******************************************************************************/
 void mtb_hx8347_write_command_stream(uint8_t *data, int num)
 {
-    int i;
+    uint32_t call_start = DWT->CYCCNT;
 
-    __LCD_DC_CLR();
-
-    __LCD_CS_CLR();
-    for (i = 0; i < num; i++)
+    lcd_dma_fence();
+    lcd_win_valid = false;
+    if ((num > 0) && (data[num - 1] == 0x22))
     {
-    	cyhal_spi_send(&mSPI, data[i]);
+        mtb_hx8347_select_depth(16);
     }
-    __LCD_CS_SET();
+    for (int i = 0; i < num; i++)
+    {
+        lcd_shadow_command(data[i]);
+        lcd_reg = data[i];
+    }
+    __LCD_DC_CLR();
+
+    lcd_spi_stream(data, num);
+    lcd_call_end(MTB_HX8347_CALL_COMMAND_STREAM, call_start);
 }
 
 
@@ -292,17 +754,85 @@ void mtb_hx8347_write_command_stream(uint8_t *data, int num)
  *******************************************************************************/
 void mtb_hx8347_write_data_stream(uint8_t *data, int num)
 {
-	int i;
+	uint32_t call_start = DWT->CYCCNT;
 
+	lcd_dma_fence();
+	lcd_shadow_data(data, (uint32_t)num);
 	__LCD_DC_SET();
 
-	__LCD_CS_CLR();
-	for (i = 0; i < num; i++)
-	{
-	    cyhal_spi_send(&mSPI, data[i]);
-	    //cyhal_spi_transfer(&mSPI, (const uint8_t*)data, num, NULL, 0, 0);
+	lcd_spi_stream(data, num);
+	lcd_call_end(MTB_HX8347_CALL_DATA_STREAM, call_start);
+}
+
+
+/*******************************************************************************
+ * 16-bit port command write, the register index is the low byte.
+ *******************************************************************************/
+void mtb_hx8347_write_command16(uint16_t command)
+{
+	mtb_hx8347_write_command((uint8_t)command);
+}
+
+
+/*******************************************************************************
+ * 16-bit port data write. Pixels go out as one two-byte frame, register
+ * values as their low byte.
+ *******************************************************************************/
+void mtb_hx8347_write_data16(uint16_t data)
+{
+	uint32_t call_start;
+	uint8_t wire[2];
+
+	if (lcd_reg != 0x22) {
+		mtb_hx8347_write_data((uint8_t)data);
+		return;
 	}
-	__LCD_CS_SET();
+
+	call_start = DWT->CYCCNT;
+	lcd_dma_fence();
+	wire[0] = (uint8_t)(data >> 8);
+	wire[1] = (uint8_t)data;
+	lcd_shadow_data(wire, 2u);
+	__LCD_DC_SET();
+
+	lcd_spi_stream(wire, 2);
+	lcd_call_end(MTB_HX8347_CALL_DATA, call_start);
+}
+
+
+/*******************************************************************************
+ * 16-bit port multi-pixel write. The pixels are swapped into wire order a
+ * chunk at a time and each chunk goes out as one burst.
+ *******************************************************************************/
+void mtb_hx8347_write_data16_stream(uint16_t *data, int num)
+{
+	static uint8_t wire[LCD_FILL_PATTERN_SIZE];
+	uint32_t call_start = DWT->CYCCNT;
+	int chunk, i;
+
+	if (lcd_reg != 0x22) {
+		for (i = 0; i < num; i++) {
+			mtb_hx8347_write_data((uint8_t)data[i]);
+		}
+		return;
+	}
+
+	lcd_dma_fence();
+	__LCD_DC_SET();
+	__LCD_BUS_ACQUIRE();
+	while (num > 0) {
+		chunk = (num > (int)(sizeof(wire) / 2u)) ? (int)(sizeof(wire) / 2u) : num;
+		for (i = 0; i < chunk; i++) {
+			wire[2 * i] = (uint8_t)(data[i] >> 8);
+			wire[2 * i + 1] = (uint8_t)data[i];
+		}
+		lcd_shadow_data(wire, 2u * (uint32_t)chunk);
+		lcd_spi_stream(wire, 2 * chunk);
+		data += chunk;
+		num -= chunk;
+	}
+	__LCD_BUS_RELEASE();
+	lcd_call_end(MTB_HX8347_CALL_DATA_STREAM, call_start);
 }
 
 
@@ -312,10 +842,15 @@ void mtb_hx8347_write_data_stream(uint8_t *data, int num)
  *******************************************************************************/
 uint8_t mtb_hx8347_read_data(void)
 {
+#if (LCD_SHADOW_ENABLE)
+	uint8_t data;
 
+	lcd_shadow_read(&data, 1u);
+	return data;
+#else
 	CY_ASSERT(0);
 	return 0;
-
+#endif
 }
 
 
@@ -328,8 +863,42 @@ void mtb_hx8347_read_data_stream(uint8_t *data, int num)
 
 	//cyhal_gpio_init(CYBSP_USER_LED, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, CYBSP_LED_STATE_OFF);
     //cyhal_gpio_write(CYBSP_USER_LED, 0);
+#if (LCD_SHADOW_ENABLE)
+	lcd_shadow_read(data, (uint32_t)num);
+#else
+	CY_ASSERT(0);
+#endif
+
+}
+
+
+/*******************************************************************************
+ * 16-bit port reads. Served by the shadow like the 8-bit ones, the dummy read
+ * after 0x22 is a whole word on this port.
+ *******************************************************************************/
+uint16_t mtb_hx8347_read_data16(void)
+{
+#if (LCD_SHADOW_ENABLE)
+	uint16_t data;
+
+	lcd_shadow_read16(&data, 1u);
+	return data;
+#else
 	CY_ASSERT(0);
+	return 0;
+#endif
+}
 
+
+void mtb_hx8347_read_data16_stream(uint16_t *data, int num)
+{
+#if (LCD_SHADOW_ENABLE)
+	lcd_shadow_read16(data, (uint32_t)num);
+#else
+	(void)data;
+	(void)num;
+	CY_ASSERT(0);
+#endif
 }
 
 
@@ -338,6 +907,7 @@ void mtb_hx8347_read_data_stream(uint8_t *data, int num)
  *******************************************************************************/
 void mtb_hx8347_free(void)
 {
+    lcd_dma_fence();
     cyhal_gpio_free(LCD_DC_PIN);
     cyhal_gpio_free(LCD_CS_PIN);
     cyhal_gpio_free(LCD_BL_PIN);
@@ -345,6 +915,73 @@ void mtb_hx8347_free(void)
 
 }
 
+/*******************************************************************************
+ * Selects burst or per-byte transfers for the stream functions.
+ *******************************************************************************/
+void mtb_hx8347_set_burst_mode(bool enable)
+{
+    lcd_burst_mode = enable;
+}
+
+
+/*******************************************************************************
+ * Copies the SPI traffic counters.
+ *******************************************************************************/
+void mtb_hx8347_get_stats(mtb_hx8347_stats_t *stats)
+{
+    *stats = lcd_stats;
+}
+
+
+/*******************************************************************************
+ * Returns the per-call cycle counters.
+ *******************************************************************************/
+const mtb_hx8347_call_stats_t *mtb_hx8347_get_call_stats(void)
+{
+    return lcd_calls;
+}
+
+
+/*******************************************************************************
+ * Clears the SPI traffic and per-call counters.
+ *******************************************************************************/
+void mtb_hx8347_reset_stats(void)
+{
+    uint32_t i;
+
+    memset(&lcd_stats, 0, sizeof(lcd_stats));
+    for (i = 0; i < MTB_HX8347_CALL_COUNT; i++)
+    {
+        lcd_calls[i].calls = 0u;
+        lcd_calls[i].cycles = 0u;
+    }
+}
+
+
+/*******************************************************************************
+ * Returns the stream throughput in bytes per second.
+ *******************************************************************************/
+uint32_t mtb_hx8347_get_bytes_per_second(void)
+{
+    if (lcd_stats.cycles == 0u)
+    {
+        return 0u;
+    }
+    return (uint32_t)(((uint64_t)lcd_stats.bytes * SystemCoreClock) / lcd_stats.cycles);
+}
+
+/*******************************************************************************
+ * Returns the duration of mtb_hx8347_init() and the time from its start to
+ * the first GRAM write.
+ *******************************************************************************/
+void mtb_hx8347_get_boot_timing(uint32_t *init_us, uint32_t *first_pixel_us)
+{
+    uint32_t cycles_per_us = SystemCoreClock / 1000000u;
+
+    *init_us = lcd_boot.init_cycles / cycles_per_us;
+    *first_pixel_us = lcd_boot.first_pixel_seen ? (lcd_boot.first_pixel_cycles / cycles_per_us) : 0u;
+}
+
 /*
 cy_rslt_t MTB_E2271CS021_WriteSPIBuffer(uint8_t* data, uint16_t dataLength)
 {
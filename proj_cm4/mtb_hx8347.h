@@ -11,6 +11,7 @@
 #include "cy_result.h"
 #include "cyhal.h"
 #include "cybsp.h"
+#include "spi_bus.h"
 
 
 #if defined(__cplusplus)
@@ -33,18 +34,156 @@ extern "C"
 #define LCD_DC_PIN CYBSP_D7
 #define LCD_CS_PIN CYBSP_D10
 
+/* Set to 0 to fall back to one cyhal_spi_send() call per byte */
+#ifndef LCD_SPI_BURST_ENABLE
+#define LCD_SPI_BURST_ENABLE        1
+#endif
+
+/*
+ * SCLK while the LCD owns the shared SPI bus. The HX8347 serial write cycle
+ * is specified at 100 ns, raise this from the Makefile if the panel keeps up.
+ */
+#ifndef LCD_SPI_FREQ_HZ
+#define LCD_SPI_FREQ_HZ             (10000000UL)
+#endif
+
+/*
+ * Port width GUIDRV_FlexColor is configured for: 8 (M16C0B8, one callback per
+ * byte) or 16 (M16C0B16, whole pixels and pixel arrays per callback).
+ */
+#ifndef LCD_PORT_WIDTH
+#define LCD_PORT_WIDTH              8
+#endif
+
+/* Memory access control (register 0x16) bits */
+#define LCD_MADCTL_MY               (0x80u)     /* Row address order */
+#define LCD_MADCTL_MX               (0x40u)     /* Column address order */
+#define LCD_MADCTL_MV               (0x20u)     /* Row/column exchange */
+#define LCD_MADCTL_ML               (0x10u)     /* Vertical refresh order */
+#define LCD_MADCTL_BGR              (0x08u)
+
+/* Pixel formats of register 0x17 */
+#define LCD_COLMOD_12BPP            (0x03u)     /* 4k colours, two pixels in three bytes */
+#define LCD_COLMOD_16BPP            (0x05u)     /* 65k colours */
+
+/*
+ * Set to 1 to send flat colours in the 12bpp format. Only colours that the
+ * panel shows identically in both formats are sent dense, so the picture
+ * does not change.
+ */
+#ifndef LCD_COLOR12_ENABLE
+#define LCD_COLOR12_ENABLE          0
+#endif
+
+/* Pixels below which the two 0x17 writes cost more than 12bpp saves */
+#define LCD_COLOR12_MIN_PIXELS      (32u)
+
+/* Display mode control (register 0x01) bits */
+#define LCD_DMC_SCROLL              (0x08u)     /* Vertical scroll on */
+
+/* Orientation selected by mtb_hx8347_init(), see mtb_hx8347_rotation_t */
+#ifndef LCD_ROTATION
+#define LCD_ROTATION                MTB_HX8347_ROTATION_90
+#endif
+
+/* Bytes of repeated colour pushed per FIFO write by the fill primitive */
+#define LCD_FILL_PATTERN_SIZE       (128u)
+
 
 #define __LCD_CS_OUT()      cyhal_gpio_init(LCD_CS_PIN, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, false)
 #define __LCD_DC_OUT()      cyhal_gpio_init(LCD_DC_PIN, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, false)
 #define __LCD_BL_OUT()      cyhal_gpio_init(LCD_BL_PIN, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_STRONG, false)
 
-#define __LCD_CS_CLR()      cyhal_gpio_write(LCD_CS_PIN, false)
-#define __LCD_CS_SET()      cyhal_gpio_write(LCD_CS_PIN, true)
-#define __LCD_DC_CLR()      cyhal_gpio_write(LCD_DC_PIN, false)
-#define __LCD_DC_SET()      cyhal_gpio_write(LCD_DC_PIN, true)
+/*
+ * CS and DC are driven straight through the port registers, the HAL GPIO
+ * calls cost more than the SPI byte they frame. DC is only written when the
+ * command/data phase changes, lcd_dc_level mirrors the pin.
+ */
+extern uint8_t lcd_dc_level;
+
+#define __LCD_CS_CLR()      Cy_GPIO_Clr(CYHAL_GET_PORTADDR(LCD_CS_PIN), CYHAL_GET_PIN(LCD_CS_PIN))
+#define __LCD_CS_SET()      Cy_GPIO_Set(CYHAL_GET_PORTADDR(LCD_CS_PIN), CYHAL_GET_PIN(LCD_CS_PIN))
+#define __LCD_DC_CLR()      do { if (lcd_dc_level != 0u) { Cy_GPIO_Clr(CYHAL_GET_PORTADDR(LCD_DC_PIN), CYHAL_GET_PIN(LCD_DC_PIN)); lcd_dc_level = 0u; } } while (0)
+#define __LCD_DC_SET()      do { if (lcd_dc_level == 0u) { Cy_GPIO_Set(CYHAL_GET_PORTADDR(LCD_DC_PIN), CYHAL_GET_PIN(LCD_DC_PIN)); lcd_dc_level = 1u; } } while (0)
+
+/* Every CS-framed LCD transfer runs with the shared SPI bus acquired */
+extern int lcd_bus_id;
+
+#define __LCD_BUS_ACQUIRE() spi_bus_acquire(lcd_bus_id)
+#define __LCD_BUS_RELEASE() spi_bus_release(lcd_bus_id)
+
+/*
+ * RGB565 to the 12bpp wire format and back, the panel widens a 4-bit
+ * channel by repeating its top bits.
+ */
+static inline uint16_t lcd_rgb565_to_444(uint16_t c)
+{
+    return (uint16_t)(((c >> 4) & 0x0F00u) | ((c >> 3) & 0x00F0u) | ((c >> 1) & 0x000Fu));
+}
+
+static inline uint16_t lcd_rgb444_to_565(uint16_t c)
+{
+    uint16_t r = (c >> 8) & 0x0Fu, g = (c >> 4) & 0x0Fu, b = c & 0x0Fu;
+
+    return (uint16_t)((((r << 1) | (r >> 3)) << 11) | (((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3)));
+}
+
+/* True if the panel shows the colour the same in 12bpp and 16bpp mode */
+static inline bool lcd_color_fits_444(uint16_t c)
+{
+    return lcd_rgb444_to_565(lcd_rgb565_to_444(c)) == c;
+}
+
 #define __LCD_BL_OFF()		cyhal_gpio_write(LCD_BL_PIN, false)
 #define __LCD_BL_ON()		cyhal_gpio_write(LCD_BL_PIN, true)
 
+/** SPI traffic counters kept by the driver */
+typedef struct
+{
+    uint32_t bytes;         /**< Bytes sent by the stream functions */
+    uint32_t bursts;        /**< Streams sent as one CS-held FIFO burst */
+    uint32_t hal_calls;     /**< Per-byte cyhal_spi_send() calls */
+    uint32_t cycles;        /**< CPU cycles spent inside the stream functions */
+    uint32_t reg_writes;    /**< Register writes, two bytes each on the wire */
+    uint32_t reg_skipped;   /**< Window register writes saved by the cache */
+    uint32_t depth_switches;/**< Pixel format (0x17) changes */
+    uint32_t dense_pixels;  /**< Pixels sent in the 12bpp format */
+} mtb_hx8347_stats_t;
+
+/** Driver entry points timed by the per-call cycle counters */
+typedef enum
+{
+    MTB_HX8347_CALL_COMMAND,
+    MTB_HX8347_CALL_DATA,
+    MTB_HX8347_CALL_COMMAND_STREAM,
+    MTB_HX8347_CALL_DATA_STREAM,
+    MTB_HX8347_CALL_SET_WINDOW,
+    MTB_HX8347_CALL_FILL_RECT,
+    MTB_HX8347_CALL_COUNT
+} mtb_hx8347_call_t;
+
+/**
+ * Panel orientations, applied by the controller scan direction (register
+ * 0x16). Window and pixel coordinates are always given in the selected
+ * orientation, so a logical row is one contiguous GRAM write.
+ */
+typedef enum
+{
+    MTB_HX8347_ROTATION_0,      /**< Portrait, 240x320, logical (x, y) on panel column x, row y */
+    MTB_HX8347_ROTATION_90,     /**< Landscape, 320x240, logical (x, y) on panel column y, row 319 - x */
+    MTB_HX8347_ROTATION_180,    /**< Portrait, upside down, logical (x, y) on panel column 239 - x, row 319 - y */
+    MTB_HX8347_ROTATION_270,    /**< Landscape, upside down, logical (x, y) on panel column 239 - y, row x */
+    MTB_HX8347_ROTATION_COUNT
+} mtb_hx8347_rotation_t;
+
+/** Per-call cycle counters */
+typedef struct
+{
+    const char *name;       /**< Function name for the profiling output */
+    uint32_t calls;         /**< Number of calls since the last reset */
+    uint32_t cycles;        /**< CPU cycles spent in those calls */
+} mtb_hx8347_call_stats_t;
+
 /**
 * \addtogroup group_board_libs TFT Display
 * \{
@@ -96,6 +235,42 @@ void mtb_hx8347_write_command_stream(uint8_t *data, int num);
  */
 void mtb_hx8347_write_data_stream(uint8_t *data, int num);
 
+/**
+ * 16-bit port command write. The HX8347 register index is 8 bits wide, only
+ * the low byte is sent.
+ * @param[in] command The command to issue to the display
+ */
+void mtb_hx8347_write_command16(uint16_t command);
+
+/**
+ * 16-bit port data write. A pixel (GRAM selected with 0x22) goes out as two
+ * bytes, high byte first. Register values are 8 bits wide, only the low byte
+ * is sent.
+ * @param[in] data The value to issue to the display
+ */
+void mtb_hx8347_write_data16(uint16_t data);
+
+/**
+ * 16-bit port multi-pixel write. Converts the pixels to wire order and sends
+ * them in CS-held bursts.
+ * @param[in] data Pointer to the pixels to send to the display
+ * @param[in] num  The number of pixels in the data array
+ */
+void mtb_hx8347_write_data16_stream(uint16_t *data, int num);
+
+/**
+ * 16-bit port read, see mtb_hx8347_read_data().
+ * @return The pixel read from the display
+ */
+uint16_t mtb_hx8347_read_data16(void);
+
+/**
+ * 16-bit port multi-pixel read, see mtb_hx8347_read_data_stream().
+ * @param[in,out]   data Pointer to where to store the pixels
+ * @param[in]       num  The number of pixels to read
+ */
+void mtb_hx8347_read_data16_stream(uint16_t *data, int num);
+
 /**
  * Reads one byte of data from the software i8080 interface with the LCD_DC pin
  * set to 1.
@@ -116,6 +291,153 @@ void mtb_hx8347_read_data_stream(uint8_t *data, int num);
  */
 void mtb_hx8347_free(void);
 
+/**
+ * Selects the orientation. Rewrites the scan direction register and forgets
+ * the cached window, GRAM content stays where it is on the glass.
+ * @param[in] rotation One of mtb_hx8347_rotation_t
+ */
+void mtb_hx8347_set_rotation(mtb_hx8347_rotation_t rotation);
+
+/**
+ * Returns the selected orientation.
+ * @return One of mtb_hx8347_rotation_t
+ */
+mtb_hx8347_rotation_t mtb_hx8347_get_rotation(void);
+
+/**
+ * Returns the width of the panel in the selected orientation.
+ * @return 240 in portrait, 320 in landscape
+ */
+uint16_t mtb_hx8347_get_width(void);
+
+/**
+ * Returns the height of the panel in the selected orientation.
+ * @return 320 in portrait, 240 in landscape
+ */
+uint16_t mtb_hx8347_get_height(void);
+
+/**
+ * Selects the pixel format for the next GRAM write. Register 0x17 is only
+ * written when the format changes, so it must be called before the window
+ * is opened.
+ * @param[in] bits 12 or 16
+ */
+void mtb_hx8347_select_depth(uint8_t bits);
+
+/**
+ * Allows or forbids the 12bpp format for flat colours at runtime.
+ * @param[in] enable true to send fitting colours dense
+ */
+void mtb_hx8347_set_color12(bool enable);
+
+/**
+ * Returns whether flat colours may go out in the 12bpp format.
+ * @return true if enabled
+ */
+bool mtb_hx8347_get_color12(void);
+
+/**
+ * Turns the panel's vertical scroll on or off. The scroll area is the whole
+ * 320 line gate axis: logical x in landscape, logical y in portrait. Turning
+ * it off returns to offset 0.
+ * @param[in] enable true to scroll
+ */
+void mtb_hx8347_scroll_enable(bool enable);
+
+/**
+ * Sets the scroll offset along the 320 line axis. The pixel shown at
+ * position p of that axis is read from GRAM position (p + offset) % 320, see
+ * mtb_hx8347_scroll_map(). GRAM addressing is not affected.
+ * @param[in] offset 0..319, in the selected orientation
+ */
+void mtb_hx8347_scroll_to(uint16_t offset);
+
+/**
+ * Returns the scroll offset last set with mtb_hx8347_scroll_to().
+ * @return 0..319
+ */
+uint16_t mtb_hx8347_get_scroll_offset(void);
+
+/**
+ * Maps a position on the glass along the scroll axis to the GRAM position it
+ * shows at the current offset.
+ * @param[in] pos 0..319
+ * @return GRAM position 0..319
+ */
+uint16_t mtb_hx8347_scroll_map(uint16_t pos);
+
+/**
+ * Programs the GRAM window and opens a GRAM write (0x22). The end registers
+ * are only rewritten when they differ from the last programmed window.
+ * @param[in] x0    Left column (coordinates in the selected orientation)
+ * @param[in] y0    Top row
+ * @param[in] x1    Right column, inclusive
+ * @param[in] y1    Bottom row, inclusive
+ */
+void mtb_hx8347_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+/**
+ * Copies a rectangle of pixels into GRAM in one CS-held burst.
+ * @param[in] x0    Left column (coordinates in the selected orientation)
+ * @param[in] y0    Top row
+ * @param[in] x1    Right column, inclusive
+ * @param[in] y1    Bottom row, inclusive
+ * @param[in] data  RGB565 pixels, high byte first, row by row
+ */
+void mtb_hx8347_blit565(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, const uint8_t *data);
+
+/**
+ * Fills a rectangle of the panel with one colour. Programs the full GRAM
+ * window and streams the colour with the TX FIFO kept full, instead of one
+ * HAL call per byte. Colours that fit 12bpp go out in three bytes per two
+ * pixels when that format is enabled.
+ * @param[in] x0    Left column (coordinates in the selected orientation)
+ * @param[in] y0    Top row
+ * @param[in] x1    Right column, inclusive
+ * @param[in] y1    Bottom row, inclusive
+ * @param[in] color RGB565 colour as sent on the wire
+ */
+void mtb_hx8347_fill_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+
+/**
+ * Selects how the stream functions push data: whole buffers through the SCB
+ * FIFO with LCD_CS held low, or one blocking HAL call per byte.
+ * @param[in] enable true for burst transfers
+ */
+void mtb_hx8347_set_burst_mode(bool enable);
+
+/**
+ * Copies the SPI traffic counters collected since the last reset.
+ * @param[out] stats Where to store the counters
+ */
+void mtb_hx8347_get_stats(mtb_hx8347_stats_t *stats);
+
+/**
+ * Returns the per-call cycle counters, indexed by mtb_hx8347_call_t.
+ * @return Array of MTB_HX8347_CALL_COUNT entries
+ */
+const mtb_hx8347_call_stats_t *mtb_hx8347_get_call_stats(void);
+
+/**
+ * Clears the SPI traffic and per-call counters.
+ */
+void mtb_hx8347_reset_stats(void);
+
+/**
+ * Returns the stream throughput measured since the last counter reset.
+ * @return Bytes per second, 0 if nothing has been sent yet
+ */
+uint32_t mtb_hx8347_get_bytes_per_second(void);
+
+/**
+ * Boot timing probe. Reports how long mtb_hx8347_init() took and how long it
+ * was from its start until the first GRAM write (the first pixel).
+ * @param[out] init_us        Duration of the init sequence in microseconds
+ * @param[out] first_pixel_us Time to the first pixel in microseconds, 0 if
+ *                            nothing has been drawn yet
+ */
+void mtb_hx8347_get_boot_timing(uint32_t *init_us, uint32_t *first_pixel_us);
+
 /** \} group_board_libs */
 
 void lcd_write_byte(uint8_t chByte, uint8_t chCmd);
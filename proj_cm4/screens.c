@@ -0,0 +1,442 @@
+/*
+ * screens.c
+ *
+ *  Screen table and the drawing code of each screen, see screens.h.
+ */
+
+#include "cy_pdl.h"
+#include "screens.h"
+#include "lcd_band.h"
+#include "lcd_bitmap.h"
+#include "lcd_dlist.h"
+#include "lcd_scroll.h"
+#include "lcd_snap.h"
+#include "lcd_sprite.h"
+#include "GUI.h"
+
+
+extern GUI_CONST_STORAGE GUI_BITMAP bma_apple_rle;
+extern GUI_CONST_STORAGE GUI_BITMAP bma_rle;
+extern GUI_CONST_STORAGE GUI_BITMAP bmball_rle;
+extern GUI_CONST_STORAGE GUI_BITMAP bmb_rle;
+
+typedef struct {
+   int digit;
+   int color;
+} number_args_t;
+
+static void menu_draw(void *p);
+static void number_draw(void *p);
+static void display_a_draw(void *p);
+static void display_b_draw(void *p);
+static void display_b_back_draw(void *p);
+static void display_number_draw(void *p);
+static int number_regions(const void *p, lcd_region_t *regions);
+static void draw_symbol(int digit);
+static void draw_triangle(void);
+
+/* The static screens take no parameters, so the version of their drawing
+ * stands for their inputs in the snapshot hash. Bump it with any change to
+ * what menu_screen() and number_screen() put on the panel: their layout,
+ * colours, fonts or the display list that draws them. */
+static const uint32_t screen_draw_version = 1u;
+
+/* Digit and colour of each number lesson */
+static const number_args_t number_args[] = {
+   { 1, 3 }, { 2, 1 }, { 3, 2 }, { 4, 4 }, { 5, 5 }, { 6, 6 },
+};
+
+/* The ball of letter B bounces right of the letter, decoded into the arena
+ * when the screen comes up */
+static const screen_anim_t letter_b_anim = {
+   display_b_back_draw, &bmball_rle, 220, 141, -3, -4, { 130, 0, 319, 239 },
+};
+
+#define NUMBER_LESSON(n, back, next) \
+    [SCREEN_NUMBER_##n] = { "number_" #n, SCREEN_KIND_NUMBER, display_number_draw, \
+                            &number_args[(n) - 1], number_regions, { NULL, NULL }, \
+                            (back), (next), 0u }
+
+/* Static screens snapshot under their id. The letter lessons warm the
+ * palettes of the letter they lead to; the palette cache holds
+ * LCD_BITMAP_CACHE_SIZE, two lessons' worth, so only one neighbour each */
+static const screen_t screen_table[SCREEN_COUNT] =
+{
+    [SCREEN_MENU]     = { "menu", SCREEN_KIND_STATIC, menu_draw, NULL, NULL, { NULL, NULL },
+                          SCREEN_LETTER_A, SCREEN_NUMBERS, SCREEN_PREFETCH_BACK },
+    [SCREEN_NUMBERS]  = { "numbers", SCREEN_KIND_STATIC, number_draw, NULL, NULL, { NULL, NULL },
+                          SCREEN_MENU, SCREEN_NUMBER_1, 0u },
+    [SCREEN_LETTER_A] = { "letter_a", SCREEN_KIND_LETTER, display_a_draw, NULL, NULL,
+                          { &bma_apple_rle, &bma_rle },
+                          SCREEN_MENU, SCREEN_LETTER_B, SCREEN_PREFETCH_NEXT },
+    [SCREEN_LETTER_B] = { "letter_b", SCREEN_KIND_LETTER, display_b_draw, NULL, NULL,
+                          { &bmball_rle, &bmb_rle },
+                          SCREEN_LETTER_A, SCREEN_NONE, SCREEN_PREFETCH_BACK, &letter_b_anim },
+    NUMBER_LESSON(1, SCREEN_NUMBERS,  SCREEN_NUMBER_2),
+    NUMBER_LESSON(2, SCREEN_NUMBER_1, SCREEN_NUMBER_3),
+    NUMBER_LESSON(3, SCREEN_NUMBER_2, SCREEN_NUMBER_4),
+    NUMBER_LESSON(4, SCREEN_NUMBER_3, SCREEN_NUMBER_5),
+    NUMBER_LESSON(5, SCREEN_NUMBER_4, SCREEN_NUMBER_6),
+    NUMBER_LESSON(6, SCREEN_NUMBER_5, SCREEN_NONE),
+};
+
+/* Screen on the panel, SCREEN_NONE before the first */
+static screen_id_t screen_shown = SCREEN_NONE;
+
+
+/*******************************************************************************
+ * Returns a table entry.
+ *******************************************************************************/
+const screen_t *screen_get(screen_id_t id)
+{
+    return &screen_table[((unsigned)id < SCREEN_COUNT) ? id : SCREEN_MENU];
+}
+
+
+/*******************************************************************************
+ * Maps a screen number from the CM0+ to the table: the lessons of one kind
+ * are numbered from 2 in table order.
+ *******************************************************************************/
+screen_id_t screen_pick(screen_id_t from, int index)
+{
+    screen_kind_t kind = screen_get(from)->kind;
+    screen_id_t id, last = SCREEN_MENU;
+
+    if (index <= 0)
+    {
+        return SCREEN_MENU;
+    }
+    if (index == 1)
+    {
+        return SCREEN_NUMBERS;
+    }
+    if (from == SCREEN_NUMBERS)
+    {
+        kind = SCREEN_KIND_NUMBER;
+    }
+    else if (kind == SCREEN_KIND_STATIC)
+    {
+        kind = SCREEN_KIND_LETTER;
+    }
+
+    for (id = SCREEN_MENU; id < SCREEN_COUNT; id++)
+    {
+        if (screen_table[id].kind == kind)
+        {
+            last = id;
+            if (--index < 2)
+            {
+                break;
+            }
+        }
+    }
+    return last;
+}
+
+
+/*******************************************************************************
+ * Puts a screen on the panel, the way its kind and the screen before ask for.
+ *******************************************************************************/
+void screen_show(screen_id_t id)
+{
+    const screen_t *s = screen_get(id);
+    void *data = (void *)s->data;
+    lcd_region_t regions[LCD_REGION_MAX];
+    bool same = (screen_shown < SCREEN_COUNT) && (screen_table[screen_shown].kind == s->kind);
+
+    id = (screen_id_t)(s - screen_table);
+    lcd_sprite_stop();
+    if (!same || (s->regions == NULL))
+    {
+        lcd_region_invalidate();
+    }
+
+    if (s->kind == SCREEN_KIND_STATIC)
+    {
+        lcd_snap_show((unsigned)id, s->draw, data, &screen_draw_version, sizeof(screen_draw_version));
+    }
+    else if (s->regions != NULL)
+    {
+        lcd_region_show((int)s->kind, regions, s->regions(s->data, regions), s->draw, data);
+    }
+    else if (same && (id != screen_shown))
+    {
+        lcd_scroll_slide(s->draw, data, (id > screen_shown) ? LCD_SCROLL_FORWARD : LCD_SCROLL_BACK);
+    }
+    else
+    {
+        lcd_band_draw(s->draw, data);
+    }
+    screen_shown = id;
+
+    if (s->anim != NULL)
+    {
+        lcd_sprite_begin(s->anim->background, data);
+        (void)lcd_sprite_add(s->anim->bitmap, s->anim->x, s->anim->y,
+                             s->anim->dx, s->anim->dy, &s->anim->bounds);
+    }
+}
+
+
+/*******************************************************************************
+ * Converts the palettes of a screen's bitmaps into the lcd_bitmap cache.
+ *******************************************************************************/
+static void screen_preload(screen_id_t id)
+{
+    const screen_t *s = screen_get(id);
+    int i;
+
+    for (i = 0; i < SCREEN_ASSETS; i++)
+    {
+        if ((s->assets[i] != NULL) && (s->assets[i]->pPal != NULL))
+        {
+            (void)lcd_bitmap_get_trans(s->assets[i]->pPal);
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Loads the assets of the neighbours named by the prefetch hints.
+ *******************************************************************************/
+void screen_prefetch(screen_id_t id)
+{
+    const screen_t *s = screen_get(id);
+
+    if (((s->prefetch & SCREEN_PREFETCH_BACK) != 0u) && (s->back != SCREEN_NONE))
+    {
+        screen_preload((screen_id_t)s->back);
+    }
+    if (((s->prefetch & SCREEN_PREFETCH_NEXT) != 0u) && (s->next != SCREEN_NONE))
+    {
+        screen_preload((screen_id_t)s->next);
+    }
+}
+
+
+static void menu_draw(void *p){
+	(void)p;
+	menu_screen();
+}
+
+static void number_draw(void *p){
+	(void)p;
+	number_screen();
+}
+
+static void display_a_draw(void *p){
+	(void)p;
+	GUI_Clear();
+	GUI_DrawBitmap(&bma_apple_rle, 220, 112);
+	GUI_DrawBitmap(&bma_rle, 0, 0);
+}
+
+static void display_b_back_draw(void *p){
+	(void)p;
+	GUI_Clear();
+    GUI_DrawBitmap(&bmb_rle, 0, 0);
+}
+
+static void display_b_draw(void *p){
+	display_b_back_draw(p);
+	GUI_DrawBitmap(&bmball_rle, 220, 141);
+}
+
+void menu_screen(void){
+	lcd_dlist_begin();
+	GUI_SetBkColor(GUI_BLACK);
+	lcd_dlist_clear();
+	GUI_SetColor(GUI_WHITE);
+	GUI_SetFont(&GUI_Font32B_ASCII);
+    //GUI_SetFont(&GUI_Font32B_1);
+	lcd_dlist_text_hcenter("Kids Learning Kit", 160, 20);
+	GUI_SetFont(&GUI_Font8x16);
+	lcd_dlist_text_hcenter("Touch a Capsense Button to Start", 160, 120);
+	//GUI_SetColor(GUI_RED);
+    lcd_dlist_fill_circle(70, 175, 30);
+    lcd_dlist_fill_circle(240, 175, 30);
+    GUI_SetColor(GUI_BLUE);
+    lcd_dlist_fill_circle(70, 175, 25);
+    lcd_dlist_fill_circle(240, 175, 25);
+    GUI_SetColor(GUI_WHITE);
+    GUI_SetFont(&GUI_Font20_ASCII);
+    lcd_dlist_text_hcenter("Numbers", 70, 210);
+    lcd_dlist_text_hcenter("Alphabets", 240, 210);
+    lcd_dlist_end();
+}
+
+
+void number_screen(void){
+   lcd_dlist_begin();
+   GUI_SetBkColor(GUI_BLACK);
+   lcd_dlist_clear();
+   GUI_SetColor(GUI_WHITE);
+   GUI_SetFont(&GUI_Font32B_ASCII);
+   //GUI_SetFont(&GUI_Font32B_1);
+   //GUI_SetFont(&GUI_Font);
+   lcd_dlist_text_hcenter("Numbers", 160, 20);
+
+   GUI_SetFont(&GUI_Font8x16);
+   lcd_dlist_text_hcenter("Use Slider (>>>) to Change Color", 160, 100);
+   GUI_SetFont(&GUI_Font8x16);
+   lcd_dlist_text_hcenter("Touch Capsense Button to Start", 160, 120);
+
+   lcd_dlist_fill_circle(70, 175, 30);
+   lcd_dlist_fill_circle(240, 175, 30);
+   GUI_SetColor(GUI_BLUE);
+   lcd_dlist_fill_circle(70, 175, 25);
+   lcd_dlist_fill_circle(240, 175, 25);
+   GUI_SetColor(GUI_WHITE);
+   GUI_SetFont(&GUI_Font20_ASCII);
+   lcd_dlist_text_hcenter("Next", 70, 210);
+   lcd_dlist_text_hcenter("Back", 240, 210);
+   lcd_dlist_end();
+}
+
+static void display_number_draw(void *p){
+   const number_args_t *args = p;
+   int digit = args->digit;
+   int color = args->color;
+
+   GUI_SetBkColor(GUI_BLACK);
+   GUI_Clear();
+   switch(color){
+   case 0:
+	   GUI_SetColor(GUI_WHITE);
+	   break;
+   case 1:
+   	   GUI_SetColor(GUI_RED);
+   	   break;
+   case 2:
+   	   GUI_SetColor(GUI_BLUE);
+   	   break;
+   case 3:
+   	   GUI_SetColor(GUI_YELLOW);
+   	   break;
+   case 4:
+   	   GUI_SetColor(GUI_GREEN);
+   	   break;
+   case 5:
+   	   GUI_SetColor(GUI_MAGENTA);
+   	   break;
+   case 6:
+       GUI_SetColor(GUI_GRAY);
+       break;
+   case 7:
+       GUI_SetColor(GUI_CYAN);
+       break;
+   }
+   GUI_SetFont(&GUI_FontD80);
+   GUI_DispDecAt(digit, 30, 30, 1);
+   //GUI_SetColor(GUI_BLUE);
+
+   draw_symbol(digit);
+
+}
+
+/* Area of the symbol under each digit, see draw_symbol() */
+static const GUI_RECT number_symbol_rect[] = {
+   [1] = { 155, 115, 245, 205 },
+   [2] = {  48, 134, 302, 199 },
+   [3] = {  50, 140, 270, 200 },
+   [4] = {   5, 135, 315, 205 },
+   [5] = {  50,  70, 270, 210 },
+};
+
+/* Regions of a number screen: the digit, keyed by digit and colour, and the
+ * symbol, which only depends on the digit */
+static int number_regions(const void *p, lcd_region_t *regions){
+   const number_args_t *args = p;
+   const GUI_FONT *font = GUI_SetFont(&GUI_FontD80);
+   int n = 1;
+
+   regions[0].rect.x0 = 30;
+   regions[0].rect.y0 = 30;
+   regions[0].rect.x1 = (I16)(30 + GUI_GetCharDistX((U16)('0' + args->digit)) - 1);
+   regions[0].rect.y1 = (I16)(30 + GUI_GetFontSizeY() - 1);
+   regions[0].key = (uint32_t)args->digit | ((uint32_t)args->color << 8);
+   GUI_SetFont(font);
+
+   if(args->digit >= 1 && args->digit < (int)GUI_COUNTOF(number_symbol_rect)){
+      regions[1].rect = number_symbol_rect[args->digit];
+      regions[1].key = (uint32_t)args->digit;
+      n++;
+   }
+   return n;
+}
+
+static void draw_symbol(int digit){
+	switch(digit+1){
+	   case 0:
+		   GUI_SetColor(GUI_WHITE);
+		   break;
+	   case 1:
+	   	   GUI_SetColor(GUI_RED);
+	   	   break;
+	   case 2:
+	   	   GUI_SetColor(GUI_BLUE);
+	   	   break;
+	   case 3:
+	   	   GUI_SetColor(GUI_YELLOW);
+	   	   break;
+	   case 4:
+	   	   GUI_SetColor(GUI_GREEN);
+	   	   break;
+	   case 5:
+	   	   GUI_SetColor(GUI_MAGENTA);
+	   	   break;
+	   case 6:
+	       GUI_SetColor(GUI_CYAN);
+	       break;
+	   }
+	switch(digit){
+	   case 0:
+		   //GUI_DrawCircle(10, 50, 20);
+		   break;
+	   case 1:
+		   GUI_FillCircle(200, 160, 45);
+		   GUI_SetColor(GUI_RED);
+		   GUI_FillCircle(180, 140, 5);
+		   GUI_FillCircle(220, 140, 5);
+		   GUI_FillEllipse(200, 160, 7, 5);
+	   	   break;
+	   case 2:
+		   draw_triangle();
+	   	   break;
+	   case 3:
+		   GUI_FillRect(50, 140, 110, 200);
+		   GUI_FillRect(130, 140, 190, 200);
+		   GUI_FillRect(210, 140, 270, 200);
+	   	   break;
+	   case 4:
+		   GUI_FillCircle(40, 170, 35);
+		   GUI_FillCircle(120, 170, 35);
+		   GUI_FillCircle(200, 170, 35);
+		   GUI_FillCircle(280, 170, 35);
+	   	   break;
+	   case 5:
+		   GUI_FillRect(130, 70, 190, 130);
+		   GUI_FillRect(210, 70, 270, 130);
+		   GUI_FillRect(130, 150, 190, 210);
+		   GUI_FillRect(210, 150, 270, 210);
+		   GUI_FillRect(50, 150, 110, 210);
+	   	   break;
+	   }
+
+}
+
+static void draw_triangle(void){
+	const GUI_POINT aPoints[] = {
+			      { 40, 20}, //x1, y1
+			      { 0, 20},//x1, y2
+			      { 20, 0} //
+			      };
+	GUI_POINT aEnlargedPoints[GUI_COUNTOF(aPoints)];
+	GUI_EnlargePolygon(aEnlargedPoints, aPoints, GUI_COUNTOF(aPoints), 3 * 5);
+	//GUI_FillPolygon(aPoints, GUI_COUNTOF(aPoints), 140, 110);
+	GUI_FillPolygon(aEnlargedPoints, GUI_COUNTOF(aPoints), 90, 160);
+	GUI_FillPolygon(aEnlargedPoints, GUI_COUNTOF(aPoints), 220, 160);
+}
+
+
+/* [] END OF FILE */
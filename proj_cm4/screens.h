@@ -0,0 +1,143 @@
+/*
+ * screens.h
+ *
+ *  The screens of the learning kit as one const table. An entry says how the
+ *  screen is drawn, which regions of it change from one screen of its kind to
+ *  the next, which bitmaps it draws and where Next and Back lead. Showing a
+ *  screen is an index into the table; a new lesson is a new entry.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "GUI.h"
+#include "lcd_region.h"
+#include "lcd_sprite.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Bitmaps listed per screen for preloading */
+#define SCREEN_ASSETS               (2)
+
+/* Arena bytes the animation of any one screen takes, see LCD_SPRITE_BYTES;
+ * the most is the 100x99 ball of letter B */
+#if (LCD_SPRITE_ENABLE)
+#define SCREEN_SPRITE_BYTES         LCD_SPRITE_BYTES(100u, 99u)
+#else
+#define SCREEN_SPRITE_BYTES         (0u)
+#endif
+
+/* Prefetch hints, neighbours whose assets are loaded once a screen is up */
+#define SCREEN_PREFETCH_BACK        (1u << 0)
+#define SCREEN_PREFETCH_NEXT        (1u << 1)
+
+/** Screens, in table order */
+typedef enum
+{
+    SCREEN_MENU,            /**< Start screen */
+    SCREEN_NUMBERS,         /**< Introduction to the numbers */
+    SCREEN_LETTER_A,
+    SCREEN_LETTER_B,
+    SCREEN_NUMBER_1,
+    SCREEN_NUMBER_2,
+    SCREEN_NUMBER_3,
+    SCREEN_NUMBER_4,
+    SCREEN_NUMBER_5,
+    SCREEN_NUMBER_6,
+    SCREEN_COUNT,
+    SCREEN_NONE = 0xFF      /**< No screen, where Next leads on the last lesson */
+} screen_id_t;
+
+/** Screen kinds. Moving within a kind slides or repaints regions */
+typedef enum
+{
+    SCREEN_KIND_STATIC,     /**< Drawn straight, snapshot on the SD card */
+    SCREEN_KIND_LETTER,     /**< Letter lessons, slide into each other */
+    SCREEN_KIND_NUMBER      /**< Number lessons, repaint what changed */
+} screen_kind_t;
+
+/** Sprite a screen sets bouncing once it is up, see lcd_sprite.h */
+typedef struct
+{
+    void (*background)(void *data); /**< The screen without the sprite */
+    const GUI_BITMAP *bitmap;       /**< 8bpp, the one draw puts there */
+    int x, y;                       /**< Where draw puts it */
+    int dx, dy;                     /**< Pixels per frame */
+    GUI_RECT bounds;                /**< Area it bounces in */
+} screen_anim_t;
+
+/** One entry of the screen table */
+typedef struct
+{
+    const char *name;               /**< For the benchmark and the log */
+    screen_kind_t kind;             /**< How the screen goes on the panel */
+    void (*draw)(void *data);       /**< Draws the whole screen, the lcd_band_draw() contract */
+    const void *data;               /**< Passed to draw and regions */
+    /** Regions of the screen, NULL if it is always drawn whole
+     *  @return Number of regions stored, at most LCD_REGION_MAX */
+    int (*regions)(const void *data, lcd_region_t *regions);
+    const GUI_BITMAP *assets[SCREEN_ASSETS];    /**< Bitmaps drawn, NULL when fewer */
+    uint8_t back;                   /**< screen_id_t of the Back button, SCREEN_NONE if it does nothing */
+    uint8_t next;                   /**< screen_id_t of the Next button, SCREEN_NONE if it does nothing */
+    uint8_t prefetch;               /**< SCREEN_PREFETCH_* */
+    const screen_anim_t *anim;      /**< Animation, NULL for a still screen */
+} screen_t;
+
+
+/**
+ * Returns a table entry.
+ * @param[in] id Screen
+ * @return Entry, never NULL; ids past the table give the start screen
+ */
+const screen_t *screen_get(screen_id_t id);
+
+/**
+ * Maps a screen number picked directly by the CM0+ to the table: 0 is the
+ * start screen, 1 the numbers introduction and from 2 on the lessons of the
+ * kind that is being shown, clamped to the last one.
+ * @param[in] from  Screen shown or requested so far
+ * @param[in] index Screen number
+ * @return Screen
+ */
+screen_id_t screen_pick(screen_id_t from, int index);
+
+/**
+ * Puts a screen on the panel. Static screens are replayed from their snapshot
+ * or drawn, a letter lesson slides in from the letter before, a number lesson
+ * repaints the regions that differ from the number before and anything else
+ * is drawn whole. The animation of the screen before stops, the one of this
+ * screen starts.
+ * @param[in] id Screen
+ */
+void screen_show(screen_id_t id);
+
+/**
+ * Loads the palettes of the bitmaps on the neighbours named by the prefetch
+ * hints of a screen, so the next lesson does not convert them on its first
+ * band. Meant for after the screen is up and before the user moves on.
+ * @param[in] id Screen on the panel
+ */
+void screen_prefetch(screen_id_t id);
+
+/**
+ * Draws the start screen straight to the panel, for the benchmark.
+ */
+void menu_screen(void);
+
+/**
+ * Draws the numbers introduction straight to the panel, for the benchmark.
+ */
+void number_screen(void);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,255 @@
+/*
+ * spi_bus.c
+ *
+ *  Arbitration of the shared SPI block, see spi_bus.h.
+ */
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "spi_bus.h"
+
+#include <string.h>
+
+#if (LCD_RTOS)
+#include "cyabs_rtos.h"
+#endif
+
+
+typedef struct
+{
+    const spi_bus_config_t *config;
+    uint32_t frequency_hz;
+    uint32_t depth;             /* Nesting level of spi_bus_acquire() */
+    uint32_t start;             /* CYCCNT at the outermost acquisition */
+    spi_bus_stats_t stats;
+} spi_bus_device_t;
+
+static cyhal_spi_t *spi_bus_spi;
+static uint32_t spi_bus_frequency_hz;
+static cyhal_spi_mode_t spi_bus_mode;
+
+static spi_bus_device_t spi_bus_devices[SPI_BUS_MAX_DEVICES];
+static int spi_bus_count;
+static int spi_bus_owner = -1;
+
+#if (LCD_RTOS)
+/* Held from the outermost acquisition to the matching release, so a device
+ * driven from another task waits for the transfer in progress */
+static cy_mutex_t spi_bus_mutex;
+#endif
+
+
+/*******************************************************************************
+ * Sets the starting clock and records the state of the SPI block.
+ *******************************************************************************/
+cy_rslt_t spi_bus_init(cyhal_spi_t *spi, uint32_t frequency_hz, cyhal_spi_mode_t mode)
+{
+    cy_rslt_t result = cyhal_spi_set_frequency(spi, frequency_hz);
+
+    spi_bus_spi = spi;
+    spi_bus_frequency_hz = frequency_hz;
+    spi_bus_mode = mode;
+    spi_bus_owner = -1;
+#if (LCD_RTOS)
+    (void)cy_rtos_init_mutex(&spi_bus_mutex);
+#endif
+    return result;
+}
+
+
+/*******************************************************************************
+ * Adds a device to the table.
+ *******************************************************************************/
+int spi_bus_register(const spi_bus_config_t *config)
+{
+    spi_bus_device_t *dev;
+
+    if (spi_bus_count >= SPI_BUS_MAX_DEVICES)
+    {
+        return -1;
+    }
+    dev = &spi_bus_devices[spi_bus_count];
+    memset(dev, 0, sizeof(*dev));
+    dev->config = config;
+    dev->frequency_hz = config->frequency_hz;
+    return spi_bus_count++;
+}
+
+
+/*******************************************************************************
+ * Changes the clock of a device. The owner switches at once, between two of
+ * its own bytes, anyone else picks it up at the next ownership change.
+ *******************************************************************************/
+void spi_bus_set_frequency(int id, uint32_t frequency_hz)
+{
+    if ((id < 0) || (id >= spi_bus_count))
+    {
+        return;
+    }
+    spi_bus_devices[id].frequency_hz = frequency_hz;
+    if ((spi_bus_owner == id) && (spi_bus_spi != NULL) && (frequency_hz != spi_bus_frequency_hz))
+    {
+        while (!Cy_SCB_SPI_IsTxComplete(spi_bus_spi->base))
+        {
+            /* Let the last byte out at the old clock */
+        }
+        if (CY_RSLT_SUCCESS == cyhal_spi_set_frequency(spi_bus_spi, frequency_hz))
+        {
+            spi_bus_frequency_hz = frequency_hz;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Sets CPOL/CPHA. The SCB has to be disabled while SPI_CTRL changes.
+ *******************************************************************************/
+static void spi_bus_set_mode(cyhal_spi_mode_t mode)
+{
+    uint32_t ctrl = SCB_SPI_CTRL(spi_bus_spi->base) & ~(SCB_SPI_CTRL_CPHA_Msk | SCB_SPI_CTRL_CPOL_Msk);
+
+    switch (mode)
+    {
+        case CYHAL_SPI_MODE_01_MSB:
+        case CYHAL_SPI_MODE_01_LSB:
+            ctrl |= SCB_SPI_CTRL_CPHA_Msk;
+            break;
+        case CYHAL_SPI_MODE_10_MSB:
+        case CYHAL_SPI_MODE_10_LSB:
+            ctrl |= SCB_SPI_CTRL_CPOL_Msk;
+            break;
+        case CYHAL_SPI_MODE_11_MSB:
+        case CYHAL_SPI_MODE_11_LSB:
+            ctrl |= SCB_SPI_CTRL_CPHA_Msk | SCB_SPI_CTRL_CPOL_Msk;
+            break;
+        default:
+            break;
+    }
+
+    Cy_SCB_SPI_Disable(spi_bus_spi->base, &spi_bus_spi->context);
+    SCB_SPI_CTRL(spi_bus_spi->base) = ctrl;
+    Cy_SCB_SPI_Enable(spi_bus_spi->base);
+}
+
+
+/*******************************************************************************
+ * Lets the previous owner finish and programs the block for a new owner.
+ *******************************************************************************/
+static void spi_bus_switch(int id)
+{
+    spi_bus_device_t *dev = &spi_bus_devices[id];
+    uint32_t start = DWT->CYCCNT;
+
+    if ((spi_bus_owner >= 0) && (spi_bus_devices[spi_bus_owner].config->drain != NULL))
+    {
+        spi_bus_devices[spi_bus_owner].config->drain();
+    }
+
+    if (spi_bus_spi != NULL)
+    {
+        while (!Cy_SCB_SPI_IsTxComplete(spi_bus_spi->base))
+        {
+            /* Last byte of the previous owner still in the shifter */
+        }
+        if (dev->config->mode != spi_bus_mode)
+        {
+            spi_bus_set_mode(dev->config->mode);
+            spi_bus_mode = dev->config->mode;
+        }
+        if (dev->frequency_hz != spi_bus_frequency_hz)
+        {
+            if (CY_RSLT_SUCCESS == cyhal_spi_set_frequency(spi_bus_spi, dev->frequency_hz))
+            {
+                spi_bus_frequency_hz = dev->frequency_hz;
+            }
+        }
+    }
+
+    spi_bus_owner = id;
+    dev->stats.switches++;
+    dev->stats.switch_cycles += DWT->CYCCNT - start;
+}
+
+
+/*******************************************************************************
+ * Takes the bus for a device.
+ *******************************************************************************/
+void spi_bus_acquire(int id)
+{
+    spi_bus_device_t *dev;
+
+    if ((id < 0) || (id >= spi_bus_count))
+    {
+        return;
+    }
+    dev = &spi_bus_devices[id];
+    if (dev->depth++ != 0u)
+    {
+        return;
+    }
+#if (LCD_RTOS)
+    (void)cy_rtos_get_mutex(&spi_bus_mutex, CY_RTOS_NEVER_TIMEOUT);
+#endif
+
+    /* Only one device can be inside a transfer at a time */
+    CY_ASSERT((spi_bus_owner < 0) || (spi_bus_owner == id) || (spi_bus_devices[spi_bus_owner].depth == 0u));
+
+    if (spi_bus_owner != id)
+    {
+        spi_bus_switch(id);
+    }
+    dev->stats.acquisitions++;
+    dev->start = DWT->CYCCNT;
+}
+
+
+/*******************************************************************************
+ * Ends the innermost acquisition of a device.
+ *******************************************************************************/
+void spi_bus_release(int id)
+{
+    spi_bus_device_t *dev;
+
+    if ((id < 0) || (id >= spi_bus_count))
+    {
+        return;
+    }
+    dev = &spi_bus_devices[id];
+    if ((dev->depth != 0u) && (--dev->depth == 0u))
+    {
+        dev->stats.busy_cycles += DWT->CYCCNT - dev->start;
+#if (LCD_RTOS)
+        (void)cy_rtos_set_mutex(&spi_bus_mutex);
+#endif
+    }
+}
+
+
+/*******************************************************************************
+ * Copies the counters of one device.
+ *******************************************************************************/
+const char *spi_bus_get_stats(int id, spi_bus_stats_t *stats)
+{
+    if ((id < 0) || (id >= spi_bus_count))
+    {
+        return NULL;
+    }
+    *stats = spi_bus_devices[id].stats;
+    return spi_bus_devices[id].config->name;
+}
+
+
+/*******************************************************************************
+ * Clears the counters of all devices.
+ *******************************************************************************/
+void spi_bus_reset_stats(void)
+{
+    int i;
+
+    for (i = 0; i < spi_bus_count; i++)
+    {
+        memset(&spi_bus_devices[i].stats, 0, sizeof(spi_bus_stats_t));
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,105 @@
+/*
+ * spi_bus.h
+ *
+ *  Arbitration of the SPI block shared by the LCD and the SD card. Every
+ *  device registers its own clock and mode; the block is only reprogrammed
+ *  when a different device acquires it. Ownership is sticky, so back to back
+ *  transfers of one device cost a compare. With LCD_RTOS the bus is also a
+ *  mutex; each device must be driven from a single task.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cyhal.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Maximum number of devices on the bus */
+#define SPI_BUS_MAX_DEVICES         (4)
+
+/** Device profile, handed over at registration */
+typedef struct
+{
+    const char *name;           /**< Name for the profiling output */
+    uint32_t frequency_hz;      /**< SCLK the device runs at */
+    cyhal_spi_mode_t mode;      /**< Clock polarity and phase */
+    cyhal_gpio_t cs_pin;        /**< Chip select, driven by the device itself */
+    void (*drain)(void);        /**< Waits for background transfers, may be NULL */
+} spi_bus_config_t;
+
+/** Per-device bus counters */
+typedef struct
+{
+    uint32_t acquisitions;      /**< Outermost spi_bus_acquire() calls */
+    uint32_t switches;          /**< Times the bus was reprogrammed for the device */
+    uint32_t busy_cycles;       /**< CPU cycles the device held the bus */
+    uint32_t switch_cycles;     /**< CPU cycles spent reprogramming the bus for it */
+} spi_bus_stats_t;
+
+
+/**
+ * Hands the SPI block to the bus manager and sets its clock. Must be called
+ * after cyhal_spi_init(). The clock only lasts until the first device takes
+ * the bus, so it must suit whatever talks on the bus before: the SD card
+ * starts at SD_SPI_INIT_HZ.
+ * @param[in] spi          Initialized SPI block
+ * @param[in] frequency_hz Clock to start the block at
+ * @param[in] mode         Mode the block was initialized with
+ * @return Result of setting the clock
+ */
+cy_rslt_t spi_bus_init(cyhal_spi_t *spi, uint32_t frequency_hz, cyhal_spi_mode_t mode);
+
+/**
+ * Registers a device. The config must stay valid, it is not copied.
+ * @param[in] config Device profile
+ * @return Device id for the other calls, -1 if the table is full
+ */
+int spi_bus_register(const spi_bus_config_t *config);
+
+/**
+ * Changes the clock of a registered device, e.g. the SD card after its
+ * 400 kHz identification phase. Takes effect at the next acquisition.
+ * @param[in] id           Device id
+ * @param[in] frequency_hz New clock
+ */
+void spi_bus_set_frequency(int id, uint32_t frequency_hz);
+
+/**
+ * Takes the bus for a device. Calls nest; if another device owned the bus
+ * last, its drain function runs and the block is reprogrammed.
+ * @param[in] id Device id
+ */
+void spi_bus_acquire(int id);
+
+/**
+ * Ends the innermost spi_bus_acquire() of a device.
+ * @param[in] id Device id
+ */
+void spi_bus_release(int id);
+
+/**
+ * Copies the counters of one device.
+ * @param[in]  id    Device id
+ * @param[out] stats Where to store the counters
+ * @return Device name, NULL if id is not registered
+ */
+const char *spi_bus_get_stats(int id, spi_bus_stats_t *stats);
+
+/**
+ * Clears the counters of all devices.
+ */
+void spi_bus_reset_stats(void);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
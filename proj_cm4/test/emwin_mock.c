@@ -0,0 +1,698 @@
+/*
+ * emwin_mock.c
+ *
+ *  Host mock of the emWin calls in stubs/GUI.h, see emwin_mock.h.
+ */
+
+#include "GUI.h"
+#include "GUI_Private.h"
+#include "mtb_hx8347.h"
+#include "emwin_mock.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+typedef struct
+{
+    GUI_RECT rect;
+    uint16_t *data;
+    uint32_t bytes;
+} emwin_mock_device_t;
+
+/* Handle n is devices[n - 1], 0 is the screen */
+static emwin_mock_device_t emwin_mock_devices[EMWIN_MOCK_DEVICES];
+static GUI_MEMDEV_Handle emwin_mock_selected;
+static GUI_DRAWMODE emwin_mock_mode;
+static GUI_CONTEXT emwin_mock_context;
+static GUI_COLOR emwin_mock_color;
+static GUI_COLOR emwin_mock_bk;
+static const GUI_FONT *emwin_mock_font;
+static uint32_t emwin_mock_used;
+static uint32_t emwin_mock_peak;
+
+/* What emWin has sent to the panel, rows of LCD_GetXSize() pixels */
+static uint16_t emwin_mock_screen[LCD_WIDTH * LCD_HEIGHT];
+
+GUI_CONTEXT *GUI_pContext = &emwin_mock_context;
+emwin_mock_calls_t emwin_mock_calls;
+GUI_TIMER_TIME emwin_mock_time;
+uint32_t emwin_mock_pool_bytes = EMWIN_MOCK_POOL_BYTES;
+
+GUI_CONST_STORAGE GUI_FONT GUI_Font8x16 = { 16, 16, 8 };
+GUI_CONST_STORAGE GUI_FONT GUI_Font20_ASCII = { 20, 20, 10 };
+GUI_CONST_STORAGE GUI_FONT GUI_Font32B_ASCII = { 32, 32, 17 };
+GUI_CONST_STORAGE GUI_FONT GUI_FontD80 = { 80, 80, 47 };
+
+
+/*******************************************************************************
+ * Clips to the selected device, or to the screen with none selected.
+ *******************************************************************************/
+static void emwin_mock_clip(void)
+{
+    if (emwin_mock_selected != 0)
+    {
+        GUI_pContext->ClipRect = emwin_mock_devices[emwin_mock_selected - 1].rect;
+    }
+    else
+    {
+        GUI_pContext->ClipRect.x0 = 0;
+        GUI_pContext->ClipRect.y0 = 0;
+        GUI_pContext->ClipRect.x1 = (I16)(LCD_GetXSize() - 1);
+        GUI_pContext->ClipRect.y1 = (I16)(LCD_GetYSize() - 1);
+    }
+}
+
+
+/* Narrows the clip rectangle */
+static void emwin_mock_clip_to(const GUI_RECT *rect)
+{
+    GUI_RECT *clip = &GUI_pContext->ClipRect;
+
+    clip->x0 = (rect->x0 > clip->x0) ? rect->x0 : clip->x0;
+    clip->y0 = (rect->y0 > clip->y0) ? rect->y0 : clip->y0;
+    clip->x1 = (rect->x1 < clip->x1) ? rect->x1 : clip->x1;
+    clip->y1 = (rect->y1 < clip->y1) ? rect->y1 : clip->y1;
+}
+
+
+void emwin_mock_reset(void)
+{
+    int i;
+
+    memset(&emwin_mock_calls, 0, sizeof(emwin_mock_calls));
+    for (i = 0; i < EMWIN_MOCK_DEVICES; i++)
+    {
+        if (emwin_mock_devices[i].data != NULL)
+        {
+            emwin_mock_calls.leaked++;
+            GUI_MEMDEV_Delete(i + 1);
+        }
+    }
+    emwin_mock_selected = 0;
+    emwin_mock_mode = GUI_DRAWMODE_NORMAL;
+    emwin_mock_color = GUI_WHITE;
+    emwin_mock_bk = GUI_BLACK;
+    emwin_mock_font = &GUI_Font8x16;
+    emwin_mock_pool_bytes = EMWIN_MOCK_POOL_BYTES;
+    emwin_mock_peak = 0u;
+    memset(emwin_mock_screen, 0, sizeof(emwin_mock_screen));
+    emwin_mock_clip();
+}
+
+
+uint16_t emwin_mock_lcd(int x, int y)
+{
+    return emwin_mock_screen[y * LCD_GetXSize() + x];
+}
+
+
+/*******************************************************************************
+ * Returns the pixel of the selected device, or of the screen, at a screen
+ * position inside the clip rectangle, NULL outside it.
+ *******************************************************************************/
+static uint16_t *emwin_mock_pixel(int x, int y)
+{
+    const emwin_mock_device_t *dev;
+    const GUI_RECT *clip = &GUI_pContext->ClipRect;
+
+    if ((x < clip->x0) || (x > clip->x1) || (y < clip->y0) || (y > clip->y1))
+    {
+        return NULL;
+    }
+    if (emwin_mock_selected == 0)
+    {
+        emwin_mock_calls.lcd_pixels++;
+        return &emwin_mock_screen[y * LCD_GetXSize() + x];
+    }
+    dev = &emwin_mock_devices[emwin_mock_selected - 1];
+    return &dev->data[(y - dev->rect.y0) * (dev->rect.x1 - dev->rect.x0 + 1) + (x - dev->rect.x0)];
+}
+
+
+/* Counts a drawing call that goes straight to the screen */
+static void emwin_mock_draw_call(void)
+{
+    if (emwin_mock_selected == 0)
+    {
+        emwin_mock_calls.unselected++;
+    }
+}
+
+
+/* One line of a fill in the current colour */
+static void emwin_mock_hline(int x0, int y, int x1, GUI_COLOR color)
+{
+    uint16_t index = (uint16_t)GUI_Color2Index(color);
+    uint16_t *dst;
+    int x;
+
+    for (x = x0; x <= x1; x++)
+    {
+        dst = emwin_mock_pixel(x, y);
+        if (dst != NULL)
+        {
+            *dst = index;
+            emwin_mock_calls.fill_pixels++;
+        }
+    }
+}
+
+
+void emwin_mock_paint(uint16_t (*color)(int x, int y))
+{
+    const GUI_RECT *clip = &GUI_pContext->ClipRect;
+    int x, y;
+
+    emwin_mock_draw_call();
+    for (y = clip->y0; y <= clip->y1; y++)
+    {
+        for (x = clip->x0; x <= clip->x1; x++)
+        {
+            *emwin_mock_pixel(x, y) = color(x, y);
+        }
+    }
+}
+
+
+GUI_TIMER_TIME GUI_GetTime(void)
+{
+    return emwin_mock_time;
+}
+
+
+int LCD_GetXSize(void)
+{
+    return mtb_hx8347_get_width();
+}
+
+
+int LCD_GetYSize(void)
+{
+    return mtb_hx8347_get_height();
+}
+
+
+/* 0xBBGGRR to RGB565 */
+LCD_PIXELINDEX GUI_Color2Index(GUI_COLOR Color)
+{
+    return (((Color & 0xF8u) << 8) | ((Color >> 5) & 0x7E0u) | ((Color >> 19) & 0x1Fu));
+}
+
+
+GUI_DRAWMODE GUI_GetDrawMode(void)
+{
+    return emwin_mock_mode;
+}
+
+
+GUI_DRAWMODE GUI_SetDrawMode(GUI_DRAWMODE dm)
+{
+    GUI_DRAWMODE old = emwin_mock_mode;
+
+    emwin_mock_mode = dm;
+    return old;
+}
+
+
+GUI_COLOR GUI_GetColor(void)
+{
+    return emwin_mock_color;
+}
+
+
+void GUI_SetColor(GUI_COLOR Color)
+{
+    emwin_mock_color = Color;
+}
+
+
+GUI_COLOR GUI_GetBkColor(void)
+{
+    return emwin_mock_bk;
+}
+
+
+void GUI_SetBkColor(GUI_COLOR Color)
+{
+    emwin_mock_bk = Color;
+}
+
+
+const GUI_FONT *GUI_GetFont(void)
+{
+    return emwin_mock_font;
+}
+
+
+const GUI_FONT *GUI_SetFont(const GUI_FONT *pNewFont)
+{
+    const GUI_FONT *old = emwin_mock_font;
+
+    emwin_mock_font = pNewFont;
+    return old;
+}
+
+
+int GUI_GetTextMode(void)
+{
+    return GUI_TM_NORMAL;
+}
+
+
+int GUI_GetFontSizeY(void)
+{
+    return emwin_mock_font->YSize;
+}
+
+
+int GUI_GetFontDistY(void)
+{
+    return emwin_mock_font->YDist;
+}
+
+
+int GUI_GetCharDistX(U16 c)
+{
+    (void)c;
+    return emwin_mock_font->XDist;
+}
+
+
+int GUI_GetStringDistX(const char *s)
+{
+    return (int)strlen(s) * emwin_mock_font->XDist;
+}
+
+
+void GUI_SetClipRect(const GUI_RECT *pRect)
+{
+    emwin_mock_clip();
+    if (pRect != NULL)
+    {
+        emwin_mock_clip_to(pRect);
+    }
+}
+
+
+/*******************************************************************************
+ * 8bpp only, as the bitmaps of the application are. Index 0 is left out in
+ * the transparent draw mode.
+ *******************************************************************************/
+void LCD_DrawBitmap(int x0, int y0, int xsize, int ysize, int xMul, int yMul, int BitsPerPixel,
+                    int BytesPerLine, const U8 *pPixel, const LCD_PIXELINDEX *pTrans)
+{
+    uint16_t *dst;
+    U8 index;
+    int x, y;
+
+    emwin_mock_draw_call();
+    emwin_mock_calls.bitmap_rows += (uint32_t)ysize;
+    if (BitsPerPixel != 8)
+    {
+        return;
+    }
+    for (y = 0; y < ysize * yMul; y++)
+    {
+        for (x = 0; x < xsize * xMul; x++)
+        {
+            index = pPixel[(y / yMul) * BytesPerLine + x / xMul];
+            if (!((emwin_mock_mode & GUI_DRAWMODE_TRANS) && (index == 0u)))
+            {
+                dst = emwin_mock_pixel(x0 + x, y0 + y);
+                if (dst != NULL)
+                {
+                    *dst = (uint16_t)pTrans[index];
+                }
+            }
+        }
+    }
+}
+
+
+void GUI_DrawBitmap(const GUI_BITMAP *pBM, int x0, int y0)
+{
+    LCD_PIXELINDEX trans[256];
+    GUI_DRAWMODE mode = emwin_mock_mode;
+    int i;
+
+    if (pBM->pMethods != NULL)
+    {
+        pBM->pMethods->pfDraw(x0, y0, pBM->XSize, pBM->YSize, pBM->pData, pBM->pPal, 1, 1);
+        return;
+    }
+    for (i = 0; i < 256; i++)
+    {
+        trans[i] = (i < pBM->pPal->NumEntries) ? GUI_Color2Index(pBM->pPal->pPalEntries[i]) : 0u;
+    }
+    if (pBM->pPal->HasTrans)
+    {
+        emwin_mock_mode |= GUI_DRAWMODE_TRANS;
+    }
+    LCD_DrawBitmap(x0, y0, pBM->XSize, pBM->YSize, 1, 1, pBM->BitsPerPixel, pBM->BytesPerLine, pBM->pData, trans);
+    emwin_mock_mode = mode;
+}
+
+
+void GUI_Clear(void)
+{
+    int y;
+
+    emwin_mock_draw_call();
+    for (y = 0; y < LCD_GetYSize(); y++)
+    {
+        emwin_mock_hline(0, y, LCD_GetXSize() - 1, emwin_mock_bk);
+    }
+}
+
+
+void GUI_FillRect(int x0, int y0, int x1, int y1)
+{
+    int y;
+
+    emwin_mock_draw_call();
+    emwin_mock_calls.fill_rects++;
+    for (y = y0; y <= y1; y++)
+    {
+        emwin_mock_hline(x0, y, x1, emwin_mock_color);
+    }
+}
+
+
+/*******************************************************************************
+ * The lines of emWin's GL_FillCircle(), some of them twice.
+ *******************************************************************************/
+void GUI_FillCircle(int x0, int y0, int r)
+{
+    int32_t i, imax = (r * 707) / 1000 + 1;
+    int32_t sqmax = r * r + r / 2;
+    int x = r;
+
+    emwin_mock_draw_call();
+    emwin_mock_hline(x0 - r, y0, x0 + r, emwin_mock_color);
+    for (i = 1; i <= imax; i++)
+    {
+        if ((i * i + x * x) > sqmax)
+        {
+            if (x > imax)
+            {
+                emwin_mock_hline(x0 - i + 1, y0 + x, x0 + i - 1, emwin_mock_color);
+                emwin_mock_hline(x0 - i + 1, y0 - x, x0 + i - 1, emwin_mock_color);
+            }
+            x--;
+        }
+        emwin_mock_hline(x0 - x, y0 + i, x0 + x, emwin_mock_color);
+        emwin_mock_hline(x0 - x, y0 - i, x0 + x, emwin_mock_color);
+    }
+}
+
+
+/* Every pixel whose centre is inside the ellipse */
+void GUI_FillEllipse(int x0, int y0, int rx, int ry)
+{
+    int32_t dx, dy;
+
+    emwin_mock_draw_call();
+    for (dy = -ry; dy <= ry; dy++)
+    {
+        dx = rx;
+        while ((dx > 0) && ((dx * dx * ry * ry + dy * dy * rx * rx) > (rx * rx * ry * ry)))
+        {
+            dx--;
+        }
+        emwin_mock_hline(x0 - dx, y0 + dy, x0 + dx, emwin_mock_color);
+    }
+}
+
+
+/*******************************************************************************
+ * Scanline fill, even-odd, of the lines the polygon spans from its top edge
+ * down to but not including its bottom edge.
+ *******************************************************************************/
+void GUI_FillPolygon(const GUI_POINT *pPoints, int NumPoints, int x0, int y0)
+{
+    double xs[EMWIN_MOCK_POLYGON_POINTS], t;
+    const GUI_POINT *a, *b;
+    int i, j, n, y, ymin = pPoints[0].y, ymax = pPoints[0].y;
+
+    emwin_mock_draw_call();
+    for (i = 1; i < NumPoints; i++)
+    {
+        ymin = (pPoints[i].y < ymin) ? pPoints[i].y : ymin;
+        ymax = (pPoints[i].y > ymax) ? pPoints[i].y : ymax;
+    }
+    for (y = ymin; y < ymax; y++)
+    {
+        for (i = 0, n = 0; i < NumPoints; i++)
+        {
+            a = &pPoints[i];
+            b = &pPoints[(i + 1) % NumPoints];
+            if (((a->y <= y) && (y < b->y)) || ((b->y <= y) && (y < a->y)))
+            {
+                xs[n++] = a->x + (double)(y - a->y) * (b->x - a->x) / (b->y - a->y);
+            }
+        }
+        for (i = 1; i < n; i++)
+        {
+            for (j = i; (j > 0) && (xs[j - 1] > xs[j]); j--)
+            {
+                t = xs[j];
+                xs[j] = xs[j - 1];
+                xs[j - 1] = t;
+            }
+        }
+        for (i = 0; i + 1 < n; i += 2)
+        {
+            emwin_mock_hline(x0 + (int)ceil(xs[i]), y0 + y, x0 + (int)floor(xs[i + 1]), emwin_mock_color);
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Moves every edge of a convex polygon out by Len, the corners to where the
+ * moved edges meet.
+ *******************************************************************************/
+void GUI_EnlargePolygon(GUI_POINT *pDest, const GUI_POINT *pSrc, int NumPoints, int Len)
+{
+    double nx[EMWIN_MOCK_POLYGON_POINTS], ny[EMWIN_MOCK_POLYGON_POINTS], c[EMWIN_MOCK_POLYGON_POINTS];
+    double cx = 0.0, cy = 0.0, dx, dy, d, det;
+    int i, j;
+
+    for (i = 0; i < NumPoints; i++)
+    {
+        cx += pSrc[i].x / (double)NumPoints;
+        cy += pSrc[i].y / (double)NumPoints;
+    }
+    /* Edge i from point i to i + 1 as nx * x + ny * y = c, normal outwards */
+    for (i = 0; i < NumPoints; i++)
+    {
+        j = (i + 1) % NumPoints;
+        dx = pSrc[j].x - pSrc[i].x;
+        dy = pSrc[j].y - pSrc[i].y;
+        d = sqrt(dx * dx + dy * dy);
+        nx[i] = dy / d;
+        ny[i] = -dx / d;
+        if ((nx[i] * (pSrc[i].x - cx) + ny[i] * (pSrc[i].y - cy)) < 0.0)
+        {
+            nx[i] = -nx[i];
+            ny[i] = -ny[i];
+        }
+        c[i] = nx[i] * pSrc[i].x + ny[i] * pSrc[i].y + Len;
+    }
+    for (i = 0; i < NumPoints; i++)
+    {
+        j = (i + NumPoints - 1) % NumPoints;
+        det = nx[j] * ny[i] - ny[j] * nx[i];
+        pDest[i].x = (I16)lround((c[j] * ny[i] - ny[j] * c[i]) / det);
+        pDest[i].y = (I16)lround((nx[j] * c[i] - c[j] * nx[i]) / det);
+    }
+}
+
+
+/*******************************************************************************
+ * Stand-in glyphs: a fixed pattern per character over the cell, the rest of
+ * the cell in the background colour.
+ *******************************************************************************/
+static void emwin_mock_text(const char *s, int x, int y)
+{
+    uint16_t fg = (uint16_t)GUI_Color2Index(emwin_mock_color);
+    uint16_t bk = (uint16_t)GUI_Color2Index(emwin_mock_bk);
+    uint16_t *dst;
+    int gx, gy;
+
+    emwin_mock_draw_call();
+    for (; *s != '\0'; s++, x += emwin_mock_font->XDist)
+    {
+        for (gy = 0; gy < emwin_mock_font->YSize; gy++)
+        {
+            for (gx = 0; gx < emwin_mock_font->XDist; gx++)
+            {
+                dst = emwin_mock_pixel(x + gx, y + gy);
+                if (dst != NULL)
+                {
+                    *dst = (((*s * 7 + gx * 3 + gy * 5) % 4) == 0) ? fg : bk;
+                }
+            }
+        }
+    }
+}
+
+
+void GUI_DispStringHCenterAt(const char *s, int x, int y)
+{
+    emwin_mock_text(s, x - GUI_GetStringDistX(s) / 2, y);
+}
+
+
+void GUI_DispDecAt(I32 v, I16 x, I16 y, U8 Len)
+{
+    char s[24];
+
+    snprintf(s, sizeof(s), "%0*ld", (Len < 20u) ? (int)Len : 20, (long)v);
+    emwin_mock_text(s, x, y);
+}
+
+
+GUI_MEMDEV_Handle GUI_MEMDEV_Create(int x0, int y0, int xsize, int ysize)
+{
+    emwin_mock_device_t *dev;
+    uint32_t bytes = (uint32_t)(xsize * ysize) * sizeof(uint16_t);
+    int i;
+
+    if (emwin_mock_used + bytes > emwin_mock_pool_bytes)
+    {
+        return 0;
+    }
+    for (i = 0; i < EMWIN_MOCK_DEVICES; i++)
+    {
+        dev = &emwin_mock_devices[i];
+        if (dev->data == NULL)
+        {
+            dev->data = calloc((size_t)(xsize * ysize), sizeof(uint16_t));
+            dev->bytes = bytes;
+            dev->rect.x0 = (I16)x0;
+            dev->rect.y0 = (I16)y0;
+            dev->rect.x1 = (I16)(x0 + xsize - 1);
+            dev->rect.y1 = (I16)(y0 + ysize - 1);
+            emwin_mock_used += bytes;
+            emwin_mock_peak = (emwin_mock_used > emwin_mock_peak) ? emwin_mock_used : emwin_mock_peak;
+            emwin_mock_calls.created++;
+            emwin_mock_calls.odd_width += (uint32_t)(xsize & 1);
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+
+void GUI_MEMDEV_Delete(GUI_MEMDEV_Handle hMem)
+{
+    if (hMem == emwin_mock_selected)
+    {
+        GUI_MEMDEV_Select(0);
+    }
+    free(emwin_mock_devices[hMem - 1].data);
+    emwin_mock_devices[hMem - 1].data = NULL;
+    emwin_mock_used -= emwin_mock_devices[hMem - 1].bytes;
+}
+
+
+GUI_MEMDEV_Handle GUI_MEMDEV_Select(GUI_MEMDEV_Handle hMem)
+{
+    GUI_MEMDEV_Handle old = emwin_mock_selected;
+
+    emwin_mock_selected = hMem;
+    emwin_mock_clip();
+    return old;
+}
+
+
+void *GUI_MEMDEV_GetDataPtr(GUI_MEMDEV_Handle hMem)
+{
+    return emwin_mock_devices[hMem - 1].data;
+}
+
+
+GUI_MEMDEV_Handle GUI_MEMDEV_GetSelMemdev(void)
+{
+    return emwin_mock_selected;
+}
+
+
+/*******************************************************************************
+ * One device of NumLines, or of the whole rectangle with 0, moved down the
+ * rectangle band by band; each band is drawn clipped to the rectangle and
+ * copied to the screen. Without the memory for it the callback draws straight
+ * to the screen, as emWin does, and 1 is returned.
+ *******************************************************************************/
+int GUI_MEMDEV_Draw(GUI_RECT *pRect, GUI_CALLBACK_VOID_P *pfDraw, void *pData, int NumLines, int Flags)
+{
+    emwin_mock_device_t *dev;
+    GUI_MEMDEV_Handle hMem, old;
+    int lines = (NumLines > 0) ? NumLines : (pRect->y1 - pRect->y0 + 1);
+    int xsize = pRect->x1 - pRect->x0 + 1;
+    int x, y, y0;
+
+    (void)Flags;
+    hMem = GUI_MEMDEV_Create(pRect->x0, pRect->y0, xsize, lines);
+    if (hMem == 0)
+    {
+        GUI_SetClipRect(pRect);
+        pfDraw(pData);
+        GUI_SetClipRect(NULL);
+        return 1;
+    }
+
+    dev = &emwin_mock_devices[hMem - 1];
+    old = GUI_MEMDEV_Select(0);
+    for (y0 = pRect->y0; y0 <= pRect->y1; y0 += lines)
+    {
+        dev->rect.y0 = (I16)y0;
+        dev->rect.y1 = (I16)(y0 + lines - 1);
+        GUI_MEMDEV_Select(hMem);
+        emwin_mock_clip_to(pRect);
+        pfDraw(pData);
+        GUI_MEMDEV_Select(0);
+
+        for (y = y0; (y < y0 + lines) && (y <= pRect->y1); y++)
+        {
+            for (x = pRect->x0; x <= pRect->x1; x++)
+            {
+                emwin_mock_screen[y * LCD_GetXSize() + x] = dev->data[(y - y0) * xsize + (x - pRect->x0)];
+                emwin_mock_calls.lcd_pixels++;
+            }
+        }
+    }
+    GUI_MEMDEV_Select(old);
+    GUI_MEMDEV_Delete(hMem);
+    return 0;
+}
+
+
+I32 GUI_ALLOC_GetNumUsedBytes(void)
+{
+    return (I32)emwin_mock_used;
+}
+
+
+I32 GUI_ALLOC_GetNumFreeBytes(void)
+{
+    return (I32)(emwin_mock_pool_bytes - emwin_mock_used);
+}
+
+
+I32 GUI_ALLOC_GetMaxSize(void)
+{
+    return (I32)(emwin_mock_pool_bytes - emwin_mock_used);
+}
+
+
+I32 GUI_ALLOC_GetMaxUsedBytes(void)
+{
+    return (I32)emwin_mock_peak;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,80 @@
+/*
+ * emwin_mock.h
+ *
+ *  Host mock of the emWin calls in stubs/GUI.h. Memory devices are 16bpp
+ *  with rows of exactly their width and come out of a pool of
+ *  emwin_mock_pool_bytes; selecting one clips drawing to it. Drawing with no
+ *  device selected goes to a 16bpp screen of the panel's size in its current
+ *  orientation, which stands for what emWin sends to the panel, and is
+ *  counted. The clock is set by the test.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "GUI.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Memory devices alive at a time */
+#define EMWIN_MOCK_DEVICES          (4)
+
+/* Default pool, room for a full screen device */
+#define EMWIN_MOCK_POOL_BYTES       (256u * 1024u)
+
+/* Corners of a polygon */
+#define EMWIN_MOCK_POLYGON_POINTS   (16)
+
+/** Calls since the last emwin_mock_reset() */
+typedef struct
+{
+    uint32_t created;       /**< GUI_MEMDEV_Create() */
+    uint32_t odd_width;     /**< Devices created with an odd width */
+    uint32_t leaked;        /**< Devices alive at the reset */
+    uint32_t unselected;    /**< Drawing calls with no device selected */
+    uint32_t bitmap_rows;   /**< Rows handed to LCD_DrawBitmap() */
+    uint32_t fill_rects;    /**< GUI_FillRect() */
+    uint32_t fill_pixels;   /**< Pixels written by the fills and GUI_Clear(), every time */
+    uint32_t lcd_pixels;    /**< Pixels written to the screen, drawn or copied from a device */
+} emwin_mock_calls_t;
+
+extern emwin_mock_calls_t emwin_mock_calls;
+
+/** Bytes of the memory device pool, back to the default at a reset */
+extern uint32_t emwin_mock_pool_bytes;
+
+/** GUI_GetTime(), in milliseconds */
+extern GUI_TIMER_TIME emwin_mock_time;
+
+/**
+ * Frees the devices left, deselects, clears the counters and the screen and
+ * sets emWin's colours and font back.
+ */
+void emwin_mock_reset(void);
+
+/**
+ * Returns a pixel of the screen.
+ * @param[in] x Column in the current orientation
+ * @param[in] y Row in the current orientation
+ * @return RGB565 colour
+ */
+uint16_t emwin_mock_lcd(int x, int y);
+
+/**
+ * Paints every pixel of the selected device, or of the screen, inside the
+ * clip rectangle, in place of the drawing a background callback does.
+ * @param[in] color Colour index of a screen pixel
+ */
+void emwin_mock_paint(uint16_t (*color)(int x, int y));
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
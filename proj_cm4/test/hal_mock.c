@@ -0,0 +1,485 @@
+/*
+ * hal_mock.c
+ *
+ *  Host mock of the cyhal and PDL calls behind the LCD driver, see
+ *  hal_mock.h.
+ */
+
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "hal_mock.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+#define HAL_MOCK_PINS               (32u)
+
+static CoreDebug_Type hal_mock_core_debug;
+static DWT_Type hal_mock_dwt;
+static CySCB_Type hal_mock_scb;
+
+CoreDebug_Type *CoreDebug = &hal_mock_core_debug;
+DWT_Type *DWT = &hal_mock_dwt;
+uint32_t SystemCoreClock = HAL_MOCK_CORE_HZ;
+
+GPIO_PRT_Type hal_mock_port;
+cyhal_spi_t mSPI = { .base = &hal_mock_scb };
+hal_mock_calls_t hal_mock_calls;
+
+static volatile uint8_t hal_mock_levels[HAL_MOCK_PINS];
+static hal_mock_wire_t *hal_mock_log;
+static uint32_t hal_mock_log_len;
+static uint32_t hal_mock_log_size;
+
+static cyhal_spi_event_callback_t hal_mock_callback;
+static void *hal_mock_callback_arg;
+
+/* Critical sections of all threads exclude each other, as masked interrupts
+ * do on the single core. The code under test does not nest them. */
+static pthread_mutex_t hal_mock_critical = PTHREAD_MUTEX_INITIALIZER;
+
+/* Deferred DMA, see hal_mock_dma_defer() */
+static struct
+{
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t kick;
+    pthread_cond_t idle;
+    bool started;
+    bool defer;
+    volatile bool busy;     /* A transfer is on the wire */
+    uint32_t sum;           /* Checksum of its buffer at the kick */
+    hal_mock_dma_t *current;
+    hal_mock_dma_t chain[HAL_MOCK_DMA_CHAIN];
+    uint32_t num;
+    uint32_t collisions;
+} hal_mock_dma =
+{
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .kick = PTHREAD_COND_INITIALIZER,
+    .idle = PTHREAD_COND_INITIALIZER,
+};
+
+
+/*******************************************************************************
+ * Appends bytes to the log with the current LCD_DC and LCD_CS levels.
+ *******************************************************************************/
+static void hal_mock_clock_out(const uint8_t *data, uint32_t num)
+{
+    uint32_t i;
+
+    if (hal_mock_log_len + num > hal_mock_log_size)
+    {
+        hal_mock_log_size = 2u * (hal_mock_log_len + num);
+        hal_mock_log = realloc(hal_mock_log, hal_mock_log_size * sizeof(hal_mock_wire_t));
+        if (hal_mock_log == NULL)
+        {
+            fprintf(stderr, "hal_mock: out of memory\n");
+            exit(2);
+        }
+    }
+    for (i = 0; i < num; i++)
+    {
+        hal_mock_log[hal_mock_log_len].byte = data[i];
+        hal_mock_log[hal_mock_log_len].dc = hal_mock_levels[LCD_DC_PIN];
+        hal_mock_log[hal_mock_log_len].cs = hal_mock_levels[LCD_CS_PIN];
+        hal_mock_log_len++;
+    }
+}
+
+
+static void hal_mock_dma_wait(void)
+{
+    pthread_mutex_lock(&hal_mock_dma.lock);
+    while (hal_mock_dma.busy)
+    {
+        pthread_cond_wait(&hal_mock_dma.idle, &hal_mock_dma.lock);
+    }
+    pthread_mutex_unlock(&hal_mock_dma.lock);
+}
+
+
+void hal_mock_reset(void)
+{
+    hal_mock_dma_wait();
+    hal_mock_log_len = 0u;
+    hal_mock_dma.num = 0u;
+    hal_mock_dma.collisions = 0u;
+    memset(&hal_mock_calls, 0, sizeof(hal_mock_calls));
+}
+
+
+const hal_mock_wire_t *hal_mock_wire(uint32_t *num)
+{
+    *num = hal_mock_log_len;
+    return hal_mock_log;
+}
+
+
+uint32_t hal_mock_count(uint8_t dc)
+{
+    uint32_t i, n = 0u;
+
+    for (i = 0; i < hal_mock_log_len; i++)
+    {
+        n += (hal_mock_log[i].dc == dc) ? 1u : 0u;
+    }
+    return n;
+}
+
+
+bool hal_mock_pin(cyhal_gpio_t pin)
+{
+    return (pin < HAL_MOCK_PINS) && (hal_mock_levels[pin] != 0u);
+}
+
+
+void hal_mock_assert(const char *expr, const char *file, int line)
+{
+    fprintf(stderr, "%s:%d: CY_ASSERT(%s) failed\n", file, line, expr);
+    abort();
+}
+
+
+/*******************************************************************************
+ * GPIO
+ *******************************************************************************/
+static void hal_mock_level(uint32_t pin, uint8_t level)
+{
+    if (pin < HAL_MOCK_PINS)
+    {
+        hal_mock_levels[pin] = level;
+    }
+    hal_mock_calls.gpio_writes++;
+}
+
+
+void Cy_GPIO_Set(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    (void)base;
+    hal_mock_level(pinNum, 1u);
+}
+
+
+void Cy_GPIO_Clr(GPIO_PRT_Type *base, uint32_t pinNum)
+{
+    (void)base;
+    hal_mock_level(pinNum, 0u);
+}
+
+
+cy_rslt_t cyhal_gpio_init(cyhal_gpio_t pin, cyhal_gpio_direction_t direction, cyhal_gpio_drive_mode_t drive_mode, bool init_val)
+{
+    (void)direction;
+    (void)drive_mode;
+    if (pin < HAL_MOCK_PINS)
+    {
+        hal_mock_levels[pin] = init_val ? 1u : 0u;
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+
+void cyhal_gpio_write(cyhal_gpio_t pin, bool value)
+{
+    hal_mock_level(pin, value ? 1u : 0u);
+}
+
+
+void cyhal_gpio_free(cyhal_gpio_t pin)
+{
+    (void)pin;
+}
+
+
+/*******************************************************************************
+ * Blocking traffic while a deferred transfer is on the wire would interleave
+ * with it on the target.
+ *******************************************************************************/
+static void hal_mock_dma_check(void)
+{
+    if (hal_mock_dma.busy)
+    {
+        hal_mock_dma.collisions++;
+    }
+}
+
+
+/*******************************************************************************
+ * SPI. Blocking calls return once their bytes are out, the cycle counter
+ * moves by what that takes on the target.
+ *******************************************************************************/
+cy_rslt_t cyhal_spi_send(cyhal_spi_t *obj, uint32_t value)
+{
+    uint8_t byte = (uint8_t)value;
+
+    (void)obj;
+    hal_mock_dma_check();
+    hal_mock_clock_out(&byte, 1u);
+    hal_mock_calls.spi_send++;
+    DWT->CYCCNT += HAL_MOCK_CALL_CYCLES + HAL_MOCK_BYTE_CYCLES;
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cyhal_spi_transfer(cyhal_spi_t *obj, const uint8_t *tx, size_t tx_length, uint8_t *rx, size_t rx_length, uint8_t write_fill)
+{
+    (void)obj;
+    (void)write_fill;
+    hal_mock_dma_check();
+    hal_mock_clock_out(tx, (uint32_t)tx_length);
+    if (rx != NULL)
+    {
+        memset(rx, 0, rx_length);
+    }
+    DWT->CYCCNT += HAL_MOCK_CALL_CYCLES + (uint32_t)tx_length * HAL_MOCK_BYTE_CYCLES;
+    return CY_RSLT_SUCCESS;
+}
+
+
+void Cy_SCB_SPI_WriteArrayBlocking(CySCB_Type *base, void *buffer, uint32_t size)
+{
+    (void)base;
+    hal_mock_dma_check();
+    hal_mock_clock_out((const uint8_t *)buffer, size);
+    hal_mock_calls.write_array++;
+    DWT->CYCCNT += size * HAL_MOCK_BYTE_CYCLES;
+}
+
+
+static uint32_t hal_mock_sum(const uint8_t *data, uint32_t num)
+{
+    uint32_t i, sum = 2166136261u;
+
+    for (i = 0; i < num; i++)
+    {
+        sum = (sum ^ data[i]) * 16777619u;
+    }
+    return sum;
+}
+
+
+/*******************************************************************************
+ * The DMA: holds each transfer for its byte time, checks that nobody wrote
+ * its buffer meanwhile and raises the done event from its own context, as
+ * the interrupt does on the target.
+ *******************************************************************************/
+static void *hal_mock_dma_thread(void *arg)
+{
+    hal_mock_dma_t *dma;
+    struct timespec wire;
+    uint64_t ns;
+
+    (void)arg;
+    pthread_mutex_lock(&hal_mock_dma.lock);
+    for (;;)
+    {
+        while (hal_mock_dma.current == NULL)
+        {
+            pthread_cond_wait(&hal_mock_dma.kick, &hal_mock_dma.lock);
+        }
+        dma = hal_mock_dma.current;
+        pthread_mutex_unlock(&hal_mock_dma.lock);
+
+        ns = (uint64_t)dma->len * 8u * 1000000000u / LCD_SPI_FREQ_HZ;
+        wire.tv_sec = (time_t)(ns / 1000000000u);
+        wire.tv_nsec = (long)(ns % 1000000000u);
+        nanosleep(&wire, NULL);
+        dma->modified = (hal_mock_sum(dma->buf, dma->len) != hal_mock_dma.sum);
+
+        pthread_mutex_lock(&hal_mock_dma.lock);
+        hal_mock_dma.current = NULL;
+        dma->done = true;
+        hal_mock_dma.busy = false;
+        if (hal_mock_callback != NULL)
+        {
+            hal_mock_callback(hal_mock_callback_arg, CYHAL_SPI_IRQ_DONE);
+        }
+        pthread_cond_broadcast(&hal_mock_dma.idle);
+    }
+    return NULL;
+}
+
+
+void hal_mock_dma_defer(bool enable)
+{
+    hal_mock_dma_wait();
+    if (enable && !hal_mock_dma.started)
+    {
+        if (pthread_create(&hal_mock_dma.thread, NULL, hal_mock_dma_thread, NULL) != 0)
+        {
+            fprintf(stderr, "hal_mock: no DMA thread\n");
+            exit(2);
+        }
+        hal_mock_dma.started = true;
+    }
+    hal_mock_dma.defer = enable;
+}
+
+
+const hal_mock_dma_t *hal_mock_dma_chain(uint32_t *num)
+{
+    *num = hal_mock_dma.num;
+    return hal_mock_dma.chain;
+}
+
+
+bool hal_mock_dma_busy(void)
+{
+    return hal_mock_dma.busy;
+}
+
+
+uint32_t hal_mock_dma_collisions(void)
+{
+    return hal_mock_dma.collisions;
+}
+
+
+/*******************************************************************************
+ * Asynchronous transfers. The bytes are logged at the kick, they go out in
+ * that order. Without deferral the done event comes before the return.
+ *******************************************************************************/
+cy_rslt_t cyhal_spi_transfer_async(cyhal_spi_t *obj, const uint8_t *tx, size_t tx_length, uint8_t *rx, size_t rx_length)
+{
+    hal_mock_dma_t *dma;
+
+    (void)obj;
+    (void)rx;
+    (void)rx_length;
+    hal_mock_dma_check();
+    hal_mock_clock_out(tx, (uint32_t)tx_length);
+    hal_mock_calls.transfer_async++;
+    DWT->CYCCNT += HAL_MOCK_CALL_CYCLES;
+
+    if (!hal_mock_dma.defer)
+    {
+        DWT->CYCCNT += (uint32_t)tx_length * HAL_MOCK_BYTE_CYCLES;
+        if (hal_mock_callback != NULL)
+        {
+            hal_mock_callback(hal_mock_callback_arg, CYHAL_SPI_IRQ_DONE);
+        }
+        return CY_RSLT_SUCCESS;
+    }
+
+    pthread_mutex_lock(&hal_mock_dma.lock);
+    if (hal_mock_dma.busy)
+    {
+        /* The HAL refuses a transfer while one is running */
+        pthread_mutex_unlock(&hal_mock_dma.lock);
+        return CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, 0u, 1u);
+    }
+    dma = &hal_mock_dma.chain[(hal_mock_dma.num < HAL_MOCK_DMA_CHAIN) ? hal_mock_dma.num : (HAL_MOCK_DMA_CHAIN - 1u)];
+    hal_mock_dma.num += (hal_mock_dma.num < HAL_MOCK_DMA_CHAIN) ? 1u : 0u;
+    dma->buf = tx;
+    dma->len = (uint32_t)tx_length;
+    dma->done = false;
+    dma->modified = false;
+    hal_mock_dma.sum = hal_mock_sum(tx, (uint32_t)tx_length);
+    hal_mock_dma.busy = true;
+    hal_mock_dma.current = dma;
+    pthread_cond_signal(&hal_mock_dma.kick);
+    pthread_mutex_unlock(&hal_mock_dma.lock);
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cyhal_spi_set_async_mode(cyhal_spi_t *obj, cyhal_async_mode_t mode, uint8_t dma_priority)
+{
+    (void)obj;
+    (void)mode;
+    (void)dma_priority;
+    return CY_RSLT_SUCCESS;
+}
+
+
+void cyhal_spi_register_callback(cyhal_spi_t *obj, cyhal_spi_event_callback_t callback, void *callback_arg)
+{
+    (void)obj;
+    hal_mock_callback = callback;
+    hal_mock_callback_arg = callback_arg;
+}
+
+
+void cyhal_spi_enable_event(cyhal_spi_t *obj, cyhal_spi_event_t event, uint8_t intr_priority, bool enable)
+{
+    (void)obj;
+    (void)event;
+    (void)intr_priority;
+    (void)enable;
+}
+
+
+cy_rslt_t cyhal_spi_set_frequency(cyhal_spi_t *obj, uint32_t hz)
+{
+    (void)obj;
+    (void)hz;
+    return CY_RSLT_SUCCESS;
+}
+
+
+void cyhal_spi_free(cyhal_spi_t *obj)
+{
+    (void)obj;
+}
+
+
+bool Cy_SCB_SPI_IsTxComplete(CySCB_Type const *base)
+{
+    (void)base;
+    return true;
+}
+
+
+void Cy_SCB_SPI_ClearRxFifo(CySCB_Type *base)
+{
+    (void)base;
+}
+
+
+void Cy_SCB_SPI_ClearRxFifoStatus(CySCB_Type *base, uint32_t clearMask)
+{
+    (void)base;
+    (void)clearMask;
+}
+
+
+void Cy_SCB_SPI_Disable(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
+{
+    (void)base;
+    (void)context;
+}
+
+
+void Cy_SCB_SPI_Enable(CySCB_Type *base)
+{
+    (void)base;
+}
+
+
+void cyhal_system_delay_ms(uint32_t milliseconds)
+{
+    hal_mock_calls.delays++;
+    DWT->CYCCNT += milliseconds * (HAL_MOCK_CORE_HZ / 1000u);
+}
+
+
+uint32_t cyhal_system_critical_section_enter(void)
+{
+    pthread_mutex_lock(&hal_mock_critical);
+    return 0u;
+}
+
+
+void cyhal_system_critical_section_exit(uint32_t old_interrupt_state)
+{
+    (void)old_interrupt_state;
+    pthread_mutex_unlock(&hal_mock_critical);
+}
+
+/* [] END OF FILE */
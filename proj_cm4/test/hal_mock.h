@@ -0,0 +1,138 @@
+/*
+ * hal_mock.h
+ *
+ *  Host mock of the cyhal SPI/GPIO and PDL SCB calls behind mtb_hx8347.c,
+ *  lcd_dma.c and lcd_shadow.c. Every byte the driver clocks out is logged
+ *  with the levels LCD_DC and LCD_CS had at that moment, and every HAL call
+ *  is counted. The DWT cycle counter advances by a fixed cost per call and
+ *  per byte, so the driver's own throughput figures come out of a model of
+ *  the target rather than the speed of the host.
+ *
+ *  Asynchronous transfers either finish before cyhal_spi_transfer_async()
+ *  returns or, with hal_mock_dma_defer(), go to a thread that plays the DMA:
+ *  it keeps each transfer on the wire for its byte time and then raises the
+ *  done event, so the driver's double buffering and fences run against a
+ *  transfer that is really still in flight.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cyhal.h"
+#include "mtb_hx8347.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/* Core clock of the model, the CM4 of the kit */
+#define HAL_MOCK_CORE_HZ            (100000000u)
+
+/* Cycles one byte takes on the wire at LCD_SPI_FREQ_HZ */
+#define HAL_MOCK_BYTE_CYCLES        (8u * (HAL_MOCK_CORE_HZ / LCD_SPI_FREQ_HZ))
+
+/* Cycles the HAL spends around a blocking call before the byte moves */
+#define HAL_MOCK_CALL_CYCLES        (150u)
+
+/* Transfers kept in the deferred DMA chain */
+#define HAL_MOCK_DMA_CHAIN          (64u)
+
+/** One byte on the wire */
+typedef struct
+{
+    uint8_t byte;
+    uint8_t dc;             /**< LCD_DC level, 0 command, 1 data */
+    uint8_t cs;             /**< LCD_CS level, must be 0 */
+} hal_mock_wire_t;
+
+/** Calls since the last hal_mock_reset() */
+typedef struct
+{
+    uint32_t spi_send;      /**< cyhal_spi_send() */
+    uint32_t write_array;   /**< Cy_SCB_SPI_WriteArrayBlocking() */
+    uint32_t transfer_async;/**< cyhal_spi_transfer_async() */
+    uint32_t gpio_writes;   /**< Cy_GPIO_Set()/Cy_GPIO_Clr() and cyhal_gpio_write() */
+    uint32_t delays;        /**< cyhal_system_delay_ms() */
+} hal_mock_calls_t;
+
+extern hal_mock_calls_t hal_mock_calls;
+
+/** One transfer of the deferred DMA chain */
+typedef struct
+{
+    const uint8_t *buf;     /**< Source buffer */
+    uint32_t len;           /**< Bytes */
+    bool done;              /**< Done event raised */
+    bool modified;          /**< Buffer written while the transfer was on the wire */
+} hal_mock_dma_t;
+
+/* The SPI object main.c owns on the target */
+extern cyhal_spi_t mSPI;
+
+
+/**
+ * Clears the byte log, the call counters and the DMA chain, once the
+ * transfer on the wire is done. The pin levels and the cycle counter carry
+ * on.
+ */
+void hal_mock_reset(void);
+
+/**
+ * Returns the byte log.
+ * @param[out] num Number of bytes logged since the last reset
+ * @return First entry
+ */
+const hal_mock_wire_t *hal_mock_wire(uint32_t *num);
+
+/**
+ * Counts the logged bytes sent with one LCD_DC level.
+ * @param[in] dc 0 for command bytes, 1 for data bytes
+ * @return Number of bytes
+ */
+uint32_t hal_mock_count(uint8_t dc);
+
+/**
+ * Returns the level of a pin.
+ * @param[in] pin Pin number
+ * @return true if high
+ */
+bool hal_mock_pin(cyhal_gpio_t pin);
+
+/**
+ * Keeps asynchronous transfers in flight for their byte time, see above.
+ * Waits for the transfer on the wire before switching.
+ * @param[in] enable true to defer the done event
+ */
+void hal_mock_dma_defer(bool enable);
+
+/**
+ * Returns the deferred transfers since the last hal_mock_reset().
+ * @param[out] num Number of transfers, at most HAL_MOCK_DMA_CHAIN are kept
+ * @return First transfer
+ */
+const hal_mock_dma_t *hal_mock_dma_chain(uint32_t *num);
+
+/**
+ * Returns whether a deferred transfer is on the wire.
+ * @return true until its done event
+ */
+bool hal_mock_dma_busy(void);
+
+/**
+ * Counts the blocking sends and the transfers that were started while a
+ * deferred transfer was still on the wire, since the last hal_mock_reset().
+ * The driver's fences must keep this at 0.
+ * @return Number of collisions
+ */
+uint32_t hal_mock_dma_collisions(void);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
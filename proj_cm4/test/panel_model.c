@@ -0,0 +1,197 @@
+/*
+ * panel_model.c
+ *
+ *  Reference model of the HX8347, see panel_model.h. Written from the
+ *  controller's register description rather than from the driver: the
+ *  window and scan registers are plain register contents and the address
+ *  counter walks them pixel by pixel.
+ */
+
+#include "panel_model.h"
+
+#include <string.h>
+
+
+#define PANEL_COLS                  (240u)
+#define PANEL_ROWS                  (320u)
+
+/* Register 0x16 */
+#define PANEL_MY                    (0x80u)
+#define PANEL_MX                    (0x40u)
+#define PANEL_MV                    (0x20u)
+
+/* Register 0x01 */
+#define PANEL_SCROLL                (0x08u)
+
+/* Register 0x17, anything else is 16bpp here */
+#define PANEL_COLMOD_12BPP          (0x03u)
+
+static struct
+{
+    uint16_t frame[PANEL_ROWS][PANEL_COLS];
+    bool written[PANEL_ROWS][PANEL_COLS];
+    uint8_t regs[256];
+    uint8_t index;          /* Register selected by the last command byte */
+    uint16_t ac_x, ac_y;    /* Address counter, in the scan order */
+    uint8_t bytes[3];       /* GRAM bytes of a pixel or 12bpp pair so far */
+    uint8_t num_bytes;
+    uint32_t stray;
+} panel;
+
+
+static uint16_t panel_reg16(uint8_t high)
+{
+    return (uint16_t)((panel.regs[high] << 8) | panel.regs[high + 1u]);
+}
+
+
+void panel_model_reset(void)
+{
+    memset(&panel, 0, sizeof(panel));
+    /* Power-on window, the whole panel */
+    panel.regs[0x05] = (uint8_t)(PANEL_COLS - 1u);
+    panel.regs[0x08] = (uint8_t)((PANEL_ROWS - 1u) >> 8);
+    panel.regs[0x09] = (uint8_t)(PANEL_ROWS - 1u);
+    panel.regs[0x17] = 0x06u;
+}
+
+
+/*******************************************************************************
+ * Stores a pixel at the address counter and steps it. The counter runs in
+ * the scan order 0x16 selects: MX and MY count the column and row addresses
+ * down from the far edge of that order, MV swaps which of them is the GRAM
+ * column.
+ *******************************************************************************/
+static void panel_put(uint16_t color)
+{
+    uint8_t madctl = panel.regs[0x16];
+    uint16_t width = (madctl & PANEL_MV) ? PANEL_ROWS : PANEL_COLS;
+    uint16_t height = (madctl & PANEL_MV) ? PANEL_COLS : PANEL_ROWS;
+    uint16_t x = panel.ac_x, y = panel.ac_y;
+    uint16_t col, row;
+
+    if ((x < width) && (y < height))
+    {
+        if (madctl & PANEL_MX)
+        {
+            x = (uint16_t)(width - 1u - x);
+        }
+        if (madctl & PANEL_MY)
+        {
+            y = (uint16_t)(height - 1u - y);
+        }
+        col = (madctl & PANEL_MV) ? y : x;
+        row = (madctl & PANEL_MV) ? x : y;
+        panel.frame[row][col] = color;
+        panel.written[row][col] = true;
+    }
+
+    if (panel.ac_x >= panel_reg16(0x04))
+    {
+        panel.ac_x = panel_reg16(0x02);
+        panel.ac_y = (panel.ac_y >= panel_reg16(0x08)) ? panel_reg16(0x06) : (uint16_t)(panel.ac_y + 1u);
+    }
+    else
+    {
+        panel.ac_x++;
+    }
+}
+
+
+/* 4 bits per channel widened the way the panel does, top bits repeated */
+static uint16_t panel_444(uint16_t c)
+{
+    uint16_t r = (c >> 8) & 0xFu, g = (c >> 4) & 0xFu, b = c & 0xFu;
+
+    return (uint16_t)((((r << 1) | (r >> 3)) << 11) | (((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3)));
+}
+
+
+static void panel_gram(uint8_t byte)
+{
+    panel.bytes[panel.num_bytes++] = byte;
+    if (panel.regs[0x17] == PANEL_COLMOD_12BPP)
+    {
+        if (panel.num_bytes == 3u)
+        {
+            panel_put(panel_444((uint16_t)((panel.bytes[0] << 4) | (panel.bytes[1] >> 4))));
+            panel_put(panel_444((uint16_t)(((panel.bytes[1] & 0xFu) << 8) | panel.bytes[2])));
+            panel.num_bytes = 0u;
+        }
+    }
+    else if (panel.num_bytes == 2u)
+    {
+        panel_put((uint16_t)((panel.bytes[0] << 8) | panel.bytes[1]));
+        panel.num_bytes = 0u;
+    }
+}
+
+
+void panel_model_replay(const hal_mock_wire_t *wire, uint32_t num)
+{
+    uint32_t i;
+
+    for (i = 0; i < num; i++)
+    {
+        if (wire[i].cs != 0u)
+        {
+            panel.stray++;
+            continue;
+        }
+        if (wire[i].dc == 0u)
+        {
+            panel.index = wire[i].byte;
+            panel.num_bytes = 0u;
+            continue;
+        }
+        if (panel.index == 0x22)
+        {
+            panel_gram(wire[i].byte);
+            continue;
+        }
+        panel.regs[panel.index] = wire[i].byte;
+        /* The start registers load the address counter */
+        if ((panel.index == 0x02) || (panel.index == 0x03))
+        {
+            panel.ac_x = panel_reg16(0x02);
+        }
+        else if ((panel.index == 0x06) || (panel.index == 0x07))
+        {
+            panel.ac_y = panel_reg16(0x06);
+        }
+    }
+}
+
+
+uint16_t panel_model_pixel(uint16_t col, uint16_t row, bool *written)
+{
+    if (written != NULL)
+    {
+        *written = panel.written[row][col];
+    }
+    return panel.frame[row][col];
+}
+
+
+uint16_t panel_model_glass(uint16_t col, uint16_t row)
+{
+    uint16_t tfa = panel_reg16(0x0E);
+    uint16_t vsa = panel_reg16(0x10);
+    uint16_t bfa = panel_reg16(0x12);
+    uint16_t vsp = panel_reg16(0x14);
+
+    if ((panel.regs[0x01] & PANEL_SCROLL) && (vsa != 0u) && (row >= tfa) && (row < PANEL_ROWS - bfa) &&
+        (vsp >= tfa) && (vsp < tfa + vsa))
+    {
+        row = (uint16_t)(tfa + ((vsp - tfa) + (row - tfa)) % vsa);
+    }
+    return panel.frame[row][col];
+}
+
+
+uint32_t panel_model_stray_bytes(void)
+{
+    return panel.stray;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,68 @@
+/*
+ * panel_model.h
+ *
+ *  Reference model of the HX8347 for the host test. It keeps the whole
+ *  240x320 GRAM as a flat frame and is fed nothing but the bytes hal_mock.c
+ *  logged off the wire, so it shares no code or state with the driver or
+ *  with lcd_shadow.c and can be held against either.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal_mock.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+/**
+ * Returns the model to the panel's reset state, every pixel unwritten.
+ */
+void panel_model_reset(void);
+
+/**
+ * Applies logged bytes in order: LCD_DC low selects a register, high writes
+ * its value or, after 0x22, GRAM.
+ * @param[in] wire Bytes from hal_mock_wire()
+ * @param[in] num  Number of bytes
+ */
+void panel_model_replay(const hal_mock_wire_t *wire, uint32_t num);
+
+/**
+ * Returns a pixel as GRAM stores it.
+ * @param[in]  col     Column 0..239
+ * @param[in]  row     Row 0..319
+ * @param[out] written Set to whether the pixel was written since the reset,
+ *                     may be NULL
+ * @return RGB565 colour the panel shows
+ */
+uint16_t panel_model_pixel(uint16_t col, uint16_t row, bool *written);
+
+/**
+ * Returns what the glass shows at a place. With the vertical scroll on
+ * (register 0x01) a gate line of the scroll area shows the GRAM row the
+ * start line (0x14-0x15) puts there, the fixed areas stay.
+ * @param[in] col Column 0..239
+ * @param[in] row Gate line 0..319
+ * @return RGB565 colour
+ */
+uint16_t panel_model_glass(uint16_t col, uint16_t row);
+
+/**
+ * Returns the bytes that were clocked with LCD_CS high and so never reached
+ * the panel.
+ * @return Number of bytes
+ */
+uint32_t panel_model_stray_bytes(void);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,110 @@
+/*
+ * rtos_mock.c
+ *
+ *  Host mock of the RTOS abstraction on pthreads, see stubs/cyabs_rtos.h.
+ */
+
+#include "cyabs_rtos.h"
+
+#include <errno.h>
+#include <time.h>
+
+
+cy_rslt_t cy_rtos_init_semaphore(cy_semaphore_t *semaphore, uint32_t maxcount, uint32_t initcount)
+{
+    pthread_mutex_init(&semaphore->lock, NULL);
+    pthread_cond_init(&semaphore->given, NULL);
+    semaphore->count = initcount;
+    semaphore->maxcount = maxcount;
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_rtos_get_semaphore(cy_semaphore_t *semaphore, cy_time_t timeout_ms, bool in_isr)
+{
+    struct timespec until;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    (void)in_isr;
+
+    clock_gettime(CLOCK_REALTIME, &until);
+    until.tv_sec += timeout_ms / 1000u;
+    until.tv_nsec += (long)(timeout_ms % 1000u) * 1000000L;
+    if (until.tv_nsec >= 1000000000L)
+    {
+        until.tv_sec++;
+        until.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&semaphore->lock);
+    while ((semaphore->count == 0u) && (result == CY_RSLT_SUCCESS))
+    {
+        if (timeout_ms == CY_RTOS_NEVER_TIMEOUT)
+        {
+            pthread_cond_wait(&semaphore->given, &semaphore->lock);
+        }
+        else if (pthread_cond_timedwait(&semaphore->given, &semaphore->lock, &until) == ETIMEDOUT)
+        {
+            result = (semaphore->count == 0u) ? CY_RTOS_TIMEOUT : CY_RSLT_SUCCESS;
+        }
+    }
+    if (result == CY_RSLT_SUCCESS)
+    {
+        semaphore->count--;
+    }
+    pthread_mutex_unlock(&semaphore->lock);
+    return result;
+}
+
+
+cy_rslt_t cy_rtos_set_semaphore(cy_semaphore_t *semaphore, bool in_isr)
+{
+    (void)in_isr;
+
+    pthread_mutex_lock(&semaphore->lock);
+    if (semaphore->count < semaphore->maxcount)
+    {
+        semaphore->count++;
+    }
+    pthread_cond_signal(&semaphore->given);
+    pthread_mutex_unlock(&semaphore->lock);
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_rtos_deinit_semaphore(cy_semaphore_t *semaphore)
+{
+    pthread_cond_destroy(&semaphore->given);
+    pthread_mutex_destroy(&semaphore->lock);
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_rtos_init_mutex(cy_mutex_t *mutex)
+{
+    pthread_mutexattr_t attr;
+
+    /* The abstraction creates recursive mutexes */
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_rtos_get_mutex(cy_mutex_t *mutex, cy_time_t timeout_ms)
+{
+    (void)timeout_ms;
+
+    pthread_mutex_lock(mutex);
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_rtos_set_mutex(cy_mutex_t *mutex)
+{
+    pthread_mutex_unlock(mutex);
+    return CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,72 @@
+/*
+ * storage_mock.c
+ *
+ *  Host stand-in for the storage task of main.c and the card behind it: jobs
+ *  run in the caller and there is no card, so lcd_snap.c draws every screen
+ *  as it would with the card slot empty.
+ */
+
+#include <stdbool.h>
+#include "ff.h"
+
+
+bool storage_call(void (*run)(void *arg), void *arg)
+{
+    run(arg);
+    return true;
+}
+
+
+FRESULT f_mount(FATFS *fs, const TCHAR *path, BYTE opt)
+{
+    (void)fs;
+    (void)path;
+    (void)opt;
+    return FR_NOT_READY;
+}
+
+
+FRESULT f_open(FIL *fp, const TCHAR *path, BYTE mode)
+{
+    (void)fp;
+    (void)path;
+    (void)mode;
+    return FR_NOT_READY;
+}
+
+
+FRESULT f_read(FIL *fp, void *buff, UINT btr, UINT *br)
+{
+    (void)fp;
+    (void)buff;
+    (void)btr;
+    *br = 0u;
+    return FR_NOT_READY;
+}
+
+
+FRESULT f_write(FIL *fp, const void *buff, UINT btw, UINT *bw)
+{
+    (void)fp;
+    (void)buff;
+    (void)btw;
+    *bw = 0u;
+    return FR_NOT_READY;
+}
+
+
+FRESULT f_lseek(FIL *fp, FSIZE_t ofs)
+{
+    (void)fp;
+    (void)ofs;
+    return FR_NOT_READY;
+}
+
+
+FRESULT f_close(FIL *fp)
+{
+    (void)fp;
+    return FR_NOT_READY;
+}
+
+/* [] END OF FILE */
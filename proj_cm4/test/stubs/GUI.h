@@ -0,0 +1,149 @@
+/*
+ * GUI.h
+ *
+ *  Host stand-in for emWin: the types and calls the driver and the modules
+ *  drawing the screens use, with emWin's names and field order. The calls
+ *  are implemented by emwin_mock.c on 16bpp memory devices and a 16bpp
+ *  screen; the fonts are monospaced stand-ins of the sizes the screens use.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+typedef uint8_t U8;
+typedef uint16_t U16;
+typedef uint32_t U32;
+typedef int16_t I16;
+typedef int32_t I32;
+
+typedef uint32_t GUI_COLOR;
+typedef uint32_t LCD_COLOR;
+typedef uint32_t LCD_PIXELINDEX;
+typedef int GUI_TIMER_TIME;
+typedef int GUI_DRAWMODE;
+typedef int GUI_MEMDEV_Handle;
+
+#ifndef GUI_CONST_STORAGE
+#define GUI_CONST_STORAGE           const
+#endif
+
+/* Colours are 0xBBGGRR */
+#define GUI_USE_ARGB                (0)
+
+#define GUI_DRAWMODE_NORMAL         (0)
+#define GUI_DRAWMODE_TRANS          (2)
+
+#define GUI_TM_NORMAL               (0)
+
+#define GUI_MEMDEV_NOTRANS          (1 << 0)
+
+#define GUI_COUNTOF(a)              (sizeof(a) / sizeof(a[0]))
+
+#define GUI_BLACK                   (0x000000u)
+#define GUI_WHITE                   (0xFFFFFFu)
+#define GUI_RED                     (0x0000FFu)
+#define GUI_GREEN                   (0x00FF00u)
+#define GUI_BLUE                    (0xFF0000u)
+#define GUI_YELLOW                  (0x00FFFFu)
+#define GUI_MAGENTA                 (0xFF00FFu)
+#define GUI_CYAN                    (0xFFFF00u)
+#define GUI_GRAY                    (0x808080u)
+
+typedef struct
+{
+    I16 x0, y0, x1, y1;
+} GUI_RECT;
+
+typedef struct
+{
+    I16 x, y;
+} GUI_POINT;
+
+/* Every character is XDist wide, emWin's fonts are opaque to the application */
+typedef struct
+{
+    U8 YSize;
+    U8 YDist;
+    U8 XDist;
+} GUI_FONT;
+
+typedef struct
+{
+    int NumEntries;
+    char HasTrans;
+    const LCD_COLOR *pPalEntries;
+} LCD_LOGPALETTE;
+
+typedef LCD_LOGPALETTE GUI_LOGPALETTE;
+
+typedef struct
+{
+    void (*pfDraw)(int x0, int y0, int xsize, int ysize, const U8 *pPixel, const LCD_LOGPALETTE *pLogPal,
+                   int xMag, int yMag);
+    GUI_COLOR (*pfIndex2Color)(LCD_PIXELINDEX Index);
+} GUI_BITMAP_METHODS;
+
+typedef struct
+{
+    U16 XSize;
+    U16 YSize;
+    U16 BytesPerLine;
+    U16 BitsPerPixel;
+    const U8 *pData;
+    const GUI_LOGPALETTE *pPal;
+    const GUI_BITMAP_METHODS *pMethods;
+} GUI_BITMAP;
+
+typedef void GUI_CALLBACK_VOID_P(void *p);
+
+extern GUI_CONST_STORAGE GUI_FONT GUI_Font8x16;
+extern GUI_CONST_STORAGE GUI_FONT GUI_Font20_ASCII;
+extern GUI_CONST_STORAGE GUI_FONT GUI_Font32B_ASCII;
+extern GUI_CONST_STORAGE GUI_FONT GUI_FontD80;
+
+GUI_TIMER_TIME GUI_GetTime(void);
+int LCD_GetXSize(void);
+int LCD_GetYSize(void);
+LCD_PIXELINDEX GUI_Color2Index(GUI_COLOR Color);
+GUI_DRAWMODE GUI_GetDrawMode(void);
+GUI_DRAWMODE GUI_SetDrawMode(GUI_DRAWMODE dm);
+void GUI_DrawBitmap(const GUI_BITMAP *pBM, int x0, int y0);
+
+GUI_COLOR GUI_GetColor(void);
+void GUI_SetColor(GUI_COLOR Color);
+GUI_COLOR GUI_GetBkColor(void);
+void GUI_SetBkColor(GUI_COLOR Color);
+const GUI_FONT *GUI_GetFont(void);
+const GUI_FONT *GUI_SetFont(const GUI_FONT *pNewFont);
+int GUI_GetTextMode(void);
+int GUI_GetFontSizeY(void);
+int GUI_GetFontDistY(void);
+int GUI_GetCharDistX(U16 c);
+int GUI_GetStringDistX(const char *s);
+void GUI_SetClipRect(const GUI_RECT *pRect);
+
+void GUI_Clear(void);
+void GUI_FillRect(int x0, int y0, int x1, int y1);
+void GUI_FillCircle(int x0, int y0, int r);
+void GUI_FillEllipse(int x0, int y0, int rx, int ry);
+void GUI_FillPolygon(const GUI_POINT *pPoints, int NumPoints, int x0, int y0);
+void GUI_EnlargePolygon(GUI_POINT *pDest, const GUI_POINT *pSrc, int NumPoints, int Len);
+void GUI_DispStringHCenterAt(const char *s, int x, int y);
+void GUI_DispDecAt(I32 v, I16 x, I16 y, U8 Len);
+void LCD_DrawBitmap(int x0, int y0, int xsize, int ysize, int xMul, int yMul, int BitsPerPixel,
+                    int BytesPerLine, const U8 *pPixel, const LCD_PIXELINDEX *pTrans);
+
+GUI_MEMDEV_Handle GUI_MEMDEV_Create(int x0, int y0, int xsize, int ysize);
+void GUI_MEMDEV_Delete(GUI_MEMDEV_Handle hMem);
+GUI_MEMDEV_Handle GUI_MEMDEV_Select(GUI_MEMDEV_Handle hMem);
+void *GUI_MEMDEV_GetDataPtr(GUI_MEMDEV_Handle hMem);
+GUI_MEMDEV_Handle GUI_MEMDEV_GetSelMemdev(void);
+int GUI_MEMDEV_Draw(GUI_RECT *pRect, GUI_CALLBACK_VOID_P *pfDraw, void *pData, int NumLines, int Flags);
+
+I32 GUI_ALLOC_GetNumUsedBytes(void);
+I32 GUI_ALLOC_GetNumFreeBytes(void);
+I32 GUI_ALLOC_GetMaxSize(void);
+I32 GUI_ALLOC_GetMaxUsedBytes(void);
+
+/* [] END OF FILE */
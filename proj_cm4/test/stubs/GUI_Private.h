@@ -0,0 +1,18 @@
+/*
+ * GUI_Private.h
+ *
+ *  Host stand-in for the emWin context, only its clip rectangle.
+ */
+
+#pragma once
+
+#include "GUI.h"
+
+typedef struct
+{
+    GUI_RECT ClipRect;
+} GUI_CONTEXT;
+
+extern GUI_CONTEXT *GUI_pContext;
+
+/* [] END OF FILE */
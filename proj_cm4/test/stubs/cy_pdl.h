@@ -0,0 +1,71 @@
+/*
+ * cy_pdl.h
+ *
+ *  Host stand-in for the parts of the PDL the LCD driver uses: the GPIO and
+ *  SCB SPI calls are implemented by hal_mock.c, the DWT cycle counter is a
+ *  plain variable the mock advances as bytes go out.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result.h"
+
+#define CY_ASSERT(x)                do { if (!(x)) { hal_mock_assert(#x, __FILE__, __LINE__); } } while (0)
+#define CY_UNUSED_PARAMETER(x)      (void)(x)
+
+void hal_mock_assert(const char *expr, const char *file, int line);
+
+/* GPIO port, the mock keeps one level per pin number */
+typedef struct
+{
+    volatile uint32_t OUT;
+} GPIO_PRT_Type;
+
+void Cy_GPIO_Set(GPIO_PRT_Type *base, uint32_t pinNum);
+void Cy_GPIO_Clr(GPIO_PRT_Type *base, uint32_t pinNum);
+
+/* SCB, only SPI_CTRL is touched directly */
+typedef struct
+{
+    volatile uint32_t SPI_CTRL;
+} CySCB_Type;
+
+typedef struct
+{
+    uint32_t unused;
+} cy_stc_scb_spi_context_t;
+
+#define SCB_SPI_CTRL(base)          ((base)->SPI_CTRL)
+#define SCB_SPI_CTRL_CPHA_Msk       (0x00000004u)
+#define SCB_SPI_CTRL_CPOL_Msk       (0x00000008u)
+#define CY_SCB_SPI_RX_OVERFLOW      (0x00000020u)
+
+void Cy_SCB_SPI_WriteArrayBlocking(CySCB_Type *base, void *buffer, uint32_t size);
+bool Cy_SCB_SPI_IsTxComplete(CySCB_Type const *base);
+void Cy_SCB_SPI_ClearRxFifo(CySCB_Type *base);
+void Cy_SCB_SPI_ClearRxFifoStatus(CySCB_Type *base, uint32_t clearMask);
+void Cy_SCB_SPI_Disable(CySCB_Type *base, cy_stc_scb_spi_context_t *context);
+void Cy_SCB_SPI_Enable(CySCB_Type *base);
+
+/* Cortex-M4 cycle counter */
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+extern CoreDebug_Type *CoreDebug;
+extern DWT_Type *DWT;
+extern uint32_t SystemCoreClock;
+
+#define CoreDebug_DEMCR_TRCENA_Msk  (1u << 24)
+#define DWT_CTRL_CYCCNTENA_Msk      (1u)
+
+/* [] END OF FILE */
@@ -0,0 +1,19 @@
+/*
+ * cy_result.h
+ *
+ *  Host stand-in for the ModusToolbox result type.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef uint32_t cy_rslt_t;
+
+#define CY_RSLT_SUCCESS             ((cy_rslt_t)0u)
+#define CY_RSLT_TYPE_ERROR          (0x00020000u)
+#define CY_RSLT_CREATE(type, module, code)  ((cy_rslt_t)((type) | (module) | (code)))
+
+/* [] END OF FILE */
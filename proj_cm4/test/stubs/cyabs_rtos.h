@@ -0,0 +1,39 @@
+/*
+ * cyabs_rtos.h
+ *
+ *  Host stand-in for the RTOS abstraction calls of the LCD_RTOS build,
+ *  implemented on pthreads by rtos_mock.c.
+ */
+
+#pragma once
+
+#include "cy_result.h"
+
+#include <pthread.h>
+
+typedef uint32_t cy_time_t;
+
+#define CY_RTOS_NEVER_TIMEOUT       (0xFFFFFFFFu)
+#define CY_RTOS_TIMEOUT             CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, 0x0100u, 2u)
+
+/* Counts up to maxcount like a FreeRTOS counting semaphore */
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t given;
+    uint32_t count;
+    uint32_t maxcount;
+} cy_semaphore_t;
+
+typedef pthread_mutex_t cy_mutex_t;
+
+cy_rslt_t cy_rtos_init_semaphore(cy_semaphore_t *semaphore, uint32_t maxcount, uint32_t initcount);
+cy_rslt_t cy_rtos_get_semaphore(cy_semaphore_t *semaphore, cy_time_t timeout_ms, bool in_isr);
+cy_rslt_t cy_rtos_set_semaphore(cy_semaphore_t *semaphore, bool in_isr);
+cy_rslt_t cy_rtos_deinit_semaphore(cy_semaphore_t *semaphore);
+
+cy_rslt_t cy_rtos_init_mutex(cy_mutex_t *mutex);
+cy_rslt_t cy_rtos_get_mutex(cy_mutex_t *mutex, cy_time_t timeout_ms);
+cy_rslt_t cy_rtos_set_mutex(cy_mutex_t *mutex);
+
+/* [] END OF FILE */
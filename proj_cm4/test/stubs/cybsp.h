@@ -0,0 +1,15 @@
+/*
+ * cybsp.h
+ *
+ *  Host stand-in for the BSP pin names the LCD driver uses.
+ */
+
+#pragma once
+
+#include "cyhal.h"
+
+#define CYBSP_D7                    ((cyhal_gpio_t)7u)
+#define CYBSP_D9                    ((cyhal_gpio_t)9u)
+#define CYBSP_D10                   ((cyhal_gpio_t)10u)
+
+/* [] END OF FILE */
@@ -0,0 +1,85 @@
+/*
+ * cyhal.h
+ *
+ *  Host stand-in for the HAL SPI, GPIO and system calls the LCD driver uses,
+ *  implemented by hal_mock.c.
+ */
+
+#pragma once
+
+#include "cy_pdl.h"
+
+/* Pins are plain numbers, CYHAL_GET_PIN() hands them to the PDL calls */
+typedef uint32_t cyhal_gpio_t;
+
+#define NC                          ((cyhal_gpio_t)0xFFu)
+
+extern GPIO_PRT_Type hal_mock_port;
+
+#define CYHAL_GET_PORTADDR(pin)     (&hal_mock_port)
+#define CYHAL_GET_PIN(pin)          ((uint32_t)(pin))
+
+typedef enum
+{
+    CYHAL_GPIO_DIR_INPUT,
+    CYHAL_GPIO_DIR_OUTPUT
+} cyhal_gpio_direction_t;
+
+typedef enum
+{
+    CYHAL_GPIO_DRIVE_NONE,
+    CYHAL_GPIO_DRIVE_STRONG
+} cyhal_gpio_drive_mode_t;
+
+cy_rslt_t cyhal_gpio_init(cyhal_gpio_t pin, cyhal_gpio_direction_t direction, cyhal_gpio_drive_mode_t drive_mode, bool init_val);
+void cyhal_gpio_write(cyhal_gpio_t pin, bool value);
+void cyhal_gpio_free(cyhal_gpio_t pin);
+
+typedef struct
+{
+    CySCB_Type *base;
+    cy_stc_scb_spi_context_t context;
+} cyhal_spi_t;
+
+typedef enum
+{
+    CYHAL_SPI_MODE_00_MSB,
+    CYHAL_SPI_MODE_00_LSB,
+    CYHAL_SPI_MODE_01_MSB,
+    CYHAL_SPI_MODE_01_LSB,
+    CYHAL_SPI_MODE_10_MSB,
+    CYHAL_SPI_MODE_10_LSB,
+    CYHAL_SPI_MODE_11_MSB,
+    CYHAL_SPI_MODE_11_LSB
+} cyhal_spi_mode_t;
+
+typedef enum
+{
+    CYHAL_SPI_IRQ_NONE = 0,
+    CYHAL_SPI_IRQ_DONE = 1 << 2
+} cyhal_spi_event_t;
+
+typedef enum
+{
+    CYHAL_ASYNC_SW,
+    CYHAL_ASYNC_DMA
+} cyhal_async_mode_t;
+
+#define CYHAL_DMA_PRIORITY_DEFAULT  (3u)
+
+typedef void (*cyhal_spi_event_callback_t)(void *callback_arg, cyhal_spi_event_t event);
+
+cy_rslt_t cyhal_spi_send(cyhal_spi_t *obj, uint32_t value);
+cy_rslt_t cyhal_spi_transfer(cyhal_spi_t *obj, const uint8_t *tx, size_t tx_length, uint8_t *rx, size_t rx_length, uint8_t write_fill);
+cy_rslt_t cyhal_spi_transfer_async(cyhal_spi_t *obj, const uint8_t *tx, size_t tx_length, uint8_t *rx, size_t rx_length);
+cy_rslt_t cyhal_spi_set_async_mode(cyhal_spi_t *obj, cyhal_async_mode_t mode, uint8_t dma_priority);
+cy_rslt_t cyhal_spi_set_frequency(cyhal_spi_t *obj, uint32_t hz);
+void cyhal_spi_register_callback(cyhal_spi_t *obj, cyhal_spi_event_callback_t callback, void *callback_arg);
+void cyhal_spi_enable_event(cyhal_spi_t *obj, cyhal_spi_event_t event, uint8_t intr_priority, bool enable);
+void cyhal_spi_free(cyhal_spi_t *obj);
+
+void cyhal_system_delay_ms(uint32_t milliseconds);
+uint32_t cyhal_system_critical_section_enter(void);
+void cyhal_system_critical_section_exit(uint32_t old_interrupt_state);
+
+/* [] END OF FILE */
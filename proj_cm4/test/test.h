@@ -0,0 +1,90 @@
+/*
+ * test.h
+ *
+ *  Checks and suites of the host test, see test_main.c.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "mtb_hx8347.h"
+
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+
+extern uint32_t test_checks;
+extern uint32_t test_failures;
+
+/* A failed check is reported and counted, the suite carries on */
+#define TEST_CHECK(cond)                                                        \
+    do {                                                                        \
+        test_checks++;                                                          \
+        if (!(cond)) {                                                          \
+            printf("  %s:%d: %s\n", __FILE__, __LINE__, #cond);                 \
+            test_failures++;                                                    \
+        }                                                                       \
+    } while (0)
+
+#define TEST_EQUAL(actual, expected)                                            \
+    do {                                                                        \
+        unsigned long test_a = (unsigned long)(actual);                         \
+        unsigned long test_e = (unsigned long)(expected);                       \
+        test_checks++;                                                          \
+        if (test_a != test_e) {                                                 \
+            printf("  %s:%d: %s is %lu, expected %lu\n", __FILE__, __LINE__,    \
+                   #actual, test_a, test_e);                                    \
+            test_failures++;                                                    \
+        }                                                                       \
+    } while (0)
+
+
+/**
+ * Brings the panel up as main.c does, then clears the byte log and the
+ * driver counters.
+ */
+void test_panel_init(void);
+
+/**
+ * Feeds the reference panel model the bytes logged since the last replay,
+ * then clears the log.
+ */
+void test_replay(void);
+
+/**
+ * Maps a logical pixel to GRAM with the formulas documented on
+ * mtb_hx8347_rotation_t, written out per orientation.
+ * @param[in]  rotation Orientation
+ * @param[in]  x        Logical column
+ * @param[in]  y        Logical row
+ * @param[out] col      GRAM column
+ * @param[out] row      GRAM row
+ */
+void test_gram_of(mtb_hx8347_rotation_t rotation, uint16_t x, uint16_t y, uint16_t *col, uint16_t *row);
+
+/* Suites */
+void test_hal_calls(void);
+void test_window_registers(void);
+void test_shadow_frame(void);
+void test_shadow_cap(void);
+void test_rotation(void);
+void test_dma(void);
+void test_scroll(void);
+void test_prof(void);
+void test_sprite(void);
+void test_dlist(void);
+void test_region(void);
+void test_bitmap(void);
+void test_rle(void);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+/* [] END OF FILE */
@@ -0,0 +1,184 @@
+/*
+ * test_bitmap.c
+ *
+ *  Palette cache of lcd_bitmap.c: six palettes go through the
+ *  LCD_BITMAP_CACHE_SIZE entries. Misses are counted in the palette zone of
+ *  lcd_prof.c, hits hand back the table they handed out before, and the
+ *  oldest palette is the one evicted. Every table handed out must hold the
+ *  direct conversion of its palette, the wire-order twin the same colours
+ *  high byte first, and a bitmap drawn through the cache must come out as
+ *  GUI_DrawBitmap() draws it.
+ */
+
+#include "mtb_hx8347.h"
+#include "lcd_bitmap.h"
+#include "lcd_prof.h"
+#include "emwin_mock.h"
+#include "test.h"
+
+
+#define TEST_PALETTES               (6)
+
+/* Bitmap drawn both ways */
+#define TEST_BITMAP_XSIZE           (24)
+#define TEST_BITMAP_YSIZE           (10)
+
+/* Short palettes leave the tail of the tables at 0 */
+static const int test_entries[TEST_PALETTES] = { 256, 256, 16, 256, 200, 3 };
+
+static LCD_COLOR test_colors[TEST_PALETTES][256];
+static LCD_LOGPALETTE test_pals[TEST_PALETTES];
+static U8 test_pixels[TEST_BITMAP_XSIZE * TEST_BITMAP_YSIZE];
+
+
+/* Palette conversions so far */
+static uint32_t test_misses(void)
+{
+    lcd_prof_stats_t stats;
+
+    lcd_prof_get_stats(LCD_PROF_PALETTE, &stats);
+    return stats.count;
+}
+
+
+/*******************************************************************************
+ * Checks both tables of a palette against the direct conversion.
+ * @return Entries that differ
+ *******************************************************************************/
+static uint32_t test_tables(int k, const LCD_PIXELINDEX *trans)
+{
+    const uint16_t *wire = lcd_bitmap_get_wire_lut(trans);
+    const uint8_t *bytes = (const uint8_t *)wire;
+    LCD_PIXELINDEX want;
+    uint32_t errors = 0u;
+    int i;
+
+    if (wire == NULL)
+    {
+        return 256u;
+    }
+    for (i = 0; i < 256; i++)
+    {
+        want = (i < test_pals[k].NumEntries) ? GUI_Color2Index(test_colors[k][i]) : 0u;
+        if ((trans[i] != want) || (bytes[2 * i] != (uint8_t)(want >> 8)) || (bytes[2 * i + 1] != (uint8_t)want))
+        {
+            if (errors == 0u)
+            {
+                printf("  palette %d entry %d: trans %04lX, wire %02X%02X, expected %04lX\n", k, i,
+                       (unsigned long)trans[i], bytes[2 * i], bytes[2 * i + 1], (unsigned long)want);
+            }
+            errors++;
+        }
+    }
+    return errors;
+}
+
+
+/*******************************************************************************
+ * Draws the test bitmap with a palette into a fresh device.
+ * @return The device, to be deleted by the caller
+ *******************************************************************************/
+static GUI_MEMDEV_Handle test_draw(int k, bool cached)
+{
+    const GUI_BITMAP bm =
+    {
+        TEST_BITMAP_XSIZE, TEST_BITMAP_YSIZE, TEST_BITMAP_XSIZE, 8, test_pixels, &test_pals[k], NULL
+    };
+    GUI_MEMDEV_Handle hMem = GUI_MEMDEV_Create(0, 0, TEST_BITMAP_XSIZE, TEST_BITMAP_YSIZE);
+
+    GUI_MEMDEV_Select(hMem);
+    if (cached)
+    {
+        lcd_bitmap_draw(&bm, 0, 0);
+    }
+    else
+    {
+        GUI_DrawBitmap(&bm, 0, 0);
+    }
+    GUI_MEMDEV_Select(0);
+    return hMem;
+}
+
+
+void test_bitmap(void)
+{
+    const LCD_PIXELINDEX *trans[TEST_PALETTES];
+    GUI_MEMDEV_Handle cached, direct;
+    uint32_t i, errors, misses;
+    int k;
+
+    for (k = 0; k < TEST_PALETTES; k++)
+    {
+        for (i = 0; i < 256u; i++)
+        {
+            test_colors[k][i] = (LCD_COLOR)((i * 0x0107F3u) ^ ((uint32_t)k * 0x2A5C11u));
+        }
+        test_pals[k].NumEntries = test_entries[k];
+        test_pals[k].HasTrans = 0;
+        test_pals[k].pPalEntries = test_colors[k];
+    }
+    for (i = 0; i < sizeof(test_pixels); i++)
+    {
+        test_pixels[i] = (U8)((i * 37u) % 3u);
+    }
+    lcd_prof_reset();
+    emwin_mock_reset();
+
+    /* Four misses fill the cache whatever it held, then four hits */
+    errors = 0u;
+    for (k = 0; k < LCD_BITMAP_CACHE_SIZE; k++)
+    {
+        trans[k] = lcd_bitmap_get_trans(&test_pals[k]);
+        errors += test_tables(k, trans[k]);
+    }
+    TEST_EQUAL(errors, 0u);
+    TEST_EQUAL(test_misses(), LCD_BITMAP_CACHE_SIZE);
+    for (k = 0; k < LCD_BITMAP_CACHE_SIZE; k++)
+    {
+        TEST_CHECK(lcd_bitmap_get_trans(&test_pals[k]) == trans[k]);
+    }
+    TEST_EQUAL(test_misses(), LCD_BITMAP_CACHE_SIZE);
+
+    /* Each new palette takes the entry of the oldest */
+    trans[4] = lcd_bitmap_get_trans(&test_pals[4]);
+    TEST_CHECK(trans[4] == trans[0]);
+    TEST_EQUAL(test_tables(4, trans[4]), 0u);
+    trans[5] = lcd_bitmap_get_trans(&test_pals[5]);
+    TEST_CHECK(trans[5] == trans[1]);
+    TEST_EQUAL(test_tables(5, trans[5]), 0u);
+    TEST_EQUAL(test_misses(), LCD_BITMAP_CACHE_SIZE + 2u);
+    for (k = 2; k < TEST_PALETTES; k++)
+    {
+        TEST_CHECK(lcd_bitmap_get_trans(&test_pals[k]) == trans[k]);
+    }
+    TEST_EQUAL(test_misses(), LCD_BITMAP_CACHE_SIZE + 2u);
+
+    /* An evicted palette comes back converted again, over the next oldest */
+    TEST_CHECK(lcd_bitmap_get_trans(&test_pals[0]) == trans[2]);
+    TEST_EQUAL(test_tables(0, trans[2]), 0u);
+    TEST_EQUAL(test_misses(), LCD_BITMAP_CACHE_SIZE + 3u);
+    TEST_CHECK(lcd_bitmap_get_wire_lut(test_pals[0].pPalEntries) == NULL);
+
+    /* Drawn through the cache as emWin draws it, a cached palette is no miss */
+    misses = test_misses();
+    for (k = 0; k < TEST_PALETTES; k += 5)
+    {
+        cached = test_draw(k, true);
+        direct = test_draw(k, false);
+        errors = 0u;
+        for (i = 0; i < sizeof(test_pixels); i++)
+        {
+            errors += (((uint16_t *)GUI_MEMDEV_GetDataPtr(cached))[i] !=
+                       ((uint16_t *)GUI_MEMDEV_GetDataPtr(direct))[i]) ? 1u : 0u;
+        }
+        TEST_EQUAL(errors, 0u);
+        GUI_MEMDEV_Delete(cached);
+        GUI_MEMDEV_Delete(direct);
+    }
+    TEST_EQUAL(test_misses(), misses);
+    TEST_EQUAL(emwin_mock_calls.unselected, 0u);
+
+    lcd_prof_reset();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,118 @@
+/*
+ * test_dlist.c
+ *
+ *  Display list optimizer against plain replay: menu_screen() and
+ *  number_screen() are drawn straight to the emWin screen once replayed as
+ *  recorded and once optimized, over a screen painted with a pattern none of
+ *  them uses. Both must leave the same colour on every pixel, the optimized
+ *  one with fewer fill pixels, and send one GUI_FillRect() per rectangle it
+ *  counts.
+ */
+
+#include "mtb_hx8347.h"
+#include "lcd_dlist.h"
+#include "screens.h"
+#include "emwin_mock.h"
+#include "test.h"
+
+#include <string.h>
+
+
+/* What was on the screen before */
+static uint16_t test_old_screen(int x, int y)
+{
+    return (uint16_t)(0x0841u + x * 3 + y * 97);
+}
+
+
+/*******************************************************************************
+ * Draws a screen over the pattern with the optimizer on or off.
+ * @return emWin calls of the screen
+ *******************************************************************************/
+static emwin_mock_calls_t test_draw(void (*screen)(void), bool optimize, lcd_dlist_stats_t *stats)
+{
+    emwin_mock_calls_t calls;
+
+    emwin_mock_paint(test_old_screen);
+    memset(&emwin_mock_calls, 0, sizeof(emwin_mock_calls));
+    lcd_dlist_set_optimize(optimize);
+    screen();
+    lcd_dlist_get_stats(stats);
+    calls = emwin_mock_calls;
+    return calls;
+}
+
+
+void test_dlist(void)
+{
+    static const struct
+    {
+        const char *name;
+        void (*draw)(void);
+    } screens[] =
+    {
+        { "menu_screen",   menu_screen },
+        { "number_screen", number_screen },
+    };
+    static uint16_t replayed[LCD_WIDTH * LCD_HEIGHT];
+    mtb_hx8347_rotation_t rotation = mtb_hx8347_get_rotation();
+    emwin_mock_calls_t plain, optimized;
+    lcd_dlist_stats_t stats;
+    uint32_t i, errors;
+    int x, y, xsize, ysize;
+
+    test_panel_init();
+    mtb_hx8347_set_rotation(MTB_HX8347_ROTATION_90);
+    emwin_mock_reset();
+    xsize = LCD_GetXSize();
+    ysize = LCD_GetYSize();
+
+    for (i = 0; i < sizeof(screens) / sizeof(screens[0]); i++)
+    {
+        plain = test_draw(screens[i].draw, false, &stats);
+        TEST_CHECK(!stats.overflow);
+        TEST_EQUAL(stats.rects, 0u);
+        for (y = 0; y < ysize; y++)
+        {
+            for (x = 0; x < xsize; x++)
+            {
+                replayed[y * xsize + x] = emwin_mock_lcd(x, y);
+            }
+        }
+
+        optimized = test_draw(screens[i].draw, true, &stats);
+        TEST_CHECK(!stats.overflow);
+        TEST_EQUAL(optimized.fill_rects, stats.rects);
+        TEST_CHECK(optimized.fill_pixels < plain.fill_pixels);
+        TEST_CHECK(optimized.lcd_pixels < plain.lcd_pixels);
+
+        errors = 0u;
+        for (y = 0; y < ysize; y++)
+        {
+            for (x = 0; x < xsize; x++)
+            {
+                if (emwin_mock_lcd(x, y) != replayed[y * xsize + x])
+                {
+                    if (errors == 0u)
+                    {
+                        printf("  %s x %d y %d: optimized %04X, replayed %04X\n", screens[i].name, x, y,
+                               (unsigned)emwin_mock_lcd(x, y), (unsigned)replayed[y * xsize + x]);
+                    }
+                    errors++;
+                }
+            }
+        }
+        TEST_EQUAL(errors, 0u);
+
+        printf("  %-14s fills %6lu -> %6lu pixels, all %6lu -> %6lu, %lu rectangles\n", screens[i].name,
+               (unsigned long)plain.fill_pixels, (unsigned long)optimized.fill_pixels,
+               (unsigned long)plain.lcd_pixels, (unsigned long)optimized.lcd_pixels,
+               (unsigned long)stats.rects);
+    }
+
+    TEST_EQUAL(emwin_mock_calls.created, 0u);
+    lcd_dlist_set_optimize(true);
+    mtb_hx8347_set_rotation(rotation);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,143 @@
+/*
+ * test_dma.c
+ *
+ *  DMA streaming against the deferred DMA of hal_mock.c: streams are cut
+ *  into line buffers that alternate, the CPU is back while the last one is
+ *  still on the wire, no buffer changes under a running transfer and
+ *  blocking traffic waits for the fence.
+ */
+
+#include "cyhal.h"
+#include "mtb_hx8347.h"
+#include "lcd_dma.h"
+#include "hal_mock.h"
+#include "test.h"
+
+#include <string.h>
+
+
+/* Bytes of the long test stream, four full line buffers and a part */
+#define TEST_DMA_BYTES              (4u * LCD_DMA_BUF_SIZE + 904u)
+
+
+/*******************************************************************************
+ * Compares the data bytes on the wire with what was handed over.
+ *******************************************************************************/
+static bool test_wire_data(const uint8_t *data, uint32_t num)
+{
+    const hal_mock_wire_t *wire;
+    uint32_t i, n, k = 0u;
+
+    wire = hal_mock_wire(&n);
+    for (i = 0; i < n; i++)
+    {
+        if (wire[i].dc == 0u)
+        {
+            continue;
+        }
+        if ((k >= num) || (wire[i].byte != data[k]) || (wire[i].cs != 0u))
+        {
+            return false;
+        }
+        k++;
+    }
+    return k == num;
+}
+
+
+/*******************************************************************************
+ * Checks the chain of one stream: full line buffers but the last, the two
+ * buffers taking turns, none written while it was on the wire.
+ *******************************************************************************/
+static void test_chain(uint32_t bytes)
+{
+    const hal_mock_dma_t *chain;
+    uint32_t i, num, total = 0u;
+
+    chain = hal_mock_dma_chain(&num);
+    TEST_EQUAL(num, (bytes + LCD_DMA_BUF_SIZE - 1u) / LCD_DMA_BUF_SIZE);
+    for (i = 0; i < num; i++)
+    {
+        TEST_CHECK(chain[i].done);
+        TEST_CHECK(!chain[i].modified);
+        TEST_EQUAL(chain[i].len, (i + 1u < num) ? LCD_DMA_BUF_SIZE : bytes - total);
+        if (i > 0u)
+        {
+            TEST_CHECK(chain[i].buf != chain[i - 1u].buf);
+        }
+        if (i > 1u)
+        {
+            TEST_CHECK(chain[i].buf == chain[i - 2u].buf);
+        }
+        total += chain[i].len;
+    }
+    TEST_EQUAL(total, bytes);
+}
+
+
+void test_dma(void)
+{
+    static uint8_t data[TEST_DMA_BYTES];
+    static uint16_t pixels[700];
+    static uint8_t wire[2u * 700u];
+    mtb_hx8347_stats_t stats;
+    uint32_t i, fence;
+    bool reached;
+
+    for (i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(i * 13u + (i >> 8));
+    }
+    for (i = 0; i < 700u; i++)
+    {
+        pixels[i] = (uint16_t)(0xA000u + i * 3u);
+        wire[2u * i] = (uint8_t)(pixels[i] >> 8);
+        wire[2u * i + 1u] = (uint8_t)pixels[i];
+    }
+
+    test_panel_init();
+    TEST_EQUAL(lcd_dma_init(), CY_RSLT_SUCCESS);
+    hal_mock_dma_defer(true);
+
+    /* The call returns with the last buffer still on the wire */
+    mtb_hx8347_set_window(0, 0, mtb_hx8347_get_width() - 1u, mtb_hx8347_get_height() - 1u);
+    hal_mock_reset();
+    lcd_dma_write_data_stream(data, (int)sizeof(data));
+    fence = lcd_dma_get_fence();
+    reached = lcd_dma_fence_reached(fence);
+    TEST_CHECK(!reached);
+    TEST_CHECK(hal_mock_dma_busy());
+    lcd_dma_wait_fence(fence);
+    TEST_CHECK(lcd_dma_fence_reached(fence));
+    TEST_CHECK(!hal_mock_dma_busy());
+    TEST_CHECK(hal_mock_pin(LCD_CS_PIN));
+    test_chain(sizeof(data));
+    TEST_CHECK(test_wire_data(data, sizeof(data)));
+    TEST_EQUAL(hal_mock_calls.spi_send + hal_mock_calls.write_array, 0u);
+
+    /* The 16-bit port swaps into wire order on the way into the buffers */
+    hal_mock_reset();
+    lcd_dma_write_data16_stream(pixels, 700);
+    lcd_dma_fence();
+    test_chain(sizeof(wire));
+    TEST_CHECK(test_wire_data(wire, sizeof(wire)));
+
+    /* A command right behind a stream waits for it through the fence */
+    hal_mock_reset();
+    lcd_dma_write_data_stream(data, 2 * LCD_DMA_BUF_SIZE);
+    mtb_hx8347_set_window(0, 0, 9, 9);
+    TEST_EQUAL(hal_mock_dma_collisions(), 0u);
+
+    /* Short streams go out blocking */
+    hal_mock_reset();
+    mtb_hx8347_reset_stats();
+    lcd_dma_write_data_stream(data, LCD_DMA_MIN_BYTES - 2);
+    mtb_hx8347_get_stats(&stats);
+    TEST_EQUAL(hal_mock_calls.transfer_async, 0u);
+    TEST_EQUAL(stats.bursts, 1u);
+
+    hal_mock_dma_defer(false);
+    TEST_EQUAL(hal_mock_dma_collisions(), 0u);
+}
+
+/* [] END OF FILE */
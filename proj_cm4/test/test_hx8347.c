@@ -0,0 +1,210 @@
+/*
+ * test_hx8347.c
+ *
+ *  Driver traffic: the HAL calls a frame costs in each transfer mode and the
+ *  register bytes each GRAM window costs.
+ */
+
+#include "cyhal.h"
+#include "mtb_hx8347.h"
+#include "hal_mock.h"
+#include "test.h"
+
+#include <string.h>
+
+
+/* Window registers and 0x22 of a rect with both ends rewritten */
+#define TEST_WINDOW_BYTES           (8u * 2u + 1u)
+
+
+/*******************************************************************************
+ * Hashes the log, so two modes can be shown to put the same bytes on the
+ * wire. Bytes clocked with LCD_CS high count as a failure.
+ *******************************************************************************/
+static uint32_t test_wire_hash(void)
+{
+    const hal_mock_wire_t *wire;
+    uint32_t i, num, stray = 0u, hash = 2166136261u;
+
+    wire = hal_mock_wire(&num);
+    for (i = 0; i < num; i++)
+    {
+        stray += wire[i].cs;
+        hash = (hash ^ (uint32_t)((wire[i].dc << 8) | wire[i].byte)) * 16777619u;
+    }
+    TEST_EQUAL(stray, 0u);
+    return hash;
+}
+
+
+/*******************************************************************************
+ * Sends one full frame the way emWin does, a window and then a stream per
+ * line, and returns the hash of the bytes.
+ *******************************************************************************/
+static uint32_t test_frame(bool burst, mtb_hx8347_stats_t *stats)
+{
+    static uint8_t line[2u * LCD_HEIGHT];
+    uint16_t w, h, y;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(line); i++)
+    {
+        line[i] = (uint8_t)(i * 7u);
+    }
+
+    test_panel_init();
+    mtb_hx8347_set_burst_mode(burst);
+    w = mtb_hx8347_get_width();
+    h = mtb_hx8347_get_height();
+    mtb_hx8347_set_window(0, 0, w - 1u, h - 1u);
+    for (y = 0; y < h; y++)
+    {
+        mtb_hx8347_write_data_stream(line, 2 * w);
+    }
+    mtb_hx8347_get_stats(stats);
+    mtb_hx8347_set_burst_mode(true);
+
+    return test_wire_hash();
+}
+
+
+/*******************************************************************************
+ * A frame costs one FIFO write per line in burst mode and one cyhal_spi_send()
+ * per byte without it; the bytes on the wire are the same.
+ *******************************************************************************/
+void test_hal_calls(void)
+{
+    mtb_hx8347_stats_t stats;
+    hal_mock_calls_t burst, bytewise;
+    uint32_t burst_hash, bytewise_hash, burst_bps, bytewise_bps;
+    uint32_t pixels = (uint32_t)LCD_WIDTH * LCD_HEIGHT;
+    uint32_t lines;
+
+    burst_hash = test_frame(true, &stats);
+    burst = hal_mock_calls;
+    burst_bps = mtb_hx8347_get_bytes_per_second();
+    lines = mtb_hx8347_get_height();
+    TEST_EQUAL(burst.spi_send, TEST_WINDOW_BYTES);
+    TEST_EQUAL(burst.write_array, lines);
+    TEST_EQUAL(stats.bursts, lines);
+    TEST_EQUAL(stats.hal_calls, 0u);
+    TEST_EQUAL(stats.bytes, 2u * pixels);
+
+    bytewise_hash = test_frame(false, &stats);
+    bytewise = hal_mock_calls;
+    bytewise_bps = mtb_hx8347_get_bytes_per_second();
+    TEST_EQUAL(bytewise.spi_send, TEST_WINDOW_BYTES + 2u * pixels);
+    TEST_EQUAL(bytewise.write_array, 0u);
+    TEST_EQUAL(stats.bursts, 0u);
+    TEST_EQUAL(stats.hal_calls, 2u * pixels);
+    TEST_EQUAL(stats.bytes, 2u * pixels);
+
+    TEST_EQUAL(burst_hash, bytewise_hash);
+    TEST_CHECK(burst_bps > bytewise_bps);
+
+    printf("  frame           %lu HAL calls burst, %lu per byte\n",
+           (unsigned long)(burst.spi_send + burst.write_array),
+           (unsigned long)(bytewise.spi_send + bytewise.write_array));
+    printf("  modelled        %lu B/s burst, %lu B/s per byte\n",
+           (unsigned long)burst_bps, (unsigned long)bytewise_bps);
+}
+
+
+/*******************************************************************************
+ * Copies the command bytes logged since the last reset.
+ * @return Number of command bytes, all bytes in *bytes
+ *******************************************************************************/
+static uint32_t test_commands(uint8_t *commands, uint32_t max, uint32_t *bytes)
+{
+    const hal_mock_wire_t *wire;
+    uint32_t i, num, n = 0u;
+
+    wire = hal_mock_wire(&num);
+    for (i = 0; i < num; i++)
+    {
+        if ((wire[i].dc == 0u) && (n < max))
+        {
+            commands[n++] = wire[i].byte;
+        }
+    }
+    *bytes = num;
+    hal_mock_reset();
+    return n;
+}
+
+
+/*******************************************************************************
+ * A rect whose end column and row are the ones programmed last only rewrites
+ * the start registers; anything that may have moved the window behind the
+ * cache's back brings the end registers back.
+ *******************************************************************************/
+void test_window_registers(void)
+{
+    static const uint8_t all[] = { 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x22 };
+    static const uint8_t starts[] = { 0x02, 0x03, 0x06, 0x07, 0x22 };
+    static const uint8_t rows[] = { 0x02, 0x03, 0x06, 0x07, 0x08, 0x09, 0x22 };
+    static const uint8_t pixel[2] = { 0x12, 0x34 };
+    mtb_hx8347_stats_t stats;
+    uint8_t commands[16];
+    uint32_t n, bytes;
+
+    test_panel_init();
+
+    /* Nothing cached after the rotation */
+    mtb_hx8347_set_window(10, 20, 50, 60);
+    n = test_commands(commands, sizeof(commands), &bytes);
+    TEST_EQUAL(n, sizeof(all));
+    TEST_EQUAL(bytes, 2u * 8u + 1u);
+    TEST_CHECK(memcmp(commands, all, sizeof(all)) == 0);
+
+    /* Same ends, only the start registers */
+    mtb_hx8347_set_window(0, 0, 50, 60);
+    n = test_commands(commands, sizeof(commands), &bytes);
+    TEST_EQUAL(n, sizeof(starts));
+    TEST_EQUAL(bytes, 2u * 4u + 1u);
+    TEST_CHECK(memcmp(commands, starts, sizeof(starts)) == 0);
+
+    /* New bottom row, the row end follows */
+    mtb_hx8347_set_window(0, 0, 50, 61);
+    n = test_commands(commands, sizeof(commands), &bytes);
+    TEST_EQUAL(n, sizeof(rows));
+    TEST_EQUAL(bytes, 2u * 6u + 1u);
+    TEST_CHECK(memcmp(commands, rows, sizeof(rows)) == 0);
+
+    /* A blit at the cached ends adds nothing but its pixels */
+    mtb_hx8347_blit565(50, 61, 50, 61, pixel);
+    n = test_commands(commands, sizeof(commands), &bytes);
+    TEST_EQUAL(n, sizeof(starts));
+    TEST_EQUAL(bytes, 2u * 4u + 1u + sizeof(pixel));
+
+    mtb_hx8347_get_stats(&stats);
+    TEST_EQUAL(stats.reg_skipped, 4u + 2u + 4u);
+
+    /* A rotation forgets the window */
+    mtb_hx8347_set_rotation(mtb_hx8347_get_rotation());
+    (void)test_commands(commands, sizeof(commands), &bytes);
+    mtb_hx8347_set_window(50, 61, 50, 61);
+    n = test_commands(commands, sizeof(commands), &bytes);
+    TEST_EQUAL(n, sizeof(all));
+
+    /* So does GUIDRV_FlexColor programming its own */
+    mtb_hx8347_write_command(0x02);
+    (void)test_commands(commands, sizeof(commands), &bytes);
+    mtb_hx8347_set_window(50, 61, 50, 61);
+    n = test_commands(commands, sizeof(commands), &bytes);
+    TEST_EQUAL(n, sizeof(all));
+
+    /* A 12bpp fill pays for 0x17 once, the 16bpp blit after it once more */
+    mtb_hx8347_set_color12(true);
+    mtb_hx8347_fill_rect(0, 0, 50, 61, BLUE);
+    n = test_commands(commands, sizeof(commands), &bytes);
+    TEST_EQUAL(n, 1u + sizeof(starts));
+    TEST_EQUAL(commands[0], 0x17);
+    mtb_hx8347_set_color12(false);
+    mtb_hx8347_blit565(50, 61, 50, 61, pixel);
+    n = test_commands(commands, sizeof(commands), &bytes);
+    TEST_EQUAL(n, 1u + sizeof(starts));
+    TEST_EQUAL(commands[0], 0x17);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,67 @@
+/*
+ * test_main.c
+ *
+ *  Host test of the LCD driver. The driver sources are built unchanged
+ *  against the cyhal mock of hal_mock.c; each suite drives them through
+ *  their public API and checks the bytes and calls that come out.
+ */
+
+#include "cyhal.h"
+#include "mtb_hx8347.h"
+#include "spi_bus.h"
+#include "hal_mock.h"
+#include "test.h"
+
+
+uint32_t test_checks;
+uint32_t test_failures;
+
+static const struct
+{
+    const char *name;
+    void (*run)(void);
+} test_suites[] =
+{
+    { "hal_calls",      test_hal_calls },
+    { "window_regs",    test_window_registers },
+    { "shadow_frame",   test_shadow_frame },
+    { "shadow_cap",     test_shadow_cap },
+    { "rotation",       test_rotation },
+    { "dma",            test_dma },
+    { "scroll",         test_scroll },
+    { "prof",           test_prof },
+    { "sprite",         test_sprite },
+    { "dlist",          test_dlist },
+    { "region",         test_region },
+    { "bitmap",         test_bitmap },
+    { "rle",            test_rle },
+};
+
+
+void test_panel_init(void)
+{
+    spi_bus_init(&mSPI, LCD_SPI_FREQ_HZ, CYHAL_SPI_MODE_11_MSB);
+    mtb_hx8347_init();
+    mtb_hx8347_set_burst_mode(true);
+    hal_mock_reset();
+    mtb_hx8347_reset_stats();
+}
+
+
+int main(void)
+{
+    uint32_t i, failures;
+
+    for (i = 0; i < sizeof(test_suites) / sizeof(test_suites[0]); i++)
+    {
+        failures = test_failures;
+        printf("%s\n", test_suites[i].name);
+        test_suites[i].run();
+        printf("%s %s\n", (test_failures == failures) ? "PASS" : "FAIL", test_suites[i].name);
+    }
+    printf("%lu checks, %lu failed\n", (unsigned long)test_checks, (unsigned long)test_failures);
+
+    return (test_failures == 0u) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,170 @@
+/*
+ * test_prof.c
+ *
+ *  Profiling zones on the host clock and the render handoff of main.c,
+ *  app_handoff.c on the pthread RTOS mock: requests posted while nobody waits
+ *  collapse into one wake for the newest, and with an input thread posting
+ *  while a storage thread keeps a core busy, the render thread must wake for
+ *  the last request and record each wake in LCD_PROF_WAKE.
+ */
+
+#include "lcd_prof.h"
+#include "app_handoff.h"
+#include "cyabs_rtos.h"
+#include "test.h"
+
+#include <pthread.h>
+#include <time.h>
+
+
+/* Requests the input thread sends */
+#define TEST_PROF_REQUESTS          (200u)
+
+/* Gap between two requests, the renderer is asleep when the next one comes */
+#define TEST_PROF_GAP_NS            (500000L)
+
+/* Time the clock check sleeps */
+#define TEST_PROF_SLEEP_NS          (2000000L)
+
+/* Wait of the renderer once the input thread is done */
+#define TEST_PROF_IDLE_MS           (100u)
+
+/* Screen of each request */
+#define TEST_PROF_SCREEN(i)         ((screen_id_t)(SCREEN_NUMBER_1 + (i) % 6u))
+
+static volatile bool test_posting;
+static volatile bool test_loading;
+static uint32_t test_wakes;
+static screen_id_t test_last;
+
+
+static void test_sleep(long ns)
+{
+    struct timespec ts = { 0, ns };
+
+    while (nanosleep(&ts, &ts) != 0)
+    {
+    }
+}
+
+
+/*******************************************************************************
+ * Posts each request stamped with its arrival, as input_task() of main.c does.
+ *******************************************************************************/
+static void *test_input_thread(void *arg)
+{
+    uint32_t i;
+    (void)arg;
+
+    for (i = 0; i < TEST_PROF_REQUESTS; i++)
+    {
+        test_sleep(TEST_PROF_GAP_NS);
+        app_handoff_post(TEST_PROF_SCREEN(i), lcd_prof_now());
+    }
+    test_posting = false;
+    return NULL;
+}
+
+
+/*******************************************************************************
+ * Picks up the requests as render_task() of main.c does, until the input
+ * thread is done and nothing more comes.
+ *******************************************************************************/
+static void *test_render_thread(void *arg)
+{
+    screen_id_t id;
+    uint32_t since;
+    (void)arg;
+
+    for (;;)
+    {
+        bool posting = test_posting;
+
+        if (app_handoff_wait(TEST_PROF_IDLE_MS, &id, &since))
+        {
+            test_wakes++;
+            test_last = id;
+        }
+        else if (!posting)
+        {
+            break;
+        }
+    }
+    return NULL;
+}
+
+
+/*******************************************************************************
+ * Stands in for an SD load, never blocks until told to stop.
+ *******************************************************************************/
+static void *test_storage_thread(void *arg)
+{
+    volatile uint32_t sum = 0u;
+    (void)arg;
+
+    while (test_loading)
+    {
+        sum += sum * 33u + 1u;
+    }
+    return NULL;
+}
+
+
+void test_prof(void)
+{
+    pthread_t input, render, storage;
+    lcd_prof_stats_t stats;
+    screen_id_t id;
+    uint32_t since, got;
+
+    /* Ticks are nanoseconds and a zone keeps what it timed */
+    TEST_EQUAL(lcd_prof_ticks_per_us(), 1000u);
+    lcd_prof_reset();
+    {
+        LCD_PROF_BEGIN(LCD_PROF_DISPATCH);
+        test_sleep(TEST_PROF_SLEEP_NS);
+        LCD_PROF_END(LCD_PROF_DISPATCH);
+    }
+    lcd_prof_get_stats(LCD_PROF_DISPATCH, &stats);
+    TEST_EQUAL(stats.count, 1u);
+    TEST_CHECK(stats.min >= (uint32_t)TEST_PROF_SLEEP_NS);
+    TEST_CHECK(stats.min == stats.max);
+    TEST_CHECK(stats.total == stats.min);
+
+    /* Requests nobody waited for wake the renderer once, for the newest */
+    lcd_prof_reset();
+    TEST_EQUAL(app_handoff_init(), CY_RSLT_SUCCESS);
+    app_handoff_post(SCREEN_NUMBER_1, lcd_prof_now());
+    app_handoff_post(SCREEN_NUMBER_2, lcd_prof_now());
+    since = lcd_prof_now();
+    app_handoff_post(SCREEN_NUMBER_3, since);
+    TEST_CHECK(app_handoff_wait(0u, &id, &got));
+    TEST_EQUAL(id, SCREEN_NUMBER_3);
+    TEST_EQUAL(got, since);
+    TEST_CHECK(!app_handoff_wait(0u, &id, &got));
+    lcd_prof_get_stats(LCD_PROF_WAKE, &stats);
+    TEST_EQUAL(stats.count, 1u);
+
+    /* The handoff, with the storage thread loading all the while */
+    lcd_prof_reset();
+    test_wakes = 0u;
+    test_posting = true;
+    test_loading = true;
+    TEST_EQUAL(pthread_create(&storage, NULL, test_storage_thread, NULL), 0);
+    TEST_EQUAL(pthread_create(&render, NULL, test_render_thread, NULL), 0);
+    TEST_EQUAL(pthread_create(&input, NULL, test_input_thread, NULL), 0);
+    pthread_join(input, NULL);
+    pthread_join(render, NULL);
+    test_loading = false;
+    pthread_join(storage, NULL);
+
+    lcd_prof_get_stats(LCD_PROF_WAKE, &stats);
+    TEST_EQUAL(stats.count, test_wakes);
+    TEST_CHECK((test_wakes >= 1u) && (test_wakes <= TEST_PROF_REQUESTS));
+    TEST_EQUAL(test_last, TEST_PROF_SCREEN(TEST_PROF_REQUESTS - 1u));
+    TEST_CHECK(stats.min <= stats.max);
+    lcd_prof_dump();
+    lcd_prof_reset();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,110 @@
+/*
+ * test_region.c
+ *
+ *  Incremental redraw of the number lessons: screens 1 to 6 are walked with
+ *  screen_show() as Next does, once with lcd_region_invalidate() before each
+ *  so every screen is drawn whole, and once letting lcd_region.c repaint only
+ *  the regions that changed. After every step both walks must leave the same
+ *  pixels on the emWin screen; the pixels sent, which lcd_region.c counts and
+ *  the mock sees, are reported per walk.
+ */
+
+#include "mtb_hx8347.h"
+#include "lcd_region.h"
+#include "screens.h"
+#include "emwin_mock.h"
+#include "test.h"
+
+#include <string.h>
+
+
+/* Number lessons walked */
+#define TEST_NUMBERS                (SCREEN_NUMBER_6 - SCREEN_NUMBER_1 + 1)
+
+static uint16_t test_whole[TEST_NUMBERS][LCD_WIDTH * LCD_HEIGHT];
+
+
+/*******************************************************************************
+ * Walks the number lessons from the numbers introduction.
+ * @param[in] invalidate Forget the panel before each lesson
+ * @param[in] check      Compare every step with the whole screens
+ * @return Pixels the mock saw sent for the lessons
+ *******************************************************************************/
+static uint32_t test_walk(bool invalidate, bool check)
+{
+    lcd_region_stats_t stats;
+    uint32_t pixels = 0u, errors = 0u;
+    int n, x, y, xsize = LCD_GetXSize(), ysize = LCD_GetYSize();
+
+    screen_show(SCREEN_NUMBERS);
+    for (n = 0; n < TEST_NUMBERS; n++)
+    {
+        if (invalidate)
+        {
+            lcd_region_invalidate();
+        }
+        memset(&emwin_mock_calls, 0, sizeof(emwin_mock_calls));
+        screen_show((screen_id_t)(SCREEN_NUMBER_1 + n));
+        lcd_region_get_stats(&stats);
+        TEST_EQUAL(emwin_mock_calls.lcd_pixels, stats.pixels);
+        pixels += emwin_mock_calls.lcd_pixels;
+
+        for (y = 0; y < ysize; y++)
+        {
+            for (x = 0; x < xsize; x++)
+            {
+                if (!check)
+                {
+                    test_whole[n][y * xsize + x] = emwin_mock_lcd(x, y);
+                }
+                else if (emwin_mock_lcd(x, y) != test_whole[n][y * xsize + x])
+                {
+                    if (errors == 0u)
+                    {
+                        printf("  number %d x %d y %d: %04X, drawn whole %04X\n", n + 1, x, y,
+                               (unsigned)emwin_mock_lcd(x, y), (unsigned)test_whole[n][y * xsize + x]);
+                    }
+                    errors++;
+                }
+            }
+        }
+    }
+    TEST_EQUAL(errors, 0u);
+    return pixels;
+}
+
+
+void test_region(void)
+{
+    mtb_hx8347_rotation_t rotation = mtb_hx8347_get_rotation();
+    lcd_region_stats_t before, after;
+    uint32_t whole, changed;
+
+    test_panel_init();
+    mtb_hx8347_set_rotation(MTB_HX8347_ROTATION_90);
+    emwin_mock_reset();
+
+    lcd_region_get_stats(&before);
+    whole = test_walk(true, false);
+    lcd_region_get_stats(&after);
+    TEST_EQUAL(after.full - before.full, TEST_NUMBERS);
+    TEST_EQUAL(after.partial, before.partial);
+    TEST_EQUAL(whole, (uint32_t)TEST_NUMBERS * LCD_WIDTH * LCD_HEIGHT);
+
+    /* The first lesson follows another kind of screen and is drawn whole */
+    before = after;
+    changed = test_walk(false, true);
+    lcd_region_get_stats(&after);
+    TEST_EQUAL(after.full - before.full, 1u);
+    TEST_EQUAL(after.partial - before.partial, TEST_NUMBERS - 1);
+    TEST_CHECK(changed < whole);
+
+    printf("  numbers 1-6     %lu pixels drawn whole, %lu by region (%lu%%)\n", (unsigned long)whole,
+           (unsigned long)changed, (unsigned long)((100u * changed) / whole));
+
+    emwin_mock_reset();
+    TEST_EQUAL(emwin_mock_calls.leaked, 0u);
+    mtb_hx8347_set_rotation(rotation);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,175 @@
+/*
+ * test_rle.c
+ *
+ *  Run-length coded bitmaps against the uncompressed ones they were made
+ *  from: every stream decodes to the indices of its original, in whole rows,
+ *  in pieces that split runs and literals, and after skipping rows. Drawn
+ *  through LCD_RLE_METHODS_8BPP with a clip rectangle that starts and ends
+ *  inside the image, a coded bitmap must hand LCD_DrawBitmap() only the rows
+ *  inside the clip rectangle, put the pixels of its original there and leave
+ *  everything outside it alone.
+ */
+
+#include "mtb_hx8347.h"
+#include "lcd_rle.h"
+#include "emwin_mock.h"
+#include "test.h"
+
+#include <string.h>
+
+
+/* Where the clipped bitmaps are drawn, in a device of the margin around them */
+#define TEST_RLE_X                  (7)
+#define TEST_RLE_Y                  (5)
+#define TEST_RLE_MARGIN             (12)
+
+/* Clip rectangle rows, from the top of the image */
+#define TEST_RLE_CLIP_FIRST         (37)
+#define TEST_RLE_CLIP_LAST          (70)
+
+/* Pieces decoded at a time, neither divides a row */
+static const uint32_t test_pieces[] = { 7u, 13u, 1u, 255u };
+
+extern GUI_CONST_STORAGE GUI_BITMAP bma;
+extern GUI_CONST_STORAGE GUI_BITMAP bma_rle;
+extern GUI_CONST_STORAGE GUI_BITMAP bmb;
+extern GUI_CONST_STORAGE GUI_BITMAP bmb_rle;
+extern GUI_CONST_STORAGE GUI_BITMAP bma_apple;
+extern GUI_CONST_STORAGE GUI_BITMAP bma_apple_rle;
+extern GUI_CONST_STORAGE GUI_BITMAP bmball;
+extern GUI_CONST_STORAGE GUI_BITMAP bmball_rle;
+
+static uint8_t test_indices[128 * 128];
+
+
+/* What was in the device before */
+static uint16_t test_old_pixel(int x, int y)
+{
+    return (uint16_t)(0x5AA5u ^ (x * 31 + y * 7));
+}
+
+
+/*******************************************************************************
+ * Decodes a stream in pieces and compares it with the indices of the original.
+ * @param[in] skip Rows skipped first
+ * @return Rows that differ
+ *******************************************************************************/
+static uint32_t test_decode(const GUI_BITMAP *rle, const GUI_BITMAP *raw, int skip)
+{
+    lcd_rle_decoder_t dec;
+    uint32_t size = (uint32_t)(raw->XSize * raw->YSize);
+    uint32_t done, n, i, errors = 0u;
+    int y;
+
+    lcd_rle_init(&dec, rle->pData);
+    lcd_rle_skip(&dec, (uint32_t)(skip * raw->XSize));
+    for (done = (uint32_t)(skip * raw->XSize), i = 0; done < size; done += n, i++)
+    {
+        n = test_pieces[i % (sizeof(test_pieces) / sizeof(test_pieces[0]))];
+        n = (n < size - done) ? n : (size - done);
+        lcd_rle_decode(&dec, &test_indices[done], n);
+    }
+    for (y = skip; y < raw->YSize; y++)
+    {
+        errors += (memcmp(&test_indices[y * raw->XSize], &raw->pData[y * raw->BytesPerLine],
+                          raw->XSize) != 0) ? 1u : 0u;
+    }
+    return errors;
+}
+
+
+/*******************************************************************************
+ * Draws a bitmap into a fresh device over the old pixels, clipped to rows
+ * first to last of the image.
+ * @return The device, to be deleted by the caller
+ *******************************************************************************/
+static GUI_MEMDEV_Handle test_draw(const GUI_BITMAP *bm, int first, int last)
+{
+    GUI_MEMDEV_Handle hMem = GUI_MEMDEV_Create(0, 0, bm->XSize + TEST_RLE_MARGIN, bm->YSize + TEST_RLE_MARGIN);
+    GUI_RECT clip = { 0, (I16)(TEST_RLE_Y + first), (I16)(bm->XSize + TEST_RLE_MARGIN - 1), (I16)(TEST_RLE_Y + last) };
+
+    GUI_MEMDEV_Select(hMem);
+    emwin_mock_paint(test_old_pixel);
+    GUI_SetClipRect(&clip);
+    GUI_DrawBitmap(bm, TEST_RLE_X, TEST_RLE_Y);
+    GUI_SetClipRect(NULL);
+    GUI_MEMDEV_Select(0);
+    return hMem;
+}
+
+
+void test_rle(void)
+{
+    static const struct
+    {
+        const char *name;
+        const GUI_BITMAP *rle;
+        const GUI_BITMAP *raw;
+    } pairs[] =
+    {
+        { "a",       &bma_rle,       &bma },
+        { "b",       &bmb_rle,       &bmb },
+        { "a_apple", &bma_apple_rle, &bma_apple },
+        { "ball",    &bmball_rle,    &bmball },
+    };
+    GUI_MEMDEV_Handle coded, plain, whole;
+    const uint16_t *pc, *pp, *pw;
+    uint32_t i, errors, outside;
+    int x, y, xsize;
+
+    emwin_mock_reset();
+    for (i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++)
+    {
+        TEST_EQUAL(pairs[i].rle->XSize, pairs[i].raw->XSize);
+        TEST_EQUAL(pairs[i].rle->YSize, pairs[i].raw->YSize);
+        TEST_EQUAL(pairs[i].rle->pPal->NumEntries, pairs[i].raw->pPal->NumEntries);
+        TEST_EQUAL(pairs[i].rle->pPal->HasTrans, pairs[i].raw->pPal->HasTrans);
+        TEST_CHECK(memcmp(pairs[i].rle->pPal->pPalEntries, pairs[i].raw->pPal->pPalEntries,
+                          (size_t)pairs[i].raw->pPal->NumEntries * sizeof(LCD_COLOR)) == 0);
+
+        TEST_EQUAL(test_decode(pairs[i].rle, pairs[i].raw, 0), 0u);
+        TEST_EQUAL(test_decode(pairs[i].rle, pairs[i].raw, TEST_RLE_CLIP_FIRST), 0u);
+
+        /* Clipped, against the original clipped and the original whole; only
+         * the rows inside the clip rectangle are decoded and drawn */
+        emwin_mock_calls.bitmap_rows = 0u;
+        coded = test_draw(pairs[i].rle, TEST_RLE_CLIP_FIRST, TEST_RLE_CLIP_LAST);
+        TEST_EQUAL(emwin_mock_calls.bitmap_rows, TEST_RLE_CLIP_LAST - TEST_RLE_CLIP_FIRST + 1);
+        plain = test_draw(pairs[i].raw, TEST_RLE_CLIP_FIRST, TEST_RLE_CLIP_LAST);
+        whole = test_draw(pairs[i].raw, 0, pairs[i].raw->YSize + TEST_RLE_MARGIN - TEST_RLE_Y - 1);
+        pc = GUI_MEMDEV_GetDataPtr(coded);
+        pp = GUI_MEMDEV_GetDataPtr(plain);
+        pw = GUI_MEMDEV_GetDataPtr(whole);
+        xsize = pairs[i].raw->XSize + TEST_RLE_MARGIN;
+        errors = 0u;
+        outside = 0u;
+        for (y = 0; y < pairs[i].raw->YSize + TEST_RLE_MARGIN; y++)
+        {
+            for (x = 0; x < xsize; x++)
+            {
+                if ((y < TEST_RLE_Y + TEST_RLE_CLIP_FIRST) || (y > TEST_RLE_Y + TEST_RLE_CLIP_LAST))
+                {
+                    outside += (pc[y * xsize + x] != test_old_pixel(x, y)) ? 1u : 0u;
+                }
+                else
+                {
+                    errors += (pc[y * xsize + x] != pw[y * xsize + x]) ? 1u : 0u;
+                }
+                errors += (pc[y * xsize + x] != pp[y * xsize + x]) ? 1u : 0u;
+            }
+        }
+        if ((errors != 0u) || (outside != 0u))
+        {
+            printf("  %s: %lu pixels differ, %lu outside the clip rectangle\n", pairs[i].name,
+                   (unsigned long)errors, (unsigned long)outside);
+        }
+        TEST_EQUAL(errors, 0u);
+        TEST_EQUAL(outside, 0u);
+        GUI_MEMDEV_Delete(coded);
+        GUI_MEMDEV_Delete(plain);
+        GUI_MEMDEV_Delete(whole);
+    }
+    TEST_EQUAL(emwin_mock_calls.unselected, 0u);
+}
+
+/* [] END OF FILE */
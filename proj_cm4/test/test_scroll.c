@@ -0,0 +1,93 @@
+/*
+ * test_scroll.c
+ *
+ *  Vertical scroll against the reference model: at every offset and in
+ *  every orientation the glass shows at position p of the scroll axis the
+ *  GRAM position mtb_hx8347_scroll_map() names for it.
+ */
+
+#include "cyhal.h"
+#include "mtb_hx8347.h"
+#include "hal_mock.h"
+#include "panel_model.h"
+#include "test.h"
+
+
+/* Colour of GRAM position q of the scroll axis */
+#define TEST_LINE_COLOR(q)          ((uint16_t)((q) * 199u + 1u))
+
+
+/*******************************************************************************
+ * Checks every position of the scroll axis, at the first pixel across it.
+ * @return Positions that show the wrong line
+ *******************************************************************************/
+static uint32_t test_glass(mtb_hx8347_rotation_t rotation)
+{
+    uint32_t errors = 0u;
+    uint16_t p, col, row, want;
+    bool landscape = (rotation & 1) != 0;
+
+    for (p = 0; p < LCD_HEIGHT; p++)
+    {
+        test_gram_of(rotation, landscape ? p : 0u, landscape ? 0u : p, &col, &row);
+        want = TEST_LINE_COLOR(mtb_hx8347_scroll_map(p));
+        if (panel_model_glass(col, row) != want)
+        {
+            if (errors == 0u)
+            {
+                printf("  rotation %d offset %u: position %u shows %04X, expected %04X\n",
+                       (int)rotation * 90, (unsigned)mtb_hx8347_get_scroll_offset(), (unsigned)p,
+                       (unsigned)panel_model_glass(col, row), (unsigned)want);
+            }
+            errors++;
+        }
+    }
+    return errors;
+}
+
+
+void test_scroll(void)
+{
+    static const uint16_t offsets[] = { 0, 1, 100, 160, 319, 320 + 7 };
+    mtb_hx8347_rotation_t rotation = mtb_hx8347_get_rotation();
+    uint32_t r, i, errors = 0u;
+    uint16_t q;
+
+    hal_mock_reset();
+    mtb_hx8347_scroll_enable(true);
+    for (r = 0; r < MTB_HX8347_ROTATION_COUNT; r++)
+    {
+        /* One colour per line of the scroll axis, drawn while scrolled */
+        mtb_hx8347_set_rotation((mtb_hx8347_rotation_t)r);
+        for (q = 0; q < LCD_HEIGHT; q++)
+        {
+            if (r & 1u)
+            {
+                mtb_hx8347_fill_rect(q, 0, q, LCD_WIDTH - 1u, TEST_LINE_COLOR(q));
+            }
+            else
+            {
+                mtb_hx8347_fill_rect(0, q, LCD_WIDTH - 1u, q, TEST_LINE_COLOR(q));
+            }
+        }
+
+        for (i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++)
+        {
+            mtb_hx8347_scroll_to(offsets[i]);
+            TEST_EQUAL(mtb_hx8347_get_scroll_offset(), offsets[i] % LCD_HEIGHT);
+            test_replay();
+            errors += test_glass((mtb_hx8347_rotation_t)r);
+        }
+    }
+    TEST_EQUAL(errors, 0u);
+
+    /* Off again, the glass shows GRAM as it is */
+    mtb_hx8347_scroll_enable(false);
+    test_replay();
+    TEST_EQUAL(mtb_hx8347_get_scroll_offset(), 0u);
+    TEST_EQUAL(test_glass((mtb_hx8347_rotation_t)(MTB_HX8347_ROTATION_COUNT - 1)), 0u);
+
+    mtb_hx8347_set_rotation(rotation);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,305 @@
+/*
+ * test_shadow.c
+ *
+ *  GRAM shadow against the reference model: whatever the driver sends, the
+ *  frame the shadow answers reads from is the frame the panel would hold,
+ *  and each orientation puts a logical pixel where mtb_hx8347_rotation_t
+ *  says.
+ */
+
+#include "cyhal.h"
+#include "mtb_hx8347.h"
+#include "lcd_dma.h"
+#include "lcd_shadow.h"
+#include "spi_bus.h"
+#include "hal_mock.h"
+#include "panel_model.h"
+#include "test.h"
+
+
+/* Pixels of the biggest test blit */
+#define TEST_BLIT_PIXELS            (40u * 25u)
+
+static uint8_t test_gram[1u + 2u * LCD_WIDTH * LCD_HEIGHT];
+
+
+/*******************************************************************************
+ * Fills a blit buffer with a pattern that differs for every pixel and seed.
+ *******************************************************************************/
+static const uint8_t *test_pattern(uint32_t pixels, uint16_t seed)
+{
+    static uint8_t data[2u * TEST_BLIT_PIXELS];
+    uint16_t color;
+    uint32_t i;
+
+    for (i = 0; i < pixels; i++)
+    {
+        color = (uint16_t)(seed + i * 41u);
+        data[2u * i] = (uint8_t)(color >> 8);
+        data[2u * i + 1u] = (uint8_t)color;
+    }
+    return data;
+}
+
+
+/*******************************************************************************
+ * Feeds the model what went out since the last replay.
+ *******************************************************************************/
+void test_replay(void)
+{
+    const hal_mock_wire_t *wire;
+    uint32_t num;
+
+    wire = hal_mock_wire(&num);
+    panel_model_replay(wire, num);
+    TEST_EQUAL(panel_model_stray_bytes(), 0u);
+    hal_mock_reset();
+}
+
+
+/*******************************************************************************
+ * Replays the log into the model and compares all of GRAM with the shadow,
+ * read back in portrait where scan order and GRAM order are the same.
+ * @return Pixels that differ or that the model never saw written
+ *******************************************************************************/
+static uint32_t test_compare(void)
+{
+    uint32_t errors = 0u;
+    uint16_t col, row, shadow, model;
+    bool written;
+
+    test_replay();
+    mtb_hx8347_set_rotation(MTB_HX8347_ROTATION_0);
+    mtb_hx8347_set_window(0, 0, LCD_WIDTH - 1u, LCD_HEIGHT - 1u);
+    mtb_hx8347_read_data_stream(test_gram, (int)sizeof(test_gram));
+
+    for (row = 0; row < LCD_HEIGHT; row++)
+    {
+        for (col = 0; col < LCD_WIDTH; col++)
+        {
+            shadow = (uint16_t)((test_gram[1u + 2u * (row * LCD_WIDTH + col)] << 8) |
+                                test_gram[2u + 2u * (row * LCD_WIDTH + col)]);
+            model = panel_model_pixel(col, row, &written);
+            if (!written || (shadow != model))
+            {
+                if (errors == 0u)
+                {
+                    printf("  column %u row %u: shadow %04X, model %04X%s\n", (unsigned)col, (unsigned)row,
+                           (unsigned)shadow, (unsigned)model, written ? "" : " never written");
+                }
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+
+/*******************************************************************************
+ * Draws through every write path of the driver in every orientation, then
+ * holds the shadow against the model fed from the bytes on the wire.
+ *******************************************************************************/
+void test_shadow_frame(void)
+{
+    static const uint8_t window[] = { 0x02, 0x00, 0x03, 0x21, 0x04, 0x00, 0x05, 0x2A,
+                                      0x06, 0x00, 0x07, 0x40, 0x08, 0x00, 0x09, 0x46 };
+    static uint16_t pixels16[TEST_BLIT_PIXELS];
+    mtb_hx8347_rotation_t rotation = mtb_hx8347_get_rotation();
+    lcd_shadow_stats_t before, after;
+    uint32_t i;
+
+    /* From power on, so the model sees the init sequence too */
+    panel_model_reset();
+    hal_mock_reset();
+    spi_bus_init(&mSPI, LCD_SPI_FREQ_HZ, CYHAL_SPI_MODE_11_MSB);
+    mtb_hx8347_init();
+    lcd_shadow_get_stats(&before);
+
+    /* Landscape: a full clear, a fill, a 12bpp fill of an odd count, a blit */
+    mtb_hx8347_set_rotation(MTB_HX8347_ROTATION_90);
+    lcd_clear_screen(WHITE);
+    mtb_hx8347_fill_rect(10, 10, 100, 50, BLUE);
+    mtb_hx8347_set_color12(true);
+    mtb_hx8347_fill_rect(5, 60, 33, 90, 0xF800);
+    mtb_hx8347_set_color12(false);
+    mtb_hx8347_blit565(200, 150, 236, 172, test_pattern(37u * 23u, 1u));
+
+    /* Upside down: blit and fill */
+    mtb_hx8347_set_rotation(MTB_HX8347_ROTATION_180);
+    mtb_hx8347_blit565(3, 7, 22, 26, test_pattern(20u * 20u, 2u));
+    mtb_hx8347_fill_rect(100, 200, 140, 260, 0x07E0);
+
+    /* Landscape upside down: the 16-bit port stream */
+    mtb_hx8347_set_rotation(MTB_HX8347_ROTATION_270);
+    for (i = 0; i < 20u * 20u; i++)
+    {
+        pixels16[i] = (uint16_t)(0x1234u + i * 97u);
+    }
+    mtb_hx8347_set_window(50, 60, 69, 79);
+    mtb_hx8347_write_data16_stream(pixels16, 20 * 20);
+
+    /* Portrait: the GUIDRV_FlexColor byte path and the DMA path */
+    mtb_hx8347_set_rotation(MTB_HX8347_ROTATION_0);
+    for (i = 0; i < sizeof(window); i += 2u)
+    {
+        mtb_hx8347_write_command(window[i]);
+        mtb_hx8347_write_data(window[i + 1u]);
+    }
+    mtb_hx8347_write_command(0x22);
+    mtb_hx8347_write_data_stream((uint8_t *)test_pattern(10u * 7u, 3u), 2 * 10 * 7);
+    lcd_write_word(0xABCD);
+    TEST_EQUAL(lcd_dma_init(), CY_RSLT_SUCCESS);
+    mtb_hx8347_set_window(160, 250, 199, 274);
+    lcd_dma_write_data_stream((uint8_t *)test_pattern(40u * 25u, 4u), 2 * 40 * 25);
+    lcd_dma_fence();
+
+    TEST_EQUAL(test_compare(), 0u);
+    lcd_shadow_get_stats(&after);
+    TEST_EQUAL(after.overflows - before.overflows, 0u);
+    TEST_EQUAL(after.misses - before.misses, 0u);
+    printf("  shadow          %lu of %lu slots for the test frame\n",
+           (unsigned long)after.slots_used, (unsigned long)after.slots_total);
+
+    mtb_hx8347_set_rotation(rotation);
+}
+
+
+/*******************************************************************************
+ * Overruns the slot pool with blits that straddle tiles. The dropped tiles
+ * must read as misses; every pixel the shadow does answer must match.
+ *******************************************************************************/
+void test_shadow_cap(void)
+{
+    static uint8_t readback[3];
+    mtb_hx8347_rotation_t rotation = mtb_hx8347_get_rotation();
+    lcd_shadow_stats_t before, after;
+    uint32_t misses, known = 0u, wrong = 0u;
+    uint16_t col, row, x, y, shadow;
+
+    lcd_shadow_get_stats(&before);
+    hal_mock_reset();
+    mtb_hx8347_set_rotation(MTB_HX8347_ROTATION_0);
+    for (y = 8; y + 20u < LCD_HEIGHT; y += 32u)
+    {
+        for (x = 8; x + 20u < LCD_WIDTH; x += 32u)
+        {
+            mtb_hx8347_blit565(x, y, x + 19u, y + 19u, test_pattern(20u * 20u, (uint16_t)(x ^ y)));
+        }
+    }
+    test_replay();
+
+    for (row = 0; row < LCD_HEIGHT; row++)
+    {
+        for (col = 0; col < LCD_WIDTH; col++)
+        {
+            lcd_shadow_get_stats(&after);
+            misses = after.misses;
+            mtb_hx8347_set_window(col, row, col, row);
+            mtb_hx8347_read_data_stream(readback, sizeof(readback));
+            lcd_shadow_get_stats(&after);
+            if (after.misses != misses)
+            {
+                continue;
+            }
+            shadow = (uint16_t)((readback[1] << 8) | readback[2]);
+            known++;
+            if (shadow != panel_model_pixel(col, row, NULL))
+            {
+                wrong++;
+            }
+        }
+    }
+    hal_mock_reset();
+
+    TEST_CHECK(after.overflows > before.overflows);
+    TEST_EQUAL(wrong, 0u);
+    printf("  shadow cap      %lu tiles dropped, %lu of %lu pixels still served\n",
+           (unsigned long)(after.overflows - before.overflows), (unsigned long)known,
+           (unsigned long)(LCD_WIDTH * LCD_HEIGHT));
+
+    mtb_hx8347_set_rotation(rotation);
+}
+
+
+/*******************************************************************************
+ * GRAM column and row of a logical pixel, as documented per orientation.
+ *******************************************************************************/
+void test_gram_of(mtb_hx8347_rotation_t rotation, uint16_t x, uint16_t y, uint16_t *col, uint16_t *row)
+{
+    switch (rotation)
+    {
+        case MTB_HX8347_ROTATION_90:  *col = y;                   *row = LCD_HEIGHT - 1u - x; break;
+        case MTB_HX8347_ROTATION_180: *col = LCD_WIDTH - 1u - x;  *row = LCD_HEIGHT - 1u - y; break;
+        case MTB_HX8347_ROTATION_270: *col = LCD_WIDTH - 1u - y;  *row = x;                   break;
+        default:                      *col = x;                   *row = y;                   break;
+    }
+}
+
+
+/*******************************************************************************
+ * Checks one logical pixel in the model and, read back in portrait, in the
+ * shadow.
+ * @return true if both hold the colour at the documented place
+ *******************************************************************************/
+static bool test_placed(mtb_hx8347_rotation_t rotation, uint16_t x, uint16_t y, uint16_t color)
+{
+    static uint8_t readback[3];
+    uint16_t col, row, shadow;
+
+    test_gram_of(rotation, x, y, &col, &row);
+    mtb_hx8347_set_window(col, row, col, row);
+    mtb_hx8347_read_data_stream(readback, sizeof(readback));
+    shadow = (uint16_t)((readback[1] << 8) | readback[2]);
+    if ((panel_model_pixel(col, row, NULL) != color) || (shadow != color))
+    {
+        printf("  rotation %d: (%u, %u) not at column %u row %u\n", (int)rotation * 90,
+               (unsigned)x, (unsigned)y, (unsigned)col, (unsigned)row);
+        return false;
+    }
+    return true;
+}
+
+
+/*******************************************************************************
+ * In every orientation marks three corners and draws one logical row, then
+ * looks for each pixel at the GRAM address mtb_hx8347_rotation_t documents.
+ *******************************************************************************/
+void test_rotation(void)
+{
+    mtb_hx8347_rotation_t rotation = mtb_hx8347_get_rotation();
+    const uint8_t *span;
+    uint32_t r, misplaced = 0u;
+    uint16_t w, h, i, color;
+
+    hal_mock_reset();
+    for (r = 0; r < MTB_HX8347_ROTATION_COUNT; r++)
+    {
+        mtb_hx8347_set_rotation((mtb_hx8347_rotation_t)r);
+        w = mtb_hx8347_get_width();
+        h = mtb_hx8347_get_height();
+        TEST_EQUAL(w, (r & 1u) ? LCD_HEIGHT : LCD_WIDTH);
+        lcd_clear_screen(BLACK);
+        mtb_hx8347_fill_rect(0, 0, 0, 0, BLUE);
+        mtb_hx8347_fill_rect(w - 1u, 0, w - 1u, 0, WHITE);
+        mtb_hx8347_fill_rect(0, h - 1u, 0, h - 1u, 0xF800);
+        span = test_pattern(20u, (uint16_t)(r + 1u));
+        mtb_hx8347_blit565(10, 5, 29, 5, span);
+        test_replay();
+
+        mtb_hx8347_set_rotation(MTB_HX8347_ROTATION_0);
+        misplaced += test_placed((mtb_hx8347_rotation_t)r, 0, 0, BLUE) ? 0u : 1u;
+        misplaced += test_placed((mtb_hx8347_rotation_t)r, w - 1u, 0, WHITE) ? 0u : 1u;
+        misplaced += test_placed((mtb_hx8347_rotation_t)r, 0, h - 1u, 0xF800) ? 0u : 1u;
+        for (i = 0; i < 20u; i++)
+        {
+            color = (uint16_t)((span[2u * i] << 8) | span[2u * i + 1u]);
+            misplaced += test_placed((mtb_hx8347_rotation_t)r, 10u + i, 5, color) ? 0u : 1u;
+        }
+        hal_mock_reset();
+    }
+    TEST_EQUAL(misplaced, 0u);
+
+    mtb_hx8347_set_rotation(rotation);
+}
+
+/* [] END OF FILE */
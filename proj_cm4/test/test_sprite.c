@@ -0,0 +1,272 @@
+/*
+ * test_sprite.c
+ *
+ *  Sprites against the reference model: the ball of the b screen, run-length
+ *  coded, bounces as main.c animates it and a transparent sprite crosses it
+ *  and a still picture in the background. After every frame the whole panel
+ *  must show the background with the sprites on top at the places a
+ *  reference bounce puts them, the ball with the pixels of the uncompressed
+ *  ball.c.
+ */
+
+#include "cyhal.h"
+#include "mtb_hx8347.h"
+#include "lcd_dma.h"
+#include "lcd_sprite.h"
+#include "app_arena.h"
+#include "spi_bus.h"
+#include "hal_mock.h"
+#include "emwin_mock.h"
+#include "panel_model.h"
+#include "test.h"
+
+
+/* Still picture of the background */
+#define TEST_PICTURE_X              (17)
+#define TEST_PICTURE_Y              (60)
+
+/* Transparent sprite, an odd width so its rows are not padded */
+#define TEST_GLASS_XSIZE            (33)
+#define TEST_GLASS_YSIZE            (40)
+
+/* Frames drawn back to back, then frames drawn late through the poll */
+#define TEST_SPRITE_FRAMES          (120)
+#define TEST_SPRITE_POLLS           (30)
+
+extern GUI_CONST_STORAGE GUI_BITMAP bmball;
+extern GUI_CONST_STORAGE GUI_BITMAP bmball_rle;
+
+/* Where the reference bounce puts a sprite */
+typedef struct
+{
+    const GUI_BITMAP *bm;       /* Uncompressed pixels of the sprite */
+    int x, y, dx, dy;
+    GUI_RECT bounds;
+} test_sprite_t;
+
+static test_sprite_t test_sprites[2];
+
+static U8 test_glass_pixels[TEST_GLASS_XSIZE * TEST_GLASS_YSIZE];
+static LCD_COLOR test_glass_colors[256];
+static const GUI_LOGPALETTE test_glass_pal = { 256, 1, test_glass_colors };
+static const GUI_BITMAP test_glass =
+{
+    TEST_GLASS_XSIZE, TEST_GLASS_YSIZE, TEST_GLASS_XSIZE, 8, test_glass_pixels, &test_glass_pal, NULL
+};
+
+
+static uint16_t test_pattern(int x, int y)
+{
+    return (uint16_t)(x * 7 + y * 131 + (x ^ y));
+}
+
+
+/*******************************************************************************
+ * Colour index of a bitmap pixel, -1 where it is transparent or not covered.
+ *******************************************************************************/
+static int test_bitmap_pixel(const GUI_BITMAP *bm, int x0, int y0, int x, int y)
+{
+    U8 index;
+
+    if ((x < x0) || (y < y0) || (x >= x0 + bm->XSize) || (y >= y0 + bm->YSize))
+    {
+        return -1;
+    }
+    index = bm->pData[(y - y0) * bm->BytesPerLine + (x - x0)];
+    if (bm->pPal->HasTrans && (index == 0u))
+    {
+        return -1;
+    }
+    return (int)GUI_Color2Index(bm->pPal->pPalEntries[index]);
+}
+
+
+/* The screen without its sprites, uncompressed */
+static uint16_t test_screen(int x, int y)
+{
+    int c = test_bitmap_pixel(&bmball, TEST_PICTURE_X, TEST_PICTURE_Y, x, y);
+
+    return (c >= 0) ? (uint16_t)c : test_pattern(x, y);
+}
+
+
+/* Background callback, the still picture through its run-length coding */
+static void test_background(void *data)
+{
+    (void)data;
+    emwin_mock_paint(test_pattern);
+    GUI_DrawBitmap(&bmball_rle, TEST_PICTURE_X, TEST_PICTURE_Y);
+}
+
+
+static void test_bounce(int *pos, int *vel, int lo, int hi)
+{
+    *pos += *vel;
+    if (*pos < lo)
+    {
+        *pos = 2 * lo - *pos;
+        *vel = -*vel;
+    }
+    else if (*pos > hi)
+    {
+        *pos = 2 * hi - *pos;
+        *vel = -*vel;
+    }
+}
+
+
+static void test_step(uint32_t steps)
+{
+    test_sprite_t *s;
+    uint32_t i, k;
+
+    for (i = 0; i < sizeof(test_sprites) / sizeof(test_sprites[0]); i++)
+    {
+        s = &test_sprites[i];
+        for (k = 0; k < steps; k++)
+        {
+            test_bounce(&s->x, &s->dx, s->bounds.x0, s->bounds.x1 - s->bm->XSize + 1);
+            test_bounce(&s->y, &s->dy, s->bounds.y0, s->bounds.y1 - s->bm->YSize + 1);
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * Replays the frame into the model and compares every pixel of the panel.
+ * @return Pixels that differ
+ *******************************************************************************/
+static uint32_t test_frame(void)
+{
+    uint32_t errors = 0u;
+    uint16_t col, row, want;
+    int x, y, i, c;
+
+    test_replay();
+    for (y = 0; y < LCD_WIDTH; y++)
+    {
+        for (x = 0; x < LCD_HEIGHT; x++)
+        {
+            want = test_screen(x, y);
+            for (i = 0; i < (int)(sizeof(test_sprites) / sizeof(test_sprites[0])); i++)
+            {
+                c = test_bitmap_pixel(test_sprites[i].bm, test_sprites[i].x, test_sprites[i].y, x, y);
+                want = (c >= 0) ? (uint16_t)c : want;
+            }
+            test_gram_of(MTB_HX8347_ROTATION_90, (uint16_t)x, (uint16_t)y, &col, &row);
+            if (panel_model_pixel(col, row, NULL) != want)
+            {
+                if (errors == 0u)
+                {
+                    printf("  x %d y %d: panel %04X, expected %04X\n", x, y,
+                           (unsigned)panel_model_pixel(col, row, NULL), (unsigned)want);
+                }
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+
+void test_sprite(void)
+{
+    static const test_sprite_t start[] =
+    {
+        { &bmball, 220, 141, -3, -4, { 130, 0, 319, 239 } },
+        { &test_glass, 10, 10, 7, 5, { 0, 0, 319, 239 } },
+    };
+    static uint16_t row[LCD_HEIGHT];
+    mtb_hx8347_rotation_t rotation = mtb_hx8347_get_rotation();
+    lcd_sprite_stats_t stats;
+    app_arena_stats_t arena;
+    uint32_t i, mark, errors, dropped = 0u;
+    int x, y;
+
+    for (i = 0; i < sizeof(test_glass_pixels); i++)
+    {
+        test_glass_pixels[i] = (U8)((i % 5u == 0u) ? 0u : (i * 11u) % 256u);
+    }
+    for (i = 0; i < 256u; i++)
+    {
+        test_glass_colors[i] = (LCD_COLOR)(i * 0x010307u);
+    }
+
+    /* From power on, landscape as the application runs */
+    panel_model_reset();
+    hal_mock_reset();
+    spi_bus_init(&mSPI, LCD_SPI_FREQ_HZ, CYHAL_SPI_MODE_11_MSB);
+    mtb_hx8347_init();
+    TEST_EQUAL(lcd_dma_init(), CY_RSLT_SUCCESS);
+    mtb_hx8347_set_rotation(MTB_HX8347_ROTATION_90);
+    emwin_mock_reset();
+    emwin_mock_time = 1000;
+
+    /* The screen is on the panel before the animation starts */
+    mtb_hx8347_set_window(0, 0, LCD_HEIGHT - 1u, LCD_WIDTH - 1u);
+    for (y = 0; y < LCD_WIDTH; y++)
+    {
+        for (x = 0; x < LCD_HEIGHT; x++)
+        {
+            row[x] = test_screen(x, y);
+        }
+        mtb_hx8347_write_data16_stream(row, LCD_HEIGHT);
+    }
+
+    mark = app_arena_mark();
+    lcd_sprite_begin(test_background, NULL);
+    TEST_EQUAL(lcd_sprite_add(&bmball_rle, 220, 141, -3, -4, &start[0].bounds), 0);
+    TEST_EQUAL(lcd_sprite_add(&test_glass, 10, 10, 7, 5, &start[1].bounds), 1);
+    TEST_EQUAL(lcd_sprite_add(&test_glass, 300, 10, 1, 1, &start[1].bounds), -1);
+    test_sprites[0] = start[0];
+    test_sprites[1] = start[1];
+    app_arena_get_stats(&arena);
+    printf("  arena           %lu of %lu bytes for two sprites\n", (unsigned long)(arena.used - mark),
+           (unsigned long)arena.size);
+
+    /* Every frame moves first, the first one too */
+    lcd_sprite_run(1);
+    test_step(1u);
+    TEST_EQUAL(test_frame(), 0u);
+
+    errors = 0u;
+    for (i = 0; (i < TEST_SPRITE_FRAMES) && (errors == 0u); i++)
+    {
+        lcd_sprite_run(1);
+        test_step(1u);
+        errors += test_frame();
+    }
+    TEST_EQUAL(errors, 0u);
+
+    /* Late by one to three slots, the motion of the missed ones comes along */
+    lcd_sprite_get_stats(&stats);
+    TEST_EQUAL(stats.dropped, 0u);
+    for (i = 0; (i < TEST_SPRITE_POLLS) && (errors == 0u); i++)
+    {
+        TEST_CHECK(!lcd_sprite_poll());
+        emwin_mock_time += (GUI_TIMER_TIME)(((i % 3u) + 1u) * LCD_SPRITE_PERIOD_MS);
+        TEST_CHECK(lcd_sprite_poll());
+        test_step((i % 3u) + 1u);
+        dropped += i % 3u;
+        errors += test_frame();
+    }
+    TEST_EQUAL(errors, 0u);
+
+    lcd_sprite_get_stats(&stats);
+    TEST_EQUAL(stats.frames, 1u + TEST_SPRITE_FRAMES + TEST_SPRITE_POLLS);
+    TEST_EQUAL(stats.dropped, dropped);
+    TEST_EQUAL(stats.failures, 1u);
+    TEST_EQUAL(emwin_mock_calls.odd_width, 0u);
+    TEST_EQUAL(emwin_mock_calls.unselected, 0u);
+
+    /* The sprites stay, their memory goes back */
+    lcd_sprite_stop();
+    TEST_EQUAL(app_arena_mark(), mark);
+    TEST_EQUAL(test_frame(), 0u);
+    emwin_mock_reset();
+    TEST_EQUAL(emwin_mock_calls.leaked, 0u);
+
+    mtb_hx8347_set_rotation(rotation);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""
+bmp_rle.py
+
+Converts 8bpp palette bitmaps generated by the emWin Bitmap Converter into
+the run-length container drawn by proj_cm4/lcd_rle.c.
+
+Stream format, one control byte followed by its payload:
+    0x00-0x7F  literal, (c + 1) index bytes follow
+    0x80-0xFF  run, the next index byte repeats (c - 0x80 + 2) times
+Runs continue across row ends, the decoder keeps its state between rows.
+
+Every converted bitmap is decoded again and compared with the source before
+anything is written.
+
+Usage:
+    bmp_rle.py a.c [b.c ...] [-o OUTDIR]   convert, writes <file>_rle.c
+    bmp_rle.py --check a.c [b.c ...]        round-trip only, writes nothing
+"""
+
+import argparse
+import os
+import re
+import sys
+
+MAX_LITERAL = 128
+MAX_RUN = 129
+
+
+def parse(path):
+    """Returns name, sizes, palette source block and pixel indices."""
+    text = open(path).read()
+
+    bm = re.search(r'GUI_CONST_STORAGE\s+GUI_BITMAP\s+(\w+)\s*=\s*\{(.*?)\};', text, re.S)
+    if not bm:
+        raise ValueError('%s: no GUI_BITMAP definition' % path)
+    name = bm.group(1)
+    fields = [re.sub(r'//.*', '', f).strip() for f in bm.group(2).split('\n')]
+    fields = [f.rstrip(',').strip() for f in fields if f]
+    xsize, ysize, bytes_per_line, bpp = (int(f) for f in fields[:4])
+    data_name = re.search(r'\(const unsigned char \*\)(\w+)', fields[4]).group(1)
+    pal_name = re.search(r'&(\w+)', fields[5]).group(1)
+    if bpp != 8:
+        raise ValueError('%s: %d bpp, only 8 bpp palette images are supported' % (path, bpp))
+
+    pal = re.search(r'static GUI_CONST_STORAGE GUI_LOGPALETTE\s+%s\s*=\s*\{(.*?)\};' % pal_name, text, re.S)
+    pal_fields = re.sub(r'//.*', '', pal.group(1))
+    colors_name = re.search(r'&(\w+)\[0\]', pal_fields).group(1)
+    colors = re.search(r'(static GUI_CONST_STORAGE GUI_COLOR\s+%s\[\]\s*=\s*\{.*?\n\};)' % colors_name,
+                       text, re.S).group(1)
+    num_colors, has_trans = (int(v) for v in re.findall(r'(\d+)\s*,', pal_fields)[:2])
+
+    data = re.search(r'%s\[\]\s*=\s*\{(.*?)\};' % data_name, text, re.S).group(1)
+    pixels = bytes(int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]{2}', data))
+    if len(pixels) != bytes_per_line * ysize:
+        raise ValueError('%s: %d data bytes, expected %d' % (path, len(pixels), bytes_per_line * ysize))
+    if bytes_per_line != xsize:
+        pixels = b''.join(pixels[y * bytes_per_line:y * bytes_per_line + xsize] for y in range(ysize))
+
+    return {
+        'name': name, 'xsize': xsize, 'ysize': ysize, 'pixels': pixels,
+        'colors_name': colors_name, 'colors': colors,
+        'num_colors': num_colors, 'has_trans': has_trans,
+    }
+
+
+def encode(pixels):
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+    n = len(pixels)
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:MAX_LITERAL]
+
+    while i < n:
+        run = 1
+        while i + run < n and run < MAX_RUN and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            flush()
+            out.append(0x80 + run - 2)
+            out.append(pixels[i])
+            i += run
+        else:
+            literal.append(pixels[i])
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def decode(stream, num):
+    out = bytearray()
+    i = 0
+    while len(out) < num:
+        c = stream[i]
+        i += 1
+        if c < 0x80:
+            out.extend(stream[i:i + c + 1])
+            i += c + 1
+        else:
+            out.extend(bytes([stream[i]]) * (c - 0x80 + 2))
+            i += 1
+    if len(out) != num or i != len(stream):
+        raise ValueError('stream length mismatch')
+    return bytes(out)
+
+
+def emit(bm, stream, source):
+    name = bm['name'] + '_rle'
+    lines = []
+    for off in range(0, len(stream), 16):
+        lines.append('  ' + ', '.join('0x%02X' % b for b in stream[off:off + 16]) + ',')
+    return '''/*
+ * {out}
+ *
+ *  Generated by tools/bmp_rle.py from {src}, do not edit.
+ *  {x} x {y} pixels, {raw} bytes raw, {packed} bytes run-length coded.
+ */
+
+#include "GUI.h"
+#include "lcd_rle.h"
+
+#ifndef GUI_CONST_STORAGE
+  #define GUI_CONST_STORAGE const
+#endif
+
+{colors}
+
+static GUI_CONST_STORAGE GUI_LOGPALETTE _Pal{name} = {{
+  {num},  // Number of entries
+  {trans},    // {trans_text}
+  (const LCD_COLOR *)&{colors_name}[0]
+}};
+
+static GUI_CONST_STORAGE unsigned char _ac{name}[] = {{
+{data}
+}};
+
+GUI_CONST_STORAGE GUI_BITMAP {name} = {{
+  {x}, // xSize
+  {y}, // ySize
+  {x}, // BytesPerLine
+  8, // BitsPerPixel
+  (const unsigned char *)_ac{name},  // Pointer to run-length stream
+  &_Pal{name},  // Pointer to palette
+  &LCD_RLE_METHODS_8BPP
+}};
+
+/* [] END OF FILE */
+'''.format(out=os.path.basename(source).replace('.c', '_rle.c'), src=os.path.basename(source),
+           x=bm['xsize'], y=bm['ysize'], raw=len(bm['pixels']), packed=len(stream),
+           colors=bm['colors'], name=name, num=bm['num_colors'], trans=bm['has_trans'],
+           trans_text='Has transparency' if bm['has_trans'] else 'No transparency',
+           colors_name=bm['colors_name'], data='\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run-length code emWin 8bpp bitmaps.')
+    parser.add_argument('files', nargs='+', help='C files from the emWin Bitmap Converter')
+    parser.add_argument('-o', '--outdir', help='output directory, default next to the input')
+    parser.add_argument('--check', action='store_true', help='round-trip only, write nothing')
+    args = parser.parse_args()
+
+    failed = 0
+    for path in args.files:
+        try:
+            bm = parse(path)
+            stream = encode(bm['pixels'])
+            if decode(stream, len(bm['pixels'])) != bm['pixels']:
+                raise ValueError('round-trip mismatch')
+        except (ValueError, AttributeError, IndexError) as err:
+            print('FAIL %s: %s' % (path, err))
+            failed += 1
+            continue
+
+        print('ok   %-12s %3dx%-3d %6d -> %6d bytes (%d%%)' % (
+            bm['name'], bm['xsize'], bm['ysize'], len(bm['pixels']), len(stream),
+            100 * len(stream) // len(bm['pixels'])))
+        if not args.check:
+            outdir = args.outdir or os.path.dirname(path)
+            out = os.path.join(outdir, os.path.basename(path).replace('.c', '_rle.c'))
+            with open(out, 'w') as f:
+                f.write(emit(bm, stream, path))
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())